@@ -4,13 +4,32 @@
 
 # License: Mozilla Public License 2.0. (See ./LICENSE).
 
-# Set to C++ 17.
-if(MSVC)
-    set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} /std:c++17")
+# Opt into C++ 20 to build the coroutine tasks.
+option(
+    CELERIQUE_ENABLE_CPP20
+    "The Switch that builds with C++ 20 and enables the coroutine tasks."
+    OFF
+)
+
+if (CELERIQUE_ENABLE_CPP20)
+    # Set to C++ 20.
+    if(MSVC)
+        set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} /std:c++20")
+    else()
+        set(CMAKE_CXX_STANDARD_REQUIRED ON)
+        set(CMAKE_CXX_STANDARD 20)
+        set(CMAKE_CXX_EXTENSIONS OFF)
+    endif()
+    add_compile_definitions(CELERIQUE_COROUTINES_ENABLED)
 else()
-    set(CMAKE_CXX_STANDARD_REQUIRED ON)
-    set(CMAKE_CXX_STANDARD 17)
-    set(CMAKE_CXX_EXTENSIONS OFF)
+    # Set to C++ 17.
+    if(MSVC)
+        set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} /std:c++17")
+    else()
+        set(CMAKE_CXX_STANDARD_REQUIRED ON)
+        set(CMAKE_CXX_STANDARD 17)
+        set(CMAKE_CXX_EXTENSIONS OFF)
+    endif()
 endif()
 
 # Runtime library.
@@ -0,0 +1,75 @@
+/*
+
+File: ./core/include/celerique/internal/archive.h
+Author: Aldhinn Espinas
+Description: This header file contains the on-disk layout of packed asset archives.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#if !defined(CELERIQUE_INTERNAL_ARCHIVE_HEADER_FILE)
+#define CELERIQUE_INTERNAL_ARCHIVE_HEADER_FILE
+
+#include <celerique/archive.h>
+
+// Begin C++ Only Region.
+#if defined(__cplusplus)
+#include <cstdint>
+
+// Layout of an archive (every field little-endian):
+//
+//  [ArchiveHeader]                         64 bytes at offset 0.
+//  [entry 0] [entry 1] ... [entry N-1]     Each starting at a multiple of CELERIQUE_ARCHIVE_ALIGNMENT.
+//  [ArchiveTocEntry x N]                   Sorted by name hash, starting at a multiple of CELERIQUE_ARCHIVE_ALIGNMENT.
+//
+// An uncompressed entry is its raw bytes. A compressed entry starts with `numChunks + 1`
+// uint64_t offsets (relative to the start of the entry) delimiting its chunks, followed by
+// the chunks. A chunk whose stored size equals its uncompressed size is stored raw.
+
+namespace celerique { namespace internal {
+    /// @brief The bytes identifying an archive file.
+    constexpr char archiveMagic[8] = {'C', 'E', 'L', 'Q', 'P', 'A', 'K', '\0'};
+    /// @brief The version of the archive layout written by this build.
+    constexpr uint32_t archiveVersion = 1;
+
+    /// @brief The header at the start of every archive.
+    struct ArchiveHeader final {
+        /// @brief Always `archiveMagic`.
+        char magic[8];
+        /// @brief The version of the archive layout.
+        uint32_t version;
+        /// @brief The number of entries in the table of contents.
+        uint32_t numEntries;
+        /// @brief The offset of the table of contents from the start of the archive.
+        uint64_t tocOffset;
+        /// @brief Padding up to `CELERIQUE_ARCHIVE_ALIGNMENT`.
+        uint8_t reserved[40];
+    };
+    static_assert(sizeof(ArchiveHeader) == CELERIQUE_ARCHIVE_ALIGNMENT, "Archive header must fill one alignment unit.");
+
+    /// @brief The on-disk description of a single archive entry.
+    struct ArchiveTocEntry final {
+        /// @brief The hashed name of the entry.
+        uint64_t nameHash;
+        /// @brief The offset of the entry from the start of the archive.
+        uint64_t offset;
+        /// @brief The uncompressed size of the entry.
+        uint64_t size;
+        /// @brief The number of bytes the entry takes up in the archive.
+        uint64_t storedSize;
+        /// @brief The compression applied to the entry.
+        uint32_t compression;
+        /// @brief The uncompressed size of each chunk of a compressed entry.
+        uint32_t chunkSize;
+        /// @brief Reserved for future use. Always 0.
+        uint64_t reserved;
+    };
+    static_assert(sizeof(ArchiveTocEntry) == 48, "Archive table of contents entries must be tightly packed.");
+}}
+#endif
+// End C++ Only Region.
+
+#endif
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
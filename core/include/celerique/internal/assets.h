@@ -0,0 +1,188 @@
+/*
+
+File: ./core/include/celerique/internal/assets.h
+Author: Aldhinn Espinas
+Description: This header file contains internal interfaces to the asynchronous asset loading system.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#if !defined(CELERIQUE_INTERNAL_ASSETS_HEADER_FILE)
+#define CELERIQUE_INTERNAL_ASSETS_HEADER_FILE
+
+#include <celerique/assets.h>
+#include <celerique/events.h>
+#include <celerique/jobs.h>
+
+// Begin C++ Only Region.
+#if defined(__cplusplus)
+#include <list>
+#include <queue>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace celerique { namespace internal {
+    /// @brief The number of threads dedicated to reading files from disk.
+    constexpr size_t numAssetIoThreads = 2;
+
+    /// @brief The bookkeeping of a single asset.
+    struct AssetRecord final {
+        /// @brief The path of the file the asset is loaded from.
+        ::std::string filePath;
+        /// @brief The decoder that produces the asset's in-memory representation.
+        AssetDecoder decoder;
+        /// @brief The current loading state.
+        AssetState state = CELERIQUE_ASSET_STATE_NULL;
+        /// @brief The number of handles referring to this asset.
+        size_t refCount = 0;
+        /// @brief The decoded asset data.
+        ::std::shared_ptr<void> ptrData;
+        /// @brief The engines that requested the asset, each receiving its completion event.
+        ::std::vector<IEventListener*> vecPtrRequesters;
+    };
+
+    /// @brief A pending request in the asset load queue.
+    struct AssetRequest final {
+        /// @brief The identifier of the asset to be loaded.
+        AssetID assetId;
+        /// @brief The priority of the load request.
+        AssetPriority priority;
+        /// @brief Monotonic submission order so that equal priorities are serviced first-in-first-out.
+        uint64_t sequence;
+
+        /// @brief Ordering used by `::std::priority_queue` (the greatest element is serviced first).
+        /// @param other The other request to compare against.
+        /// @return `true` if this request should be serviced after `other`.
+        inline bool operator<(const AssetRequest& other) const {
+            if (priority != other.priority) return priority < other.priority;
+            return sequence > other.sequence;
+        }
+    };
+
+    /// @brief Manages reading, decoding and reference counting of assets.
+    class AssetManager final : public virtual EventBroadcasterBase {
+    public:
+        /// @brief Request an asset to be loaded in the background.
+        /// @param filePath The path of the file to load the asset from.
+        /// @param priority The priority of the load request.
+        /// @param decoder The decoder run on a job worker.
+        /// @param ptrRequester The pointer to the engine receiving the completion event, or `nullptr` to broadcast it
+        /// to the process default engine.
+        /// @return The identifier of the requested asset (already retained once).
+        AssetID load(
+            const ::std::string& filePath, AssetPriority priority, AssetDecoder&& decoder, IEventListener* ptrRequester
+        );
+        /// @brief Add a reference to an asset.
+        /// @param assetId The identifier of the asset.
+        void retain(AssetID assetId);
+        /// @brief Remove a reference to an asset. Frees the asset once no references remain.
+        /// @param assetId The identifier of the asset.
+        void release(AssetID assetId);
+        /// @brief The current loading state of an asset.
+        /// @param assetId The identifier of the asset.
+        /// @return The asset state value.
+        AssetState state(AssetID assetId);
+        /// @brief Access the decoded data of an asset.
+        /// @param assetId The identifier of the asset.
+        /// @return The shared pointer to the decoded data or `nullptr` if not ready.
+        ::std::shared_ptr<void> data(AssetID assetId);
+        /// @brief Broadcast the completion events of loads requested without an engine
+        /// collected since the last call on the calling thread. Called by the process default engine once per update cycle.
+        void dispatchCompletedLoads();
+        /// @brief Deliver the completion events of the loads a requester asked for since the last call
+        /// on the calling thread. Called by every engine once per update cycle.
+        /// @param ptrRequester The pointer to the requester receiving its completion events.
+        void dispatchCompletedLoads(IEventListener* ptrRequester);
+        /// @brief Start collecting the completion events of the loads a requester asks for.
+        /// @param ptrRequester The pointer to the requester.
+        void addRequester(IEventListener* ptrRequester);
+        /// @brief Stop collecting completion events for a requester and drop the ones not yet delivered.
+        /// @param ptrRequester The pointer to the requester.
+        void removeRequester(IEventListener* ptrRequester);
+
+        /// @brief Gets the reference to the asset manager object.
+        static AssetManager& getRef();
+
+    // Private helper functions.
+    private:
+        /// @brief Pop the most important request from the queue and read its file.
+        /// Runs on one of the I/O threads.
+        void serviceNextRequest();
+        /// @brief Run the decoder for the read file contents. Runs on a job worker.
+        /// @param assetId The identifier of the asset.
+        /// @param fileContents The raw contents of the asset's file.
+        void decode(AssetID assetId, ::std::vector<Byte>&& fileContents);
+        /// @brief Record the final state of an asset and queue its completion event.
+        /// @param assetId The identifier of the asset.
+        /// @param ptrData The decoded data or `nullptr` if the load failed.
+        void complete(AssetID assetId, ::std::shared_ptr<void>&& ptrData);
+        /// @brief Queue a completion event for a requester. Called with `_recordsMutex` held exclusively.
+        /// @param ptrEvent The shared pointer to the completion event.
+        /// @param ptrRequester The pointer to the engine receiving the event, or `nullptr` to broadcast it
+        /// to the process default engine.
+        void queueCompletionEvent(::std::shared_ptr<EventBase> ptrEvent, IEventListener* ptrRequester);
+        /// @brief Read the whole contents of a file.
+        /// @param filePath The path of the file to be read.
+        /// @param fileContents The container receiving the contents.
+        /// @return `true` if the file was read successfully.
+        static bool readFile(const ::std::string& filePath, ::std::vector<Byte>& fileContents);
+
+    // Private member variables.
+    private:
+        /// @brief The map of asset identifiers to their records.
+        ::std::unordered_map<AssetID, AssetRecord> _mapAssetIdToRecord;
+        /// @brief The map of file paths to the identifiers of the assets loaded from them.
+        ::std::unordered_map<::std::string, AssetID> _mapFilePathToAssetId;
+        /// @brief The last generated asset identifier.
+        AssetID _nextAssetId = CELERIQUE_ASSET_ID_NULL;
+        /// @brief The mutex for `_mapAssetIdToRecord`, `_mapFilePathToAssetId` and `_nextAssetId`.
+        ::std::shared_mutex _recordsMutex;
+        /// @brief The queue of load requests ordered by priority.
+        ::std::priority_queue<AssetRequest> _queueRequests;
+        /// @brief The number of requests submitted so far.
+        uint64_t _numSubmittedRequests = 0;
+        /// @brief The mutex for `_queueRequests` and `_numSubmittedRequests`.
+        ::std::mutex _requestsMutex;
+        /// @brief The completion events of loads requested without an engine waiting to be broadcast.
+        ::std::list<::std::shared_ptr<EventBase>> _listCompletionEvents;
+        /// @brief The map of requesters to their completion events waiting to be delivered.
+        ::std::unordered_map<IEventListener*, ::std::list<::std::shared_ptr<EventBase>>> _mapRequesterToListCompletionEvents;
+        /// @brief The mutex for `_listCompletionEvents` and `_mapRequesterToListCompletionEvents`.
+        ::std::mutex _completionMutex;
+        /// @brief The number of completion events queued and not yet delivered, read without locking
+        /// so that engine updates with nothing to deliver skip `_completionMutex`.
+        ::std::atomic<size_t> _atomicNumQueuedCompletionEvents = 0;
+        /// @brief The state that indicates the manager is being destroyed and should stop servicing requests.
+        ::std::atomic<bool> _atomicIsShuttingDown = false;
+        /// @brief The threads dedicated to reading files from disk.
+        ThreadPool _ioThreadPool;
+
+    private:
+        /// @brief Private default constructor to prevent external instantiation.
+        AssetManager();
+        /// @brief Private destructor to prevent external deletion.
+        ~AssetManager();
+
+    public:
+        /// @brief Prevent copying.
+        AssetManager(const AssetManager&) = delete;
+        /// @brief Prevent moving.
+        AssetManager(AssetManager&&) = delete;
+        /// @brief Prevent copy re-assignment.
+        AssetManager& operator=(const AssetManager&) = delete;
+        /// @brief Prevent move re-assignment.
+        AssetManager& operator=(AssetManager&&) = delete;
+    };
+}}
+#endif
+// End C++ Only Region.
+
+#endif
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
@@ -0,0 +1,70 @@
+/*
+
+File: ./core/include/celerique/internal/background.h
+Author: Aldhinn Espinas
+Description: This header file contains internal interfaces to the background work scheduler.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#if !defined(CELERIQUE_INTERNAL_BACKGROUND_HEADER_FILE)
+#define CELERIQUE_INTERNAL_BACKGROUND_HEADER_FILE
+
+#include <celerique/background.h>
+
+// Begin C++ Only Region.
+#if defined(__cplusplus)
+#include <atomic>
+#include <deque>
+#include <mutex>
+
+namespace celerique { namespace internal {
+    /// @brief Keeps background work and runs it in slices within the time each update has left.
+    /// Every engine instance owns one.
+    class BackgroundScheduler final {
+    public:
+        /// @brief Queue background work. Safe to call from any thread.
+        /// @param task The background work.
+        /// @param priority The priority of the work.
+        void submit(BackgroundTask&& task, BackgroundPriority priority);
+        /// @brief Run slices of the waiting work, highest priority first and round robin within a
+        /// priority, until the budget is spent. Runs at least one slice if any work is waiting.
+        /// Called on the update thread.
+        /// @param budget The time the update has left.
+        void runSlices(::std::chrono::nanoseconds budget);
+        /// @brief The statistics of the scheduler.
+        /// @return A copy of the statistics.
+        BackgroundSchedulerStats stats();
+
+    // Private member variables.
+    private:
+        /// @brief The waiting work of each priority.
+        ::std::deque<BackgroundTask> _arrQueueTasks[CELERIQUE_NUM_BACKGROUND_PRIORITIES];
+        /// @brief The statistics, without `numPendingTasks`.
+        BackgroundSchedulerStats _stats;
+        /// @brief The mutex for `_arrQueueTasks` and `_stats`.
+        ::std::mutex _tasksMutex;
+        /// @brief The number of tasks waiting, checked without locking when nothing is queued.
+        ::std::atomic<size_t> _atomicNumPendingTasks = 0;
+
+    public:
+        /// @brief Default constructor.
+        BackgroundScheduler() = default;
+
+        /// @brief Prevent copying.
+        BackgroundScheduler(const BackgroundScheduler&) = delete;
+        /// @brief Prevent moving.
+        BackgroundScheduler(BackgroundScheduler&&) = delete;
+        /// @brief Prevent copy re-assignment.
+        BackgroundScheduler& operator=(const BackgroundScheduler&) = delete;
+        /// @brief Prevent move re-assignment.
+        BackgroundScheduler& operator=(BackgroundScheduler&&) = delete;
+    };
+}}
+#endif
+// End C++ Only Region.
+
+#endif
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
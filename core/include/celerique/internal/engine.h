@@ -12,16 +12,77 @@ License: Mozilla Public License 2.0. (See ./LICENSE).
 #define CELERIQUE_INTERNAL_ENGINE_HEADER_FILE
 
 #include <celerique.h>
+#include <celerique/internal/background.h>
+#include <celerique/internal/tasks.h>
 
 // Begin C++ Only Region.
 #if defined(__cplusplus)
 #include <list>
 #include <memory>
 #include <atomic>
-#include <shared_mutex>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <chrono>
+#include <unordered_map>
+#include <typeindex>
 
 namespace celerique { namespace internal {
-    /// @brief The class description of the engine's internal implementations.
+    /// @brief A pending addition of an application layer or a window, queued by any thread
+    /// and applied by the update thread between frames.
+    struct EngineMutation final {
+        /// @brief The application layer to be added, if any.
+        ::std::unique_ptr<ApplicationLayerBase> ptrAppLayer;
+        /// @brief The graphical user interface window to be added, if any.
+        ::std::unique_ptr<WindowBase> ptrWindow;
+        /// @brief The mutation queued before this one.
+        EngineMutation* ptrNext = nullptr;
+    };
+
+    /// @brief The update schedule of an application layer updated less than every frame.
+    struct LayerSchedule final {
+        /// @brief Whether the layer is updated on every engine update, ignoring the other members.
+        bool isEveryUpdate = true;
+        /// @brief The number of engine updates between updates, for frame based cadences.
+        uint32_t periodFrames = 1;
+        /// @brief The engine update, modulo `periodFrames`, on which the layer updates.
+        uint32_t phaseFrames = 0;
+        /// @brief The time between updates, for rate based cadences. Zero for frame based cadences.
+        ::std::chrono::nanoseconds periodNanoSecs = ::std::chrono::nanoseconds::zero();
+        /// @brief The time left until the next update, for rate based cadences.
+        ::std::chrono::nanoseconds untilNextUpdate = ::std::chrono::nanoseconds::zero();
+        /// @brief The time elapsed since the layer's previous update.
+        ::std::chrono::nanoseconds sinceLastUpdate = ::std::chrono::nanoseconds::zero();
+    };
+
+    /// @brief The layers receiving the events of each window, rebuilt whenever layers are added.
+    struct EventRoutes final {
+        /// @brief The layers subscribed to no window, receiving the events of windows without a route.
+        ::std::vector<ApplicationLayerBase*> vecUnsubscribedLayers;
+        /// @brief The layers subscribed to a window together with the unsubscribed ones, in layer order.
+        ::std::unordered_map<WindowID, ::std::vector<ApplicationLayerBase*>> mapWindowLayers;
+    };
+
+    /// @brief The events of one type from one window, queued for the layers batching their events.
+    struct EventBatch final {
+        /// @brief The type of the events.
+        ::std::type_index typeId;
+        /// @brief The window the events came from.
+        WindowID sourceWindowId;
+        /// @brief The events, in the order they were broadcast.
+        ::std::vector<::std::shared_ptr<EventBase>> vecEvents;
+    };
+
+    /// @brief The engine's own section of a state snapshot, followed by every layer's schedule.
+    struct EngineStateHeader final {
+        /// @brief The number of engine updates so far.
+        uint64_t numUpdates;
+        /// @brief The number of layer schedules following the header.
+        uint64_t numLayerSchedules;
+    };
+
+    /// @brief The class description of the engine's internal implementations. The free functions drive
+    /// the process default instance, `EngineContext` owns additional ones.
     class Engine final : public virtual IStateful, public virtual IEventListener {
     public:
         /// @brief Updates the state of the engine.
@@ -30,16 +91,41 @@ namespace celerique { namespace internal {
         /// @brief The event handler method.
         /// @param ptrEvent The shared pointer to the event being dispatched.
         void onEvent(::std::shared_ptr<EventBase> ptrEvent) override;
-        /// @brief Add an application layer to be managed by the engine.
+        /// @brief Add an application layer to be managed by the engine. Safe to call from any
+        /// thread, including from a layer's `onUpdate` or `onEvent`. The layer is added before the next update.
         /// @param ptrAppLayer The unique pointer to the application layer instance.
         void addAppLayer(::std::unique_ptr<ApplicationLayerBase>&& ptrAppLayer);
-        /// @brief Add a graphical user interface window to be managed by the engine.
+        /// @brief Add a graphical user interface window to be managed by the engine. Safe to call from any
+        /// thread, including from a layer's `onUpdate` or `onEvent`. The window is added before the next update.
         /// @param ptrWindow The unique pointer to the window instance.
         void addWindow(::std::unique_ptr<WindowBase>&& ptrWindow);
         /// @brief Creates and run the application run loop.
         void run();
+        /// @brief Set the time each iteration of the application run loop aims to take. Iterations finishing early
+        /// spend the rest on background work, then sleep.
+        /// @param targetFrameTime The target frame time. Zero runs iterations back to back, with no background budget.
+        void setTargetFrameTime(::std::chrono::nanoseconds targetFrameTime);
+        /// @brief Set where and how the application layers' render snapshots are rendered.
+        /// Takes effect the next time the application run loop starts.
+        /// @param renderThreadMode The render thread mode.
+        void setRenderThreadMode(RenderThreadMode renderThreadMode);
+        /// @brief Checkpoint the engine and every application layer into a state snapshot, replacing its contents.
+        /// Called by the update thread.
+        /// @param snapshot The snapshot to write into.
+        void saveState(StateSnapshot& snapshot);
+        /// @brief Roll the engine and every application layer back to a state snapshot. Called by the update thread.
+        /// @param snapshot The snapshot to read from.
+        void restoreState(const StateSnapshot& snapshot);
+        /// @brief The scheduler of the background work run in this engine's updates.
+        /// @return The reference to `_backgroundScheduler`.
+        inline BackgroundScheduler& backgroundScheduler() { return _backgroundScheduler; }
+#if defined(CELERIQUE_COROUTINES_ENABLED)
+        /// @brief The scheduler of the tasks suspended until one of this engine's updates.
+        /// @return The reference to `_taskScheduler`.
+        inline TaskScheduler& taskScheduler() { return _taskScheduler; }
+#endif
 
-        /// @brief Gets the reference to the engine object.
+        /// @brief Gets the reference to the process default engine object.
         static Engine& getRef();
 
     // Private helper functions.
@@ -47,27 +133,120 @@ namespace celerique { namespace internal {
         /// @brief The event handler for engine shutdown event.
         /// @param ptrEvent The shared pointer to the event being dispatched.
         void onEngineShutdown(::std::shared_ptr<EventBase> ptrEvent);
+        /// @brief Update the layers and windows, without running background work.
+        /// @param ptrUpdateData The shared pointer to the update data container.
+        void updateState(::std::shared_ptr<IUpdateData> ptrUpdateData);
+        /// @brief Spend what is left of the target frame time on background work.
+        /// @param frameStart When the frame started.
+        void runBackgroundSlices(::std::chrono::high_resolution_clock::time_point frameStart);
+        /// @brief Sleep until the target frame time elapsed since the frame started, if one is set.
+        /// @param frameStart When the frame started.
+        void paceFrame(::std::chrono::high_resolution_clock::time_point frameStart);
+        /// @brief Queue a mutation without locking.
+        /// @param ptrMutation The pointer to the mutation, owned by the queue from here on.
+        void pushMutation(EngineMutation* ptrMutation);
+        /// @brief Apply the queued mutations in the order they were queued, publishing new
+        /// layer and window arrays if anything was added. Called by the update thread between frames.
+        void applyMutations();
+        /// @brief Publish a new array of application layers and the event routes built from it.
+        /// Called by the update thread.
+        /// @param ptrVecAppLayers The unique pointer to the application layers in update order.
+        void publishLayers(::std::unique_ptr<::std::vector<ApplicationLayerBase*>>&& ptrVecAppLayers);
+        /// @brief Build the update schedule of a layer being added, picking a staggered phase when asked to.
+        /// @param cadence The cadence the layer declared.
+        /// @return The update schedule.
+        LayerSchedule scheduleLayer(const LayerUpdateCadence& cadence);
+        /// @brief Queue an event for the layers batching their events, in the batch of its type and source window.
+        /// @param ptrEvent The shared pointer to the event.
+        void queueBatchedEvent(::std::shared_ptr<EventBase>&& ptrEvent);
+        /// @brief Deliver the events queued for the layers batching them, one span per batch.
+        /// Called by the update thread.
+        void deliverEventBatches();
+        /// @brief Build the routes of window events from the windows each layer subscribed to.
+        /// @param vecAppLayers The application layers in update order.
+        /// @return The shared pointer to the routes.
+        static ::std::shared_ptr<EventRoutes> buildEventRoutes(const ::std::vector<ApplicationLayerBase*>& vecAppLayers);
+        /// @brief Have every application layer record its snapshot into the mailbox's write slot.
+        /// @return The reference to the snapshots written, one per layer.
+        ::std::vector<RenderSnapshot>& writeSnapshots();
+        /// @brief Have every application layer render its snapshot.
+        /// @param vecSnapshots The snapshots, one per layer.
+        void renderSnapshots(const ::std::vector<RenderSnapshot>& vecSnapshots);
+        /// @brief The render thread's loop, rendering published snapshots until it is told to stop
+        /// and every published snapshot was rendered.
+        void renderThreadLoop();
 
     // Private member variables.
     private:
-        /// @brief The collection of application layer instances.
+        /// @brief The collection of application layer instances. Only touched by the update thread.
         ::std::list<::std::unique_ptr<ApplicationLayerBase>> _listPtrAppLayers;
-        /// @brief The mutex for `_listPtrAppLayers`.
-        ::std::shared_mutex _layerMutex;
-        /// @brief The graphical user interface windows managed by the engine.
+        /// @brief Every array of application layers published so far. Layers are only ever added, so older arrays
+        /// are kept until the engine is destroyed and threads still reading one never need to be waited for.
+        ::std::list<::std::unique_ptr<const ::std::vector<ApplicationLayerBase*>>> _listPublishedVecAppLayers;
+        /// @brief Every set of event routes published so far, kept alive like `_listPublishedVecAppLayers`.
+        ::std::list<::std::shared_ptr<const EventRoutes>> _listPublishedEventRoutes;
+        /// @brief The application layers in update order, replaced (never modified) between frames.
+        /// Read without locking from any thread.
+        ::std::atomic<const ::std::vector<ApplicationLayerBase*>*> _atomicPtrVecAppLayers = nullptr;
+        /// @brief The layers receiving the events of each window, replaced (never modified) along with
+        /// `_atomicPtrVecAppLayers`. Read without locking from any thread.
+        ::std::atomic<const EventRoutes*> _atomicPtrEventRoutes = nullptr;
+        /// @brief The events broadcast since the last update that layers batching their events have yet to receive.
+        /// Batches emptied by a delivery are kept with their capacity for later events of the same type and window.
+        ::std::vector<EventBatch> _vecQueuedBatches;
+        /// @brief The number of events in `_vecQueuedBatches`, read without locking so that
+        /// updates with nothing queued skip the mutex.
+        ::std::atomic<size_t> _atomicNumQueuedBatchedEvents = 0;
+        /// @brief The mutex object restricting access to `_vecQueuedBatches`. Events may be broadcast from any thread.
+        ::std::mutex _queuedBatchesMutex;
+        /// @brief The batches being delivered to the layers batching their events. Only touched by the update thread.
+        ::std::vector<EventBatch> _vecDeliveringBatches;
+        /// @brief The update schedule of every layer, in the order of `_atomicPtrVecAppLayers`. Only touched by the update thread.
+        ::std::vector<LayerSchedule> _vecLayerSchedules;
+        /// @brief The number of engine updates so far. Only touched by the update thread.
+        uint64_t _numUpdates = 0;
+        /// @brief The number of rate based layers given a staggered phase so far.
+        uint64_t _numStaggeredRateLayers = 0;
+        /// @brief The graphical user interface windows managed by the engine. Only touched by the update thread.
         ::std::list<::std::unique_ptr<WindowBase>> _listPtrWindows;
-        /// @brief The mutex for `_listPtrWindows`.
-        ::std::shared_mutex _windowsMutex;
+        /// @brief The windows in update order. Only touched by the update thread.
+        ::std::vector<WindowBase*> _vecWindows;
+        /// @brief The most recently queued mutation, linking to the ones queued before it.
+        ::std::atomic<EngineMutation*> _atomicPtrMutations = nullptr;
+        /// @brief The background work run in this engine's updates.
+        BackgroundScheduler _backgroundScheduler;
+#if defined(CELERIQUE_COROUTINES_ENABLED)
+        /// @brief The tasks suspended until one of this engine's updates.
+        TaskScheduler _taskScheduler;
+#endif
+        /// @brief Whether this is the process default engine, which receives the completion events of
+        /// loads asked for outside any engine update.
+        bool _isProcessDefault;
         /// @brief The state that indicate if the application loop should keep running.
         ::std::atomic<bool> _atomicShouldAppLoopRunning = true;
+        /// @brief The time each iteration of the application run loop aims to take in nanoseconds, 0 for none.
+        ::std::atomic<int64_t> _atomicTargetFrameNanoSecs = 0;
+        /// @brief Where and how the application layers' render snapshots are rendered.
+        ::std::atomic<RenderThreadMode> _atomicRenderThreadMode = CELERIQUE_RENDER_THREAD_MODE_NONE;
+        /// @brief The state that indicate if the render thread should keep waiting for snapshots.
+        ::std::atomic<bool> _atomicShouldRenderThreadRun = false;
+        /// @brief The snapshots of every layer handed from the update thread to the render thread.
+        TripleBufferMailbox<::std::vector<RenderSnapshot>> _mailboxSnapshots;
+        /// @brief The index of the next frame to be recorded.
+        uint64_t _nextFrameIndex = 0;
+        /// @brief The mutex paired with `_condVarMailbox`.
+        ::std::mutex _mailboxMutex;
+        /// @brief Wakes the render thread when a snapshot is published and the update thread when one is taken.
+        ::std::condition_variable _condVarMailbox;
 
-    private:
-        /// @brief Private default constructor to prevent external instantiation.
-        Engine();
-        /// @brief Private destructor to prevent external deletion.
+    public:
+        /// @brief Member init constructor.
+        /// @param isProcessDefault Whether this is the process default engine, which receives the completion
+        /// events of loads asked for without an engine. There must only be one.
+        Engine(bool isProcessDefault = false);
+        /// @brief Destructor.
         ~Engine();
 
-    public:
         /// @brief Prevent copying.
         Engine(const Engine&) = delete;
         /// @brief Prevent moving.
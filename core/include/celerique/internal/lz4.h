@@ -0,0 +1,47 @@
+/*
+
+File: ./core/include/celerique/internal/lz4.h
+Author: Aldhinn Espinas
+Description: This header file contains an LZ4 block format compressor and decompressor.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#if !defined(CELERIQUE_INTERNAL_LZ4_HEADER_FILE)
+#define CELERIQUE_INTERNAL_LZ4_HEADER_FILE
+
+#include <celerique/types.h>
+
+// Begin C++ Only Region.
+#if defined(__cplusplus)
+#include <cstddef>
+
+namespace celerique { namespace internal {
+    /// @brief The largest size the compressed form of `srcSize` bytes can take.
+    /// @param srcSize The size of the uncompressed data.
+    /// @return The worst case compressed size.
+    constexpr size_t lz4CompressBound(size_t srcSize) {
+        return srcSize + srcSize / 255 + 16;
+    }
+
+    /// @brief Compress into a single LZ4 block (no frame header).
+    /// @param ptrSrc The pointer to the data to be compressed.
+    /// @param srcSize The size of the data to be compressed.
+    /// @param ptrDst The pointer to the destination buffer of at least `lz4CompressBound(srcSize)` bytes.
+    /// @return The size of the compressed block.
+    size_t lz4Compress(const CeleriqueByte* ptrSrc, size_t srcSize, CeleriqueByte* ptrDst);
+    /// @brief Decompress a single LZ4 block. Every read and write is bounds checked.
+    /// @param ptrSrc The pointer to the compressed block.
+    /// @param srcSize The size of the compressed block.
+    /// @param ptrDst The pointer to the destination buffer.
+    /// @param dstSize The exact size of the decompressed data.
+    /// @return `true` if the block was well formed and decompressed to exactly `dstSize` bytes.
+    bool lz4Decompress(const CeleriqueByte* ptrSrc, size_t srcSize, CeleriqueByte* ptrDst, size_t dstSize);
+}}
+#endif
+// End C++ Only Region.
+
+#endif
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
@@ -0,0 +1,486 @@
+/*
+
+File: ./core/include/celerique/internal/simd.h
+Author: Aldhinn Espinas
+Description: This header file contains SIMD kernels shared across the engine core,
+    with SSE, NEON and scalar implementations chosen at compile time.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#if !defined(CELERIQUE_INTERNAL_SIMD_HEADER_FILE)
+#define CELERIQUE_INTERNAL_SIMD_HEADER_FILE
+
+#include <celerique/defines.h>
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CELERIQUE_SIMD_SSE
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define CELERIQUE_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+// Begin C++ Only Region.
+#if defined(__cplusplus)
+namespace celerique { namespace internal {
+    /// @brief Multiply two row-major 4x4 float matrices (`ptrOut = ptrLeft * ptrRight`).
+    /// Each row of the product is a linear combination of the right-hand side rows.
+    /// @param ptrLeft The 16 floats of the left-hand side matrix.
+    /// @param ptrRight The 16 floats of the right-hand side matrix.
+    /// @param ptrOut The 16 floats receiving the product. Must not alias either input.
+    inline void mat4x4Multiply(const float* ptrLeft, const float* ptrRight, float* ptrOut) {
+#if defined(CELERIQUE_SIMD_SSE)
+        /// @brief The rows of the right-hand side matrix.
+        const __m128 rightRow0 = _mm_loadu_ps(ptrRight + 0), rightRow1 = _mm_loadu_ps(ptrRight + 4);
+        const __m128 rightRow2 = _mm_loadu_ps(ptrRight + 8), rightRow3 = _mm_loadu_ps(ptrRight + 12);
+        for (int row = 0; row < 4; row++) {
+            /// @brief The current row of the left-hand side matrix.
+            const float* ptrLeftRow = ptrLeft + row * 4;
+            __m128 productRow = _mm_mul_ps(_mm_set1_ps(ptrLeftRow[0]), rightRow0);
+            productRow = _mm_add_ps(productRow, _mm_mul_ps(_mm_set1_ps(ptrLeftRow[1]), rightRow1));
+            productRow = _mm_add_ps(productRow, _mm_mul_ps(_mm_set1_ps(ptrLeftRow[2]), rightRow2));
+            productRow = _mm_add_ps(productRow, _mm_mul_ps(_mm_set1_ps(ptrLeftRow[3]), rightRow3));
+            _mm_storeu_ps(ptrOut + row * 4, productRow);
+        }
+#elif defined(CELERIQUE_SIMD_NEON)
+        /// @brief The rows of the right-hand side matrix.
+        const float32x4_t rightRow0 = vld1q_f32(ptrRight + 0), rightRow1 = vld1q_f32(ptrRight + 4);
+        const float32x4_t rightRow2 = vld1q_f32(ptrRight + 8), rightRow3 = vld1q_f32(ptrRight + 12);
+        for (int row = 0; row < 4; row++) {
+            /// @brief The current row of the left-hand side matrix.
+            const float* ptrLeftRow = ptrLeft + row * 4;
+            float32x4_t productRow = vmulq_n_f32(rightRow0, ptrLeftRow[0]);
+            productRow = vmlaq_n_f32(productRow, rightRow1, ptrLeftRow[1]);
+            productRow = vmlaq_n_f32(productRow, rightRow2, ptrLeftRow[2]);
+            productRow = vmlaq_n_f32(productRow, rightRow3, ptrLeftRow[3]);
+            vst1q_f32(ptrOut + row * 4, productRow);
+        }
+#else
+        for (int row = 0; row < 4; row++) {
+            for (int col = 0; col < 4; col++) {
+                ptrOut[row * 4 + col] =
+                    ptrLeft[row * 4 + 0] * ptrRight[0 + col] + ptrLeft[row * 4 + 1] * ptrRight[4 + col] +
+                    ptrLeft[row * 4 + 2] * ptrRight[8 + col] + ptrLeft[row * 4 + 3] * ptrRight[12 + col];
+            }
+        }
+#endif
+    }
+
+    /// @brief Transpose a 4x4 float matrix, converting between row-major and column-major storage.
+    /// @param ptrSrc The 16 floats of the matrix.
+    /// @param ptrOut The 16 floats receiving the transpose. Must not alias the input.
+    inline void mat4x4Transpose(const float* ptrSrc, float* ptrOut) {
+#if defined(CELERIQUE_SIMD_SSE)
+        __m128 row0 = _mm_loadu_ps(ptrSrc + 0), row1 = _mm_loadu_ps(ptrSrc + 4);
+        __m128 row2 = _mm_loadu_ps(ptrSrc + 8), row3 = _mm_loadu_ps(ptrSrc + 12);
+        _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+        _mm_storeu_ps(ptrOut + 0, row0);
+        _mm_storeu_ps(ptrOut + 4, row1);
+        _mm_storeu_ps(ptrOut + 8, row2);
+        _mm_storeu_ps(ptrOut + 12, row3);
+#elif defined(CELERIQUE_SIMD_NEON)
+        // The de-interleaving load gathers every 4th float, which is a column.
+        /// @brief The columns of the matrix.
+        const float32x4x4_t columns = vld4q_f32(ptrSrc);
+        vst1q_f32(ptrOut + 0, columns.val[0]);
+        vst1q_f32(ptrOut + 4, columns.val[1]);
+        vst1q_f32(ptrOut + 8, columns.val[2]);
+        vst1q_f32(ptrOut + 12, columns.val[3]);
+#else
+        for (int row = 0; row < 4; row++) {
+            for (int col = 0; col < 4; col++) ptrOut[col * 4 + row] = ptrSrc[row * 4 + col];
+        }
+#endif
+    }
+
+    /// @brief Linearly interpolate two 4 float vectors (`ptrOut = from + (to - from) * t`).
+    /// @param ptrFrom The 4 floats at `t = 0`.
+    /// @param ptrTo The 4 floats at `t = 1`.
+    /// @param t The interpolation factor.
+    /// @param ptrOut The 4 floats receiving the result. May alias either input.
+    inline void vec4Lerp(const float* ptrFrom, const float* ptrTo, float t, float* ptrOut) {
+#if defined(CELERIQUE_SIMD_SSE)
+        /// @brief The vector at `t = 0`.
+        const __m128 from = _mm_loadu_ps(ptrFrom);
+        _mm_storeu_ps(ptrOut, _mm_add_ps(from, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(ptrTo), from), _mm_set1_ps(t))));
+#elif defined(CELERIQUE_SIMD_NEON)
+        /// @brief The vector at `t = 0`.
+        const float32x4_t from = vld1q_f32(ptrFrom);
+        vst1q_f32(ptrOut, vmlaq_n_f32(from, vsubq_f32(vld1q_f32(ptrTo), from), t));
+#else
+        for (int i = 0; i < 4; i++) ptrOut[i] = ptrFrom[i] + (ptrTo[i] - ptrFrom[i]) * t;
+#endif
+    }
+
+    /// @brief Interpolate two unit quaternions along the shortest path and re-normalize (nlerp).
+    /// @param ptrFrom The quaternion (x, y, z, w) at `t = 0`.
+    /// @param ptrTo The quaternion (x, y, z, w) at `t = 1`.
+    /// @param t The interpolation factor.
+    /// @param ptrOut The 4 floats receiving the unit quaternion. May alias either input.
+    inline void quaternionNlerp(const float* ptrFrom, const float* ptrTo, float t, float* ptrOut) {
+#if defined(CELERIQUE_SIMD_SSE)
+        /// @brief The quaternion at `t = 0`.
+        const __m128 from = _mm_loadu_ps(ptrFrom);
+        /// @brief The quaternion at `t = 1`.
+        __m128 to = _mm_loadu_ps(ptrTo);
+        /// @brief The dot product, summed into every lane.
+        __m128 dot = _mm_mul_ps(from, to);
+        dot = _mm_add_ps(dot, _mm_shuffle_ps(dot, dot, _MM_SHUFFLE(2, 3, 0, 1)));
+        dot = _mm_add_ps(dot, _mm_shuffle_ps(dot, dot, _MM_SHUFFLE(1, 0, 3, 2)));
+        // Flipping the target to the same hemisphere takes the shortest path.
+        to = _mm_xor_ps(to, _mm_and_ps(dot, _mm_set1_ps(-0.0f)));
+        /// @brief The interpolated quaternion.
+        __m128 result = _mm_add_ps(from, _mm_mul_ps(_mm_sub_ps(to, from), _mm_set1_ps(t)));
+        /// @brief The squared length, summed into every lane.
+        __m128 lengthSquared = _mm_mul_ps(result, result);
+        lengthSquared = _mm_add_ps(lengthSquared, _mm_shuffle_ps(lengthSquared, lengthSquared, _MM_SHUFFLE(2, 3, 0, 1)));
+        lengthSquared = _mm_add_ps(lengthSquared, _mm_shuffle_ps(lengthSquared, lengthSquared, _MM_SHUFFLE(1, 0, 3, 2)));
+        _mm_storeu_ps(ptrOut, _mm_div_ps(result, _mm_sqrt_ps(lengthSquared)));
+#elif defined(CELERIQUE_SIMD_NEON)
+        /// @brief The quaternion at `t = 0`.
+        const float32x4_t from = vld1q_f32(ptrFrom);
+        /// @brief The quaternion at `t = 1`.
+        float32x4_t to = vld1q_f32(ptrTo);
+        /// @brief The products of the dot product.
+        float32x4_t products = vmulq_f32(from, to);
+        /// @brief The dot product in both lanes.
+        float32x2_t dot = vadd_f32(vget_low_f32(products), vget_high_f32(products));
+        dot = vpadd_f32(dot, dot);
+        // Flipping the target to the same hemisphere takes the shortest path.
+        if (vget_lane_f32(dot, 0) < 0.0f) to = vnegq_f32(to);
+        /// @brief The interpolated quaternion.
+        float32x4_t result = vmlaq_n_f32(from, vsubq_f32(to, from), t);
+        products = vmulq_f32(result, result);
+        /// @brief The squared length in both lanes.
+        float32x2_t lengthSquared = vadd_f32(vget_low_f32(products), vget_high_f32(products));
+        lengthSquared = vpadd_f32(lengthSquared, lengthSquared);
+        vst1q_f32(ptrOut, vmulq_n_f32(result, 1.0f / sqrtf(vget_lane_f32(lengthSquared, 0))));
+#else
+        /// @brief The dot product.
+        float dot = ptrFrom[0] * ptrTo[0] + ptrFrom[1] * ptrTo[1] + ptrFrom[2] * ptrTo[2] + ptrFrom[3] * ptrTo[3];
+        /// @brief The sign flipping the target to the same hemisphere, taking the shortest path.
+        float sign = dot < 0.0f ? -1.0f : 1.0f;
+        /// @brief The interpolated quaternion.
+        float result[4];
+        for (int i = 0; i < 4; i++) result[i] = ptrFrom[i] + (ptrTo[i] * sign - ptrFrom[i]) * t;
+        /// @brief One over the length.
+        float inverseLength = 1.0f / sqrtf(
+            result[0] * result[0] + result[1] * result[1] + result[2] * result[2] + result[3] * result[3]
+        );
+        for (int i = 0; i < 4; i++) ptrOut[i] = result[i] * inverseLength;
+#endif
+    }
+
+    /// @brief Four float lanes.
+    struct Float4 {
+#if defined(CELERIQUE_SIMD_SSE)
+        /// @brief The lanes.
+        __m128 lanes;
+#elif defined(CELERIQUE_SIMD_NEON)
+        /// @brief The lanes.
+        float32x4_t lanes;
+#else
+        /// @brief The lanes.
+        float lanes[4];
+#endif
+    };
+    /// @brief Four 32 bit unsigned integer lanes. Comparisons produce all-ones lanes for true.
+    struct Uint4 {
+#if defined(CELERIQUE_SIMD_SSE)
+        /// @brief The lanes.
+        __m128i lanes;
+#elif defined(CELERIQUE_SIMD_NEON)
+        /// @brief The lanes.
+        uint32x4_t lanes;
+#else
+        /// @brief The lanes.
+        uint32_t lanes[4];
+#endif
+    };
+
+#if defined(CELERIQUE_SIMD_SSE)
+    /// @brief Load 4 floats.
+    /// @param ptrSrc The floats.
+    /// @return The lanes.
+    inline Float4 loadFloat4(const float* ptrSrc) { return {_mm_loadu_ps(ptrSrc)}; }
+    /// @brief Store 4 floats.
+    /// @param ptrDst The destination.
+    /// @param value The lanes.
+    inline void storeFloat4(float* ptrDst, Float4 value) { _mm_storeu_ps(ptrDst, value.lanes); }
+    /// @brief Broadcast a float to every lane.
+    /// @param value The float.
+    /// @return The lanes.
+    inline Float4 splatFloat4(float value) { return {_mm_set1_ps(value)}; }
+    /// @brief Load 4 integers.
+    /// @param ptrSrc The integers.
+    /// @return The lanes.
+    inline Uint4 loadUint4(const uint32_t* ptrSrc) { return {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptrSrc))}; }
+    /// @brief Store 4 integers.
+    /// @param ptrDst The destination.
+    /// @param value The lanes.
+    inline void storeUint4(uint32_t* ptrDst, Uint4 value) { _mm_storeu_si128(reinterpret_cast<__m128i*>(ptrDst), value.lanes); }
+    /// @brief Broadcast an integer to every lane.
+    /// @param value The integer.
+    /// @return The lanes.
+    inline Uint4 splatUint4(uint32_t value) { return {_mm_set1_epi32(static_cast<int>(value))}; }
+
+    // Lanewise arithmetic and bitwise operations.
+    inline Float4 operator+(Float4 left, Float4 right) { return {_mm_add_ps(left.lanes, right.lanes)}; }
+    inline Float4 operator-(Float4 left, Float4 right) { return {_mm_sub_ps(left.lanes, right.lanes)}; }
+    inline Float4 operator*(Float4 left, Float4 right) { return {_mm_mul_ps(left.lanes, right.lanes)}; }
+    inline Uint4 operator+(Uint4 left, Uint4 right) { return {_mm_add_epi32(left.lanes, right.lanes)}; }
+    inline Uint4 operator&(Uint4 left, Uint4 right) { return {_mm_and_si128(left.lanes, right.lanes)}; }
+    inline Uint4 operator|(Uint4 left, Uint4 right) { return {_mm_or_si128(left.lanes, right.lanes)}; }
+    inline Uint4 operator^(Uint4 left, Uint4 right) { return {_mm_xor_si128(left.lanes, right.lanes)}; }
+    inline Uint4 operator<<(Uint4 value, int bits) { return {_mm_slli_epi32(value.lanes, bits)}; }
+    inline Uint4 operator>>(Uint4 value, int bits) { return {_mm_srli_epi32(value.lanes, bits)}; }
+    /// @brief Multiply integers, keeping the low 32 bits of each product.
+    inline Uint4 operator*(Uint4 left, Uint4 right) {
+        // SSE2 only multiplies the even lanes into 64 bit products.
+        /// @brief The products of lanes 0 and 2.
+        __m128i even = _mm_mul_epu32(left.lanes, right.lanes);
+        /// @brief The products of lanes 1 and 3.
+        __m128i odd = _mm_mul_epu32(_mm_srli_epi64(left.lanes, 32), _mm_srli_epi64(right.lanes, 32));
+        return {_mm_unpacklo_epi32(
+            _mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0))
+        )};
+    }
+    /// @brief Multiply integers, keeping the high 32 bits of each product.
+    /// @param left The left-hand side lanes.
+    /// @param right The right-hand side lanes.
+    /// @return The high halves of the products.
+    inline Uint4 multiplyHigh(Uint4 left, Uint4 right) {
+        /// @brief The products of lanes 0 and 2.
+        __m128i even = _mm_mul_epu32(left.lanes, right.lanes);
+        /// @brief The products of lanes 1 and 3.
+        __m128i odd = _mm_mul_epu32(_mm_srli_epi64(left.lanes, 32), _mm_srli_epi64(right.lanes, 32));
+        return {_mm_unpacklo_epi32(
+            _mm_shuffle_epi32(even, _MM_SHUFFLE(3, 3, 3, 1)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(3, 3, 3, 1))
+        )};
+    }
+    /// @brief Compare floats.
+    /// @param left The left-hand side lanes.
+    /// @param right The right-hand side lanes.
+    /// @return All ones in the lanes where `left > right`.
+    inline Uint4 greaterThan(Float4 left, Float4 right) { return {_mm_castps_si128(_mm_cmpgt_ps(left.lanes, right.lanes))}; }
+    /// @brief Compare floats.
+    /// @param left The left-hand side lanes.
+    /// @param right The right-hand side lanes.
+    /// @return All ones in the lanes where `left >= right`.
+    inline Uint4 greaterEqual(Float4 left, Float4 right) { return {_mm_castps_si128(_mm_cmpge_ps(left.lanes, right.lanes))}; }
+    /// @brief Compare integers.
+    /// @param left The left-hand side lanes.
+    /// @param right The right-hand side lanes.
+    /// @return All ones in the lanes where `left == right`.
+    inline Uint4 equal(Uint4 left, Uint4 right) { return {_mm_cmpeq_epi32(left.lanes, right.lanes)}; }
+    /// @brief Reinterpret the bits of floats as integers.
+    /// @param value The float lanes.
+    /// @return The integer lanes.
+    inline Uint4 asUint4(Float4 value) { return {_mm_castps_si128(value.lanes)}; }
+    /// @brief Reinterpret the bits of integers as floats.
+    /// @param value The integer lanes.
+    /// @return The float lanes.
+    inline Float4 asFloat4(Uint4 value) { return {_mm_castsi128_ps(value.lanes)}; }
+    /// @brief Convert floats to signed integers, rounding towards zero.
+    /// @param value The float lanes, within the range of a 32 bit signed integer.
+    /// @return The integers, two's complement.
+    inline Uint4 truncateToUint4(Float4 value) { return {_mm_cvttps_epi32(value.lanes)}; }
+    /// @brief Convert integers to floats.
+    /// @param value The integers, read as signed.
+    /// @return The float lanes.
+    inline Float4 convertToFloat4(Uint4 value) { return {_mm_cvtepi32_ps(value.lanes)}; }
+#elif defined(CELERIQUE_SIMD_NEON)
+    /// @brief Load 4 floats.
+    /// @param ptrSrc The floats.
+    /// @return The lanes.
+    inline Float4 loadFloat4(const float* ptrSrc) { return {vld1q_f32(ptrSrc)}; }
+    /// @brief Store 4 floats.
+    /// @param ptrDst The destination.
+    /// @param value The lanes.
+    inline void storeFloat4(float* ptrDst, Float4 value) { vst1q_f32(ptrDst, value.lanes); }
+    /// @brief Broadcast a float to every lane.
+    /// @param value The float.
+    /// @return The lanes.
+    inline Float4 splatFloat4(float value) { return {vdupq_n_f32(value)}; }
+    /// @brief Load 4 integers.
+    /// @param ptrSrc The integers.
+    /// @return The lanes.
+    inline Uint4 loadUint4(const uint32_t* ptrSrc) { return {vld1q_u32(ptrSrc)}; }
+    /// @brief Store 4 integers.
+    /// @param ptrDst The destination.
+    /// @param value The lanes.
+    inline void storeUint4(uint32_t* ptrDst, Uint4 value) { vst1q_u32(ptrDst, value.lanes); }
+    /// @brief Broadcast an integer to every lane.
+    /// @param value The integer.
+    /// @return The lanes.
+    inline Uint4 splatUint4(uint32_t value) { return {vdupq_n_u32(value)}; }
+
+    // Lanewise arithmetic and bitwise operations.
+    inline Float4 operator+(Float4 left, Float4 right) { return {vaddq_f32(left.lanes, right.lanes)}; }
+    inline Float4 operator-(Float4 left, Float4 right) { return {vsubq_f32(left.lanes, right.lanes)}; }
+    inline Float4 operator*(Float4 left, Float4 right) { return {vmulq_f32(left.lanes, right.lanes)}; }
+    inline Uint4 operator+(Uint4 left, Uint4 right) { return {vaddq_u32(left.lanes, right.lanes)}; }
+    inline Uint4 operator&(Uint4 left, Uint4 right) { return {vandq_u32(left.lanes, right.lanes)}; }
+    inline Uint4 operator|(Uint4 left, Uint4 right) { return {vorrq_u32(left.lanes, right.lanes)}; }
+    inline Uint4 operator^(Uint4 left, Uint4 right) { return {veorq_u32(left.lanes, right.lanes)}; }
+    inline Uint4 operator<<(Uint4 value, int bits) { return {vshlq_u32(value.lanes, vdupq_n_s32(bits))}; }
+    inline Uint4 operator>>(Uint4 value, int bits) { return {vshlq_u32(value.lanes, vdupq_n_s32(-bits))}; }
+    /// @brief Multiply integers, keeping the low 32 bits of each product.
+    inline Uint4 operator*(Uint4 left, Uint4 right) { return {vmulq_u32(left.lanes, right.lanes)}; }
+    /// @brief Multiply integers, keeping the high 32 bits of each product.
+    /// @param left The left-hand side lanes.
+    /// @param right The right-hand side lanes.
+    /// @return The high halves of the products.
+    inline Uint4 multiplyHigh(Uint4 left, Uint4 right) {
+        /// @brief The products of lanes 0 and 1.
+        uint64x2_t low = vmull_u32(vget_low_u32(left.lanes), vget_low_u32(right.lanes));
+        /// @brief The products of lanes 2 and 3.
+        uint64x2_t high = vmull_u32(vget_high_u32(left.lanes), vget_high_u32(right.lanes));
+        return {vcombine_u32(vshrn_n_u64(low, 32), vshrn_n_u64(high, 32))};
+    }
+    /// @brief Compare floats.
+    /// @param left The left-hand side lanes.
+    /// @param right The right-hand side lanes.
+    /// @return All ones in the lanes where `left > right`.
+    inline Uint4 greaterThan(Float4 left, Float4 right) { return {vcgtq_f32(left.lanes, right.lanes)}; }
+    /// @brief Compare floats.
+    /// @param left The left-hand side lanes.
+    /// @param right The right-hand side lanes.
+    /// @return All ones in the lanes where `left >= right`.
+    inline Uint4 greaterEqual(Float4 left, Float4 right) { return {vcgeq_f32(left.lanes, right.lanes)}; }
+    /// @brief Compare integers.
+    /// @param left The left-hand side lanes.
+    /// @param right The right-hand side lanes.
+    /// @return All ones in the lanes where `left == right`.
+    inline Uint4 equal(Uint4 left, Uint4 right) { return {vceqq_u32(left.lanes, right.lanes)}; }
+    /// @brief Reinterpret the bits of floats as integers.
+    /// @param value The float lanes.
+    /// @return The integer lanes.
+    inline Uint4 asUint4(Float4 value) { return {vreinterpretq_u32_f32(value.lanes)}; }
+    /// @brief Reinterpret the bits of integers as floats.
+    /// @param value The integer lanes.
+    /// @return The float lanes.
+    inline Float4 asFloat4(Uint4 value) { return {vreinterpretq_f32_u32(value.lanes)}; }
+    /// @brief Convert floats to signed integers, rounding towards zero.
+    /// @param value The float lanes, within the range of a 32 bit signed integer.
+    /// @return The integers, two's complement.
+    inline Uint4 truncateToUint4(Float4 value) { return {vreinterpretq_u32_s32(vcvtq_s32_f32(value.lanes))}; }
+    /// @brief Convert integers to floats.
+    /// @param value The integers, read as signed.
+    /// @return The float lanes.
+    inline Float4 convertToFloat4(Uint4 value) { return {vcvtq_f32_s32(vreinterpretq_s32_u32(value.lanes))}; }
+#else
+    /// @brief Load 4 floats.
+    /// @param ptrSrc The floats.
+    /// @return The lanes.
+    inline Float4 loadFloat4(const float* ptrSrc) { return {{ptrSrc[0], ptrSrc[1], ptrSrc[2], ptrSrc[3]}}; }
+    /// @brief Store 4 floats.
+    /// @param ptrDst The destination.
+    /// @param value The lanes.
+    inline void storeFloat4(float* ptrDst, Float4 value) { for (int i = 0; i < 4; i++) ptrDst[i] = value.lanes[i]; }
+    /// @brief Broadcast a float to every lane.
+    /// @param value The float.
+    /// @return The lanes.
+    inline Float4 splatFloat4(float value) { return {{value, value, value, value}}; }
+    /// @brief Load 4 integers.
+    /// @param ptrSrc The integers.
+    /// @return The lanes.
+    inline Uint4 loadUint4(const uint32_t* ptrSrc) { return {{ptrSrc[0], ptrSrc[1], ptrSrc[2], ptrSrc[3]}}; }
+    /// @brief Store 4 integers.
+    /// @param ptrDst The destination.
+    /// @param value The lanes.
+    inline void storeUint4(uint32_t* ptrDst, Uint4 value) { for (int i = 0; i < 4; i++) ptrDst[i] = value.lanes[i]; }
+    /// @brief Broadcast an integer to every lane.
+    /// @param value The integer.
+    /// @return The lanes.
+    inline Uint4 splatUint4(uint32_t value) { return {{value, value, value, value}}; }
+
+    // Lanewise arithmetic and bitwise operations.
+#define CELERIQUE_SIMD_LANEWISE(TResult, expression) \
+    TResult result; for (int i = 0; i < 4; i++) result.lanes[i] = (expression); return result;
+    inline Float4 operator+(Float4 left, Float4 right) { CELERIQUE_SIMD_LANEWISE(Float4, left.lanes[i] + right.lanes[i]) }
+    inline Float4 operator-(Float4 left, Float4 right) { CELERIQUE_SIMD_LANEWISE(Float4, left.lanes[i] - right.lanes[i]) }
+    inline Float4 operator*(Float4 left, Float4 right) { CELERIQUE_SIMD_LANEWISE(Float4, left.lanes[i] * right.lanes[i]) }
+    inline Uint4 operator+(Uint4 left, Uint4 right) { CELERIQUE_SIMD_LANEWISE(Uint4, left.lanes[i] + right.lanes[i]) }
+    inline Uint4 operator&(Uint4 left, Uint4 right) { CELERIQUE_SIMD_LANEWISE(Uint4, left.lanes[i] & right.lanes[i]) }
+    inline Uint4 operator|(Uint4 left, Uint4 right) { CELERIQUE_SIMD_LANEWISE(Uint4, left.lanes[i] | right.lanes[i]) }
+    inline Uint4 operator^(Uint4 left, Uint4 right) { CELERIQUE_SIMD_LANEWISE(Uint4, left.lanes[i] ^ right.lanes[i]) }
+    inline Uint4 operator<<(Uint4 value, int bits) { CELERIQUE_SIMD_LANEWISE(Uint4, value.lanes[i] << bits) }
+    inline Uint4 operator>>(Uint4 value, int bits) { CELERIQUE_SIMD_LANEWISE(Uint4, value.lanes[i] >> bits) }
+    /// @brief Multiply integers, keeping the low 32 bits of each product.
+    inline Uint4 operator*(Uint4 left, Uint4 right) { CELERIQUE_SIMD_LANEWISE(Uint4, left.lanes[i] * right.lanes[i]) }
+    /// @brief Multiply integers, keeping the high 32 bits of each product.
+    /// @param left The left-hand side lanes.
+    /// @param right The right-hand side lanes.
+    /// @return The high halves of the products.
+    inline Uint4 multiplyHigh(Uint4 left, Uint4 right) {
+        CELERIQUE_SIMD_LANEWISE(Uint4, static_cast<uint32_t>((static_cast<uint64_t>(left.lanes[i]) * right.lanes[i]) >> 32))
+    }
+    /// @brief Compare floats.
+    /// @param left The left-hand side lanes.
+    /// @param right The right-hand side lanes.
+    /// @return All ones in the lanes where `left > right`.
+    inline Uint4 greaterThan(Float4 left, Float4 right) {
+        CELERIQUE_SIMD_LANEWISE(Uint4, left.lanes[i] > right.lanes[i] ? UINT32_MAX : 0u)
+    }
+    /// @brief Compare floats.
+    /// @param left The left-hand side lanes.
+    /// @param right The right-hand side lanes.
+    /// @return All ones in the lanes where `left >= right`.
+    inline Uint4 greaterEqual(Float4 left, Float4 right) {
+        CELERIQUE_SIMD_LANEWISE(Uint4, left.lanes[i] >= right.lanes[i] ? UINT32_MAX : 0u)
+    }
+    /// @brief Compare integers.
+    /// @param left The left-hand side lanes.
+    /// @param right The right-hand side lanes.
+    /// @return All ones in the lanes where `left == right`.
+    inline Uint4 equal(Uint4 left, Uint4 right) { CELERIQUE_SIMD_LANEWISE(Uint4, left.lanes[i] == right.lanes[i] ? UINT32_MAX : 0u) }
+    /// @brief Reinterpret the bits of floats as integers.
+    /// @param value The float lanes.
+    /// @return The integer lanes.
+    inline Uint4 asUint4(Float4 value) { Uint4 result; memcpy(result.lanes, value.lanes, sizeof(result.lanes)); return result; }
+    /// @brief Reinterpret the bits of integers as floats.
+    /// @param value The integer lanes.
+    /// @return The float lanes.
+    inline Float4 asFloat4(Uint4 value) { Float4 result; memcpy(result.lanes, value.lanes, sizeof(result.lanes)); return result; }
+    /// @brief Convert floats to signed integers, rounding towards zero.
+    /// @param value The float lanes, within the range of a 32 bit signed integer.
+    /// @return The integers, two's complement.
+    inline Uint4 truncateToUint4(Float4 value) {
+        CELERIQUE_SIMD_LANEWISE(Uint4, static_cast<uint32_t>(static_cast<int32_t>(value.lanes[i])))
+    }
+    /// @brief Convert integers to floats.
+    /// @param value The integers, read as signed.
+    /// @return The float lanes.
+    inline Float4 convertToFloat4(Uint4 value) {
+        CELERIQUE_SIMD_LANEWISE(Float4, static_cast<float>(static_cast<int32_t>(value.lanes[i])))
+    }
+#undef CELERIQUE_SIMD_LANEWISE
+#endif
+
+    /// @brief Keep the float lanes where a mask is set and zero the others.
+    /// @param value The float lanes.
+    /// @param mask The mask, all ones or all zeros per lane.
+    /// @return The masked lanes.
+    inline Float4 maskFloat4(Float4 value, Uint4 mask) { return asFloat4(asUint4(value) & mask); }
+    /// @brief Round floats down.
+    /// @param value The float lanes, within the range of a 32 bit signed integer.
+    /// @return The largest integers not greater than each lane.
+    inline Float4 floorFloat4(Float4 value) {
+        /// @brief The lanes rounded towards zero, one too large for negative fractions.
+        Float4 truncated = convertToFloat4(truncateToUint4(value));
+        return truncated - maskFloat4(splatFloat4(1.0f), greaterThan(truncated, value));
+    }
+}}
+#endif
+// End C++ Only Region.
+
+#endif
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
@@ -0,0 +1,74 @@
+/*
+
+File: ./core/include/celerique/internal/tasks.h
+Author: Aldhinn Espinas
+Description: This header file contains internal interfaces to the coroutine task scheduler.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#if !defined(CELERIQUE_INTERNAL_TASKS_HEADER_FILE)
+#define CELERIQUE_INTERNAL_TASKS_HEADER_FILE
+
+#include <celerique/tasks.h>
+
+// Begin C++ Only Region.
+#if defined(__cplusplus) && defined(CELERIQUE_COROUTINES_ENABLED)
+#include <mutex>
+#include <vector>
+
+namespace celerique { namespace internal {
+    /// @brief A suspended coroutine and the condition it waits on.
+    struct SuspendedTask final {
+        /// @brief The condition. Null holds on the next engine update.
+        ::std::function<bool()> isReady;
+        /// @brief The handle to the suspended coroutine.
+        ::std::coroutine_handle<> handle;
+    };
+
+    /// @brief Keeps suspended coroutines until the conditions they wait on hold. Every engine has one.
+    class TaskScheduler final {
+    public:
+        /// @brief Keep a suspended coroutine until its condition holds.
+        /// @param isReady The condition. Null holds on the next engine update.
+        /// @param handle The handle to the suspended coroutine.
+        void resumeWhen(::std::function<bool()>&& isReady, ::std::coroutine_handle<> handle);
+        /// @brief Resume every coroutine whose condition holds on the job workers.
+        /// Called at the start of every update of the engine owning the scheduler.
+        void onFrame();
+
+    // Private member variables.
+    private:
+        /// @brief The suspended coroutines.
+        ::std::vector<SuspendedTask> _vecSuspendedTasks;
+        /// @brief The mutex for `_vecSuspendedTasks`.
+        ::std::mutex _suspendedTasksMutex;
+
+    public:
+        /// @brief Default constructor.
+        TaskScheduler() = default;
+        /// @brief Destructor.
+        ~TaskScheduler();
+
+        /// @brief Prevent copying.
+        TaskScheduler(const TaskScheduler&) = delete;
+        /// @brief Prevent moving.
+        TaskScheduler(TaskScheduler&&) = delete;
+        /// @brief Prevent copy re-assignment.
+        TaskScheduler& operator=(const TaskScheduler&) = delete;
+        /// @brief Prevent move re-assignment.
+        TaskScheduler& operator=(TaskScheduler&&) = delete;
+    };
+
+    /// @brief Start a task on a job worker, its suspensions resumed by a scheduler's updates.
+    /// @param ptrScheduler The scheduler of the engine the task runs on, or `nullptr` for the process default engine's.
+    /// @param task The task to be started.
+    void spawnTask(TaskScheduler* ptrScheduler, Task<void>&& task);
+}}
+#endif
+// End C++ Only Region.
+
+#endif
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
@@ -0,0 +1,474 @@
+/*
+
+File: ./core/src/animation.cpp
+Author: Aldhinn Espinas
+Description: This source file contains the skeletal animation implementations.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique/animation.h>
+#include <celerique/jobs.h>
+#include <celerique/logging.h>
+#include <celerique/internal/simd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+/// @brief The number of characters animated per job.
+#define ANIMATION_CHARACTER_BATCH_SIZE                                                      16
+/// @brief The largest quantized key time.
+#define ANIMATION_MAX_QUANTIZED_TIME                                                        65535.0f
+/// @brief The largest quantized quaternion component.
+#define ANIMATION_MAX_QUANTIZED_COMPONENT                                                   32767.0f
+/// @brief The largest value of the three smallest components of a unit quaternion (1 over the square root of 2).
+#define ANIMATION_MAX_SMALLEST_COMPONENT                                                    0.70710678f
+
+/// @brief Log and throw for an invalid animation or skeleton.
+/// @param errorMessage The error message.
+[[noreturn]] static void throwInvalidAnimation(const ::std::string& errorMessage) {
+    celeriqueLogError(errorMessage);
+    throw ::std::runtime_error(errorMessage);
+}
+
+/// @brief Compose a joint pose into a row-major matrix (translation * rotation * scale).
+/// @param pose The joint pose.
+/// @param ptrOut The 16 floats receiving the matrix.
+static void composeJointPose(const ::celerique::JointPose& pose, float* ptrOut) {
+    /// @brief The rotation quaternion.
+    float x = pose.rotation[0], y = pose.rotation[1], z = pose.rotation[2], w = pose.rotation[3];
+
+    ptrOut[0] = (1.0f - 2.0f * (y * y + z * z)) * pose.scale[0];
+    ptrOut[1] = 2.0f * (x * y - w * z) * pose.scale[1];
+    ptrOut[2] = 2.0f * (x * z + w * y) * pose.scale[2];
+    ptrOut[3] = pose.translation[0];
+    ptrOut[4] = 2.0f * (x * y + w * z) * pose.scale[0];
+    ptrOut[5] = (1.0f - 2.0f * (x * x + z * z)) * pose.scale[1];
+    ptrOut[6] = 2.0f * (y * z - w * x) * pose.scale[2];
+    ptrOut[7] = pose.translation[1];
+    ptrOut[8] = 2.0f * (x * z - w * y) * pose.scale[0];
+    ptrOut[9] = 2.0f * (y * z + w * x) * pose.scale[1];
+    ptrOut[10] = (1.0f - 2.0f * (x * x + y * y)) * pose.scale[2];
+    ptrOut[11] = pose.translation[2];
+    ptrOut[12] = 0.0f;
+    ptrOut[13] = 0.0f;
+    ptrOut[14] = 0.0f;
+    ptrOut[15] = 1.0f;
+}
+
+/// @brief Find the keyframes of a channel to be interpolated with linear curve reduction:
+/// a keyframe is dropped when interpolating its kept neighbours stays within the tolerance.
+/// @param ptrTimes The key times.
+/// @param ptrValues The key values, `numComponents` floats per key.
+/// @param numKeys The number of keys.
+/// @param numComponents The number of floats per value.
+/// @param tolerance The largest error allowed on any component.
+/// @return The indices of the kept keys.
+static ::std::vector<size_t> reduceKeys(
+    const float* ptrTimes, const float* ptrValues, size_t numKeys, size_t numComponents, float tolerance
+) {
+    /// @brief The indices of the kept keys.
+    ::std::vector<size_t> vecKeptKeys;
+    if (numKeys == 0) return vecKeptKeys;
+    vecKeptKeys.emplace_back(0);
+
+    /// @brief The last kept key, the start of the current segment.
+    size_t anchor = 0;
+    for (size_t end = anchor + 2; end < numKeys; end++) {
+        // Check every key the segment from the anchor to `end` would replace.
+        /// @brief Whether the segment reproduces every key it skips.
+        bool isWithinTolerance = true;
+        for (size_t key = anchor + 1; key < end && isWithinTolerance; key++) {
+            /// @brief The duration of the segment.
+            float segmentDuration = ptrTimes[end] - ptrTimes[anchor];
+            /// @brief The interpolation factor of the key within the segment.
+            float t = segmentDuration > 0.0f ? (ptrTimes[key] - ptrTimes[anchor]) / segmentDuration : 0.0f;
+            for (size_t component = 0; component < numComponents; component++) {
+                /// @brief The value of the component at the anchor.
+                float from = ptrValues[anchor * numComponents + component];
+                /// @brief The interpolated value of the component.
+                float interpolated = from + (ptrValues[end * numComponents + component] - from) * t;
+                if (::std::fabs(interpolated - ptrValues[key * numComponents + component]) > tolerance) {
+                    isWithinTolerance = false;
+                    break;
+                }
+            }
+        }
+        if (!isWithinTolerance) {
+            anchor = end - 1;
+            vecKeptKeys.emplace_back(anchor);
+        }
+    }
+    if (numKeys > 1) vecKeptKeys.emplace_back(numKeys - 1);
+
+    // A constant channel only needs one key.
+    if (vecKeptKeys.size() == 2) {
+        /// @brief Whether both kept keys hold the same value.
+        bool isConstant = true;
+        for (size_t component = 0; component < numComponents; component++) {
+            if (::std::fabs(ptrValues[component] - ptrValues[(numKeys - 1) * numComponents + component]) > tolerance) {
+                isConstant = false;
+            }
+        }
+        if (isConstant) vecKeptKeys.pop_back();
+    }
+    return vecKeptKeys;
+}
+
+/// @brief Quantize a unit quaternion to 48 bits: the three smallest components at 15 bits each
+/// and the index of the largest one in the top bits of the first two.
+/// @param ptrQuaternion The unit quaternion (x, y, z, w).
+/// @param ptrOut The 3 integers receiving the quantized quaternion.
+static void quantizeRotation(const float* ptrQuaternion, uint16_t* ptrOut) {
+    /// @brief The index of the largest component.
+    size_t largest = 0;
+    for (size_t component = 1; component < 4; component++) {
+        if (::std::fabs(ptrQuaternion[component]) > ::std::fabs(ptrQuaternion[largest])) largest = component;
+    }
+    // q and -q are the same rotation, so the largest component is made positive and left out.
+    /// @brief The sign making the largest component positive.
+    float sign = ptrQuaternion[largest] < 0.0f ? -1.0f : 1.0f;
+    /// @brief The next quantized component.
+    size_t quantized = 0;
+    for (size_t component = 0; component < 4; component++) {
+        if (component == largest) continue;
+        /// @brief The component mapped to [0, 1].
+        float normalized = ptrQuaternion[component] * sign * (0.5f / ANIMATION_MAX_SMALLEST_COMPONENT) + 0.5f;
+        normalized = ::std::max(0.0f, ::std::min(normalized, 1.0f));
+        ptrOut[quantized++] = static_cast<uint16_t>(::std::lround(normalized * ANIMATION_MAX_QUANTIZED_COMPONENT));
+    }
+    ptrOut[0] |= static_cast<uint16_t>((largest & 1) << 15);
+    ptrOut[1] |= static_cast<uint16_t>((largest >> 1) << 15);
+}
+
+/// @brief Restore a unit quaternion quantized by `quantizeRotation`.
+/// @param ptrQuantized The 3 integers of the quantized quaternion.
+/// @param ptrOut The 4 floats receiving the quaternion (x, y, z, w).
+static inline void dequantizeRotation(const uint16_t* ptrQuantized, float* ptrOut) {
+    /// @brief The index of the largest component.
+    size_t largest = (ptrQuantized[0] >> 15) | ((ptrQuantized[1] >> 15) << 1);
+    /// @brief The sum of the squares of the smallest components.
+    float sumOfSquares = 0.0f;
+    /// @brief The next quantized component.
+    size_t quantized = 0;
+    for (size_t component = 0; component < 4; component++) {
+        if (component == largest) continue;
+        /// @brief The restored component.
+        float value = (static_cast<float>(ptrQuantized[quantized++] & 0x7FFF) * (2.0f / ANIMATION_MAX_QUANTIZED_COMPONENT) - 1.0f) *
+            ANIMATION_MAX_SMALLEST_COMPONENT;
+        ptrOut[component] = value;
+        sumOfSquares += value * value;
+    }
+    ptrOut[largest] = ::std::sqrt(::std::max(0.0f, 1.0f - sumOfSquares));
+}
+
+/// @brief Find the keys to interpolate at a time.
+/// @param ptrTimes The quantized key times.
+/// @param numKeys The number of keys, at least one.
+/// @param quantizedTime The time as a fraction of the duration out of 65535.
+/// @param refFirstKey The key at `t = 0`.
+/// @param refSecondKey The key at `t = 1`.
+/// @return The interpolation factor `t`.
+static inline float findKeys(
+    const uint16_t* ptrTimes, uint32_t numKeys, float quantizedTime, uint32_t& refFirstKey, uint32_t& refSecondKey
+) {
+    /// @brief The first key after the time.
+    uint32_t nextKey = static_cast<uint32_t>(::std::upper_bound(ptrTimes, ptrTimes + numKeys, quantizedTime) - ptrTimes);
+    if (nextKey == 0 || nextKey == numKeys) {
+        refFirstKey = refSecondKey = nextKey == 0 ? 0 : numKeys - 1;
+        return 0.0f;
+    }
+    refFirstKey = nextKey - 1;
+    refSecondKey = nextKey;
+    return (quantizedTime - ptrTimes[refFirstKey]) / static_cast<float>(ptrTimes[refSecondKey] - ptrTimes[refFirstKey]);
+}
+
+/// @brief Sample the local pose of every joint.
+/// @param time The time in seconds, clamped to the duration.
+/// @param ptrPoses The destination receiving `numJoints()` poses.
+void ::celerique::AnimationClip::sample(float time, JointPose* ptrPoses) const {
+    /// @brief The time as a fraction of the duration out of 65535.
+    float quantizedTime = _duration > 0.0f ?
+        ::std::max(0.0f, ::std::min(time / _duration, 1.0f)) * ANIMATION_MAX_QUANTIZED_TIME : 0.0f;
+    /// @brief The keys interpolated.
+    uint32_t firstKey, secondKey;
+
+    for (size_t joint = 0; joint < numJoints(); joint++) {
+        /// @brief The key ranges of the joint's channels.
+        const uint32_t* ptrRanges = &_vecKeyRanges[joint * 6];
+        JointPose& refPose = ptrPoses[joint];
+
+        if (ptrRanges[1] == 0) {
+            refPose.translation[0] = refPose.translation[1] = refPose.translation[2] = 0.0f;
+        } else {
+            /// @brief The interpolation factor.
+            float t = findKeys(&_vecTranslationTimes[ptrRanges[0]], ptrRanges[1], quantizedTime, firstKey, secondKey);
+            // The values are 3 floats apart, the 4th float read is padding or the next key's.
+            internal::vec4Lerp(
+                &_vecTranslationValues[(ptrRanges[0] + firstKey) * 3], &_vecTranslationValues[(ptrRanges[0] + secondKey) * 3],
+                t, refPose.translation
+            );
+        }
+        refPose.translation[3] = 0.0f;
+
+        if (ptrRanges[3] == 0) {
+            refPose.rotation[0] = refPose.rotation[1] = refPose.rotation[2] = 0.0f;
+            refPose.rotation[3] = 1.0f;
+        } else {
+            /// @brief The interpolation factor.
+            float t = findKeys(&_vecRotationTimes[ptrRanges[2]], ptrRanges[3], quantizedTime, firstKey, secondKey);
+            /// @brief The rotations interpolated.
+            alignas(16) float arrFirstRotation[4], arrSecondRotation[4];
+            dequantizeRotation(&_vecRotationValues[(ptrRanges[2] + firstKey) * 3], arrFirstRotation);
+            dequantizeRotation(&_vecRotationValues[(ptrRanges[2] + secondKey) * 3], arrSecondRotation);
+            internal::quaternionNlerp(arrFirstRotation, arrSecondRotation, t, refPose.rotation);
+        }
+
+        if (ptrRanges[5] == 0) {
+            refPose.scale[0] = refPose.scale[1] = refPose.scale[2] = 1.0f;
+        } else {
+            /// @brief The interpolation factor.
+            float t = findKeys(&_vecScaleTimes[ptrRanges[4]], ptrRanges[5], quantizedTime, firstKey, secondKey);
+            internal::vec4Lerp(
+                &_vecScaleValues[(ptrRanges[4] + firstKey) * 3], &_vecScaleValues[(ptrRanges[4] + secondKey) * 3],
+                t, refPose.scale
+            );
+        }
+        refPose.scale[3] = 0.0f;
+    }
+}
+
+/// @brief The memory used by the keyframes.
+/// @return The size in bytes.
+size_t celerique::AnimationClip::compressedSize() const {
+    return _vecKeyRanges.size() * sizeof(uint32_t) +
+        (_vecTranslationTimes.size() + _vecRotationTimes.size() + _vecScaleTimes.size()) * sizeof(uint16_t) +
+        (_vecTranslationValues.size() + _vecScaleValues.size()) * sizeof(float) +
+        _vecRotationValues.size() * sizeof(uint16_t);
+}
+
+/// @brief Compress a raw animation.
+/// @param rawAnimation The uncompressed animation.
+/// @param tolerance The largest distance from the raw keyframes a removed keyframe may
+/// introduce, in the units of each channel (quaternion components for rotations).
+::celerique::AnimationClip::AnimationClip(const RawAnimation& rawAnimation, float tolerance) :
+    _duration(rawAnimation.duration) {
+    /// @brief Converts seconds into a fraction of the duration out of 65535.
+    float timeScale = _duration > 0.0f ? ANIMATION_MAX_QUANTIZED_TIME / _duration : 0.0f;
+    /// @brief The key times of the channel being compressed.
+    ::std::vector<float> vecTimes;
+    /// @brief The key values of the channel being compressed.
+    ::std::vector<float> vecValues;
+
+    for (const RawJointTrack& jointTrack : rawAnimation.vecJointTracks) {
+        for (size_t channel = 0; channel < 3; channel++) {
+            /// @brief The number of components of the channel's values.
+            size_t numComponents = channel == 1 ? 4 : 3;
+            vecTimes.clear();
+            vecValues.clear();
+            if (channel == 1) {
+                for (const RawRotationKey& key : jointTrack.vecRotationKeys) {
+                    vecTimes.emplace_back(key.time);
+                    /// @brief The length of the quaternion.
+                    float length = ::std::sqrt(
+                        key.value[0] * key.value[0] + key.value[1] * key.value[1] +
+                        key.value[2] * key.value[2] + key.value[3] * key.value[3]
+                    );
+                    // Keep consecutive keys in the same hemisphere so they interpolate along the shortest path.
+                    /// @brief The sign keeping the key near the previous one.
+                    float sign = 1.0f;
+                    if (!vecValues.empty()) {
+                        /// @brief The previous key.
+                        const float* ptrPrevious = &vecValues[vecValues.size() - 4];
+                        float dot = ptrPrevious[0] * key.value[0] + ptrPrevious[1] * key.value[1] +
+                            ptrPrevious[2] * key.value[2] + ptrPrevious[3] * key.value[3];
+                        if (dot < 0.0f) sign = -1.0f;
+                    }
+                    for (ArraySize component = 0; component < 4; component++) {
+                        vecValues.emplace_back(key.value[component] * sign / length);
+                    }
+                }
+            } else {
+                for (const RawVec3Key& key : channel == 0 ? jointTrack.vecTranslationKeys : jointTrack.vecScaleKeys) {
+                    vecTimes.emplace_back(key.time);
+                    for (ArraySize component = 0; component < 3; component++) vecValues.emplace_back(key.value[component]);
+                }
+            }
+            if (!::std::is_sorted(vecTimes.begin(), vecTimes.end())) {
+                throwInvalidAnimation("Animation keyframes must be sorted by time.");
+            }
+
+            /// @brief The keys kept after curve reduction.
+            ::std::vector<size_t> vecKeptKeys = reduceKeys(
+                vecTimes.data(), vecValues.data(), vecTimes.size(), numComponents, tolerance
+            );
+            /// @brief The quantized times of the channel.
+            ::std::vector<uint16_t>& refVecTimes = channel == 0 ? _vecTranslationTimes :
+                channel == 1 ? _vecRotationTimes : _vecScaleTimes;
+            _vecKeyRanges.emplace_back(static_cast<uint32_t>(refVecTimes.size()));
+            _vecKeyRanges.emplace_back(static_cast<uint32_t>(vecKeptKeys.size()));
+
+            for (size_t key : vecKeptKeys) {
+                refVecTimes.emplace_back(static_cast<uint16_t>(::std::lround(
+                    ::std::max(0.0f, ::std::min(vecTimes[key] * timeScale, ANIMATION_MAX_QUANTIZED_TIME))
+                )));
+                if (channel == 1) {
+                    /// @brief The quantized rotation.
+                    uint16_t arrQuantized[3];
+                    quantizeRotation(&vecValues[key * 4], arrQuantized);
+                    _vecRotationValues.insert(_vecRotationValues.end(), arrQuantized, arrQuantized + 3);
+                } else {
+                    ::std::vector<float>& refVecValues = channel == 0 ? _vecTranslationValues : _vecScaleValues;
+                    refVecValues.insert(refVecValues.end(), &vecValues[key * 3], &vecValues[key * 3] + 3);
+                }
+            }
+        }
+    }
+
+    // Sampling reads 4 floats per 3 float value.
+    _vecTranslationValues.emplace_back(0.0f);
+    _vecScaleValues.emplace_back(0.0f);
+}
+
+/// @brief Member init constructor.
+/// @param vecParentIndices The parent of each joint. Parents must come before their children.
+/// @param vecInverseBindMatrices The inverse bind matrices, 16 row-major floats per joint.
+/// Identity matrices are used if empty.
+::celerique::Skeleton::Skeleton(::std::vector<uint32_t>&& vecParentIndices, ::std::vector<float>&& vecInverseBindMatrices) :
+    _vecParentIndices(::std::move(vecParentIndices)), _vecInverseBindMatrices(::std::move(vecInverseBindMatrices)) {
+    for (size_t joint = 0; joint < _vecParentIndices.size(); joint++) {
+        if (_vecParentIndices[joint] != CELERIQUE_JOINT_INDEX_NULL && _vecParentIndices[joint] >= joint) {
+            throwInvalidAnimation("Joint " + ::std::to_string(joint) + " comes before its parent.");
+        }
+    }
+    if (_vecInverseBindMatrices.empty()) {
+        _vecInverseBindMatrices.resize(_vecParentIndices.size() * 16, 0.0f);
+        for (size_t joint = 0; joint < _vecParentIndices.size(); joint++) {
+            for (size_t diagonal = 0; diagonal < 4; diagonal++) _vecInverseBindMatrices[joint * 16 + diagonal * 5] = 1.0f;
+        }
+    } else if (_vecInverseBindMatrices.size() != _vecParentIndices.size() * 16) {
+        throwInvalidAnimation("A skeleton needs one inverse bind matrix per joint.");
+    }
+}
+
+/// @brief Blend two poses, interpolating translations and scales and taking the shortest path between rotations.
+/// @param ptrFrom The poses at weight 0.
+/// @param ptrTo The poses at weight 1.
+/// @param weight The blend weight.
+/// @param numJoints The number of joints.
+/// @param ptrOut The destination receiving the blended poses. May alias either input.
+void ::celerique::blendPoses(
+    const JointPose* ptrFrom, const JointPose* ptrTo, float weight, size_t numJoints, JointPose* ptrOut
+) {
+    for (size_t joint = 0; joint < numJoints; joint++) {
+        internal::vec4Lerp(ptrFrom[joint].translation, ptrTo[joint].translation, weight, ptrOut[joint].translation);
+        internal::quaternionNlerp(ptrFrom[joint].rotation, ptrTo[joint].rotation, weight, ptrOut[joint].rotation);
+        internal::vec4Lerp(ptrFrom[joint].scale, ptrTo[joint].scale, weight, ptrOut[joint].scale);
+    }
+}
+
+/// @brief Compose local poses into model space matrices.
+/// @param skeleton The skeleton of the poses.
+/// @param ptrLocalPoses The pose of each joint relative to its parent.
+/// @param ptrModelMatrices The destination receiving 16 row-major floats per joint.
+void ::celerique::buildModelMatrices(const Skeleton& skeleton, const JointPose* ptrLocalPoses, float* ptrModelMatrices) {
+    /// @brief The local matrix of the current joint.
+    alignas(16) float localMatrix[16];
+    for (size_t joint = 0; joint < skeleton.numJoints(); joint++) {
+        /// @brief The parent of the joint.
+        uint32_t parentIndex = skeleton.parentIndices()[joint];
+        if (parentIndex == CELERIQUE_JOINT_INDEX_NULL) {
+            composeJointPose(ptrLocalPoses[joint], ptrModelMatrices + joint * 16);
+        } else {
+            composeJointPose(ptrLocalPoses[joint], localMatrix);
+            internal::mat4x4Multiply(ptrModelMatrices + parentIndex * 16, localMatrix, ptrModelMatrices + joint * 16);
+        }
+    }
+}
+
+/// @brief Write the skinning matrices (model matrix times inverse bind matrix) of every
+/// joint, `CELERIQUE_SKINNING_PALETTE_JOINT_SIZE` bytes each, for the skinning shaders.
+/// @param skeleton The skeleton of the matrices.
+/// @param ptrModelMatrices The model matrices, 16 row-major floats per joint.
+/// @param ptrDst The destination, such as a mapped storage buffer. Must be 4 byte aligned.
+/// @param dstCapacity The size of the destination in bytes.
+/// @return `false` if the destination is too small.
+bool celerique::writeSkinningPalette(
+    const Skeleton& skeleton, const float* ptrModelMatrices, void* ptrDst, size_t dstCapacity
+) {
+    if (skeleton.numJoints() * CELERIQUE_SKINNING_PALETTE_JOINT_SIZE > dstCapacity) {
+        celeriqueLogWarning("Destination memory is too small for the skinning palette.");
+        return false;
+    }
+    /// @brief The destination as floats, 12 per joint.
+    float* ptrPalette = reinterpret_cast<float*>(ptrDst);
+    /// @brief The skinning matrix of the current joint.
+    alignas(16) float skinningMatrix[16];
+    for (size_t joint = 0; joint < skeleton.numJoints(); joint++) {
+        internal::mat4x4Multiply(ptrModelMatrices + joint * 16, &skeleton.inverseBindMatrices()[joint * 16], skinningMatrix);
+        // The bottom row of an affine matrix is always (0, 0, 0, 1).
+        ::std::memcpy(ptrPalette + joint * 12, skinningMatrix, sizeof(float) * 12);
+    }
+    return true;
+}
+
+/// @brief Sample, blend, compose and write the skinning palettes of many characters
+/// sharing a skeleton, in parallel on the job workers.
+/// @param skeleton The skeleton of every character. Every clip must animate its joints.
+/// @param ptrCharacters What each character plays.
+/// @param numCharacters The number of characters.
+/// @param ptrDst The destination receiving each character's palette one after the other.
+/// @param dstCapacity The size of the destination in bytes.
+/// @return `false` if the destination is too small or a clip does not match the skeleton.
+bool celerique::animateCharacters(
+    const Skeleton& skeleton, const CharacterAnimation* ptrCharacters, size_t numCharacters,
+    void* ptrDst, size_t dstCapacity
+) {
+    /// @brief The number of joints of every character.
+    size_t numJoints = skeleton.numJoints();
+    /// @brief The size of one character's palette.
+    size_t paletteSize = numJoints * CELERIQUE_SKINNING_PALETTE_JOINT_SIZE;
+    if (numCharacters * paletteSize > dstCapacity) {
+        celeriqueLogWarning("Destination memory is too small for the skinning palettes.");
+        return false;
+    }
+    for (size_t character = 0; character < numCharacters; character++) {
+        /// @brief What the character plays.
+        const CharacterAnimation& characterAnimation = ptrCharacters[character];
+        if (characterAnimation.ptrClip == nullptr || characterAnimation.ptrClip->numJoints() != numJoints ||
+            (characterAnimation.ptrBlendClip != nullptr && characterAnimation.ptrBlendClip->numJoints() != numJoints)) {
+            celeriqueLogWarning("Animation clips must animate every joint of the skeleton.");
+            return false;
+        }
+    }
+
+    parallelFor(numCharacters, ANIMATION_CHARACTER_BATCH_SIZE, [&](size_t begin, size_t end) {
+        /// @brief The poses sampled from the played clip.
+        ::std::vector<JointPose> vecPoses(numJoints);
+        /// @brief The poses sampled from the blended clip.
+        ::std::vector<JointPose> vecBlendPoses(numJoints);
+        /// @brief The model matrices of the character.
+        ::std::vector<float> vecModelMatrices(numJoints * 16);
+        for (size_t character = begin; character < end; character++) {
+            /// @brief What the character plays.
+            const CharacterAnimation& characterAnimation = ptrCharacters[character];
+            characterAnimation.ptrClip->sample(characterAnimation.time, vecPoses.data());
+            if (characterAnimation.ptrBlendClip != nullptr && characterAnimation.blendWeight > 0.0f) {
+                characterAnimation.ptrBlendClip->sample(characterAnimation.blendTime, vecBlendPoses.data());
+                blendPoses(vecPoses.data(), vecBlendPoses.data(), characterAnimation.blendWeight, numJoints, vecPoses.data());
+            }
+            buildModelMatrices(skeleton, vecPoses.data(), vecModelMatrices.data());
+            writeSkinningPalette(
+                skeleton, vecModelMatrices.data(), reinterpret_cast<uint8_t*>(ptrDst) + character * paletteSize, paletteSize
+            );
+        }
+    });
+    return true;
+}
+
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
@@ -0,0 +1,525 @@
+/*
+
+File: ./core/src/archive.cpp
+Author: Aldhinn Espinas
+Description: This source file contains implementations of packed asset archives.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique/internal/archive.h>
+#include <celerique/internal/lz4.h>
+#include <celerique/jobs.h>
+#include <celerique/logging.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+#if defined(CELERIQUE_FOR_WINDOWS)
+#include <windows.h>
+#elif defined(CELERIQUE_FOR_POSIX_SYSTEMS)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+using ::celerique::internal::ArchiveHeader;
+using ::celerique::internal::ArchiveTocEntry;
+
+/// @brief Round a value up to the next multiple of `CELERIQUE_ARCHIVE_ALIGNMENT`.
+/// @param value The value to be rounded.
+/// @return The aligned value.
+static inline uint64_t alignToArchive(uint64_t value) {
+    return (value + CELERIQUE_ARCHIVE_ALIGNMENT - 1) & ~static_cast<uint64_t>(CELERIQUE_ARCHIVE_ALIGNMENT - 1);
+}
+
+/// @brief Read a chunk offset out of a compressed entry's chunk table.
+/// @param ptrTable The pointer to the start of the chunk table.
+/// @param index The index of the offset.
+/// @return The offset value.
+static inline uint64_t readChunkOffset(const ::celerique::Byte* ptrTable, size_t index) {
+    /// @brief The read offset.
+    uint64_t offset;
+    ::std::memcpy(&offset, ptrTable + index * sizeof(uint64_t), sizeof(uint64_t));
+    return offset;
+}
+
+/// @brief The number of chunks a compressed entry is split into.
+/// @param size The uncompressed size of the entry.
+/// @param chunkSize The uncompressed size of each chunk.
+/// @return The number of chunks.
+static inline size_t numChunksOf(uint64_t size, uint32_t chunkSize) {
+    return static_cast<size_t>((size + chunkSize - 1) / chunkSize);
+}
+
+/// @brief Release a mapping created by `openArchive`.
+/// @param ptrMapping The pointer to the start of the mapping.
+/// @param mappingSize The size of the mapping.
+/// @param ptrMappingHandle The platform specific handle kept alive for the mapping.
+static void unmapArchive(const ::celerique::Byte* ptrMapping, size_t mappingSize, ::celerique::Pointer ptrMappingHandle) {
+    if (ptrMapping == nullptr) return;
+#if defined(CELERIQUE_FOR_WINDOWS)
+    // Views are always unmapped whole.
+    (void)mappingSize;
+    UnmapViewOfFile(ptrMapping);
+    CloseHandle(reinterpret_cast<HANDLE>(ptrMappingHandle));
+#elif defined(CELERIQUE_FOR_POSIX_SYSTEMS)
+    // The mapping itself is the only handle needed.
+    (void)ptrMappingHandle;
+    ::munmap(const_cast<::celerique::Byte*>(ptrMapping), mappingSize);
+#endif
+}
+
+/// @brief Check that a mapping holds a well formed archive.
+/// @param ptrMapping The pointer to the start of the mapping.
+/// @param mappingSize The size of the mapping.
+/// @return `true` if every table of contents entry lies inside the mapping.
+static bool isValidArchive(const ::celerique::Byte* ptrMapping, size_t mappingSize) {
+    if (mappingSize < sizeof(ArchiveHeader)) return false;
+
+    /// @brief The archive header.
+    const ArchiveHeader* ptrHeader = reinterpret_cast<const ArchiveHeader*>(ptrMapping);
+    if (::std::memcmp(ptrHeader->magic, ::celerique::internal::archiveMagic, sizeof(ptrHeader->magic)) != 0) return false;
+    if (ptrHeader->version != ::celerique::internal::archiveVersion) return false;
+    if (ptrHeader->tocOffset % CELERIQUE_ARCHIVE_ALIGNMENT != 0) return false;
+    if (ptrHeader->tocOffset > mappingSize ||
+    (mappingSize - ptrHeader->tocOffset) / sizeof(ArchiveTocEntry) < ptrHeader->numEntries) return false;
+
+    /// @brief The table of contents.
+    const ArchiveTocEntry* ptrTocEntries = reinterpret_cast<const ArchiveTocEntry*>(ptrMapping + ptrHeader->tocOffset);
+    for (size_t i = 0; i < ptrHeader->numEntries; i++) {
+        /// @brief The entry being validated.
+        const ArchiveTocEntry& refEntry = ptrTocEntries[i];
+        if (refEntry.offset % CELERIQUE_ARCHIVE_ALIGNMENT != 0) return false;
+        if (refEntry.offset > mappingSize || refEntry.storedSize > mappingSize - refEntry.offset) return false;
+        // Binary search relies on the order.
+        if (i > 0 && ptrTocEntries[i - 1].nameHash >= refEntry.nameHash) return false;
+
+        switch (refEntry.compression) {
+        case CELERIQUE_ARCHIVE_COMPRESSION_NONE:
+            if (refEntry.storedSize != refEntry.size) return false;
+            break;
+        case CELERIQUE_ARCHIVE_COMPRESSION_LZ4:
+            if (refEntry.chunkSize == 0) return false;
+            if ((numChunksOf(refEntry.size, refEntry.chunkSize) + 1) * sizeof(uint64_t) > refEntry.storedSize) return false;
+            break;
+        default:
+            return false;
+        }
+    }
+    return true;
+}
+
+/// @brief Hash an entry name the way archives store it (64-bit FNV-1a).
+/// @param name The name of the entry.
+/// @return The hashed name.
+uint64_t celerique::hashArchiveEntryName(const ::std::string& name) {
+    /// @brief The running hash value.
+    uint64_t hash = 14695981039346656037ull;
+    for (char character : name) {
+        hash ^= static_cast<uint8_t>(character);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+/// @brief Member init constructor. Use `openArchive` instead.
+/// @param ptrMapping The pointer to the start of the mapped archive.
+/// @param mappingSize The size of the mapping.
+/// @param ptrMappingHandle The platform specific handle kept alive for the mapping.
+::celerique::Archive::Archive(const Byte* ptrMapping, size_t mappingSize, Pointer ptrMappingHandle) :
+_ptrMapping(ptrMapping), _mappingSize(mappingSize), _ptrMappingHandle(ptrMappingHandle) {
+    /// @brief The archive header.
+    const ArchiveHeader* ptrHeader = reinterpret_cast<const ArchiveHeader*>(_ptrMapping);
+    _ptrTocEntries = reinterpret_cast<const ArchiveTocEntry*>(_ptrMapping + ptrHeader->tocOffset);
+    _numTocEntries = ptrHeader->numEntries;
+}
+
+/// @brief The number of entries in the archive.
+/// @return The number of entries in the table of contents.
+size_t celerique::Archive::numEntries() const {
+    return _numTocEntries;
+}
+
+/// @brief Determines whether the archive has an entry.
+/// @param name The name of the entry.
+/// @return `true` if the entry exists.
+bool celerique::Archive::contains(const ::std::string& name) const {
+    return findEntry(name) != nullptr;
+}
+
+/// @brief The uncompressed size of an entry.
+/// @param name The name of the entry.
+/// @return The size in bytes or 0 if the entry does not exist.
+size_t celerique::Archive::entrySize(const ::std::string& name) const {
+    /// @brief The table of contents entry.
+    const ArchiveTocEntry* ptrEntry = findEntry(name);
+    if (ptrEntry == nullptr) return 0;
+    return static_cast<size_t>(ptrEntry->size);
+}
+
+/// @brief Direct access to an uncompressed entry inside the mapping.
+/// The pointer is aligned to `CELERIQUE_ARCHIVE_ALIGNMENT` and valid while the archive is alive.
+/// @param name The name of the entry.
+/// @return The pointer to the entry or `nullptr` if it does not exist or is compressed.
+const ::celerique::Byte* celerique::Archive::entryData(const ::std::string& name) const {
+    /// @brief The table of contents entry.
+    const ArchiveTocEntry* ptrEntry = findEntry(name);
+    if (ptrEntry == nullptr || ptrEntry->compression != CELERIQUE_ARCHIVE_COMPRESSION_NONE) return nullptr;
+    return _ptrMapping + ptrEntry->offset;
+}
+
+/// @brief Copy or decompress an entry into a caller provided buffer.
+/// Compressed chunks are decompressed in parallel on the job workers.
+/// @param name The name of the entry.
+/// @param ptrDst The destination buffer.
+/// @param dstCapacity The size of the destination buffer.
+/// @return `true` if the whole entry was written into the buffer.
+bool celerique::Archive::read(const ::std::string& name, Byte* ptrDst, size_t dstCapacity) const {
+    /// @brief The table of contents entry.
+    const ArchiveTocEntry* ptrEntry = findEntry(name);
+    if (ptrEntry == nullptr || ptrEntry->size > dstCapacity) return false;
+
+    /// @brief The pointer to the start of the stored entry.
+    const Byte* ptrStored = _ptrMapping + ptrEntry->offset;
+    if (ptrEntry->compression == CELERIQUE_ARCHIVE_COMPRESSION_NONE) {
+        ::std::memcpy(ptrDst, ptrStored, static_cast<size_t>(ptrEntry->size));
+        return true;
+    }
+
+    /// @brief The number of chunks the entry is split into.
+    const size_t numChunks = numChunksOf(ptrEntry->size, ptrEntry->chunkSize);
+    /// @brief The state indicating whether a chunk failed to decompress.
+    ::std::atomic<bool> atomicDidFail = false;
+
+    parallelFor(numChunks, 1, [&](size_t begin, size_t end) {
+        for (size_t chunkIndex = begin; chunkIndex < end; chunkIndex++) {
+            /// @brief The start of the stored chunk relative to the entry.
+            uint64_t srcBegin = readChunkOffset(ptrStored, chunkIndex);
+            /// @brief The end of the stored chunk relative to the entry.
+            uint64_t srcEnd = readChunkOffset(ptrStored, chunkIndex + 1);
+            /// @brief The start of the chunk in the decompressed entry.
+            uint64_t dstBegin = static_cast<uint64_t>(chunkIndex) * ptrEntry->chunkSize;
+            /// @brief The uncompressed size of the chunk.
+            uint64_t dstSize = ::std::min<uint64_t>(ptrEntry->chunkSize, ptrEntry->size - dstBegin);
+
+            if (srcBegin > srcEnd || srcEnd > ptrEntry->storedSize) {
+                atomicDidFail.store(true, ::std::memory_order_relaxed);
+                continue;
+            }
+            if (srcEnd - srcBegin == dstSize) {
+                ::std::memcpy(ptrDst + dstBegin, ptrStored + srcBegin, static_cast<size_t>(dstSize));
+            } else if (!internal::lz4Decompress(
+                ptrStored + srcBegin, static_cast<size_t>(srcEnd - srcBegin),
+                ptrDst + dstBegin, static_cast<size_t>(dstSize)
+            )) {
+                atomicDidFail.store(true, ::std::memory_order_relaxed);
+            }
+        }
+    });
+
+    if (atomicDidFail.load()) {
+        celeriqueLogWarning("Corrupted archive entry: " + name);
+        return false;
+    }
+    return true;
+}
+
+/// @brief Copy or decompress an entry into a new buffer.
+/// @param name The name of the entry.
+/// @return The entry's contents or an empty buffer on failure.
+::std::vector<::celerique::Byte> celerique::Archive::read(const ::std::string& name) const {
+    /// @brief The buffer receiving the entry.
+    ::std::vector<Byte> vecContents(entrySize(name));
+    if (!read(name, vecContents.data(), vecContents.size())) vecContents.clear();
+    return vecContents;
+}
+
+/// @brief Load a shader program from an entry. Uncompressed entries are
+/// referenced in place and keep this archive alive.
+/// @param name The name of the entry.
+/// @return The shader program container (empty on failure).
+::celerique::ShaderProgram celerique::Archive::shaderProgram(const ::std::string& name) {
+    /// @brief The table of contents entry.
+    const ArchiveTocEntry* ptrEntry = findEntry(name);
+    if (ptrEntry == nullptr || ptrEntry->size == 0) {
+        celeriqueLogWarning("No shader program in archive named: " + name);
+        return ShaderProgram();
+    }
+
+    /// @brief The size of the shader program.
+    size_t size = static_cast<size_t>(ptrEntry->size);
+    if (ptrEntry->compression == CELERIQUE_ARCHIVE_COMPRESSION_NONE) {
+        // The mapping is read only; shader programs are never written through this pointer.
+        return ShaderProgram(
+            size, const_cast<Byte*>(_ptrMapping + ptrEntry->offset), shared_from_this()
+        );
+    }
+
+    /// @brief The pointer to the heap allocated buffer containing the shader program.
+    Byte* ptrBuffer = new Byte[size];
+    if (!read(name, ptrBuffer, size)) {
+        delete[] ptrBuffer;
+        return ShaderProgram();
+    }
+    return ShaderProgram(size, ptrBuffer);
+}
+
+/// @brief Find the table of contents entry of a name.
+/// @param name The name of the entry.
+/// @return The pointer to the entry or `nullptr` if it does not exist.
+const ::celerique::internal::ArchiveTocEntry* celerique::Archive::findEntry(const ::std::string& name) const {
+    /// @brief The hashed name being searched.
+    uint64_t nameHash = hashArchiveEntryName(name);
+    /// @brief One past the last table of contents entry.
+    const ArchiveTocEntry* ptrTocEnd = _ptrTocEntries + _numTocEntries;
+    /// @brief The first entry whose hash is not less than the searched one.
+    const ArchiveTocEntry* ptrEntry = ::std::lower_bound(
+        _ptrTocEntries, ptrTocEnd, nameHash,
+        [](const ArchiveTocEntry& entry, uint64_t hash) { return entry.nameHash < hash; }
+    );
+    if (ptrEntry == ptrTocEnd || ptrEntry->nameHash != nameHash) return nullptr;
+    return ptrEntry;
+}
+
+/// @brief Destructor. Unmaps the archive.
+::celerique::Archive::~Archive() {
+    unmapArchive(_ptrMapping, _mappingSize, _ptrMappingHandle);
+}
+
+/// @brief Add an entry. Compression happens here, in parallel chunks on the job workers.
+/// @param name The name of the entry. Names must hash uniquely within an archive.
+/// @param ptrData The pointer to the entry's contents.
+/// @param size The size of the entry's contents.
+/// @param compression The compression applied to the entry.
+/// @param chunkSize The uncompressed size of each compressed chunk.
+void ::celerique::ArchiveWriter::addEntry(
+    const ::std::string& name, const Byte* ptrData, size_t size,
+    ArchiveCompression compression, uint32_t chunkSize
+) {
+    /// @brief The hashed name of the entry.
+    uint64_t nameHash = hashArchiveEntryName(name);
+    for (const PendingEntry& refPendingEntry : _vecPendingEntries) {
+        if (refPendingEntry.nameHash == nameHash) {
+            ::std::string errorMessage = "Archive entry name collides with an existing entry: " + name;
+            celeriqueLogError(errorMessage);
+            throw ::std::runtime_error(errorMessage);
+        }
+    }
+
+    /// @brief The entry to be written.
+    PendingEntry pendingEntry = {nameHash, size, compression, 0, {}};
+    switch (compression) {
+    case CELERIQUE_ARCHIVE_COMPRESSION_NONE:
+        pendingEntry.storedBytes.assign(ptrData, ptrData + size);
+        break;
+
+    case CELERIQUE_ARCHIVE_COMPRESSION_LZ4: {
+        if (chunkSize == 0) {
+            const char* errorMessage = "Archive chunk size must not be 0.";
+            celeriqueLogError(errorMessage);
+            throw ::std::runtime_error(errorMessage);
+        }
+        pendingEntry.chunkSize = chunkSize;
+
+        /// @brief The number of chunks the entry is split into.
+        const size_t numChunks = numChunksOf(size, chunkSize);
+        /// @brief The stored form of each chunk.
+        ::std::vector<::std::vector<Byte>> vecStoredChunks(numChunks);
+        parallelFor(numChunks, 1, [&](size_t begin, size_t end) {
+            for (size_t chunkIndex = begin; chunkIndex < end; chunkIndex++) {
+                /// @brief The pointer to the start of the chunk.
+                const Byte* ptrChunk = ptrData + chunkIndex * chunkSize;
+                /// @brief The uncompressed size of the chunk.
+                size_t chunkLength = ::std::min<size_t>(chunkSize, size - chunkIndex * chunkSize);
+                /// @brief The stored form of the chunk.
+                ::std::vector<Byte>& refStoredChunk = vecStoredChunks[chunkIndex];
+
+                refStoredChunk.resize(internal::lz4CompressBound(chunkLength));
+                /// @brief The size of the compressed chunk.
+                size_t compressedLength = internal::lz4Compress(ptrChunk, chunkLength, refStoredChunk.data());
+                // Incompressible chunks are stored raw, marked by an unchanged size.
+                if (compressedLength >= chunkLength) {
+                    refStoredChunk.assign(ptrChunk, ptrChunk + chunkLength);
+                } else {
+                    refStoredChunk.resize(compressedLength);
+                }
+            }
+        });
+
+        /// @brief The size of the chunk offset table.
+        size_t tableSize = (numChunks + 1) * sizeof(uint64_t);
+        /// @brief The offset of the next chunk relative to the start of the entry.
+        uint64_t chunkOffset = tableSize;
+        pendingEntry.storedBytes.resize(tableSize);
+        for (size_t chunkIndex = 0; chunkIndex <= numChunks; chunkIndex++) {
+            ::std::memcpy(pendingEntry.storedBytes.data() + chunkIndex * sizeof(uint64_t), &chunkOffset, sizeof(uint64_t));
+            if (chunkIndex < numChunks) chunkOffset += vecStoredChunks[chunkIndex].size();
+        }
+        for (const ::std::vector<Byte>& refStoredChunk : vecStoredChunks) {
+            pendingEntry.storedBytes.insert(pendingEntry.storedBytes.end(), refStoredChunk.begin(), refStoredChunk.end());
+        }
+    } break;
+
+    default: {
+        const char* errorMessage = "Unsupported archive compression.";
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
+    }
+    }
+
+    _vecPendingEntries.emplace_back(::std::move(pendingEntry));
+}
+
+/// @brief Write every added entry to an archive file.
+/// @param filePath The path of the archive to be written.
+/// @return `true` if the archive was written successfully.
+bool celerique::ArchiveWriter::write(const ::std::string& filePath) const {
+    /// @brief The pending entries ordered by name hash.
+    ::std::vector<size_t> vecSortedIndices(_vecPendingEntries.size());
+    ::std::iota(vecSortedIndices.begin(), vecSortedIndices.end(), 0);
+    ::std::sort(vecSortedIndices.begin(), vecSortedIndices.end(), [&](size_t lhs, size_t rhs) {
+        return _vecPendingEntries[lhs].nameHash < _vecPendingEntries[rhs].nameHash;
+    });
+
+    /// @brief The table of contents to be written.
+    ::std::vector<ArchiveTocEntry> vecTocEntries;
+    vecTocEntries.reserve(_vecPendingEntries.size());
+    /// @brief The offset of the next entry.
+    uint64_t offset = sizeof(ArchiveHeader);
+    for (size_t index : vecSortedIndices) {
+        /// @brief The entry being laid out.
+        const PendingEntry& refPendingEntry = _vecPendingEntries[index];
+        offset = alignToArchive(offset);
+        vecTocEntries.push_back(ArchiveTocEntry{
+            refPendingEntry.nameHash, offset, refPendingEntry.size, refPendingEntry.storedBytes.size(),
+            refPendingEntry.compression, refPendingEntry.chunkSize, 0
+        });
+        offset += refPendingEntry.storedBytes.size();
+    }
+
+    /// @brief The archive header.
+    ArchiveHeader header = {};
+    ::std::memcpy(header.magic, internal::archiveMagic, sizeof(header.magic));
+    header.version = internal::archiveVersion;
+    header.numEntries = static_cast<uint32_t>(vecTocEntries.size());
+    header.tocOffset = alignToArchive(offset);
+
+    /// @brief The output stream of the archive file.
+    ::std::ofstream streamArchive(filePath, ::std::ios::binary | ::std::ios::trunc);
+    if (!streamArchive.is_open()) {
+        celeriqueLogWarning("Failed to open archive file for writing: " + filePath);
+        return false;
+    }
+
+    /// @brief Zeroes written between aligned sections.
+    static const char padding[CELERIQUE_ARCHIVE_ALIGNMENT] = {};
+    streamArchive.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    /// @brief The number of bytes written so far.
+    uint64_t numBytesWritten = sizeof(header);
+    for (size_t i = 0; i < vecSortedIndices.size(); i++) {
+        /// @brief The stored bytes of the entry being written.
+        const ::std::vector<Byte>& refStoredBytes = _vecPendingEntries[vecSortedIndices[i]].storedBytes;
+        streamArchive.write(padding, static_cast<::std::streamsize>(vecTocEntries[i].offset - numBytesWritten));
+        streamArchive.write(refStoredBytes.data(), static_cast<::std::streamsize>(refStoredBytes.size()));
+        numBytesWritten = vecTocEntries[i].offset + refStoredBytes.size();
+    }
+    streamArchive.write(padding, static_cast<::std::streamsize>(header.tocOffset - numBytesWritten));
+    streamArchive.write(
+        reinterpret_cast<const char*>(vecTocEntries.data()),
+        static_cast<::std::streamsize>(vecTocEntries.size() * sizeof(ArchiveTocEntry))
+    );
+
+    if (!streamArchive.good()) {
+        celeriqueLogWarning("Failed to write archive file: " + filePath);
+        return false;
+    }
+    return true;
+}
+
+/// @brief Memory map an archive file.
+/// @param filePath The path of the archive.
+/// @return The shared pointer to the archive or `nullptr` if it could not be opened.
+::std::shared_ptr<::celerique::Archive> celerique::openArchive(const ::std::string& filePath) {
+    /// @brief The pointer to the start of the mapping.
+    const Byte* ptrMapping = nullptr;
+    /// @brief The size of the mapping.
+    size_t mappingSize = 0;
+    /// @brief The platform specific handle kept alive for the mapping.
+    Pointer ptrMappingHandle = 0;
+
+#if defined(CELERIQUE_FOR_WINDOWS)
+    /// @brief The handle to the opened file.
+    HANDLE fileHandle = CreateFileA(
+        filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL
+    );
+    if (fileHandle == INVALID_HANDLE_VALUE) {
+        celeriqueLogWarning("Failed to open archive: " + filePath);
+        return nullptr;
+    }
+    /// @brief The size of the opened file.
+    LARGE_INTEGER fileSize = {};
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(fileHandle);
+        celeriqueLogWarning("Failed to determine archive size: " + filePath);
+        return nullptr;
+    }
+    /// @brief The handle to the file mapping object.
+    HANDLE mappingHandle = CreateFileMappingA(fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+    // The mapping keeps the file open on its own.
+    CloseHandle(fileHandle);
+    if (mappingHandle == NULL) {
+        celeriqueLogWarning("Failed to map archive: " + filePath);
+        return nullptr;
+    }
+    ptrMapping = static_cast<const Byte*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+    if (ptrMapping == nullptr) {
+        CloseHandle(mappingHandle);
+        celeriqueLogWarning("Failed to map archive: " + filePath);
+        return nullptr;
+    }
+    mappingSize = static_cast<size_t>(fileSize.QuadPart);
+    ptrMappingHandle = reinterpret_cast<Pointer>(mappingHandle);
+#elif defined(CELERIQUE_FOR_POSIX_SYSTEMS)
+    /// @brief The descriptor of the opened file.
+    int fileDescriptor = ::open(filePath.c_str(), O_RDONLY);
+    if (fileDescriptor < 0) {
+        celeriqueLogWarning("Failed to open archive: " + filePath);
+        return nullptr;
+    }
+    /// @brief The status of the opened file.
+    struct stat fileStatus = {};
+    if (::fstat(fileDescriptor, &fileStatus) != 0 || fileStatus.st_size == 0) {
+        ::close(fileDescriptor);
+        celeriqueLogWarning("Failed to determine archive size: " + filePath);
+        return nullptr;
+    }
+    mappingSize = static_cast<size_t>(fileStatus.st_size);
+    /// @brief The raw mapping address.
+    void* ptrAddress = ::mmap(nullptr, mappingSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    // The mapping keeps the file open on its own.
+    ::close(fileDescriptor);
+    if (ptrAddress == MAP_FAILED) {
+        celeriqueLogWarning("Failed to map archive: " + filePath);
+        return nullptr;
+    }
+    ptrMapping = static_cast<const Byte*>(ptrAddress);
+#else
+    celeriqueLogWarning("Archives are not supported on this platform.");
+    return nullptr;
+#endif
+
+    if (!isValidArchive(ptrMapping, mappingSize)) {
+        unmapArchive(ptrMapping, mappingSize, ptrMappingHandle);
+        celeriqueLogWarning("Not a valid archive: " + filePath);
+        return nullptr;
+    }
+    return ::std::make_shared<Archive>(ptrMapping, mappingSize, ptrMappingHandle);
+}
\ No newline at end of file
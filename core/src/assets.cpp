@@ -0,0 +1,491 @@
+/*
+
+File: ./core/src/assets.cpp
+Author: Aldhinn Espinas
+Description: This source file contains implementations of the asynchronous asset loading system.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique/internal/assets.h>
+#include <celerique/events/engine.h>
+#include <celerique/logging.h>
+
+#include <utility>
+#include <exception>
+#include <algorithm>
+
+#if defined(CELERIQUE_FOR_POSIX_SYSTEMS)
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#else
+#include <fstream>
+#endif
+
+/// @brief Request an asset to be loaded in the background.
+/// @param filePath The path of the file to load the asset from.
+/// @param priority The priority of the load request.
+/// @param decoder The decoder run on a job worker.
+/// @param ptrRequester The pointer to the engine receiving the completion event, or `nullptr` to broadcast it
+/// to the process default engine.
+/// @return The identifier of the requested asset (already retained once).
+::celerique::AssetID celerique::internal::AssetManager::load(
+    const ::std::string& filePath, AssetPriority priority, AssetDecoder&& decoder, IEventListener* ptrRequester
+) {
+    /// @brief The identifier of the requested asset.
+    AssetID assetId = CELERIQUE_ASSET_ID_NULL;
+    {
+        ::std::unique_lock<::std::shared_mutex> writeLock(_recordsMutex);
+
+        /// @brief The iterator to the asset previously requested from the same file path.
+        auto iteratorAssetId = _mapFilePathToAssetId.find(filePath);
+        if (iteratorAssetId != _mapFilePathToAssetId.end()) {
+            assetId = iteratorAssetId->second;
+            /// @brief The record of the previously requested asset.
+            AssetRecord& refRecord = _mapAssetIdToRecord[assetId];
+            refRecord.refCount++;
+            // An asset already loaded completes for this requester right away.
+            if (refRecord.state == CELERIQUE_ASSET_STATE_READY) {
+                queueCompletionEvent(::std::make_shared<::celerique::event::AssetLoaded>(assetId), ptrRequester);
+                return assetId;
+            }
+            // A load still in flight also completes for this requester.
+            if (ptrRequester != nullptr && ::std::find(
+                refRecord.vecPtrRequesters.begin(), refRecord.vecPtrRequesters.end(), ptrRequester
+            ) == refRecord.vecPtrRequesters.end()) refRecord.vecPtrRequesters.push_back(ptrRequester);
+            // Only failed assets are requested again.
+            if (refRecord.state != CELERIQUE_ASSET_STATE_FAILED) return assetId;
+
+            if (decoder != nullptr) refRecord.decoder = ::std::move(decoder);
+            refRecord.state = CELERIQUE_ASSET_STATE_QUEUED;
+        } else {
+            assetId = ++_nextAssetId;
+            /// @brief The record of the newly requested asset.
+            AssetRecord& refRecord = _mapAssetIdToRecord[assetId];
+            refRecord.filePath = filePath;
+            refRecord.decoder = ::std::move(decoder);
+            refRecord.state = CELERIQUE_ASSET_STATE_QUEUED;
+            refRecord.refCount = 1;
+            if (ptrRequester != nullptr) refRecord.vecPtrRequesters.push_back(ptrRequester);
+            _mapFilePathToAssetId[filePath] = assetId;
+        }
+    }
+    {
+        ::std::lock_guard<::std::mutex> writeLock(_requestsMutex);
+        _queueRequests.push(AssetRequest{assetId, priority, _numSubmittedRequests++});
+    }
+    // Each submitted job services whichever request is the most important at the time it runs.
+    _ioThreadPool.submit([this]() { serviceNextRequest(); });
+
+    return assetId;
+}
+
+/// @brief Add a reference to an asset.
+/// @param assetId The identifier of the asset.
+void ::celerique::internal::AssetManager::retain(AssetID assetId) {
+    ::std::unique_lock<::std::shared_mutex> writeLock(_recordsMutex);
+
+    /// @brief The iterator to the asset's record.
+    auto iteratorRecord = _mapAssetIdToRecord.find(assetId);
+    if (iteratorRecord == _mapAssetIdToRecord.end()) return;
+    iteratorRecord->second.refCount++;
+}
+
+/// @brief Remove a reference to an asset. Frees the asset once no references remain.
+/// @param assetId The identifier of the asset.
+void ::celerique::internal::AssetManager::release(AssetID assetId) {
+    ::std::unique_lock<::std::shared_mutex> writeLock(_recordsMutex);
+
+    /// @brief The iterator to the asset's record.
+    auto iteratorRecord = _mapAssetIdToRecord.find(assetId);
+    if (iteratorRecord == _mapAssetIdToRecord.end()) return;
+    if (--iteratorRecord->second.refCount > 0) return;
+
+    // Pending reads and decodes of this asset are dropped once they find the record missing.
+    _mapFilePathToAssetId.erase(iteratorRecord->second.filePath);
+    _mapAssetIdToRecord.erase(iteratorRecord);
+    celeriqueLogTrace("Released asset " + ::std::to_string(assetId) + ".");
+}
+
+/// @brief The current loading state of an asset.
+/// @param assetId The identifier of the asset.
+/// @return The asset state value.
+::celerique::AssetState celerique::internal::AssetManager::state(AssetID assetId) {
+    ::std::shared_lock<::std::shared_mutex> readLock(_recordsMutex);
+
+    /// @brief The iterator to the asset's record.
+    auto iteratorRecord = _mapAssetIdToRecord.find(assetId);
+    if (iteratorRecord == _mapAssetIdToRecord.end()) return CELERIQUE_ASSET_STATE_NULL;
+    return iteratorRecord->second.state;
+}
+
+/// @brief Access the decoded data of an asset.
+/// @param assetId The identifier of the asset.
+/// @return The shared pointer to the decoded data or `nullptr` if not ready.
+::std::shared_ptr<void> celerique::internal::AssetManager::data(AssetID assetId) {
+    ::std::shared_lock<::std::shared_mutex> readLock(_recordsMutex);
+
+    /// @brief The iterator to the asset's record.
+    auto iteratorRecord = _mapAssetIdToRecord.find(assetId);
+    if (iteratorRecord == _mapAssetIdToRecord.end()) return nullptr;
+    return iteratorRecord->second.ptrData;
+}
+
+/// @brief Broadcast the completion events collected since the last call
+/// on the calling thread. Called by the engine once per update cycle.
+void ::celerique::internal::AssetManager::dispatchCompletedLoads() {
+    // Most updates have nothing to deliver, skip the lock then.
+    if (_atomicNumQueuedCompletionEvents.load(::std::memory_order_relaxed) == 0) return;
+    /// @brief The completion events to be broadcast in this call.
+    ::std::list<::std::shared_ptr<EventBase>> listCompletionEvents;
+    {
+        ::std::lock_guard<::std::mutex> writeLock(_completionMutex);
+        listCompletionEvents.swap(_listCompletionEvents);
+        _atomicNumQueuedCompletionEvents.fetch_sub(listCompletionEvents.size(), ::std::memory_order_relaxed);
+    }
+
+    for (const ::std::shared_ptr<EventBase>& ptrEvent : listCompletionEvents) {
+        broadcast(ptrEvent, CELERIQUE_EVENT_HANDLING_STRATEGY_BLOCKING);
+    }
+}
+
+/// @brief Deliver the completion events of the loads a requester asked for since the last call
+/// on the calling thread. Called by every engine once per update cycle.
+/// @param ptrRequester The pointer to the requester receiving its completion events.
+void ::celerique::internal::AssetManager::dispatchCompletedLoads(IEventListener* ptrRequester) {
+    // Most updates have nothing to deliver, skip the lock then.
+    if (_atomicNumQueuedCompletionEvents.load(::std::memory_order_relaxed) == 0) return;
+    /// @brief The completion events to be delivered in this call.
+    ::std::list<::std::shared_ptr<EventBase>> listCompletionEvents;
+    {
+        ::std::lock_guard<::std::mutex> writeLock(_completionMutex);
+
+        /// @brief The iterator to the requester's completion events.
+        auto iteratorCompletionEvents = _mapRequesterToListCompletionEvents.find(ptrRequester);
+        if (iteratorCompletionEvents == _mapRequesterToListCompletionEvents.end()) return;
+        listCompletionEvents.swap(iteratorCompletionEvents->second);
+        _atomicNumQueuedCompletionEvents.fetch_sub(listCompletionEvents.size(), ::std::memory_order_relaxed);
+    }
+
+    for (const ::std::shared_ptr<EventBase>& ptrEvent : listCompletionEvents) {
+        ptrRequester->onEvent(ptrEvent);
+    }
+}
+
+/// @brief Start collecting the completion events of the loads a requester asks for.
+/// @param ptrRequester The pointer to the requester.
+void ::celerique::internal::AssetManager::addRequester(IEventListener* ptrRequester) {
+    ::std::lock_guard<::std::mutex> writeLock(_completionMutex);
+    _mapRequesterToListCompletionEvents[ptrRequester];
+}
+
+/// @brief Stop collecting completion events for a requester and drop the ones not yet delivered.
+/// @param ptrRequester The pointer to the requester.
+void ::celerique::internal::AssetManager::removeRequester(IEventListener* ptrRequester) {
+    ::std::unique_lock<::std::shared_mutex> writeLock(_recordsMutex);
+    // A later requester at the same address must not receive loads it never asked for.
+    for (auto& pairAssetIdToRecord : _mapAssetIdToRecord) {
+        /// @brief The reference to the requesters of the asset.
+        ::std::vector<IEventListener*>& refVecPtrRequesters = pairAssetIdToRecord.second.vecPtrRequesters;
+        refVecPtrRequesters.erase(
+            ::std::remove(refVecPtrRequesters.begin(), refVecPtrRequesters.end(), ptrRequester),
+            refVecPtrRequesters.end()
+        );
+    }
+
+    ::std::lock_guard<::std::mutex> completionWriteLock(_completionMutex);
+    /// @brief The iterator to the requester's completion events.
+    auto iteratorCompletionEvents = _mapRequesterToListCompletionEvents.find(ptrRequester);
+    if (iteratorCompletionEvents == _mapRequesterToListCompletionEvents.end()) return;
+    _atomicNumQueuedCompletionEvents.fetch_sub(iteratorCompletionEvents->second.size(), ::std::memory_order_relaxed);
+    _mapRequesterToListCompletionEvents.erase(iteratorCompletionEvents);
+}
+
+/// @brief Gets the reference to the asset manager object.
+::celerique::internal::AssetManager& celerique::internal::AssetManager::getRef() {
+    /// @brief The singleton instance of the asset manager.
+    static AssetManager singletonInst;
+    return singletonInst;
+}
+
+/// @brief Pop the most important request from the queue and read its file.
+/// Runs on one of the I/O threads.
+void ::celerique::internal::AssetManager::serviceNextRequest() {
+    if (_atomicIsShuttingDown.load()) return;
+
+    /// @brief The request to be serviced.
+    AssetRequest request = {};
+    {
+        ::std::lock_guard<::std::mutex> writeLock(_requestsMutex);
+        if (_queueRequests.empty()) return;
+        request = _queueRequests.top();
+        _queueRequests.pop();
+    }
+
+    /// @brief The path of the file to be read.
+    ::std::string filePath;
+    {
+        ::std::unique_lock<::std::shared_mutex> writeLock(_recordsMutex);
+
+        /// @brief The iterator to the asset's record.
+        auto iteratorRecord = _mapAssetIdToRecord.find(request.assetId);
+        // The asset was released before it got its turn.
+        if (iteratorRecord == _mapAssetIdToRecord.end()) return;
+        iteratorRecord->second.state = CELERIQUE_ASSET_STATE_LOADING;
+        filePath = iteratorRecord->second.filePath;
+    }
+
+    /// @brief The raw contents of the asset's file.
+    ::std::vector<Byte> fileContents;
+    if (!readFile(filePath, fileContents)) {
+        celeriqueLogWarning("Failed to read asset file: " + filePath);
+        complete(request.assetId, nullptr);
+        return;
+    }
+
+    // Decoding is CPU bound so it is moved off the I/O threads.
+    /// @brief The identifier of the asset whose file was read.
+    AssetID assetId = request.assetId;
+    getJobWorkers().submit([this, assetId, fileContents = ::std::move(fileContents)]() mutable {
+        decode(assetId, ::std::move(fileContents));
+    });
+}
+
+/// @brief Run the decoder for the read file contents. Runs on a job worker.
+/// @param assetId The identifier of the asset.
+/// @param fileContents The raw contents of the asset's file.
+void ::celerique::internal::AssetManager::decode(AssetID assetId, ::std::vector<Byte>&& fileContents) {
+    /// @brief The decoder of the asset.
+    AssetDecoder decoder;
+    {
+        ::std::shared_lock<::std::shared_mutex> readLock(_recordsMutex);
+
+        /// @brief The iterator to the asset's record.
+        auto iteratorRecord = _mapAssetIdToRecord.find(assetId);
+        if (iteratorRecord == _mapAssetIdToRecord.end()) return;
+        decoder = iteratorRecord->second.decoder;
+    }
+
+    /// @brief The decoded asset data.
+    ::std::shared_ptr<void> ptrData;
+    try {
+        if (decoder == nullptr) {
+            ptrData = ::std::make_shared<::std::vector<Byte>>(::std::move(fileContents));
+        } else {
+            ptrData = decoder(::std::move(fileContents));
+        }
+    } catch (const ::std::exception& exception) {
+        celeriqueLogWarning("Failed to decode asset: " + ::std::string(exception.what()));
+        ptrData = nullptr;
+    }
+
+    complete(assetId, ::std::move(ptrData));
+}
+
+/// @brief Record the final state of an asset and queue its completion event.
+/// @param assetId The identifier of the asset.
+/// @param ptrData The decoded data or `nullptr` if the load failed.
+void ::celerique::internal::AssetManager::complete(AssetID assetId, ::std::shared_ptr<void>&& ptrData) {
+    {
+        ::std::unique_lock<::std::shared_mutex> writeLock(_recordsMutex);
+
+        /// @brief The iterator to the asset's record.
+        auto iteratorRecord = _mapAssetIdToRecord.find(assetId);
+        if (iteratorRecord == _mapAssetIdToRecord.end()) return;
+
+        /// @brief The completion event to be broadcast.
+        ::std::shared_ptr<EventBase> ptrEvent;
+        if (ptrData != nullptr) {
+            iteratorRecord->second.ptrData = ::std::move(ptrData);
+            iteratorRecord->second.state = CELERIQUE_ASSET_STATE_READY;
+            ptrEvent = ::std::make_shared<::celerique::event::AssetLoaded>(assetId);
+        } else {
+            iteratorRecord->second.state = CELERIQUE_ASSET_STATE_FAILED;
+            ptrEvent = ::std::make_shared<::celerique::event::AssetLoadFailed>(assetId);
+        }
+
+        // Queued while the state change is still exclusive so that an observed state always has its event pending.
+        /// @brief The requesters of the asset, which only receive the event themselves.
+        const ::std::vector<IEventListener*>& refVecPtrRequesters = iteratorRecord->second.vecPtrRequesters;
+        if (refVecPtrRequesters.empty()) {
+            queueCompletionEvent(::std::move(ptrEvent), nullptr);
+            return;
+        }
+        for (IEventListener* ptrRequester : refVecPtrRequesters) queueCompletionEvent(ptrEvent, ptrRequester);
+    }
+}
+
+/// @brief Queue a completion event for a requester. Called with `_recordsMutex` held exclusively.
+/// @param ptrEvent The shared pointer to the completion event.
+/// @param ptrRequester The pointer to the engine receiving the event, or `nullptr` to broadcast it
+/// to the process default engine.
+void ::celerique::internal::AssetManager::queueCompletionEvent(
+    ::std::shared_ptr<EventBase> ptrEvent, IEventListener* ptrRequester
+) {
+    ::std::lock_guard<::std::mutex> completionWriteLock(_completionMutex);
+    if (ptrRequester == nullptr) {
+        _listCompletionEvents.emplace_back(::std::move(ptrEvent));
+        _atomicNumQueuedCompletionEvents.fetch_add(1, ::std::memory_order_relaxed);
+        return;
+    }
+    /// @brief The iterator to the requester's completion events.
+    auto iteratorCompletionEvents = _mapRequesterToListCompletionEvents.find(ptrRequester);
+    if (iteratorCompletionEvents == _mapRequesterToListCompletionEvents.end()) return;
+    iteratorCompletionEvents->second.emplace_back(::std::move(ptrEvent));
+    _atomicNumQueuedCompletionEvents.fetch_add(1, ::std::memory_order_relaxed);
+}
+
+/// @brief Read the whole contents of a file.
+/// @param filePath The path of the file to be read.
+/// @param fileContents The container receiving the contents.
+/// @return `true` if the file was read successfully.
+bool celerique::internal::AssetManager::readFile(const ::std::string& filePath, ::std::vector<Byte>& fileContents) {
+#if defined(CELERIQUE_FOR_POSIX_SYSTEMS)
+    /// @brief The descriptor of the opened file.
+    int fileDescriptor = ::open(filePath.c_str(), O_RDONLY);
+    if (fileDescriptor < 0) return false;
+
+    /// @brief The status of the opened file.
+    struct stat fileStatus = {};
+    if (::fstat(fileDescriptor, &fileStatus) != 0) {
+        ::close(fileDescriptor);
+        return false;
+    }
+
+    /// @brief The size of the file in bytes.
+    size_t fileSize = static_cast<size_t>(fileStatus.st_size);
+    fileContents.resize(fileSize);
+
+    /// @brief The number of bytes read so far.
+    size_t numBytesRead = 0;
+    // Positional reads so that the I/O threads never share a file offset.
+    while (numBytesRead < fileSize) {
+        /// @brief The number of bytes read by this call.
+        ssize_t result = ::pread(
+            fileDescriptor, fileContents.data() + numBytesRead, fileSize - numBytesRead,
+            static_cast<off_t>(numBytesRead)
+        );
+        if (result < 0) {
+            if (errno == EINTR) continue;
+            ::close(fileDescriptor);
+            return false;
+        }
+        // The file got truncated while reading.
+        if (result == 0) break;
+        numBytesRead += static_cast<size_t>(result);
+    }
+    ::close(fileDescriptor);
+
+    fileContents.resize(numBytesRead);
+    return true;
+#else
+    /// @brief The input stream of the file.
+    ::std::basic_ifstream<Byte> streamFile(filePath, ::std::ios::binary | ::std::ios::ate);
+    if (!streamFile.is_open()) return false;
+
+    /// @brief The position at the end of the file.
+    ::std::streampos endOfFilePos = streamFile.tellg();
+    if (endOfFilePos == ::std::basic_ifstream<Byte>::pos_type(-1)) return false;
+    streamFile.seekg(0, ::std::ios::beg);
+
+    fileContents.resize(static_cast<size_t>(endOfFilePos));
+    if (!streamFile.read(fileContents.data(), static_cast<::std::streamsize>(endOfFilePos))) return false;
+    return true;
+#endif
+}
+
+/// @brief Private default constructor to prevent external instantiation.
+::celerique::internal::AssetManager::AssetManager() : _ioThreadPool(numAssetIoThreads) {
+    // Constructing the job workers first ensures they outlive this manager.
+    getJobWorkers();
+    celeriqueLogDebug("Initialized asset manager.");
+}
+
+/// @brief Private destructor to prevent external deletion.
+::celerique::internal::AssetManager::~AssetManager() {
+    _atomicIsShuttingDown.store(true, ::std::memory_order_release);
+    // Nothing may still be reading or decoding into this instance past this point.
+    _ioThreadPool.waitIdle();
+    getJobWorkers().waitIdle();
+    celeriqueLogDebug("Destroyed asset manager.");
+}
+
+/// @brief Member init constructor. Takes over an already retained reference.
+/// @param assetId The identifier of the asset being referred to.
+::celerique::AssetHandle::AssetHandle(AssetID assetId) : _assetId(assetId) {}
+
+/// @brief The current loading state of the asset.
+/// @return The asset state value.
+::celerique::AssetState celerique::AssetHandle::state() const {
+    if (_assetId == CELERIQUE_ASSET_ID_NULL) return CELERIQUE_ASSET_STATE_NULL;
+    return internal::AssetManager::getRef().state(_assetId);
+}
+
+/// @brief Access the type erased decoded asset data.
+/// @return The shared pointer to the decoded data or `nullptr` if not yet ready.
+::std::shared_ptr<void> celerique::AssetHandle::rawData() const {
+    if (_assetId == CELERIQUE_ASSET_ID_NULL) return nullptr;
+    return internal::AssetManager::getRef().data(_assetId);
+}
+
+/// @brief Copy constructor. Retains another reference to the asset.
+/// @param other The other handle to be copied.
+::celerique::AssetHandle::AssetHandle(const AssetHandle& other) : _assetId(other._assetId) {
+    if (_assetId != CELERIQUE_ASSET_ID_NULL) internal::AssetManager::getRef().retain(_assetId);
+}
+
+/// @brief Move constructor.
+/// @param other The r-value reference to the handle where the reference is moving from.
+::celerique::AssetHandle::AssetHandle(AssetHandle&& other) noexcept : _assetId(other._assetId) {
+    other._assetId = CELERIQUE_ASSET_ID_NULL;
+}
+
+/// @brief Copy re-assignment operator.
+/// @param other The other handle to be copied.
+/// @return The reference to this instance.
+::celerique::AssetHandle& celerique::AssetHandle::operator=(const AssetHandle& other) {
+    if (this == &other) return *this;
+
+    /// @brief The asset previously referred to.
+    AssetID prevAssetId = _assetId;
+    _assetId = other._assetId;
+    if (_assetId != CELERIQUE_ASSET_ID_NULL) internal::AssetManager::getRef().retain(_assetId);
+    if (prevAssetId != CELERIQUE_ASSET_ID_NULL) internal::AssetManager::getRef().release(prevAssetId);
+    return *this;
+}
+
+/// @brief Move re-assignment operator.
+/// @param other The r-value reference to the handle where the reference is moving from.
+/// @return The reference to this instance.
+::celerique::AssetHandle& celerique::AssetHandle::operator=(AssetHandle&& other) noexcept {
+    if (this == &other) return *this;
+
+    if (_assetId != CELERIQUE_ASSET_ID_NULL) internal::AssetManager::getRef().release(_assetId);
+    _assetId = other._assetId;
+    other._assetId = CELERIQUE_ASSET_ID_NULL;
+    return *this;
+}
+
+/// @brief Destructor. Releases the reference to the asset.
+::celerique::AssetHandle::~AssetHandle() {
+    if (_assetId != CELERIQUE_ASSET_ID_NULL) internal::AssetManager::getRef().release(_assetId);
+}
+
+/// @brief Request an asset to be loaded in the background. Requesting an
+/// already requested file path returns another handle to the same asset.
+/// Completion is broadcast as either an `event::AssetLoaded` or an
+/// `event::AssetLoadFailed` engine event to the process default engine,
+/// even for an asset that already finished loading. Layers load through
+/// `ApplicationLayerBase::loadAsset` to have it reach their own engine.
+/// @param filePath The path of the file to load the asset from.
+/// @param priority The priority of the load request.
+/// @param decoder The decoder run on a job worker. Defaults to storing the raw bytes as a `::std::vector<Byte>`.
+/// @return The handle to the requested asset.
+::celerique::AssetHandle celerique::loadAsset(
+    const ::std::string& filePath, AssetPriority priority, AssetDecoder&& decoder
+) {
+    return AssetHandle(internal::AssetManager::getRef().load(filePath, priority, ::std::move(decoder), nullptr));
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+/*
+
+File: ./core/src/background.cpp
+Author: Aldhinn Espinas
+Description: This source file contains the background work scheduler implementations.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique/internal/background.h>
+#include <celerique/internal/engine.h>
+#include <celerique/logging.h>
+
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+/// @brief The weight of the latest update in `BackgroundSchedulerStats::averageUtilization`.
+#define UTILIZATION_AVERAGE_WEIGHT                                                          0.1
+
+/// @brief Queue background work. Safe to call from any thread.
+/// @param task The background work.
+/// @param priority The priority of the work.
+void ::celerique::internal::BackgroundScheduler::submit(BackgroundTask&& task, BackgroundPriority priority) {
+    if (priority >= CELERIQUE_NUM_BACKGROUND_PRIORITIES) {
+        /// @brief The error message.
+        ::std::string errorMsg = "Unknown background priority " + ::std::to_string(priority) + ".";
+        celeriqueLogError(errorMsg);
+        throw ::std::out_of_range(errorMsg);
+    }
+    ::std::lock_guard<::std::mutex> writeLock(_tasksMutex);
+    _arrQueueTasks[priority].emplace_back(::std::move(task));
+    _atomicNumPendingTasks.fetch_add(1, ::std::memory_order_release);
+}
+
+/// @brief Run slices of the waiting work, highest priority first and round robin within a
+/// priority, until the budget is spent. Runs at least one slice if any work is waiting.
+/// Called on the update thread.
+/// @param budget The time the update has left.
+void ::celerique::internal::BackgroundScheduler::runSlices(::std::chrono::nanoseconds budget) {
+    // Most updates have nothing waiting, skip locking then.
+    if (_atomicNumPendingTasks.load(::std::memory_order_acquire) == 0) return;
+
+    /// @brief When the slices started.
+    ::std::chrono::steady_clock::time_point start = ::std::chrono::steady_clock::now();
+    /// @brief When the budget is spent.
+    ::std::chrono::steady_clock::time_point deadline = start + budget;
+    /// @brief The number of slices run in this update.
+    uint64_t numSlicesRun = 0;
+    /// @brief The number of tasks finished in this update.
+    uint64_t numTasksCompleted = 0;
+    /// @brief The number of tasks dropped after throwing in this update.
+    uint64_t numTasksFailed = 0;
+    /// @brief The current time, updated after every slice.
+    ::std::chrono::steady_clock::time_point now = start;
+    do {
+        /// @brief The work to run a slice of.
+        BackgroundTask task;
+        /// @brief The priority of the work.
+        BackgroundPriority priority = CELERIQUE_NUM_BACKGROUND_PRIORITIES;
+        {
+            ::std::lock_guard<::std::mutex> writeLock(_tasksMutex);
+            for (BackgroundPriority candidate = CELERIQUE_NUM_BACKGROUND_PRIORITIES; candidate > 0; candidate--) {
+                if (_arrQueueTasks[candidate - 1].empty()) continue;
+                priority = candidate - 1;
+                task = ::std::move(_arrQueueTasks[priority].front());
+                _arrQueueTasks[priority].pop_front();
+                break;
+            }
+        }
+        if (priority == CELERIQUE_NUM_BACKGROUND_PRIORITIES) break;
+
+        /// @brief Whether the work finished.
+        bool isFinished = false;
+        /// @brief Whether the work threw.
+        bool isFailed = false;
+        // Run outside the lock so the work may submit more work.
+        try {
+            isFinished = task();
+        } catch (const ::std::exception& exception) {
+            celeriqueLogError(::std::string("A background task threw: ") + exception.what());
+            isFailed = true;
+        } catch (...) {
+            celeriqueLogError("A background task threw an unknown exception.");
+            isFailed = true;
+        }
+        numSlicesRun++;
+        if (isFinished || isFailed) {
+            if (isFailed) numTasksFailed++;
+            else numTasksCompleted++;
+            _atomicNumPendingTasks.fetch_sub(1, ::std::memory_order_release);
+        } else {
+            // Requeue behind the other work of the same priority.
+            ::std::lock_guard<::std::mutex> writeLock(_tasksMutex);
+            _arrQueueTasks[priority].emplace_back(::std::move(task));
+        }
+        now = ::std::chrono::steady_clock::now();
+    } while (now < deadline);
+
+    ::std::lock_guard<::std::mutex> writeLock(_tasksMutex);
+    _stats.lastBudget = budget;
+    _stats.lastUsed = ::std::chrono::duration_cast<::std::chrono::nanoseconds>(now - start);
+    /// @brief The utilization of this update. A zero budget with a slice run is fully used.
+    double utilization = budget.count() > 0 ?
+        static_cast<double>(_stats.lastUsed.count()) / static_cast<double>(budget.count()) : 1.0;
+    _stats.averageUtilization += (utilization - _stats.averageUtilization) * UTILIZATION_AVERAGE_WEIGHT;
+    _stats.numSlicesRun += numSlicesRun;
+    _stats.numTasksCompleted += numTasksCompleted;
+    _stats.numTasksFailed += numTasksFailed;
+}
+
+/// @brief The statistics of the scheduler.
+/// @return A copy of the statistics.
+::celerique::BackgroundSchedulerStats celerique::internal::BackgroundScheduler::stats() {
+    ::std::lock_guard<::std::mutex> readLock(_tasksMutex);
+    /// @brief The copy of the statistics.
+    BackgroundSchedulerStats stats = _stats;
+    stats.numPendingTasks = _atomicNumPendingTasks.load();
+    return stats;
+}
+
+/// @brief Submit background work to be run in slices on the update thread after the layers and windows
+/// updated and the frame was rendered or handed to the render thread, until the frame's remaining time is spent.
+/// @param task The background work. A task throwing is logged as an error, counted as failed and dropped.
+/// @param priority The priority of the work.
+void ::celerique::submitBackgroundTask(BackgroundTask&& task, BackgroundPriority priority) {
+    internal::Engine::getRef().backgroundScheduler().submit(::std::move(task), priority);
+}
+
+/// @brief The statistics of the background work scheduler.
+/// @return A copy of the statistics.
+::celerique::BackgroundSchedulerStats celerique::backgroundSchedulerStats() {
+    return internal::Engine::getRef().backgroundScheduler().stats();
+}
+
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
@@ -0,0 +1,597 @@
+/*
+
+File: ./core/src/bridge.cpp
+Author: Aldhinn Espinas
+Description: This source file contains implementations of the shared memory event rings and the event bridge layer.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#if defined(CELERIQUE_FOR_POSIX_SYSTEMS)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#if defined(CELERIQUE_FOR_LINUX_SYSTEMS)
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+/// @brief The magic number marking a fully initialized event ring ("CLER").
+#define EVENT_RING_MAGIC                                                                    0x52454C43
+/// @brief How long a side sleeps between checks where futexes are not available.
+#define EVENT_RING_POLL_INTERVAL_MICROSECS                                                  100
+
+/// @brief The start of an event ring's shared memory, followed by the records.
+/// The producer's and the consumer's counters live on separate cache lines.
+struct EventRingHeader {
+    /// @brief `EVENT_RING_MAGIC` once the creator initialized the ring.
+    ::std::atomic<uint32_t> atomicMagic;
+    /// @brief The number of records the ring holds at most, a power of 2.
+    uint32_t capacity;
+    /// @brief The number of records pushed so far, wrapping around. Written by the producer.
+    alignas(64) ::std::atomic<uint32_t> atomicHead;
+    /// @brief Whether the consumer sleeps waiting for `atomicHead` to change.
+    ::std::atomic<uint32_t> atomicIsConsumerWaiting;
+    /// @brief The number of records popped so far, wrapping around. Written by the consumer.
+    alignas(64) ::std::atomic<uint32_t> atomicTail;
+    /// @brief Whether the producer sleeps waiting for `atomicTail` to change.
+    ::std::atomic<uint32_t> atomicIsProducerWaiting;
+};
+
+static_assert(sizeof(::celerique::BridgeEventRecord) == 64, "Event records must fill one cache line.");
+static_assert(sizeof(EventRingHeader) % 64 == 0, "Event ring records must start on a cache line.");
+static_assert(
+    ::std::atomic<uint32_t>::is_always_lock_free,
+    "Event rings need lock free atomics to be shared between processes."
+);
+
+/// @brief Sleep until a counter in shared memory no longer holds a value, or a deadline passed.
+/// @param atomicCounter The counter.
+/// @param value The value the counter held when the caller decided to wait.
+/// @param deadline When to stop waiting.
+static void waitWhileEquals(
+    ::std::atomic<uint32_t>& atomicCounter, uint32_t value, ::std::chrono::steady_clock::time_point deadline
+) {
+    /// @brief The time left until the deadline.
+    ::std::chrono::nanoseconds remaining = deadline - ::std::chrono::steady_clock::now();
+    if (remaining <= ::std::chrono::nanoseconds::zero()) return;
+#if defined(CELERIQUE_FOR_LINUX_SYSTEMS)
+    /// @brief The relative timeout of the futex.
+    struct timespec timeout = {
+        static_cast<time_t>(remaining.count() / 1000000000), static_cast<long>(remaining.count() % 1000000000)
+    };
+    // The kernel only puts the thread to sleep if the counter still holds the value, so a wake up
+    // between the caller's last check and this call is never missed. Spurious returns are re-checked by the caller.
+    ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&atomicCounter), FUTEX_WAIT, value, &timeout, nullptr, 0);
+#else
+    if (atomicCounter.load(::std::memory_order_acquire) == value) {
+        ::std::this_thread::sleep_for(::std::min(
+            remaining, ::std::chrono::nanoseconds(::std::chrono::microseconds(EVENT_RING_POLL_INTERVAL_MICROSECS))
+        ));
+    }
+#endif
+}
+
+/// @brief Wake the other side sleeping on a counter in shared memory.
+/// @param atomicCounter The counter.
+static void wakeWaiter(::std::atomic<uint32_t>& atomicCounter) {
+#if defined(CELERIQUE_FOR_LINUX_SYSTEMS)
+    ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&atomicCounter), FUTEX_WAKE, 1, nullptr, nullptr, 0);
+#endif
+}
+
+/// @brief The serializers of every event type crossing processes.
+class BridgeEventRegistry final {
+public:
+    /// @brief How an event type crosses processes.
+    struct Entry {
+        /// @brief The identifier of the event type in records.
+        ::celerique::BridgeEventType type;
+        /// @brief Writes the event's fields.
+        ::celerique::BridgeEventSerializer serializer;
+        /// @brief Creates the event from the fields.
+        ::celerique::BridgeEventDeserializer deserializer;
+    };
+
+    /// @brief Register an event type, replacing an earlier registration of the same type.
+    /// @param type The identifier of the event type in records.
+    /// @param typeId The type of the event.
+    /// @param serializer Writes the event's fields.
+    /// @param deserializer Creates the event from the fields.
+    void add(
+        ::celerique::BridgeEventType type, ::std::type_index typeId,
+        ::celerique::BridgeEventSerializer&& serializer, ::celerique::BridgeEventDeserializer&& deserializer
+    ) {
+        ::std::lock_guard<::std::mutex> lock(_mutex);
+        /// @brief The registration.
+        ::std::shared_ptr<const Entry> ptrEntry = ::std::make_shared<const Entry>(
+            Entry{type, ::std::move(serializer), ::std::move(deserializer)}
+        );
+        _mapEntriesByTypeId[typeId] = ptrEntry;
+        _mapEntriesByType[type] = ptrEntry;
+    }
+    /// @brief Find the registration of an event's type.
+    /// @param typeId The type of the event.
+    /// @return The registration, or null if the type is not registered.
+    ::std::shared_ptr<const Entry> find(::std::type_index typeId) {
+        ::std::lock_guard<::std::mutex> lock(_mutex);
+        /// @brief The registration found.
+        auto iterator = _mapEntriesByTypeId.find(typeId);
+        return iterator == _mapEntriesByTypeId.end() ? nullptr : iterator->second;
+    }
+    /// @brief Find the registration of a record's type.
+    /// @param type The identifier of the event type in records.
+    /// @return The registration, or null if the type is not registered.
+    ::std::shared_ptr<const Entry> find(::celerique::BridgeEventType type) {
+        ::std::lock_guard<::std::mutex> lock(_mutex);
+        /// @brief The registration found.
+        auto iterator = _mapEntriesByType.find(type);
+        return iterator == _mapEntriesByType.end() ? nullptr : iterator->second;
+    }
+
+    /// @brief Gets the reference to the registry, with the engine's own events registered.
+    /// @return The reference to the registry.
+    static BridgeEventRegistry& getRef() {
+        /// @brief The singleton instance of the registry.
+        static BridgeEventRegistry singletonInst;
+        return singletonInst;
+    }
+
+// Private helper functions.
+private:
+    /// @brief Register an event type without fields.
+    /// @tparam TEvent The type of the event.
+    /// @param type The identifier of the event type in records.
+    template<typename TEvent>
+    void addEmpty(::celerique::BridgeEventType type) {
+        add(
+            type, ::std::type_index(typeid(TEvent)),
+            [](const ::celerique::EventBase&, ::celerique::BridgeEventRecord&) { return true; },
+            [](const ::celerique::BridgeEventRecord&) { return ::std::make_shared<TEvent>(); }
+        );
+    }
+    /// @brief Register an event type with two fields passed to its constructor.
+    /// @tparam TEvent The type of the event.
+    /// @tparam TFirst The type of the first field.
+    /// @tparam TSecond The type of the second field.
+    /// @param type The identifier of the event type in records.
+    /// @param getFields Reads the fields of an event.
+    template<typename TEvent, typename TFirst, typename TSecond>
+    void addPair(::celerique::BridgeEventType type, ::std::pair<TFirst, TSecond>(*getFields)(const TEvent&)) {
+        add(
+            type, ::std::type_index(typeid(TEvent)),
+            [getFields](const ::celerique::EventBase& event, ::celerique::BridgeEventRecord& record) {
+                /// @brief The fields of the event.
+                ::std::pair<TFirst, TSecond> fields = getFields(dynamic_cast<const TEvent&>(event));
+                return record.write(fields.first) && record.write(fields.second);
+            },
+            [](const ::celerique::BridgeEventRecord& record) -> ::std::shared_ptr<::celerique::EventBase> {
+                /// @brief The offset of the next field.
+                size_t offset = 0;
+                /// @brief The fields of the event.
+                TFirst first;
+                TSecond second;
+                if (!record.read(offset, first) || !record.read(offset, second)) return nullptr;
+                return ::std::make_shared<TEvent>(first, second);
+            }
+        );
+    }
+
+// Private member variables.
+private:
+    /// @brief Guards the registrations.
+    ::std::mutex _mutex;
+    /// @brief The registrations by event type.
+    ::std::unordered_map<::std::type_index, ::std::shared_ptr<const Entry>> _mapEntriesByTypeId;
+    /// @brief The registrations by identifier in records.
+    ::std::unordered_map<::celerique::BridgeEventType, ::std::shared_ptr<const Entry>> _mapEntriesByType;
+
+public:
+    /// @brief Default constructor. Registers the engine's own events.
+    BridgeEventRegistry() {
+        using namespace ::celerique::event;
+        addPair<KeyboardKeyPressed, KeyCode, bool>(
+            CELERIQUE_BRIDGE_EVENT_TYPE_KEYBOARD_KEY_PRESSED,
+            [](const KeyboardKeyPressed& event) { return ::std::make_pair(event.keyCode(), event.repeating()); }
+        );
+        add(
+            CELERIQUE_BRIDGE_EVENT_TYPE_KEYBOARD_KEY_RELEASED, ::std::type_index(typeid(KeyboardKeyReleased)),
+            [](const ::celerique::EventBase& event, ::celerique::BridgeEventRecord& record) {
+                return record.write(dynamic_cast<const KeyboardKeyReleased&>(event).keyCode());
+            },
+            [](const ::celerique::BridgeEventRecord& record) -> ::std::shared_ptr<::celerique::EventBase> {
+                /// @brief The offset of the next field.
+                size_t offset = 0;
+                /// @brief The key released.
+                KeyCode keyCode;
+                if (!record.read(offset, keyCode)) return nullptr;
+                return ::std::make_shared<KeyboardKeyReleased>(keyCode);
+            }
+        );
+        addPair<MouseMoved, PixelUnits, PixelUnits>(
+            CELERIQUE_BRIDGE_EVENT_TYPE_MOUSE_MOVED,
+            [](const MouseMoved& event) { return ::std::make_pair(event.deltaX(), event.deltaY()); }
+        );
+        // Clicks and releases carry a button besides the position.
+        for (::celerique::BridgeEventType type : {CELERIQUE_BRIDGE_EVENT_TYPE_MOUSE_CLICKED, CELERIQUE_BRIDGE_EVENT_TYPE_MOUSE_RELEASED}) {
+            /// @brief Whether the events are clicks.
+            bool isClick = type == CELERIQUE_BRIDGE_EVENT_TYPE_MOUSE_CLICKED;
+            add(
+                type, isClick ? ::std::type_index(typeid(MouseClicked)) : ::std::type_index(typeid(MouseReleased)),
+                [isClick](const ::celerique::EventBase& event, ::celerique::BridgeEventRecord& record) {
+                    /// @brief The button and the position.
+                    MouseButton button = isClick ? dynamic_cast<const MouseClicked&>(event).button() :
+                        dynamic_cast<const MouseReleased&>(event).button();
+                    /// @brief The position of the cursor.
+                    const CursorPointed& pointed = dynamic_cast<const CursorPointed&>(event);
+                    return record.write(button) && record.write(pointed.xPos()) && record.write(pointed.yPos());
+                },
+                [isClick](const ::celerique::BridgeEventRecord& record) -> ::std::shared_ptr<::celerique::EventBase> {
+                    /// @brief The offset of the next field.
+                    size_t offset = 0;
+                    /// @brief The button and the position.
+                    MouseButton button;
+                    PixelUnits xPos, yPos;
+                    if (!record.read(offset, button) || !record.read(offset, xPos) || !record.read(offset, yPos)) {
+                        return nullptr;
+                    }
+                    if (isClick) return ::std::make_shared<MouseClicked>(button, xPos, yPos);
+                    return ::std::make_shared<MouseReleased>(button, xPos, yPos);
+                }
+            );
+        }
+        addPair<MouseScrolled, float, float>(
+            CELERIQUE_BRIDGE_EVENT_TYPE_MOUSE_SCROLLED,
+            [](const MouseScrolled& event) { return ::std::make_pair(event.deltaX(), event.deltaY()); }
+        );
+        addPair<WindowResize, PixelUnits, PixelUnits>(
+            CELERIQUE_BRIDGE_EVENT_TYPE_WINDOW_RESIZE,
+            [](const WindowResize& event) { return ::std::make_pair(event.width(), event.height()); }
+        );
+        addPair<WindowMove, PixelUnits, PixelUnits>(
+            CELERIQUE_BRIDGE_EVENT_TYPE_WINDOW_MOVE,
+            [](const WindowMove& event) { return ::std::make_pair(event.xPos(), event.yPos()); }
+        );
+        addEmpty<WindowClose>(CELERIQUE_BRIDGE_EVENT_TYPE_WINDOW_CLOSE);
+        addEmpty<WindowRequestClose>(CELERIQUE_BRIDGE_EVENT_TYPE_WINDOW_REQUEST_CLOSE);
+        addEmpty<WindowMinimized>(CELERIQUE_BRIDGE_EVENT_TYPE_WINDOW_MINIMIZED);
+        addEmpty<WindowFocused>(CELERIQUE_BRIDGE_EVENT_TYPE_WINDOW_FOCUSED);
+        addEmpty<EngineShutdown>(CELERIQUE_BRIDGE_EVENT_TYPE_ENGINE_SHUTDOWN);
+        for (::celerique::BridgeEventType type : {CELERIQUE_BRIDGE_EVENT_TYPE_ASSET_LOADED, CELERIQUE_BRIDGE_EVENT_TYPE_ASSET_LOAD_FAILED}) {
+            /// @brief Whether the events are successful loads.
+            bool isLoaded = type == CELERIQUE_BRIDGE_EVENT_TYPE_ASSET_LOADED;
+            add(
+                type, isLoaded ? ::std::type_index(typeid(AssetLoaded)) : ::std::type_index(typeid(AssetLoadFailed)),
+                [isLoaded](const ::celerique::EventBase& event, ::celerique::BridgeEventRecord& record) {
+                    return record.write(static_cast<uint64_t>(
+                        isLoaded ? dynamic_cast<const AssetLoaded&>(event).assetId() :
+                        dynamic_cast<const AssetLoadFailed&>(event).assetId()
+                    ));
+                },
+                [isLoaded](const ::celerique::BridgeEventRecord& record) -> ::std::shared_ptr<::celerique::EventBase> {
+                    /// @brief The offset of the next field.
+                    size_t offset = 0;
+                    /// @brief The identifier of the asset.
+                    uint64_t assetId;
+                    if (!record.read(offset, assetId)) return nullptr;
+                    if (isLoaded) return ::std::make_shared<AssetLoaded>(static_cast<::celerique::AssetID>(assetId));
+                    return ::std::make_shared<AssetLoadFailed>(static_cast<::celerique::AssetID>(assetId));
+                }
+            );
+        }
+    }
+};
+
+/// @brief Register how an application defined event type crosses processes.
+/// @param type The identifier of the event type, from `CELERIQUE_BRIDGE_EVENT_TYPE_CUSTOM` on.
+/// @param typeId The type of the event, as returned by its `typeID`.
+/// @param serializer Writes the event's fields.
+/// @param deserializer Creates the event from the fields.
+void ::celerique::registerBridgeEventType(
+    BridgeEventType type, ::std::type_index typeId,
+    BridgeEventSerializer&& serializer, BridgeEventDeserializer&& deserializer
+) {
+    if (type < CELERIQUE_BRIDGE_EVENT_TYPE_CUSTOM) {
+        celeriqueLogWarning("Bridge event type " + ::std::to_string(type) + " is reserved for the engine's own events.");
+        return;
+    }
+    BridgeEventRegistry::getRef().add(type, typeId, ::std::move(serializer), ::std::move(deserializer));
+}
+
+/// @brief Serialize an event into a record.
+/// @param event The event to be serialized.
+/// @param record The record to be overwritten.
+/// @return `false` if the event's type is not registered or its fields do not fit.
+bool celerique::serializeBridgeEvent(const EventBase& event, BridgeEventRecord& record) {
+    /// @brief The registration of the event's type.
+    ::std::shared_ptr<const BridgeEventRegistry::Entry> ptrEntry = BridgeEventRegistry::getRef().find(event.typeID());
+    if (ptrEntry == nullptr) return false;
+    record.type = ptrEntry->type;
+    record.payloadSize = 0;
+    record.sourceWindowId = event.sourceWindowId();
+    return ptrEntry->serializer(event, record);
+}
+
+/// @brief Create the event a record holds.
+/// @param record The record.
+/// @return The shared pointer to the event, or null if the type is not registered or the payload is malformed.
+::std::shared_ptr<::celerique::EventBase> celerique::deserializeBridgeEvent(const BridgeEventRecord& record) {
+    if (record.payloadSize > CELERIQUE_BRIDGE_EVENT_PAYLOAD_SIZE) return nullptr;
+    /// @brief The registration of the record's type.
+    ::std::shared_ptr<const BridgeEventRegistry::Entry> ptrEntry = BridgeEventRegistry::getRef().find(record.type);
+    if (ptrEntry == nullptr) return nullptr;
+    /// @brief The event the record holds.
+    ::std::shared_ptr<EventBase> ptrEvent = ptrEntry->deserializer(record);
+    if (ptrEvent != nullptr) ptrEvent->setSourceWindowId(record.sourceWindowId);
+    return ptrEvent;
+}
+
+/// @brief Append a record without waiting. Called by the producer only.
+/// @param record The record.
+/// @return `false` if the ring is full.
+bool celerique::SharedEventRing::tryPush(const BridgeEventRecord& record) {
+    /// @brief The header of the ring.
+    EventRingHeader* ptrHeader = reinterpret_cast<EventRingHeader*>(_ptrMapping);
+    /// @brief The number of records pushed so far.
+    uint32_t head = ptrHeader->atomicHead.load(::std::memory_order_relaxed);
+    if (head - ptrHeader->atomicTail.load(::std::memory_order_acquire) >= ptrHeader->capacity) return false;
+
+    ::std::memcpy(
+        _ptrMapping + sizeof(EventRingHeader) + (head & (ptrHeader->capacity - 1)) * sizeof(BridgeEventRecord),
+        &record, sizeof(BridgeEventRecord)
+    );
+    // Publishing the head and checking for a sleeping consumer must not be reordered,
+    // or the consumer could fall asleep right after the check.
+    ptrHeader->atomicHead.store(head + 1, ::std::memory_order_seq_cst);
+    if (ptrHeader->atomicIsConsumerWaiting.load(::std::memory_order_seq_cst) != 0) wakeWaiter(ptrHeader->atomicHead);
+    return true;
+}
+
+/// @brief Append a record, waiting for space if the ring is full. Called by the producer only.
+/// @param record The record.
+/// @param timeout How long to wait at most.
+/// @return `false` if the ring stayed full.
+bool celerique::SharedEventRing::push(const BridgeEventRecord& record, ::std::chrono::nanoseconds timeout) {
+    /// @brief The header of the ring.
+    EventRingHeader* ptrHeader = reinterpret_cast<EventRingHeader*>(_ptrMapping);
+    /// @brief When to give up.
+    ::std::chrono::steady_clock::time_point deadline = ::std::chrono::steady_clock::now() + timeout;
+    while (!tryPush(record)) {
+        if (::std::chrono::steady_clock::now() >= deadline) return false;
+        ptrHeader->atomicIsProducerWaiting.store(1, ::std::memory_order_seq_cst);
+        /// @brief The number of records popped, as seen before sleeping.
+        uint32_t tail = ptrHeader->atomicTail.load(::std::memory_order_seq_cst);
+        if (ptrHeader->atomicHead.load(::std::memory_order_relaxed) - tail >= ptrHeader->capacity) {
+            waitWhileEquals(ptrHeader->atomicTail, tail, deadline);
+        }
+        ptrHeader->atomicIsProducerWaiting.store(0, ::std::memory_order_relaxed);
+    }
+    return true;
+}
+
+/// @brief Take the oldest record without waiting. Called by the consumer only.
+/// @param record Receives the record.
+/// @return `false` if the ring is empty.
+bool celerique::SharedEventRing::tryPop(BridgeEventRecord& record) {
+    /// @brief The header of the ring.
+    EventRingHeader* ptrHeader = reinterpret_cast<EventRingHeader*>(_ptrMapping);
+    /// @brief The number of records popped so far.
+    uint32_t tail = ptrHeader->atomicTail.load(::std::memory_order_relaxed);
+    if (ptrHeader->atomicHead.load(::std::memory_order_acquire) == tail) return false;
+
+    ::std::memcpy(
+        &record, _ptrMapping + sizeof(EventRingHeader) + (tail & (ptrHeader->capacity - 1)) * sizeof(BridgeEventRecord),
+        sizeof(BridgeEventRecord)
+    );
+    ptrHeader->atomicTail.store(tail + 1, ::std::memory_order_seq_cst);
+    if (ptrHeader->atomicIsProducerWaiting.load(::std::memory_order_seq_cst) != 0) wakeWaiter(ptrHeader->atomicTail);
+    return true;
+}
+
+/// @brief Take the oldest record, waiting for one if the ring is empty. Called by the consumer only.
+/// @param record Receives the record.
+/// @param timeout How long to wait at most.
+/// @return `false` if the ring stayed empty.
+bool celerique::SharedEventRing::pop(BridgeEventRecord& record, ::std::chrono::nanoseconds timeout) {
+    /// @brief The header of the ring.
+    EventRingHeader* ptrHeader = reinterpret_cast<EventRingHeader*>(_ptrMapping);
+    /// @brief When to give up.
+    ::std::chrono::steady_clock::time_point deadline = ::std::chrono::steady_clock::now() + timeout;
+    while (!tryPop(record)) {
+        if (::std::chrono::steady_clock::now() >= deadline) return false;
+        ptrHeader->atomicIsConsumerWaiting.store(1, ::std::memory_order_seq_cst);
+        /// @brief The number of records pushed, as seen before sleeping.
+        uint32_t head = ptrHeader->atomicHead.load(::std::memory_order_seq_cst);
+        if (head == ptrHeader->atomicTail.load(::std::memory_order_relaxed)) {
+            waitWhileEquals(ptrHeader->atomicHead, head, deadline);
+        }
+        ptrHeader->atomicIsConsumerWaiting.store(0, ::std::memory_order_relaxed);
+    }
+    return true;
+}
+
+/// @brief The number of records the ring holds at most.
+/// @return The capacity, a power of 2.
+uint32_t celerique::SharedEventRing::capacity() const {
+    return reinterpret_cast<const EventRingHeader*>(_ptrMapping)->capacity;
+}
+
+/// @brief The number of records waiting. Only exact when called by the producer or the consumer.
+/// @return The number of records.
+uint32_t celerique::SharedEventRing::size() const {
+    /// @brief The header of the ring.
+    const EventRingHeader* ptrHeader = reinterpret_cast<const EventRingHeader*>(_ptrMapping);
+    return ptrHeader->atomicHead.load(::std::memory_order_acquire) - ptrHeader->atomicTail.load(::std::memory_order_acquire);
+}
+
+/// @brief Member init constructor.
+/// @param ptrMapping The pointer to the start of the mapped shared memory.
+/// @param mappingSize The size of the mapping.
+/// @param name The name of the shared memory.
+/// @param isOwner Whether the shared memory is removed with this instance.
+::celerique::SharedEventRing::SharedEventRing(Byte* ptrMapping, size_t mappingSize, const ::std::string& name, bool isOwner) :
+_ptrMapping(ptrMapping), _mappingSize(mappingSize), _name(name), _isOwner(isOwner) {}
+
+/// @brief Destructor. Unmaps the shared memory, removing its name if this instance created it.
+::celerique::SharedEventRing::~SharedEventRing() {
+#if defined(CELERIQUE_FOR_POSIX_SYSTEMS)
+    ::munmap(_ptrMapping, _mappingSize);
+    if (_isOwner) ::shm_unlink(_name.c_str());
+#endif
+}
+
+/// @brief Create a named shared memory event ring.
+/// @param name The name of the shared memory, such as `/my-game-input`.
+/// @param capacity The number of records the ring holds at most, rounded up to a power of 2.
+/// @return The shared pointer to the ring, or `nullptr` if it could not be created.
+::std::shared_ptr<::celerique::SharedEventRing> celerique::createEventRing(const ::std::string& name, uint32_t capacity) {
+#if defined(CELERIQUE_FOR_POSIX_SYSTEMS)
+    if (capacity == 0 || capacity > (UINT32_C(1) << 24)) {
+        celeriqueLogWarning("Event ring capacity must be between 1 and 16777216 records.");
+        return nullptr;
+    }
+    /// @brief The capacity rounded up to a power of 2.
+    uint32_t roundedCapacity = 1;
+    while (roundedCapacity < capacity) roundedCapacity <<= 1;
+    /// @brief The size of the shared memory.
+    size_t mappingSize = sizeof(EventRingHeader) + static_cast<size_t>(roundedCapacity) * sizeof(BridgeEventRecord);
+
+    /// @brief The descriptor of the shared memory.
+    int fileDescriptor = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fileDescriptor < 0) {
+        celeriqueLogWarning("Failed to create shared memory: " + name);
+        return nullptr;
+    }
+    if (::ftruncate(fileDescriptor, static_cast<off_t>(mappingSize)) != 0) {
+        ::close(fileDescriptor);
+        ::shm_unlink(name.c_str());
+        celeriqueLogWarning("Failed to size shared memory: " + name);
+        return nullptr;
+    }
+    /// @brief The raw mapping address.
+    void* ptrAddress = ::mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+    // The mapping keeps the shared memory open on its own.
+    ::close(fileDescriptor);
+    if (ptrAddress == MAP_FAILED) {
+        ::shm_unlink(name.c_str());
+        celeriqueLogWarning("Failed to map shared memory: " + name);
+        return nullptr;
+    }
+
+    // New shared memory is zero filled, which is also the initial state of every counter.
+    /// @brief The header of the ring.
+    EventRingHeader* ptrHeader = new (ptrAddress) EventRingHeader();
+    ptrHeader->capacity = roundedCapacity;
+    // Processes opening the ring only trust it once the magic number is visible.
+    ptrHeader->atomicMagic.store(EVENT_RING_MAGIC, ::std::memory_order_release);
+    return ::std::make_shared<SharedEventRing>(static_cast<Byte*>(ptrAddress), mappingSize, name, true);
+#else
+    celeriqueLogWarning("Shared memory event rings are not supported on this platform.");
+    return nullptr;
+#endif
+}
+
+/// @brief Open a shared memory event ring created by another process.
+/// @param name The name of the shared memory.
+/// @return The shared pointer to the ring, or `nullptr` if it does not exist or is not an event ring.
+::std::shared_ptr<::celerique::SharedEventRing> celerique::openEventRing(const ::std::string& name) {
+#if defined(CELERIQUE_FOR_POSIX_SYSTEMS)
+    /// @brief The descriptor of the shared memory.
+    int fileDescriptor = ::shm_open(name.c_str(), O_RDWR, 0);
+    if (fileDescriptor < 0) {
+        celeriqueLogWarning("Failed to open shared memory: " + name);
+        return nullptr;
+    }
+    /// @brief The status of the shared memory.
+    struct stat fileStatus = {};
+    if (::fstat(fileDescriptor, &fileStatus) != 0 || static_cast<size_t>(fileStatus.st_size) < sizeof(EventRingHeader)) {
+        ::close(fileDescriptor);
+        celeriqueLogWarning("Shared memory is too small for an event ring: " + name);
+        return nullptr;
+    }
+    /// @brief The size of the shared memory.
+    size_t mappingSize = static_cast<size_t>(fileStatus.st_size);
+    /// @brief The raw mapping address.
+    void* ptrAddress = ::mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+    ::close(fileDescriptor);
+    if (ptrAddress == MAP_FAILED) {
+        celeriqueLogWarning("Failed to map shared memory: " + name);
+        return nullptr;
+    }
+
+    /// @brief The header of the ring.
+    EventRingHeader* ptrHeader = static_cast<EventRingHeader*>(ptrAddress);
+    if (ptrHeader->atomicMagic.load(::std::memory_order_acquire) != EVENT_RING_MAGIC || ptrHeader->capacity == 0 ||
+        (ptrHeader->capacity & (ptrHeader->capacity - 1)) != 0 ||
+        mappingSize != sizeof(EventRingHeader) + static_cast<size_t>(ptrHeader->capacity) * sizeof(BridgeEventRecord)) {
+        ::munmap(ptrAddress, mappingSize);
+        celeriqueLogWarning("Not an event ring: " + name);
+        return nullptr;
+    }
+    return ::std::make_shared<SharedEventRing>(static_cast<Byte*>(ptrAddress), mappingSize, name, false);
+#else
+    celeriqueLogWarning("Shared memory event rings are not supported on this platform.");
+    return nullptr;
+#endif
+}
+
+/// @brief Broadcast every event injected since the last update.
+/// @param ptrUpdateData The shared pointer to the update data container.
+void ::celerique::EventBridgeLayer::onUpdate(::std::shared_ptr<IUpdateData> /* ptrUpdateData */) {
+    if (_ptrInboundRing == nullptr) return;
+    /// @brief The record being taken.
+    BridgeEventRecord record;
+    while (_ptrInboundRing->tryPop(record)) {
+        /// @brief The injected event.
+        ::std::shared_ptr<EventBase> ptrEvent = deserializeBridgeEvent(record);
+        if (ptrEvent == nullptr) {
+            celeriqueLogWarning("Dropped an injected event of unknown type " + ::std::to_string(record.type) + ".");
+            continue;
+        }
+        // Injected events are not sent back out, even when a batching layer hands them over a frame late.
+        ptrEvent->markBridged();
+        broadcast(ptrEvent);
+    }
+}
+
+/// @brief Send an event to the outbound ring.
+/// @param ptrEvent The shared pointer to the event being dispatched.
+void ::celerique::EventBridgeLayer::onEvent(::std::shared_ptr<EventBase> ptrEvent) {
+    if (_ptrOutboundRing == nullptr || ptrEvent == nullptr) return;
+    if (ptrEvent->isBridged()) return;
+    if (_forwardedCategories != CELERIQUE_EVENT_CATEGORY_NONE && (ptrEvent->category() & _forwardedCategories) == 0) return;
+
+    /// @brief The record being sent.
+    BridgeEventRecord record;
+    if (!serializeBridgeEvent(*ptrEvent, record)) return;
+    // Events may be broadcast from several threads, but the ring has a single producer.
+    ::std::lock_guard<::std::mutex> lock(_outboundMutex);
+    if (!_ptrOutboundRing->tryPush(record)) _atomicNumDroppedEvents.fetch_add(1, ::std::memory_order_relaxed);
+}
+
+/// @brief Member init constructor.
+/// @param ptrInboundRing The ring of events injected by another process, or null.
+/// @param ptrOutboundRing The ring the engine's events are sent to, or null.
+/// @param forwardedCategories The categories of events sent out. None sends every category.
+::celerique::EventBridgeLayer::EventBridgeLayer(
+    ::std::shared_ptr<SharedEventRing> ptrInboundRing, ::std::shared_ptr<SharedEventRing> ptrOutboundRing,
+    EventCategory forwardedCategories
+) : _ptrInboundRing(::std::move(ptrInboundRing)), _ptrOutboundRing(::std::move(ptrOutboundRing)),
+_forwardedCategories(forwardedCategories) {}
+
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
@@ -0,0 +1,519 @@
+/*
+
+File: ./core/src/broadphase.cpp
+Author: Aldhinn Espinas
+Description: This source file contains the collision broadphase implementations.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique/broadphase.h>
+#include <celerique/jobs.h>
+#include <celerique/logging.h>
+#include <celerique/internal/simd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+/// @brief The number of bodies swept per job.
+#define BROADPHASE_SWEEP_BATCH_SIZE                                                         1024
+/// @brief The number of grid cells whose bodies are paired per job.
+#define BROADPHASE_CELL_BATCH_SIZE                                                          256
+/// @brief The number of grid cells above which a body is paired against every body instead.
+#define BROADPHASE_MAX_CELLS_PER_BODY                                                       512
+/// @brief The number of bits of each packed grid cell coordinate.
+#define BROADPHASE_CELL_COORD_BITS                                                          21
+
+/// @brief A body's position along the sweep axis.
+struct SweepEndpoint {
+    /// @brief The minimum x of the body's bounding box.
+    float minX;
+    /// @brief The slot of the body.
+    uint32_t slot;
+};
+
+/// @brief A body overlapping a grid cell.
+struct CellEntry {
+    /// @brief The packed coordinates of the cell.
+    uint64_t cellKey;
+    /// @brief The slot of the body.
+    uint32_t slot;
+};
+
+/// @brief Log and throw for a body that does not exist.
+/// @param bodyId The unique identifier of the body.
+[[noreturn]] static void throwBodyNotFound(::celerique::BroadphaseBodyID bodyId) {
+    /// @brief The error message.
+    ::std::string errorMessage = "Broadphase body " + ::std::to_string(bodyId) + " does not exist.";
+    celeriqueLogError(errorMessage);
+    throw ::std::out_of_range(errorMessage);
+}
+
+/// @brief Make a pair out of two slots, smaller unique identifier first.
+/// @param slotA The slot of one body.
+/// @param slotB The slot of the other body.
+/// @return The pair.
+static inline ::celerique::BroadphasePair makePair(uint32_t slotA, uint32_t slotB) {
+    return slotA < slotB ? ::celerique::BroadphasePair{slotA + 1, slotB + 1} : ::celerique::BroadphasePair{slotB + 1, slotA + 1};
+}
+
+/// @brief Determines whether two bounding boxes of 6 floats each overlap.
+/// @param ptrA The bounds of one body.
+/// @param ptrB The bounds of the other body.
+/// @return `true` if they overlap.
+static inline bool boundsOverlap(const float* ptrA, const float* ptrB) {
+    return ptrA[0] <= ptrB[3] && ptrB[0] <= ptrA[3] &&
+        ptrA[1] <= ptrB[4] && ptrB[1] <= ptrA[4] &&
+        ptrA[2] <= ptrB[5] && ptrB[2] <= ptrA[5];
+}
+
+/// @brief The grid cell coordinate of a position.
+/// @param position The position along an axis.
+/// @param inverseCellSize One over the edge length of a grid cell.
+/// @return The cell coordinate.
+static inline int32_t cellCoord(float position, float inverseCellSize) {
+    /// @brief The cell coordinate, clamped so the conversion stays defined.
+    float coord = ::std::floor(position * inverseCellSize);
+    return static_cast<int32_t>(::std::max(-1.0e9f, ::std::min(coord, 1.0e9f)));
+}
+
+/// @brief Pack three cell coordinates into a key. Coordinates wrap around past 2^21 cells,
+/// which only makes distant cells share a key and never misses a pair.
+/// @param x The cell coordinate along the x axis.
+/// @param y The cell coordinate along the y axis.
+/// @param z The cell coordinate along the z axis.
+/// @return The key.
+static inline uint64_t packCell(int32_t x, int32_t y, int32_t z) {
+    /// @brief The mask of a packed coordinate.
+    constexpr uint64_t coordMask = (static_cast<uint64_t>(1) << BROADPHASE_CELL_COORD_BITS) - 1;
+    return ((static_cast<uint64_t>(static_cast<uint32_t>(x)) & coordMask) << (2 * BROADPHASE_CELL_COORD_BITS)) |
+        ((static_cast<uint64_t>(static_cast<uint32_t>(y)) & coordMask) << BROADPHASE_CELL_COORD_BITS) |
+        (static_cast<uint64_t>(static_cast<uint32_t>(z)) & coordMask);
+}
+
+/// @brief Insertion sort endpoints that are already nearly sorted, as they are between frames.
+/// @param ptrEndpoints The pointer to the endpoints.
+/// @param numEndpoints The number of endpoints.
+/// @param maxShifts The number of element moves after which sorting is abandoned.
+/// @return `false` if abandoned, leaving the endpoints in an arbitrary order.
+static bool insertionSortEndpoints(SweepEndpoint* ptrEndpoints, size_t numEndpoints, size_t maxShifts) {
+    /// @brief The number of element moves so far.
+    size_t numShifts = 0;
+    for (size_t i = 1; i < numEndpoints; i++) {
+        /// @brief The endpoint being inserted.
+        SweepEndpoint endpoint = ptrEndpoints[i];
+        size_t j = i;
+        while (j > 0 && ptrEndpoints[j - 1].minX > endpoint.minX) {
+            ptrEndpoints[j] = ptrEndpoints[j - 1];
+            j--;
+        }
+        ptrEndpoints[j] = endpoint;
+        numShifts += i - j;
+        if (numShifts > maxShifts) return false;
+    }
+    return true;
+}
+
+/// @brief Add a body.
+/// @param bounds The bounding box of the body.
+/// @return The unique identifier of the body.
+::celerique::BroadphaseBodyID celerique::Broadphase::addBody(const Aabb3& bounds) {
+    /// @brief The slot of the new body.
+    uint32_t slot;
+    if (!_vecFreeSlots.empty()) {
+        slot = _vecFreeSlots.back();
+        _vecFreeSlots.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(_vecIsAlive.size());
+        _vecIsAlive.emplace_back(0);
+        _vecBounds.resize(_vecBounds.size() + 6);
+    }
+
+    _vecIsAlive[slot] = 1;
+    _numBodies++;
+    if (_method == CELERIQUE_BROADPHASE_METHOD_SWEEP_AND_PRUNE) {
+        _vecSortedSlots.emplace_back(slot);
+        _numUnsortedSlots++;
+    }
+    /// @brief The unique identifier of the new body.
+    BroadphaseBodyID bodyId = slot + 1;
+    updateBody(bodyId, bounds);
+    return bodyId;
+}
+
+/// @brief Remove a body. Its pairs are reported as removed by the next `update`.
+/// @param bodyId The unique identifier of the body.
+void ::celerique::Broadphase::removeBody(BroadphaseBodyID bodyId) {
+    /// @brief The slot of the body.
+    uint32_t slot = slotOf(bodyId);
+    if (slot == noSlot) throwBodyNotFound(bodyId);
+    _vecIsAlive[slot] = 0;
+    _vecPendingFreeSlots.emplace_back(slot);
+    _numBodies--;
+}
+
+/// @brief Move a body.
+/// @param bodyId The unique identifier of the body.
+/// @param bounds The new bounding box of the body.
+void ::celerique::Broadphase::updateBody(BroadphaseBodyID bodyId, const Aabb3& bounds) {
+    /// @brief The slot of the body.
+    uint32_t slot = slotOf(bodyId);
+    if (slot == noSlot) throwBodyNotFound(bodyId);
+    /// @brief The bounds of the body.
+    float* ptrBounds = &_vecBounds[slot * 6];
+    for (ArraySize axis = 0; axis < 3; axis++) {
+        ptrBounds[axis] = bounds.min[axis];
+        ptrBounds[3 + axis] = bounds.max[axis];
+    }
+}
+
+/// @brief Determines whether a body exists.
+/// @param bodyId The unique identifier of the body.
+/// @return `true` if the body exists.
+bool celerique::Broadphase::contains(BroadphaseBodyID bodyId) const {
+    return slotOf(bodyId) != noSlot;
+}
+
+/// @brief The bounding box of a body.
+/// @param bodyId The unique identifier of the body.
+/// @return The bounding box.
+::celerique::Aabb3 celerique::Broadphase::bounds(BroadphaseBodyID bodyId) const {
+    /// @brief The slot of the body.
+    uint32_t slot = slotOf(bodyId);
+    if (slot == noSlot) throwBodyNotFound(bodyId);
+    /// @brief The bounds of the body.
+    const float* ptrBounds = &_vecBounds[slot * 6];
+    return Aabb3{{ptrBounds[0], ptrBounds[1], ptrBounds[2]}, {ptrBounds[3], ptrBounds[4], ptrBounds[5]}};
+}
+
+/// @brief Find every overlapping pair and compare them with the pairs of the previous update.
+/// @return The number of overlapping pairs.
+size_t celerique::Broadphase::update() {
+    _vecPairs.swap(_vecPreviousPairs);
+    _vecPairs.clear();
+    if (_method == CELERIQUE_BROADPHASE_METHOD_SWEEP_AND_PRUNE) sweepAndPrune();
+    else spatialHash();
+
+    // Each batch is sorted on its worker, then neighbouring batches are merged in parallel
+    // until a single sorted list is left.
+    /// @brief The number of batches of pairs.
+    size_t numBatches = _vecBatchPairs.size();
+    for (size_t width = 1; width < numBatches; width *= 2) {
+        parallelFor((numBatches + 2 * width - 1) / (2 * width), 1, [&](size_t begin, size_t end) {
+            for (size_t merge = begin; merge < end; merge++) {
+                /// @brief The batch receiving the merged pairs.
+                size_t leftBatch = merge * 2 * width;
+                /// @brief The batch merged into the left one.
+                size_t rightBatch = leftBatch + width;
+                if (rightBatch >= numBatches) continue;
+                ::std::vector<BroadphasePair>& vecLeft = _vecBatchPairs[leftBatch];
+                ::std::vector<BroadphasePair>& vecRight = _vecBatchPairs[rightBatch];
+                /// @brief Where the right batch starts after appending it.
+                size_t middle = vecLeft.size();
+                vecLeft.insert(vecLeft.end(), vecRight.begin(), vecRight.end());
+                ::std::inplace_merge(vecLeft.begin(), vecLeft.begin() + middle, vecLeft.end());
+                vecRight.clear();
+            }
+        });
+    }
+    if (numBatches > 0) _vecPairs.swap(_vecBatchPairs.front());
+    _vecPairs.erase(::std::unique(_vecPairs.begin(), _vecPairs.end()), _vecPairs.end());
+
+    _vecAddedPairs.clear();
+    ::std::set_difference(
+        _vecPairs.begin(), _vecPairs.end(), _vecPreviousPairs.begin(), _vecPreviousPairs.end(),
+        ::std::back_inserter(_vecAddedPairs)
+    );
+    _vecRemovedPairs.clear();
+    ::std::set_difference(
+        _vecPreviousPairs.begin(), _vecPreviousPairs.end(), _vecPairs.begin(), _vecPairs.end(),
+        ::std::back_inserter(_vecRemovedPairs)
+    );
+
+    // Removed bodies no longer appear in any list, so their slots can be reused.
+    _vecFreeSlots.insert(_vecFreeSlots.end(), _vecPendingFreeSlots.begin(), _vecPendingFreeSlots.end());
+    _vecPendingFreeSlots.clear();
+    return _vecPairs.size();
+}
+
+/// @brief The slot of a body in the body arrays.
+/// @param bodyId The unique identifier of the body.
+/// @return The slot, or `noSlot` if the body does not exist.
+uint32_t celerique::Broadphase::slotOf(BroadphaseBodyID bodyId) const {
+    if (bodyId == CELERIQUE_BROADPHASE_BODY_ID_NULL || bodyId > _vecIsAlive.size()) return noSlot;
+    return _vecIsAlive[bodyId - 1] ? bodyId - 1 : noSlot;
+}
+
+/// @brief Find the overlapping pairs by sweeping the bodies sorted along the x axis.
+void ::celerique::Broadphase::sweepAndPrune() {
+    _vecSortedSlots.erase(
+        ::std::remove_if(_vecSortedSlots.begin(), _vecSortedSlots.end(), [&](uint32_t slot) { return !_vecIsAlive[slot]; }),
+        _vecSortedSlots.end()
+    );
+    /// @brief The number of bodies.
+    size_t numSorted = _vecSortedSlots.size();
+
+    // Bodies move little between frames, so last frame's order is nearly sorted already
+    // and insertion sort finishes in about linear time. Large changes fall back to a full sort.
+    /// @brief The bodies in last frame's order with their new positions.
+    ::std::vector<SweepEndpoint> vecEndpoints(numSorted);
+    for (size_t i = 0; i < numSorted; i++) {
+        vecEndpoints[i] = {_vecBounds[_vecSortedSlots[i] * 6], _vecSortedSlots[i]};
+    }
+    /// @brief Whether the endpoints are sorted.
+    bool isSorted = _numUnsortedSlots * 8 <= numSorted &&
+        insertionSortEndpoints(vecEndpoints.data(), numSorted, numSorted * 8);
+    if (!isSorted) {
+        ::std::sort(vecEndpoints.begin(), vecEndpoints.end(), [](const SweepEndpoint& left, const SweepEndpoint& right) {
+            return left.minX < right.minX;
+        });
+    }
+    _numUnsortedSlots = 0;
+
+    // Gather the bounds in sweep order, one array per component, padded with 4 bodies
+    // that are never overlapped so the sweep can always read 4 candidates at a time.
+    /// @brief The number of bodies including the padding.
+    size_t numPadded = numSorted + 4;
+    /// @brief The bounds in sweep order, component by component.
+    ::std::vector<float> vecComponents(numPadded * 6, 0.0f);
+    float* ptrMinX = vecComponents.data();
+    float* ptrMaxX = ptrMinX + numPadded;
+    float* ptrMinY = ptrMaxX + numPadded;
+    float* ptrMaxY = ptrMinY + numPadded;
+    float* ptrMinZ = ptrMaxY + numPadded;
+    float* ptrMaxZ = ptrMinZ + numPadded;
+    for (size_t i = 0; i < numSorted; i++) {
+        /// @brief The slot of the body.
+        uint32_t slot = vecEndpoints[i].slot;
+        /// @brief The bounds of the body.
+        const float* ptrBounds = &_vecBounds[slot * 6];
+        _vecSortedSlots[i] = slot;
+        ptrMinX[i] = ptrBounds[0];
+        ptrMinY[i] = ptrBounds[1];
+        ptrMinZ[i] = ptrBounds[2];
+        ptrMaxX[i] = ptrBounds[3];
+        ptrMaxY[i] = ptrBounds[4];
+        ptrMaxZ[i] = ptrBounds[5];
+    }
+    ::std::fill(ptrMinX + numSorted, ptrMinX + numPadded, ::std::numeric_limits<float>::infinity());
+
+    /// @brief The number of batches of bodies.
+    size_t numBatches = (numSorted + BROADPHASE_SWEEP_BATCH_SIZE - 1) / BROADPHASE_SWEEP_BATCH_SIZE;
+    _vecBatchPairs.resize(numBatches);
+    parallelFor(numSorted, BROADPHASE_SWEEP_BATCH_SIZE, [&](size_t begin, size_t end) {
+        /// @brief The pairs found by this batch.
+        ::std::vector<BroadphasePair>& vecBatch = _vecBatchPairs[begin / BROADPHASE_SWEEP_BATCH_SIZE];
+        vecBatch.clear();
+        for (size_t i = begin; i < end; i++) {
+            // Candidates start overlapping along x at i + 1 and stop at the first one
+            // starting past this body's maximum x. Every candidate is tested 4 at a time.
+#if defined(CELERIQUE_SIMD_SSE)
+            const __m128 maxXi = _mm_set1_ps(ptrMaxX[i]);
+            const __m128 minYi = _mm_set1_ps(ptrMinY[i]), maxYi = _mm_set1_ps(ptrMaxY[i]);
+            const __m128 minZi = _mm_set1_ps(ptrMinZ[i]), maxZi = _mm_set1_ps(ptrMaxZ[i]);
+            for (size_t j = i + 1;; j += 4) {
+                /// @brief The candidates overlapping along x.
+                const __m128 xMask = _mm_cmple_ps(_mm_loadu_ps(ptrMinX + j), maxXi);
+                /// @brief The lane bits of `xMask`.
+                int xBits = _mm_movemask_ps(xMask);
+                if (xBits == 0) break;
+                /// @brief The candidates overlapping along y.
+                const __m128 yMask = _mm_and_ps(
+                    _mm_cmple_ps(_mm_loadu_ps(ptrMinY + j), maxYi), _mm_cmple_ps(minYi, _mm_loadu_ps(ptrMaxY + j))
+                );
+                /// @brief The candidates overlapping along z.
+                const __m128 zMask = _mm_and_ps(
+                    _mm_cmple_ps(_mm_loadu_ps(ptrMinZ + j), maxZi), _mm_cmple_ps(minZi, _mm_loadu_ps(ptrMaxZ + j))
+                );
+                /// @brief The lane bits of the candidates overlapping along every axis.
+                int overlapBits = _mm_movemask_ps(_mm_and_ps(xMask, _mm_and_ps(yMask, zMask)));
+                for (int lane = 0; overlapBits != 0; lane++, overlapBits >>= 1) {
+                    if (overlapBits & 1) vecBatch.emplace_back(makePair(_vecSortedSlots[i], _vecSortedSlots[j + lane]));
+                }
+                if (xBits != 0xF) break;
+            }
+#elif defined(CELERIQUE_SIMD_NEON)
+            const float32x4_t maxXi = vdupq_n_f32(ptrMaxX[i]);
+            const float32x4_t minYi = vdupq_n_f32(ptrMinY[i]), maxYi = vdupq_n_f32(ptrMaxY[i]);
+            const float32x4_t minZi = vdupq_n_f32(ptrMinZ[i]), maxZi = vdupq_n_f32(ptrMaxZ[i]);
+            for (size_t j = i + 1;; j += 4) {
+                /// @brief The candidates overlapping along x.
+                const uint32x4_t xMask = vcleq_f32(vld1q_f32(ptrMinX + j), maxXi);
+                /// @brief The lanes of `xMask`.
+                uint32_t xLanes[4];
+                vst1q_u32(xLanes, xMask);
+                if (xLanes[0] == 0) break;
+                /// @brief The candidates overlapping along every axis.
+                uint32x4_t overlapMask = vandq_u32(xMask, vandq_u32(
+                    vandq_u32(vcleq_f32(vld1q_f32(ptrMinY + j), maxYi), vcleq_f32(minYi, vld1q_f32(ptrMaxY + j))),
+                    vandq_u32(vcleq_f32(vld1q_f32(ptrMinZ + j), maxZi), vcleq_f32(minZi, vld1q_f32(ptrMaxZ + j)))
+                ));
+                /// @brief The lanes of `overlapMask`.
+                uint32_t overlapLanes[4];
+                vst1q_u32(overlapLanes, overlapMask);
+                for (size_t lane = 0; lane < 4; lane++) {
+                    if (overlapLanes[lane]) vecBatch.emplace_back(makePair(_vecSortedSlots[i], _vecSortedSlots[j + lane]));
+                }
+                if (xLanes[3] == 0) break;
+            }
+#else
+            for (size_t j = i + 1; ptrMinX[j] <= ptrMaxX[i]; j++) {
+                if (ptrMinY[j] <= ptrMaxY[i] && ptrMinY[i] <= ptrMaxY[j] && ptrMinZ[j] <= ptrMaxZ[i] && ptrMinZ[i] <= ptrMaxZ[j]) {
+                    vecBatch.emplace_back(makePair(_vecSortedSlots[i], _vecSortedSlots[j]));
+                }
+            }
+#endif
+        }
+        ::std::sort(vecBatch.begin(), vecBatch.end());
+    });
+}
+
+/// @brief Find the overlapping pairs by sorting the bodies into grid cells.
+void ::celerique::Broadphase::spatialHash() {
+    /// @brief One over the edge length of a grid cell.
+    float inverseCellSize = 1.0f / _cellSize;
+    /// @brief The slots holding a body.
+    ::std::vector<uint32_t> vecSlots;
+    vecSlots.reserve(_numBodies);
+    for (uint32_t slot = 0; slot < _vecIsAlive.size(); slot++) {
+        if (_vecIsAlive[slot]) vecSlots.emplace_back(slot);
+    }
+    /// @brief The number of bodies.
+    size_t numSlots = vecSlots.size();
+
+    // Count the cells of each body first so every body writes its entries into its own range.
+    /// @brief The first entry of each body, plus one past the last entry.
+    ::std::vector<size_t> vecEntryOffsets(numSlots + 1, 0);
+    parallelFor(numSlots, BROADPHASE_SWEEP_BATCH_SIZE, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            /// @brief The bounds of the body.
+            const float* ptrBounds = &_vecBounds[vecSlots[i] * 6];
+            /// @brief The number of cells overlapped.
+            size_t numCells = 1;
+            for (size_t axis = 0; axis < 3; axis++) {
+                numCells *= static_cast<size_t>(
+                    cellCoord(ptrBounds[3 + axis], inverseCellSize) - cellCoord(ptrBounds[axis], inverseCellSize) + 1
+                );
+                // Guard against overflowing with huge bodies.
+                numCells = ::std::min<size_t>(numCells, BROADPHASE_MAX_CELLS_PER_BODY + 1);
+            }
+            vecEntryOffsets[i + 1] = numCells > BROADPHASE_MAX_CELLS_PER_BODY ? 0 : numCells;
+        }
+    });
+
+    // Bodies spanning too many cells are paired against every body instead.
+    /// @brief The bodies spanning too many cells.
+    ::std::vector<uint32_t> vecOversizedSlots;
+    for (size_t i = 0; i < numSlots; i++) {
+        if (vecEntryOffsets[i + 1] == 0) vecOversizedSlots.emplace_back(vecSlots[i]);
+        vecEntryOffsets[i + 1] += vecEntryOffsets[i];
+    }
+
+    /// @brief Every body in every cell it overlaps.
+    ::std::vector<CellEntry> vecEntries(vecEntryOffsets[numSlots]);
+    parallelFor(numSlots, BROADPHASE_SWEEP_BATCH_SIZE, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            if (vecEntryOffsets[i] == vecEntryOffsets[i + 1]) continue;
+            /// @brief The bounds of the body.
+            const float* ptrBounds = &_vecBounds[vecSlots[i] * 6];
+            /// @brief The next entry to be written.
+            CellEntry* ptrEntry = &vecEntries[vecEntryOffsets[i]];
+            for (int32_t x = cellCoord(ptrBounds[0], inverseCellSize); x <= cellCoord(ptrBounds[3], inverseCellSize); x++) {
+                for (int32_t y = cellCoord(ptrBounds[1], inverseCellSize); y <= cellCoord(ptrBounds[4], inverseCellSize); y++) {
+                    for (int32_t z = cellCoord(ptrBounds[2], inverseCellSize); z <= cellCoord(ptrBounds[5], inverseCellSize); z++) {
+                        *ptrEntry++ = {packCell(x, y, z), vecSlots[i]};
+                    }
+                }
+            }
+        }
+    });
+    ::std::sort(vecEntries.begin(), vecEntries.end(), [](const CellEntry& left, const CellEntry& right) {
+        return left.cellKey < right.cellKey;
+    });
+
+    /// @brief The first entry of each cell, plus one past the last entry.
+    ::std::vector<size_t> vecCellOffsets;
+    for (size_t i = 0; i < vecEntries.size(); i++) {
+        if (i == 0 || vecEntries[i].cellKey != vecEntries[i - 1].cellKey) vecCellOffsets.emplace_back(i);
+    }
+    vecCellOffsets.emplace_back(vecEntries.size());
+    /// @brief The number of occupied cells.
+    size_t numCells = vecCellOffsets.size() - 1;
+
+    /// @brief The number of batches of cells.
+    size_t numCellBatches = (numCells + BROADPHASE_CELL_BATCH_SIZE - 1) / BROADPHASE_CELL_BATCH_SIZE;
+    _vecBatchPairs.resize(numCellBatches + (vecOversizedSlots.empty() ? 0 : 1));
+    parallelFor(numCells, BROADPHASE_CELL_BATCH_SIZE, [&](size_t begin, size_t end) {
+        /// @brief The pairs found by this batch.
+        ::std::vector<BroadphasePair>& vecBatch = _vecBatchPairs[begin / BROADPHASE_CELL_BATCH_SIZE];
+        vecBatch.clear();
+        for (size_t cell = begin; cell < end; cell++) {
+            for (size_t i = vecCellOffsets[cell]; i < vecCellOffsets[cell + 1]; i++) {
+                /// @brief The bounds of the first body.
+                const float* ptrBoundsA = &_vecBounds[vecEntries[i].slot * 6];
+                for (size_t j = i + 1; j < vecCellOffsets[cell + 1]; j++) {
+                    /// @brief The bounds of the second body.
+                    const float* ptrBoundsB = &_vecBounds[vecEntries[j].slot * 6];
+                    if (!boundsOverlap(ptrBoundsA, ptrBoundsB)) continue;
+                    // Bodies sharing several cells are paired only in the cell
+                    // holding the minimum corner of their overlap.
+                    /// @brief The cell holding the minimum corner of the overlap.
+                    uint64_t overlapCellKey = packCell(
+                        cellCoord(::std::max(ptrBoundsA[0], ptrBoundsB[0]), inverseCellSize),
+                        cellCoord(::std::max(ptrBoundsA[1], ptrBoundsB[1]), inverseCellSize),
+                        cellCoord(::std::max(ptrBoundsA[2], ptrBoundsB[2]), inverseCellSize)
+                    );
+                    if (overlapCellKey == vecEntries[i].cellKey) {
+                        vecBatch.emplace_back(makePair(vecEntries[i].slot, vecEntries[j].slot));
+                    }
+                }
+            }
+        }
+        ::std::sort(vecBatch.begin(), vecBatch.end());
+    });
+
+    if (vecOversizedSlots.empty()) return;
+    /// @brief The pairs of the bodies spanning too many cells.
+    ::std::vector<BroadphasePair>& vecOversizedBatch = _vecBatchPairs.back();
+    vecOversizedBatch.clear();
+    for (uint32_t oversizedSlot : vecOversizedSlots) {
+        /// @brief The bounds of the body spanning too many cells.
+        const float* ptrOversizedBounds = &_vecBounds[oversizedSlot * 6];
+        for (uint32_t slot : vecSlots) {
+            if (slot == oversizedSlot) continue;
+            // Pairs of two oversized bodies are found once, from the smaller slot.
+            if (slot < oversizedSlot && ::std::binary_search(vecOversizedSlots.begin(), vecOversizedSlots.end(), slot)) continue;
+            if (boundsOverlap(ptrOversizedBounds, &_vecBounds[slot * 6])) {
+                vecOversizedBatch.emplace_back(makePair(oversizedSlot, slot));
+            }
+        }
+    }
+    ::std::sort(vecOversizedBatch.begin(), vecOversizedBatch.end());
+}
+
+/// @brief Member init constructor.
+/// @param method The algorithm used to find overlapping bodies.
+/// @param cellSize The edge length of a grid cell, for the spatial hash method.
+::celerique::Broadphase::Broadphase(BroadphaseMethod method, float cellSize) :
+    _method(method), _cellSize(cellSize) {
+    if (method != CELERIQUE_BROADPHASE_METHOD_SWEEP_AND_PRUNE && method != CELERIQUE_BROADPHASE_METHOD_SPATIAL_HASH) {
+        /// @brief The error message.
+        ::std::string errorMessage = "Unknown broadphase method " + ::std::to_string(method) + ".";
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
+    }
+    if (method == CELERIQUE_BROADPHASE_METHOD_SPATIAL_HASH && !(cellSize > 0.0f)) {
+        /// @brief The error message.
+        ::std::string errorMessage = "The broadphase cell size must be positive.";
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
+    }
+}
+
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
@@ -9,71 +9,165 @@ License: Mozilla Public License 2.0. (See ./LICENSE).
 */
 
 #include <celerique/internal/engine.h>
+#include <celerique/internal/assets.h>
+#include <celerique/internal/tasks.h>
+#include <celerique/internal/background.h>
 
 #include <utility>
 #include <mutex>
+#include <thread>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <cstring>
+#include <type_traits>
 
 /// @brief Updates the state.
 /// @param ptrArg The shared pointer to the update data container.
 void ::celerique::internal::Engine::onUpdate(::std::shared_ptr<IUpdateData> ptrUpdateData) {
-    {
-        ::std::shared_lock<::std::shared_mutex> readLock(_layerMutex);
-        // Update layers.
-        for (::std::unique_ptr<ApplicationLayerBase>& ptrAppLayer :_listPtrAppLayers) {
-            ptrAppLayer->onUpdate(ptrUpdateData);
+    /// @brief When this update started.
+    ::std::chrono::high_resolution_clock::time_point updateStart = ::std::chrono::high_resolution_clock::now();
+    updateState(ptrUpdateData);
+    runBackgroundSlices(updateStart);
+}
+
+/// @brief Update the layers and windows, without running background work.
+/// @param ptrUpdateData The shared pointer to the update data container.
+void ::celerique::internal::Engine::updateState(::std::shared_ptr<IUpdateData> ptrUpdateData) {
+    flightRecord(CELERIQUE_FLIGHT_RECORD_KIND_FRAME, 0, _numUpdates);
+    // Frame boundary: add what was queued since the last update.
+    applyMutations();
+    // Deliver finished asset loads before layers update so they can use them this cycle.
+    AssetManager::getRef().dispatchCompletedLoads(this);
+    // Loads asked for without an engine are broadcast to the process default engine only.
+    if (_isProcessDefault) AssetManager::getRef().dispatchCompletedLoads();
+    // Hand the events broadcast since the last update to the layers batching them.
+    deliverEventBatches();
+#if defined(CELERIQUE_COROUTINES_ENABLED)
+    // Resume the tasks waiting on this update, loaded assets, timers and GPU timelines.
+    _taskScheduler.onFrame();
+#endif
+    // The arrays only change in `applyMutations` on this thread, so they are read without locking.
+    /// @brief The application layers.
+    const ::std::vector<ApplicationLayerBase*>& vecAppLayers = *_atomicPtrVecAppLayers.load(::std::memory_order_relaxed);
+    /// @brief The engine update data, if any was passed.
+    EngineUpdateData* ptrEngineUpdateData = dynamic_cast<EngineUpdateData*>(ptrUpdateData.get());
+    /// @brief The time elapsed since the previous engine update.
+    ::std::chrono::nanoseconds elapsed(ptrEngineUpdateData != nullptr ? ptrEngineUpdateData->elapsedNanoSecs() : 0);
+    // Update layers.
+    for (size_t layerIndex = 0; layerIndex < vecAppLayers.size(); layerIndex++) {
+        /// @brief The update schedule of the layer.
+        LayerSchedule& schedule = _vecLayerSchedules[layerIndex];
+        if (schedule.isEveryUpdate) {
+            vecAppLayers[layerIndex]->onUpdate(ptrUpdateData);
+            continue;
         }
-    }
-    {
-        ::std::shared_lock<::std::shared_mutex> readLock(_windowsMutex);
-        // Update graphical user interface windows.
-        for (::std::unique_ptr<WindowBase>& ptrWindow : _listPtrWindows) {
-            ptrWindow->onUpdate();
+
+        schedule.sinceLastUpdate += elapsed;
+        /// @brief Whether the layer updates this time.
+        bool isDue;
+        if (schedule.periodNanoSecs > ::std::chrono::nanoseconds::zero()) {
+            schedule.untilNextUpdate -= elapsed;
+            isDue = schedule.untilNextUpdate <= ::std::chrono::nanoseconds::zero();
+            if (isDue) schedule.untilNextUpdate += schedule.periodNanoSecs;
+            // Skip the updates missed during a long frame instead of running them back to back.
+            if (schedule.untilNextUpdate <= ::std::chrono::nanoseconds::zero()) {
+                schedule.untilNextUpdate = schedule.periodNanoSecs;
+            }
+        } else {
+            isDue = _numUpdates % schedule.periodFrames == schedule.phaseFrames;
         }
+        if (!isDue) continue;
+
+        vecAppLayers[layerIndex]->onUpdate(::std::make_shared<EngineUpdateData>(
+            ::std::chrono::nanoseconds(schedule.sinceLastUpdate)
+        ));
+        schedule.sinceLastUpdate = ::std::chrono::nanoseconds::zero();
+    }
+    _numUpdates++;
+    // Update graphical user interface windows.
+    for (WindowBase* ptrWindow : _vecWindows) {
+        ptrWindow->onUpdate();
     }
 }
 
+/// @brief Spend what is left of the target frame time on background work.
+/// @param frameStart When the frame started.
+void ::celerique::internal::Engine::runBackgroundSlices(::std::chrono::high_resolution_clock::time_point frameStart) {
+    /// @brief The target frame time.
+    ::std::chrono::nanoseconds targetFrameTime(_atomicTargetFrameNanoSecs.load(::std::memory_order_relaxed));
+    /// @brief The time left in this frame.
+    ::std::chrono::nanoseconds remainingTime = targetFrameTime - ::std::chrono::duration_cast<::std::chrono::nanoseconds>(
+        ::std::chrono::high_resolution_clock::now() - frameStart
+    );
+    _backgroundScheduler.runSlices(::std::max(remainingTime, ::std::chrono::nanoseconds::zero()));
+}
+
 /// @brief The event handler method.
 /// @param ptrEvent The shared pointer to the event being dispatched.
 void ::celerique::internal::Engine::onEvent(::std::shared_ptr<EventBase> ptrEvent) {
+    /// @brief The name of the event's type, kept for crash dumps.
+    const char* typeName = ptrEvent->typeID().name();
+    flightRecord(
+        CELERIQUE_FLIGHT_RECORD_KIND_EVENT, ptrEvent->category(), ptrEvent->sourceWindowId(), typeName, ::std::strlen(typeName)
+    );
     EventDispatcher dispatcher(ptrEvent);
     dispatcher.dispatch<::celerique::event::EngineShutdown>(
         ::std::bind(&Engine::onEngineShutdown, this, ptrEvent), CELERIQUE_EVENT_HANDLING_STRATEGY_BLOCKING
     );
     // Halt here if event should not propagate any longer.
     if (!ptrEvent->shouldPropagate()) return;
-    // Propagate window and input events to layers.
-    if ((ptrEvent->category() & (CELERIQUE_EVENT_CATEGORY_WINDOW | CELERIQUE_EVENT_CATEGORY_INPUT)) == 0) return;
-
-    {
-        ::std::shared_lock<::std::shared_mutex> readLock(_layerMutex);
+    // Propagate window, input and engine events to layers.
+    if ((ptrEvent->category() & (
+        CELERIQUE_EVENT_CATEGORY_WINDOW | CELERIQUE_EVENT_CATEGORY_INPUT | CELERIQUE_EVENT_CATEGORY_ENGINE
+    )) == 0) return;
 
-        // Dispatch input and window events to layers (from last to first).
-        for (auto layerRIterator = _listPtrAppLayers.rbegin(); layerRIterator != _listPtrAppLayers.rend(); layerRIterator++) {
-            dispatcher.dispatch<::celerique::EventBase>(
-                ::std::bind(&ApplicationLayerBase::onEvent, (*layerRIterator).get(), ptrEvent), CELERIQUE_EVENT_HANDLING_STRATEGY_BLOCKING
-            );
+    // Events may be broadcast from any thread. Published arrays live as long as the engine, so no reference is taken.
+    /// @brief The layers receiving the event. Events not coming from a window reach every layer.
+    const ::std::vector<ApplicationLayerBase*>* ptrVecTargetLayers = _atomicPtrVecAppLayers.load(::std::memory_order_acquire);
+    if (ptrEvent->sourceWindowId() != CELERIQUE_WINDOW_ID_NULL) {
+        /// @brief The routes of window events.
+        const EventRoutes* ptrEventRoutes = _atomicPtrEventRoutes.load(::std::memory_order_acquire);
+        auto windowLayersIterator = ptrEventRoutes->mapWindowLayers.find(ptrEvent->sourceWindowId());
+        ptrVecTargetLayers = windowLayersIterator != ptrEventRoutes->mapWindowLayers.end() ?
+            &windowLayersIterator->second : &ptrEventRoutes->vecUnsubscribedLayers;
+    }
+    /// @brief Whether a layer receiving the event batches its events.
+    bool isBatched = false;
+    // Dispatch input, window and engine events to layers (from last to first).
+    for (auto layerRIterator = ptrVecTargetLayers->rbegin(); layerRIterator != ptrVecTargetLayers->rend(); layerRIterator++) {
+        if ((*layerRIterator)->isBatchingEvents()) {
+            isBatched = true;
+            continue;
         }
+        dispatcher.dispatch<::celerique::EventBase>(
+            ::std::bind(&ApplicationLayerBase::onEvent, *layerRIterator, ptrEvent), CELERIQUE_EVENT_HANDLING_STRATEGY_BLOCKING
+        );
     }
+    // Batching layers get the event with the rest of this frame's on the next update.
+    if (isBatched && ptrEvent->shouldPropagate()) queueBatchedEvent(::std::move(ptrEvent));
 }
 
-/// @brief Add an application layer to be managed by the engine.
+/// @brief Add an application layer to be managed by the engine. Safe to call from any
+/// thread, including from a layer's `onUpdate` or `onEvent`. The layer is added before the next update.
 /// @param ptrAppLayer The unique pointer to the application layer instance.
 void ::celerique::internal::Engine::addAppLayer(::std::unique_ptr<ApplicationLayerBase>&& ptrAppLayer) {
-    ::std::unique_lock<::std::shared_mutex> writeLock(_layerMutex);
-
-    ptrAppLayer->addEventListener(this);
-    _listPtrAppLayers.emplace_back(::std::move(ptrAppLayer));
-    celeriqueLogTrace("Added a layer.");
+    /// @brief The mutation adding the layer.
+    EngineMutation* ptrMutation = new EngineMutation;
+    // Loads the layer asks for from here on complete on this engine, whichever thread asks.
+    ptrAppLayer->_ptrEngine = this;
+    ptrMutation->ptrAppLayer = ::std::move(ptrAppLayer);
+    pushMutation(ptrMutation);
 }
 
-/// @brief Add a graphical user interface window to be managed by the engine.
+/// @brief Add a graphical user interface window to be managed by the engine. Safe to call from any
+/// thread, including from a layer's `onUpdate` or `onEvent`. The window is added before the next update.
 /// @param ptrWindow The unique pointer to the window instance.
 void ::celerique::internal::Engine::addWindow(::std::unique_ptr<WindowBase>&& ptrWindow) {
-    ::std::unique_lock<::std::shared_mutex> writeLock(_windowsMutex);
-
-    ptrWindow->addEventListener(this);
-    _listPtrWindows.emplace_back(::std::move(ptrWindow));
-    celeriqueLogTrace("Added a graphical user interface window.");
+    /// @brief The mutation adding the window.
+    EngineMutation* ptrMutation = new EngineMutation;
+    ptrMutation->ptrWindow = ::std::move(ptrWindow);
+    pushMutation(ptrMutation);
 }
 
 /// @brief Creates and run the application run loop.
@@ -84,25 +178,146 @@ void ::celerique::internal::Engine::run() {
     ::std::chrono::time_point prevTime = clock::now();
     /// @brief The container for the current time point.
     ::std::chrono::time_point currentTime = prevTime;
+    /// @brief Where and how the snapshots are rendered during this run.
+    RenderThreadMode renderThreadMode = _atomicRenderThreadMode.load();
+    /// @brief The thread rendering the snapshots, if any.
+    ::std::thread renderThread;
+
+    // A previous shutdown only ended the previous run.
+    _atomicShouldAppLoopRunning.store(true);
+    if (renderThreadMode != CELERIQUE_RENDER_THREAD_MODE_NONE) {
+        _atomicShouldRenderThreadRun.store(true);
+        renderThread = ::std::thread(&Engine::renderThreadLoop, this);
+    }
 
     celeriqueLogTrace("Starting application loop.");
     while(_atomicShouldAppLoopRunning.load()) {
         // Record current time.
         currentTime = clock::now();
-        // Update engine state.
-        onUpdate(::std::make_shared<EngineUpdateData>(
+        // Update engine state. Background work waits until the frame is rendered or handed off.
+        updateState(::std::make_shared<EngineUpdateData>(
             ::std::chrono::duration_cast<::std::chrono::nanoseconds>(currentTime - prevTime)
         ));
         // Update previous time data.
         prevTime = currentTime;
+
+        /// @brief The snapshots the layers recorded this frame.
+        ::std::vector<RenderSnapshot>& vecSnapshots = writeSnapshots();
+        if (renderThreadMode == CELERIQUE_RENDER_THREAD_MODE_NONE) {
+            renderSnapshots(vecSnapshots);
+            runBackgroundSlices(currentTime);
+            paceFrame(currentTime);
+            continue;
+        }
+        if (renderThreadMode == CELERIQUE_RENDER_THREAD_MODE_THROUGHPUT) {
+            // Wait for the render thread to take the previous frame instead of replacing it.
+            ::std::unique_lock<::std::mutex> lock(_mailboxMutex);
+            _condVarMailbox.wait(lock, [this]() { return !_mailboxSnapshots.hasFresh(); });
+        }
+        if (_mailboxSnapshots.publish()) {
+            celeriqueLogTrace("Replaced a snapshot the render thread did not take.");
+        }
+        { ::std::lock_guard<::std::mutex> lock(_mailboxMutex); }
+        _condVarMailbox.notify_all();
+        runBackgroundSlices(currentTime);
+        paceFrame(currentTime);
     }
     celeriqueLogTrace("Ended application loop.");
+
+    if (renderThread.joinable()) {
+        _atomicShouldRenderThreadRun.store(false);
+        { ::std::lock_guard<::std::mutex> lock(_mailboxMutex); }
+        _condVarMailbox.notify_all();
+        renderThread.join();
+    }
 }
 
-/// @brief Gets the reference to the engine object.
+/// @brief Set the time each iteration of the application run loop aims to take. Iterations finishing early
+/// spend the rest on background work, then sleep.
+/// @param targetFrameTime The target frame time. Zero runs iterations back to back, with no background budget.
+void ::celerique::internal::Engine::setTargetFrameTime(::std::chrono::nanoseconds targetFrameTime) {
+    _atomicTargetFrameNanoSecs.store(targetFrameTime.count());
+}
+
+/// @brief Set where and how the application layers' render snapshots are rendered.
+/// Takes effect the next time the application run loop starts.
+/// @param renderThreadMode The render thread mode.
+void ::celerique::internal::Engine::setRenderThreadMode(RenderThreadMode renderThreadMode) {
+    _atomicRenderThreadMode.store(renderThreadMode);
+}
+
+/// @brief Checkpoint the engine and every application layer into a state snapshot, replacing its contents.
+/// Called by the update thread.
+/// @param snapshot The snapshot to write into.
+void ::celerique::internal::Engine::saveState(StateSnapshot& snapshot) {
+    static_assert(::std::is_trivially_copyable<LayerSchedule>::value, "Layer schedules are copied as is.");
+    snapshot.clear();
+
+    // The update count and schedules decide which layers update on which frame, so a rollback replays the same cadence.
+    /// @brief The engine's own state.
+    EngineStateHeader header = {_numUpdates, _vecLayerSchedules.size()};
+    /// @brief The engine's section.
+    Byte* ptrSection = snapshot.appendSection(
+        CELERIQUE_STATE_KEY_ENGINE, sizeof(header) + sizeof(LayerSchedule) * _vecLayerSchedules.size()
+    );
+    ::std::memcpy(ptrSection, &header, sizeof(header));
+    for (size_t layerIndex = 0; layerIndex < _vecLayerSchedules.size(); layerIndex++) {
+        /// @brief The reference to the schedule being saved.
+        const LayerSchedule& refSchedule = _vecLayerSchedules[layerIndex];
+        /// @brief The copy of the schedule, zeroed first so its padding is saved as zeros.
+        LayerSchedule schedule;
+        ::std::memset(static_cast<void*>(&schedule), 0, sizeof(schedule));
+        schedule.isEveryUpdate = refSchedule.isEveryUpdate;
+        schedule.periodFrames = refSchedule.periodFrames;
+        schedule.phaseFrames = refSchedule.phaseFrames;
+        schedule.periodNanoSecs = refSchedule.periodNanoSecs;
+        schedule.untilNextUpdate = refSchedule.untilNextUpdate;
+        schedule.sinceLastUpdate = refSchedule.sinceLastUpdate;
+        ::std::memcpy(ptrSection + sizeof(header) + sizeof(LayerSchedule) * layerIndex, &schedule, sizeof(schedule));
+    }
+
+    for (ApplicationLayerBase* ptrAppLayer : *_atomicPtrVecAppLayers.load(::std::memory_order_relaxed)) {
+        ptrAppLayer->onSaveState(snapshot);
+    }
+}
+
+/// @brief Roll the engine and every application layer back to a state snapshot. Called by the update thread.
+/// @param snapshot The snapshot to read from.
+void ::celerique::internal::Engine::restoreState(const StateSnapshot& snapshot) {
+    /// @brief The size of the engine's section.
+    size_t sectionSize = 0;
+    /// @brief The engine's section.
+    const Byte* ptrSection = snapshot.section(CELERIQUE_STATE_KEY_ENGINE, &sectionSize);
+    if (ptrSection != nullptr && sectionSize >= sizeof(EngineStateHeader)) {
+        /// @brief The engine's own state.
+        EngineStateHeader header;
+        ::std::memcpy(&header, ptrSection, sizeof(header));
+        _numUpdates = header.numUpdates;
+        // Layers added since the checkpoint keep their schedules.
+        if (header.numLayerSchedules <= _vecLayerSchedules.size() &&
+            sectionSize == sizeof(header) + sizeof(LayerSchedule) * header.numLayerSchedules) {
+            if (header.numLayerSchedules > 0) {
+                ::std::memcpy(
+                    _vecLayerSchedules.data(), ptrSection + sizeof(header),
+                    sizeof(LayerSchedule) * static_cast<size_t>(header.numLayerSchedules)
+                );
+            }
+        } else {
+            celeriqueLogWarning("State snapshot layer schedules do not match the engine's layers.");
+        }
+    } else {
+        celeriqueLogWarning("State snapshot holds no engine state.");
+    }
+
+    for (ApplicationLayerBase* ptrAppLayer : *_atomicPtrVecAppLayers.load(::std::memory_order_relaxed)) {
+        ptrAppLayer->onRestoreState(snapshot);
+    }
+}
+
+/// @brief Gets the reference to the process default engine object.
 ::celerique::internal::Engine& celerique::internal::Engine::getRef() {
-    /// @brief The singleton instance of the engine.
-    static Engine singletonInst;
+    /// @brief The process default instance of the engine.
+    static Engine singletonInst(true);
     return singletonInst;
 }
 
@@ -114,13 +329,302 @@ void ::celerique::internal::Engine::onEngineShutdown(::std::shared_ptr<EventBase
     celeriqueLogTrace("Engine shutdown event was dispatched.");
 }
 
-/// @brief Private default constructor to prevent external instantiation.
-::celerique::internal::Engine::Engine() {
+/// @brief Sleep until the target frame time elapsed since the frame started, if one is set.
+/// @param frameStart When the frame started.
+void ::celerique::internal::Engine::paceFrame(::std::chrono::high_resolution_clock::time_point frameStart) {
+    /// @brief The target frame time.
+    ::std::chrono::nanoseconds targetFrameTime(_atomicTargetFrameNanoSecs.load(::std::memory_order_relaxed));
+    if (targetFrameTime <= ::std::chrono::nanoseconds::zero()) return;
+    ::std::this_thread::sleep_until(frameStart + targetFrameTime);
+}
+
+/// @brief Queue a mutation without locking.
+/// @param ptrMutation The pointer to the mutation, owned by the queue from here on.
+void ::celerique::internal::Engine::pushMutation(EngineMutation* ptrMutation) {
+    ptrMutation->ptrNext = _atomicPtrMutations.load(::std::memory_order_relaxed);
+    while (!_atomicPtrMutations.compare_exchange_weak(
+        ptrMutation->ptrNext, ptrMutation, ::std::memory_order_release, ::std::memory_order_relaxed
+    ));
+}
+
+/// @brief Apply the queued mutations in the order they were queued, publishing new
+/// layer and window arrays if anything was added. Called by the update thread between frames.
+void ::celerique::internal::Engine::applyMutations() {
+    // Most frames queue nothing, skip the read-modify-write then.
+    if (_atomicPtrMutations.load(::std::memory_order_relaxed) == nullptr) return;
+    /// @brief The most recently queued mutation.
+    EngineMutation* ptrMutation = _atomicPtrMutations.exchange(nullptr, ::std::memory_order_acquire);
+
+    // The queue links newest to oldest, reverse it to apply in queue order.
+    /// @brief The oldest mutation not yet applied.
+    EngineMutation* ptrOldestMutation = nullptr;
+    while (ptrMutation != nullptr) {
+        /// @brief The mutation queued before this one.
+        EngineMutation* ptrNext = ptrMutation->ptrNext;
+        ptrMutation->ptrNext = ptrOldestMutation;
+        ptrOldestMutation = ptrMutation;
+        ptrMutation = ptrNext;
+    }
+
+    /// @brief The next array of application layers.
+    ::std::unique_ptr<::std::vector<ApplicationLayerBase*>> ptrVecAppLayers =
+        ::std::make_unique<::std::vector<ApplicationLayerBase*>>(*_atomicPtrVecAppLayers.load(::std::memory_order_relaxed));
+    /// @brief Whether a layer was added.
+    bool isAddingLayers = false;
+    while (ptrOldestMutation != nullptr) {
+        if (ptrOldestMutation->ptrAppLayer) {
+            ptrOldestMutation->ptrAppLayer->addEventListener(this);
+            ptrVecAppLayers->push_back(ptrOldestMutation->ptrAppLayer.get());
+            isAddingLayers = true;
+            _vecLayerSchedules.push_back(scheduleLayer(ptrOldestMutation->ptrAppLayer->updateCadence()));
+            _listPtrAppLayers.emplace_back(::std::move(ptrOldestMutation->ptrAppLayer));
+            celeriqueLogTrace("Added a layer.");
+        }
+        if (ptrOldestMutation->ptrWindow) {
+            ptrOldestMutation->ptrWindow->addEventListener(this);
+            _vecWindows.push_back(ptrOldestMutation->ptrWindow.get());
+            _listPtrWindows.emplace_back(::std::move(ptrOldestMutation->ptrWindow));
+            celeriqueLogTrace("Added a graphical user interface window.");
+        }
+        /// @brief The mutation queued after this one.
+        EngineMutation* ptrNext = ptrOldestMutation->ptrNext;
+        delete ptrOldestMutation;
+        ptrOldestMutation = ptrNext;
+    }
+    if (isAddingLayers) publishLayers(::std::move(ptrVecAppLayers));
+}
+
+/// @brief Publish a new array of application layers and the event routes built from it.
+/// Called by the update thread.
+/// @param ptrVecAppLayers The unique pointer to the application layers in update order.
+void ::celerique::internal::Engine::publishLayers(::std::unique_ptr<::std::vector<ApplicationLayerBase*>>&& ptrVecAppLayers) {
+    _listPublishedEventRoutes.emplace_back(buildEventRoutes(*ptrVecAppLayers));
+    _listPublishedVecAppLayers.emplace_back(::std::move(ptrVecAppLayers));
+    _atomicPtrEventRoutes.store(_listPublishedEventRoutes.back().get(), ::std::memory_order_release);
+    _atomicPtrVecAppLayers.store(_listPublishedVecAppLayers.back().get(), ::std::memory_order_release);
+}
+
+/// @brief Queue an event for the layers batching their events, in the batch of its type and source window.
+/// @param ptrEvent The shared pointer to the event.
+void ::celerique::internal::Engine::queueBatchedEvent(::std::shared_ptr<EventBase>&& ptrEvent) {
+    /// @brief The type of the event.
+    ::std::type_index typeId = ptrEvent->typeID();
+    ::std::lock_guard<::std::mutex> lock(_queuedBatchesMutex);
+    _atomicNumQueuedBatchedEvents.fetch_add(1, ::std::memory_order_relaxed);
+    // A frame only sees a handful of event types and windows, a linear search beats hashing.
+    for (EventBatch& batch : _vecQueuedBatches) {
+        if (batch.typeId == typeId && batch.sourceWindowId == ptrEvent->sourceWindowId()) {
+            batch.vecEvents.push_back(::std::move(ptrEvent));
+            return;
+        }
+    }
+    _vecQueuedBatches.push_back({typeId, ptrEvent->sourceWindowId(), {}});
+    _vecQueuedBatches.back().vecEvents.push_back(::std::move(ptrEvent));
+}
+
+/// @brief Deliver the events queued for the layers batching them, one span per batch.
+/// Called by the update thread.
+void ::celerique::internal::Engine::deliverEventBatches() {
+    // Most updates have nothing queued, skip the lock then. Events queued meanwhile are delivered next update.
+    if (_atomicNumQueuedBatchedEvents.load(::std::memory_order_relaxed) == 0) return;
+    {
+        ::std::lock_guard<::std::mutex> lock(_queuedBatchesMutex);
+        _atomicNumQueuedBatchedEvents.store(0, ::std::memory_order_relaxed);
+        // The emptied batches delivered last time are queued into next, so a steady stream of events does not allocate.
+        _vecQueuedBatches.swap(_vecDeliveringBatches);
+    }
+    for (EventBatch& batch : _vecDeliveringBatches) {
+        if (batch.vecEvents.empty()) continue;
+        /// @brief The layers receiving the batch, routed the same way as `onEvent`.
+        const ::std::vector<ApplicationLayerBase*>* ptrVecTargetLayers = _atomicPtrVecAppLayers.load(::std::memory_order_relaxed);
+        if (batch.sourceWindowId != CELERIQUE_WINDOW_ID_NULL) {
+            /// @brief The routes of window events.
+            const EventRoutes* ptrEventRoutes = _atomicPtrEventRoutes.load(::std::memory_order_relaxed);
+            auto windowLayersIterator = ptrEventRoutes->mapWindowLayers.find(batch.sourceWindowId);
+            ptrVecTargetLayers = windowLayersIterator != ptrEventRoutes->mapWindowLayers.end() ?
+                &windowLayersIterator->second : &ptrEventRoutes->vecUnsubscribedLayers;
+        }
+        /// @brief The events of the batch.
+        EventSpan span(batch.typeId, batch.vecEvents.data(), batch.vecEvents.size());
+        for (auto layerRIterator = ptrVecTargetLayers->rbegin(); layerRIterator != ptrVecTargetLayers->rend(); layerRIterator++) {
+            if ((*layerRIterator)->isBatchingEvents()) (*layerRIterator)->onEventBatch(span);
+        }
+        batch.vecEvents.clear();
+    }
+}
+
+/// @brief Build the routes of window events from the windows each layer subscribed to.
+/// @param vecAppLayers The application layers in update order.
+/// @return The shared pointer to the routes.
+::std::shared_ptr<::celerique::internal::EventRoutes> celerique::internal::Engine::buildEventRoutes(
+    const ::std::vector<ApplicationLayerBase*>& vecAppLayers
+) {
+    /// @brief The routes being built.
+    ::std::shared_ptr<EventRoutes> ptrEventRoutes = ::std::make_shared<EventRoutes>();
+    // Every subscribed window gets a route first, so unsubscribed layers before its subscribers are kept in it.
+    for (ApplicationLayerBase* ptrAppLayer : vecAppLayers) {
+        for (WindowID windowId : ptrAppLayer->subscribedWindowIds()) ptrEventRoutes->mapWindowLayers[windowId];
+    }
+    for (ApplicationLayerBase* ptrAppLayer : vecAppLayers) {
+        /// @brief The windows the layer subscribed to.
+        const ::std::vector<WindowID>& vecSubscribedWindowIds = ptrAppLayer->subscribedWindowIds();
+        if (vecSubscribedWindowIds.empty()) {
+            ptrEventRoutes->vecUnsubscribedLayers.push_back(ptrAppLayer);
+            for (auto& windowLayers : ptrEventRoutes->mapWindowLayers) windowLayers.second.push_back(ptrAppLayer);
+            continue;
+        }
+        for (WindowID windowId : vecSubscribedWindowIds) {
+            /// @brief The layers receiving the window's events so far.
+            ::std::vector<ApplicationLayerBase*>& vecWindowLayers = ptrEventRoutes->mapWindowLayers[windowId];
+            // A window listed twice still delivers once.
+            if (vecWindowLayers.empty() || vecWindowLayers.back() != ptrAppLayer) vecWindowLayers.push_back(ptrAppLayer);
+        }
+    }
+    return ptrEventRoutes;
+}
+
+/// @brief Build the update schedule of a layer being added, picking a staggered phase when asked to.
+/// @param cadence The cadence the layer declared.
+/// @return The update schedule.
+::celerique::internal::LayerSchedule celerique::internal::Engine::scheduleLayer(const LayerUpdateCadence& cadence) {
+    /// @brief The update schedule.
+    LayerSchedule schedule;
+    /// @brief Whether the cadence is a rate rather than a number of frames.
+    bool isRateBased = cadence.targetRate > 0.0;
+    if (!isRateBased && cadence.everyNthFrame == 0) {
+        celeriqueLogWarning("A layer asked to be updated every 0th frame. Updating it every frame.");
+    }
+    if (!isRateBased && cadence.everyNthFrame <= 1) return schedule;
+    schedule.isEveryUpdate = false;
+    /// @brief The phase as a fraction of the period, negative to be picked here.
+    double phase = cadence.phase;
+    if (phase >= 1.0) {
+        celeriqueLogWarning("A layer's update phase is not below 1. Wrapping it around.");
+        phase -= ::std::floor(phase);
+    }
+
+    if (isRateBased) {
+        schedule.periodNanoSecs = ::std::chrono::nanoseconds(
+            ::std::max(static_cast<int64_t>(1e9 / cadence.targetRate), static_cast<int64_t>(1))
+        );
+        // Successive multiples of the golden ratio spread any number of phases evenly.
+        if (phase < 0.0) {
+            phase = static_cast<double>(_numStaggeredRateLayers++) * 0.6180339887498949;
+            phase -= ::std::floor(phase);
+        }
+        schedule.untilNextUpdate = ::std::chrono::nanoseconds(
+            static_cast<int64_t>(static_cast<double>(schedule.periodNanoSecs.count()) * phase)
+        );
+        return schedule;
+    }
+
+    schedule.periodFrames = cadence.everyNthFrame;
+    if (phase >= 0.0) {
+        schedule.phaseFrames = static_cast<uint32_t>(phase * static_cast<double>(schedule.periodFrames));
+        return schedule;
+    }
+    // Pick the phase sharing frames with the fewest frame based layers. Two layers share
+    // frames periodically when their phases agree modulo the gcd of their periods.
+    /// @brief The fewest layers sharing frames with a phase so far.
+    size_t fewestCollisions = SIZE_MAX;
+    for (uint32_t candidatePhase = 0; candidatePhase < schedule.periodFrames; candidatePhase++) {
+        /// @brief The number of layers sharing frames with the candidate phase.
+        size_t numCollisions = 0;
+        for (const LayerSchedule& otherSchedule : _vecLayerSchedules) {
+            if (otherSchedule.isEveryUpdate || otherSchedule.periodNanoSecs > ::std::chrono::nanoseconds::zero()) continue;
+            /// @brief The greatest common divisor of the two periods.
+            uint32_t commonPeriod = ::std::gcd(schedule.periodFrames, otherSchedule.periodFrames);
+            if (candidatePhase % commonPeriod == otherSchedule.phaseFrames % commonPeriod) numCollisions++;
+        }
+        if (numCollisions < fewestCollisions) {
+            fewestCollisions = numCollisions;
+            schedule.phaseFrames = candidatePhase;
+        }
+    }
+    return schedule;
+}
+
+/// @brief Have every application layer record its snapshot into the mailbox's write slot.
+/// @return The reference to the snapshots written, one per layer.
+::std::vector<::celerique::RenderSnapshot>& celerique::internal::Engine::writeSnapshots() {
+    /// @brief The snapshots of this frame.
+    ::std::vector<RenderSnapshot>& vecSnapshots = _mailboxSnapshots.writeSlot();
+
+    /// @brief The application layers.
+    const ::std::vector<ApplicationLayerBase*>& vecAppLayers = *_atomicPtrVecAppLayers.load(::std::memory_order_relaxed);
+    vecSnapshots.resize(vecAppLayers.size());
+    /// @brief The snapshot of the layer being recorded.
+    ::std::vector<RenderSnapshot>::iterator snapshotIterator = vecSnapshots.begin();
+    for (ApplicationLayerBase* ptrAppLayer : vecAppLayers) {
+        snapshotIterator->reset(_nextFrameIndex);
+        ptrAppLayer->onWriteSnapshot(*snapshotIterator);
+        snapshotIterator++;
+    }
+    _nextFrameIndex++;
+    return vecSnapshots;
+}
+
+/// @brief Have every application layer render its snapshot.
+/// @param vecSnapshots The snapshots, one per layer.
+void ::celerique::internal::Engine::renderSnapshots(const ::std::vector<RenderSnapshot>& vecSnapshots) {
+    /// @brief The application layers, which the render thread must load atomically.
+    const ::std::vector<ApplicationLayerBase*>* ptrVecAppLayers = _atomicPtrVecAppLayers.load(::std::memory_order_acquire);
+
+    // Layers added after the snapshots were written have nothing to render yet.
+    /// @brief The snapshot of the layer being rendered.
+    ::std::vector<RenderSnapshot>::const_iterator snapshotIterator = vecSnapshots.begin();
+    for (ApplicationLayerBase* ptrAppLayer : *ptrVecAppLayers) {
+        if (snapshotIterator == vecSnapshots.end()) break;
+        ptrAppLayer->onRender(*snapshotIterator);
+        snapshotIterator++;
+    }
+}
+
+/// @brief The render thread's loop, rendering published snapshots until it is told to stop
+/// and every published snapshot was rendered.
+void ::celerique::internal::Engine::renderThreadLoop() {
+    celeriqueLogTrace("Started render thread.");
+    while (true) {
+        {
+            ::std::unique_lock<::std::mutex> lock(_mailboxMutex);
+            _condVarMailbox.wait(lock, [this]() {
+                return _mailboxSnapshots.hasFresh() || !_atomicShouldRenderThreadRun.load();
+            });
+        }
+        /// @brief The newest snapshots published.
+        const ::std::vector<RenderSnapshot>* ptrVecSnapshots = _mailboxSnapshots.consume();
+        // Told to stop with nothing left to render.
+        if (ptrVecSnapshots == nullptr) break;
+        // Let an update thread waiting on this frame record the next one while this one renders.
+        { ::std::lock_guard<::std::mutex> lock(_mailboxMutex); }
+        _condVarMailbox.notify_all();
+        renderSnapshots(*ptrVecSnapshots);
+    }
+    celeriqueLogTrace("Ended render thread.");
+}
+
+/// @brief Member init constructor.
+/// @param isProcessDefault Whether this is the process default engine, which receives the completion
+/// events of loads asked for without an engine. There must only be one.
+::celerique::internal::Engine::Engine(bool isProcessDefault) : _isProcessDefault(isProcessDefault) {
+    publishLayers(::std::make_unique<::std::vector<ApplicationLayerBase*>>());
+    AssetManager::getRef().addRequester(this);
+    if (_isProcessDefault) AssetManager::getRef().addEventListener(this);
     celeriqueLogDebug("Initialized engine.");
 }
 
-/// @brief Private destructor to prevent external deletion.
+/// @brief Destructor.
 ::celerique::internal::Engine::~Engine() {
+    AssetManager::getRef().removeRequester(this);
+    // Free the mutations queued after the last update.
+    /// @brief The most recently queued mutation.
+    EngineMutation* ptrMutation = _atomicPtrMutations.exchange(nullptr);
+    while (ptrMutation != nullptr) {
+        /// @brief The mutation queued before this one.
+        EngineMutation* ptrNext = ptrMutation->ptrNext;
+        delete ptrMutation;
+        ptrMutation = ptrNext;
+    }
     celeriqueLogDebug("Destroyed engine.");
 }
 
@@ -147,6 +651,117 @@ void ::celerique::run() {
     internal::Engine::getRef().run();
 }
 
+/// @brief Set the time each iteration of the application run loop aims to take. Iterations finishing early
+/// spend the rest on background work, then sleep.
+/// @param targetFrameTime The target frame time. Zero runs iterations back to back, with no background budget.
+void ::celerique::setTargetFrameTime(::std::chrono::nanoseconds targetFrameTime) {
+    internal::Engine::getRef().setTargetFrameTime(targetFrameTime);
+}
+
+/// @brief Set where and how the application layers' render snapshots are rendered.
+/// Takes effect the next time the application run loop starts.
+/// @param renderThreadMode The render thread mode.
+void ::celerique::setRenderThreadMode(RenderThreadMode renderThreadMode) {
+    internal::Engine::getRef().setRenderThreadMode(renderThreadMode);
+}
+
+/// @brief Checkpoint the engine and every application layer into a state snapshot, replacing its contents.
+/// @param snapshot The snapshot to write into.
+void ::celerique::saveEngineState(StateSnapshot& snapshot) {
+    internal::Engine::getRef().saveState(snapshot);
+}
+
+/// @brief Roll the engine and every application layer back to a state snapshot.
+/// @param snapshot The snapshot to read from.
+void ::celerique::restoreEngineState(const StateSnapshot& snapshot) {
+    internal::Engine::getRef().restoreState(snapshot);
+}
+
+/// @brief Updates the state of the engine instance.
+/// @param ptrUpdateData The shared pointer to the update data container.
+void ::celerique::EngineContext::onUpdate(::std::shared_ptr<EngineUpdateData> ptrUpdateData) {
+    _ptrEngine->onUpdate(::std::move(ptrUpdateData));
+}
+
+/// @brief Add an application layer to be managed by the engine instance. Safe to call from any thread.
+/// @param ptrAppLayer The unique pointer to the application layer instance.
+void ::celerique::EngineContext::addAppLayer(::std::unique_ptr<ApplicationLayerBase>&& ptrAppLayer) {
+    _ptrEngine->addAppLayer(::std::move(ptrAppLayer));
+}
+
+/// @brief Add a graphical user interface window to be managed by the engine instance. Safe to call from any thread.
+/// @param ptrWindow The unique pointer to the window instance.
+void ::celerique::EngineContext::addWindow(::std::unique_ptr<WindowBase>&& ptrWindow) {
+    _ptrEngine->addWindow(::std::move(ptrWindow));
+}
+
+/// @brief Creates and run the engine instance's application run loop on the calling thread.
+void ::celerique::EngineContext::run() {
+    _ptrEngine->run();
+}
+
+/// @brief Set the time each iteration of the instance's application run loop aims to take.
+/// @param targetFrameTime The target frame time. Zero runs iterations back to back, with no background budget.
+void ::celerique::EngineContext::setTargetFrameTime(::std::chrono::nanoseconds targetFrameTime) {
+    _ptrEngine->setTargetFrameTime(targetFrameTime);
+}
+
+/// @brief Set where and how the instance's application layers' render snapshots are rendered.
+/// @param renderThreadMode The render thread mode.
+void ::celerique::EngineContext::setRenderThreadMode(RenderThreadMode renderThreadMode) {
+    _ptrEngine->setRenderThreadMode(renderThreadMode);
+}
+
+/// @brief Submit background work to be run in slices in the instance's updates.
+/// @param task The background work.
+/// @param priority The priority of the work.
+void ::celerique::EngineContext::submitBackgroundTask(BackgroundTask&& task, BackgroundPriority priority) {
+    _ptrEngine->backgroundScheduler().submit(::std::move(task), priority);
+}
+
+/// @brief The statistics of the instance's background work scheduler.
+/// @return A copy of the statistics.
+::celerique::BackgroundSchedulerStats celerique::EngineContext::backgroundSchedulerStats() {
+    return _ptrEngine->backgroundScheduler().stats();
+}
+
+/// @brief Checkpoint the engine instance and every application layer into a state snapshot, replacing its contents.
+/// @param snapshot The snapshot to write into.
+void ::celerique::EngineContext::saveState(StateSnapshot& snapshot) {
+    _ptrEngine->saveState(snapshot);
+}
+
+/// @brief Roll the engine instance and every application layer back to a state snapshot.
+/// @param snapshot The snapshot to read from.
+void ::celerique::EngineContext::restoreState(const StateSnapshot& snapshot) {
+    _ptrEngine->restoreState(snapshot);
+}
+
+/// @brief Request an asset to be loaded in the background, completing on the engine instance.
+/// @param filePath The path of the file to load the asset from.
+/// @param priority The priority of the load request.
+/// @param decoder The decoder run on a job worker. Defaults to storing the raw bytes as a `::std::vector<Byte>`.
+/// @return The handle to the requested asset.
+::celerique::AssetHandle celerique::EngineContext::loadAsset(
+    const ::std::string& filePath, AssetPriority priority, AssetDecoder&& decoder
+) {
+    return AssetHandle(internal::AssetManager::getRef().load(filePath, priority, ::std::move(decoder), _ptrEngine.get()));
+}
+
+#if defined(CELERIQUE_COROUTINES_ENABLED)
+/// @brief Start a task on a job worker, its suspensions resumed by the instance's updates.
+/// @param task The task to be started.
+void ::celerique::EngineContext::spawnTask(Task<void>&& task) {
+    internal::spawnTask(&_ptrEngine->taskScheduler(), ::std::move(task));
+}
+#endif
+
+/// @brief Default constructor. Creates an engine instance.
+::celerique::EngineContext::EngineContext() : _ptrEngine(::std::make_unique<internal::Engine>()) {}
+
+/// @brief Destructor. Destroys the engine instance with its layers and windows.
+::celerique::EngineContext::~EngineContext() {}
+
 /// @brief Initializer constructor.
 /// @param elapsedNanoSecs The amount of time in nano seconds that passed since the last update cycle.
 ::celerique::EngineUpdateData::EngineUpdateData(::std::chrono::nanoseconds&& elapsedNanoSecs) :
@@ -167,5 +782,40 @@ int64_t celerique::EngineUpdateData::elapsedMilliSecs() const {
     return ::std::chrono::duration_cast<::std::chrono::milliseconds>(_elapsedNanoSecs).count();
 }
 
+/// @brief Record what the layer renders this frame. Called on the update thread after every layer updated.
+/// @param snapshot The snapshot to record into, cleared for this frame.
+void ::celerique::ApplicationLayerBase::onWriteSnapshot(RenderSnapshot& /* snapshot */) {}
+
+/// @brief Submit a snapshot the layer recorded.
+/// @param snapshot The snapshot to render.
+void ::celerique::ApplicationLayerBase::onRender(const RenderSnapshot& /* snapshot */) {}
+
+/// @brief Write the layer's state into sections of a snapshot being checkpointed.
+/// @param snapshot The snapshot to write into.
+void ::celerique::ApplicationLayerBase::onSaveState(StateSnapshot& /* snapshot */) {}
+
+/// @brief Roll the layer's state back to the sections it wrote into a snapshot.
+/// @param snapshot The snapshot to read from.
+void ::celerique::ApplicationLayerBase::onRestoreState(const StateSnapshot& /* snapshot */) {}
+
+/// @brief Handle a run of events of the same type at once.
+/// @param span The events, in the order they were broadcast.
+void ::celerique::ApplicationLayerBase::onEventBatch(const EventSpan& span) {
+    for (const ::std::shared_ptr<EventBase>& ptrEvent : span) {
+        if (ptrEvent->shouldPropagate()) onEvent(ptrEvent);
+    }
+}
+
+/// @brief Request an asset to be loaded in the background, completing on the engine the layer was added to.
+/// @param filePath The path of the file to load the asset from.
+/// @param priority The priority of the load request.
+/// @param decoder The decoder run on a job worker. Defaults to storing the raw bytes as a `::std::vector<Byte>`.
+/// @return The handle to the requested asset.
+::celerique::AssetHandle celerique::ApplicationLayerBase::loadAsset(
+    const ::std::string& filePath, AssetPriority priority, AssetDecoder&& decoder
+) {
+    return AssetHandle(internal::AssetManager::getRef().load(filePath, priority, ::std::move(decoder), _ptrEngine));
+}
+
 /// @brief Pure virtual destructor.
 ::celerique::ApplicationLayerBase::~ApplicationLayerBase() {}
\ No newline at end of file
@@ -10,6 +10,19 @@ License: Mozilla Public License 2.0. (See ./LICENSE).
 
 #include <celerique/graphics.h>
 
+#include <mutex>
+
+/// @brief The next value of `WindowID` to be generated.
+static ::celerique::WindowID nextWindowId = CELERIQUE_WINDOW_ID_NULL;
+/// @brief The mutex object restricting access to `nextWindowId`.
+static ::std::mutex nextWindowIdMutex;
+/// @brief Generate a process-wide unique window identifier.
+/// @return The generated `WindowID`.
+static ::celerique::WindowID genWindowId() {
+    ::std::lock_guard<::std::mutex> writeLock(nextWindowIdMutex);
+    return ++nextWindowId;
+}
+
 void ::celerique::WindowBase::useGraphicsApi(::std::shared_ptr<IGraphicsAPI> ptrGraphicsApi) {
     ::std::shared_ptr<IGraphicsAPI> ptrPrevGraphicsApi = _weakPtrGraphicsApi.lock();
     if (ptrPrevGraphicsApi != nullptr) {
@@ -23,6 +36,20 @@ void ::celerique::WindowBase::useGraphicsApi(::std::shared_ptr<IGraphicsAPI> ptr
     _weakPtrGraphicsApi = ptrGraphicsApi;
 }
 
+/// @brief Dispatch event to the listeners, marking this window as its source
+/// unless the event already carries one.
+/// @param ptrEvent The pointer to the event to be dispatched.
+/// @param strategy The dispatch strategy (blocking by default.)
+void ::celerique::WindowBase::broadcast(const ::std::shared_ptr<EventBase>& ptrEvent, EventHandlingStrategy strategy) {
+    if (ptrEvent != nullptr && ptrEvent->sourceWindowId() == CELERIQUE_WINDOW_ID_NULL) {
+        ptrEvent->setSourceWindowId(_windowId);
+    }
+    EventBroadcasterBase::broadcast(ptrEvent, strategy);
+}
+
+/// @brief Default constructor. Assigns the next unique window identifier.
+::celerique::WindowBase::WindowBase() : _windowId(genWindowId()) {}
+
 /// @brief Virtual destructor.
 ::celerique::WindowBase::~WindowBase() {
     ::std::shared_ptr<IGraphicsAPI> ptrPrevGraphicsApi = _weakPtrGraphicsApi.lock();
@@ -32,5 +59,21 @@ void ::celerique::WindowBase::useGraphicsApi(::std::shared_ptr<IGraphicsAPI> ptr
     }
 }
 
+/// @brief Reuse the commands recorded for a draw while its pipeline, vertices, indices and
+/// target image stay the same. Does nothing unless the graphics API supports it.
+/// @param isEnabled Whether to cache recorded commands.
+void ::celerique::IGraphicsAPI::setCommandBufferCaching(bool /* isEnabled */) {}
+
+/// @brief The statistics of the command buffers cached for unchanged draws.
+/// @return A copy of the statistics. All zero unless the graphics API supports caching.
+::celerique::CommandBufferCacheStats celerique::IGraphicsAPI::commandBufferCacheStats() {
+    return CommandBufferCacheStats();
+}
+
+/// @brief Render each draw once into an offscreen image, then scale it into every window sharing
+/// a device. Does nothing unless the graphics API supports it.
+/// @param isEnabled Whether windows share one rendering of the scene.
+void ::celerique::IGraphicsAPI::setSharedSceneRendering(bool /* isEnabled */) {}
+
 /// @brief Pure virtual destructor.
 ::celerique::IGraphicsAPI::~IGraphicsAPI() {}
\ No newline at end of file
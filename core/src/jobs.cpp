@@ -0,0 +1,182 @@
+/*
+
+File: ./core/src/jobs.cpp
+Author: Aldhinn Espinas
+Description: This source file contains implementations of the engine's job workers.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique/jobs.h>
+#include <celerique/logging.h>
+
+#include <utility>
+#include <exception>
+#include <atomic>
+#include <memory>
+#include <algorithm>
+
+/// @brief Member init constructor.
+/// @param numWorkers The number of worker threads to be spawned.
+/// Defaults to the number of hardware threads when set to 0.
+::celerique::ThreadPool::ThreadPool(size_t numWorkers) {
+    if (numWorkers == 0) {
+        numWorkers = static_cast<size_t>(::std::thread::hardware_concurrency());
+    }
+    // `hardware_concurrency` is allowed to return 0 if it cannot tell.
+    if (numWorkers == 0) numWorkers = 1;
+
+    _vecWorkerThreads.reserve(numWorkers);
+    for (size_t i = 0; i < numWorkers; i++) {
+        _vecWorkerThreads.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+/// @brief Submit a job to be executed by one of the worker threads.
+/// @param job The job to be executed.
+void ::celerique::ThreadPool::submit(Job&& job) {
+    {
+        ::std::lock_guard<::std::mutex> writeLock(_jobsMutex);
+        _queueJobs.emplace_back(::std::move(job));
+    }
+    _condVarJobAvailable.notify_one();
+}
+
+/// @brief Block the calling thread until the job queue is empty and no job is executing.
+void ::celerique::ThreadPool::waitIdle() {
+    ::std::unique_lock<::std::mutex> lock(_jobsMutex);
+    _condVarIdle.wait(lock, [&]() { return _queueJobs.empty() && _numRunningJobs == 0; });
+}
+
+/// @brief The number of worker threads.
+/// @return The size of `_vecWorkerThreads`.
+size_t celerique::ThreadPool::numWorkers() const {
+    return _vecWorkerThreads.size();
+}
+
+/// @brief The routine each worker thread runs until the pool is destroyed.
+void ::celerique::ThreadPool::workerLoop() {
+    while (true) {
+        /// @brief The job to be executed in this iteration.
+        Job job;
+        {
+            ::std::unique_lock<::std::mutex> lock(_jobsMutex);
+            _condVarJobAvailable.wait(lock, [&]() { return _shouldStop || !_queueJobs.empty(); });
+            // Only exit once every queued job has been picked up.
+            if (_queueJobs.empty()) return;
+
+            job = ::std::move(_queueJobs.front());
+            _queueJobs.pop_front();
+            _numRunningJobs++;
+        }
+
+        try {
+            job();
+        } catch (const ::std::exception& exception) {
+            celeriqueLogError("Uncaught exception in job: " + ::std::string(exception.what()));
+        } catch (...) {
+            celeriqueLogError("Uncaught unknown exception in job.");
+        }
+
+        {
+            ::std::lock_guard<::std::mutex> writeLock(_jobsMutex);
+            _numRunningJobs--;
+            if (_queueJobs.empty() && _numRunningJobs == 0) _condVarIdle.notify_all();
+        }
+    }
+}
+
+/// @brief Destructor. Finishes queued jobs before joining the worker threads.
+::celerique::ThreadPool::~ThreadPool() {
+    {
+        ::std::lock_guard<::std::mutex> writeLock(_jobsMutex);
+        _shouldStop = true;
+    }
+    _condVarJobAvailable.notify_all();
+
+    for (::std::thread& workerThread : _vecWorkerThreads) {
+        if (workerThread.joinable()) workerThread.join();
+    }
+}
+
+/// @brief Gets the engine-wide pool of job workers used for CPU bound work.
+/// @return The reference to the job worker thread pool.
+::celerique::ThreadPool& celerique::getJobWorkers() {
+    /// @brief The singleton pool of job workers.
+    static ThreadPool singletonInst;
+    return singletonInst;
+}
+
+/// @brief Split `numItems` into batches and run them across the job workers.
+/// The calling thread works on batches too, so it is safe to call from a job worker.
+/// Returns once every batch finished, re-throwing the first exception thrown by a batch.
+/// @param numItems The number of items to be processed.
+/// @param batchSize The maximum number of items per batch.
+/// @param rangeJob The work done for each batch.
+void ::celerique::parallelFor(size_t numItems, size_t batchSize, const RangeJob& rangeJob) {
+    if (numItems == 0) return;
+    if (batchSize == 0) batchSize = 1;
+
+    /// @brief The number of batches the items are split into.
+    const size_t numBatches = (numItems + batchSize - 1) / batchSize;
+    if (numBatches == 1) {
+        rangeJob(0, numItems);
+        return;
+    }
+
+    /// @brief The progress shared between the calling thread and the helping workers.
+    struct ParallelForState {
+        /// @brief The index of the next batch to be claimed.
+        ::std::atomic<size_t> nextBatch = 0;
+        /// @brief The number of batches that finished.
+        size_t numFinishedBatches = 0;
+        /// @brief The first exception thrown by a batch.
+        ::std::exception_ptr ptrException;
+        /// @brief The mutex for `numFinishedBatches` and `ptrException`.
+        ::std::mutex mutex;
+        /// @brief Notified when the last batch finished.
+        ::std::condition_variable condVarFinished;
+    };
+    /// @brief Shared so that helpers scheduled after every batch was claimed can still exit safely.
+    ::std::shared_ptr<ParallelForState> ptrState = ::std::make_shared<ParallelForState>();
+
+    /// @brief Claim and run batches until none are left. `rangeJob` is only
+    /// touched after a successful claim, which always happens before this call returns.
+    auto runBatches = [ptrState, numItems, batchSize, numBatches, ptrRangeJob = &rangeJob]() {
+        while (true) {
+            /// @brief The index of the claimed batch.
+            size_t batchIndex = ptrState->nextBatch.fetch_add(1);
+            if (batchIndex >= numBatches) return;
+
+            /// @brief The first item of the batch.
+            size_t begin = batchIndex * batchSize;
+            /// @brief One past the last item of the batch.
+            size_t end = ::std::min(begin + batchSize, numItems);
+            /// @brief The exception thrown by this batch, if any.
+            ::std::exception_ptr ptrException;
+            try {
+                (*ptrRangeJob)(begin, end);
+            } catch (...) {
+                ptrException = ::std::current_exception();
+            }
+
+            ::std::lock_guard<::std::mutex> writeLock(ptrState->mutex);
+            if (ptrException != nullptr && ptrState->ptrException == nullptr) {
+                ptrState->ptrException = ptrException;
+            }
+            if (++ptrState->numFinishedBatches == numBatches) ptrState->condVarFinished.notify_all();
+        }
+    };
+
+    /// @brief The number of workers asked to help.
+    size_t numHelpers = ::std::min(numBatches - 1, getJobWorkers().numWorkers());
+    for (size_t i = 0; i < numHelpers; i++) {
+        getJobWorkers().submit(runBatches);
+    }
+    runBatches();
+
+    ::std::unique_lock<::std::mutex> lock(ptrState->mutex);
+    ptrState->condVarFinished.wait(lock, [&]() { return ptrState->numFinishedBatches == numBatches; });
+    if (ptrState->ptrException != nullptr) ::std::rethrow_exception(ptrState->ptrException);
+}
\ No newline at end of file
@@ -9,6 +9,7 @@ License: Mozilla Public License 2.0. (See ./LICENSE).
 */
 
 #include <celerique/logging.h>
+#include <celerique/recorder.h>
 
 #include <mutex>
 #include <sstream>
@@ -17,6 +18,7 @@ License: Mozilla Public License 2.0. (See ./LICENSE).
 #include <thread>
 #include <filesystem>
 #include <iostream>
+#include <cstring>
 
 /// @brief The synchronization mechanism for critical sections.
 static ::std::mutex celeriqueLoggingMutex;
@@ -68,6 +70,9 @@ void __celeriqueLog(
         return;
     }
 
+    // Every record is kept in memory for crash dumps, whatever the output.
+    ::celerique::flightRecord(CELERIQUE_FLIGHT_RECORD_KIND_LOG, severity, lineNum, message, ::std::strlen(message));
+
     // Convert it to time_t.
     ::std::time_t execTimeInTimeType = ::std::chrono::system_clock::to_time_t(execTime);
     // Get the time information in the localtime.
@@ -107,4 +112,7 @@ void __celeriqueLog(
     } else {
         ::std::cerr << constructedLogMessage;
     }
+    if (severity == CELERIQUE_LOG_MESSAGE_SEVERITY_FATAL) {
+        ::celerique::internal::dumpInstalledFlightRecorder(CELERIQUE_FLIGHT_DUMP_REASON_FATAL_LOG);
+    }
 }
\ No newline at end of file
@@ -0,0 +1,213 @@
+/*
+
+File: ./core/src/lz4.cpp
+Author: Aldhinn Espinas
+Description: This source file contains an LZ4 block format compressor and decompressor.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique/internal/lz4.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/// @brief The shortest match the format can encode.
+static constexpr size_t minMatchLength = 4;
+/// @brief The last bytes of a block are always literals.
+static constexpr size_t numLastLiterals = 5;
+/// @brief The last match has to start at least this many bytes before the end of the block.
+static constexpr size_t matchFindLimit = 12;
+/// @brief The furthest back a match can refer to.
+static constexpr size_t maxMatchOffset = 65535;
+/// @brief The number of bits used to index the match finding hash table.
+static constexpr uint32_t hashLog = 12;
+
+/// @brief Read 4 unaligned bytes.
+/// @param ptr The pointer to the first byte.
+/// @return The bytes as an integer.
+static inline uint32_t read32(const CeleriqueByte* ptr) {
+    /// @brief The read value.
+    uint32_t value;
+    ::std::memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+/// @brief Hash a 4 byte sequence into the match finding table.
+/// @param sequence The 4 byte sequence.
+/// @return The index in the table.
+static inline uint32_t hashSequence(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - hashLog);
+}
+
+/// @brief Write a length value that overflowed its 4 bit token field.
+/// @param ptrDst The pointer to where the length bytes are written.
+/// @param length The remaining length past the 15 held in the token.
+/// @return The pointer past the written bytes.
+static inline CeleriqueByte* writeLengthExtension(CeleriqueByte* ptrDst, size_t length) {
+    while (length >= 255) {
+        *ptrDst++ = static_cast<CeleriqueByte>(255);
+        length -= 255;
+    }
+    *ptrDst++ = static_cast<CeleriqueByte>(length);
+    return ptrDst;
+}
+
+/// @brief Write one sequence of literals optionally followed by a match.
+/// @param ptrDst The pointer to where the sequence is written.
+/// @param ptrLiterals The pointer to the literals.
+/// @param numLiterals The number of literals.
+/// @param matchOffset The distance back to the match or 0 for the final literal-only sequence.
+/// @param matchLength The length of the match.
+/// @return The pointer past the written sequence.
+static CeleriqueByte* writeSequence(
+    CeleriqueByte* ptrDst, const CeleriqueByte* ptrLiterals, size_t numLiterals,
+    size_t matchOffset, size_t matchLength
+) {
+    /// @brief The pointer to the token byte.
+    CeleriqueByte* ptrToken = ptrDst++;
+    /// @brief The token value.
+    uint8_t token = static_cast<uint8_t>((numLiterals >= 15 ? 15 : numLiterals) << 4);
+    if (numLiterals >= 15) ptrDst = writeLengthExtension(ptrDst, numLiterals - 15);
+    ::std::memcpy(ptrDst, ptrLiterals, numLiterals);
+    ptrDst += numLiterals;
+
+    if (matchOffset != 0) {
+        *ptrDst++ = static_cast<CeleriqueByte>(matchOffset & 0xFF);
+        *ptrDst++ = static_cast<CeleriqueByte>((matchOffset >> 8) & 0xFF);
+
+        /// @brief The match length as encoded.
+        size_t encodedLength = matchLength - minMatchLength;
+        token |= static_cast<uint8_t>(encodedLength >= 15 ? 15 : encodedLength);
+        if (encodedLength >= 15) ptrDst = writeLengthExtension(ptrDst, encodedLength - 15);
+    }
+
+    *ptrToken = static_cast<CeleriqueByte>(token);
+    return ptrDst;
+}
+
+/// @brief Compress into a single LZ4 block (no frame header).
+/// @param ptrSrc The pointer to the data to be compressed.
+/// @param srcSize The size of the data to be compressed.
+/// @param ptrDst The pointer to the destination buffer of at least `lz4CompressBound(srcSize)` bytes.
+/// @return The size of the compressed block.
+size_t celerique::internal::lz4Compress(const CeleriqueByte* ptrSrc, size_t srcSize, CeleriqueByte* ptrDst) {
+    /// @brief The current write position.
+    CeleriqueByte* ptrOut = ptrDst;
+    /// @brief The start of the literals not yet written.
+    size_t anchor = 0;
+
+    if (srcSize > matchFindLimit) {
+        /// @brief The last position a match may start at.
+        const size_t matchStartLimit = srcSize - matchFindLimit;
+        /// @brief The last position a match may extend to.
+        const size_t matchEndLimit = srcSize - numLastLiterals;
+        /// @brief The most recent position of each hashed sequence, offset by one so that 0 means empty.
+        ::std::vector<uint32_t> vecHashTable(static_cast<size_t>(1) << hashLog, 0);
+
+        /// @brief The current read position.
+        size_t position = 0;
+        while (position < matchStartLimit) {
+            /// @brief The sequence starting at the current position.
+            uint32_t sequence = read32(ptrSrc + position);
+            /// @brief The table slot of the sequence.
+            uint32_t& refSlot = vecHashTable[hashSequence(sequence)];
+            /// @brief The previous position the sequence was hashed at (offset by one).
+            size_t candidate = refSlot;
+            refSlot = static_cast<uint32_t>(position + 1);
+
+            if (candidate == 0 || position + 1 - candidate > maxMatchOffset ||
+            read32(ptrSrc + candidate - 1) != sequence) {
+                position++;
+                continue;
+            }
+            candidate--;
+
+            /// @brief The length of the match.
+            size_t matchLength = minMatchLength;
+            while (position + matchLength < matchEndLimit &&
+            ptrSrc[candidate + matchLength] == ptrSrc[position + matchLength]) {
+                matchLength++;
+            }
+
+            ptrOut = writeSequence(
+                ptrOut, ptrSrc + anchor, position - anchor, position - candidate, matchLength
+            );
+            position += matchLength;
+            anchor = position;
+        }
+    }
+
+    ptrOut = writeSequence(ptrOut, ptrSrc + anchor, srcSize - anchor, 0, 0);
+    return static_cast<size_t>(ptrOut - ptrDst);
+}
+
+/// @brief Decompress a single LZ4 block. Every read and write is bounds checked.
+/// @param ptrSrc The pointer to the compressed block.
+/// @param srcSize The size of the compressed block.
+/// @param ptrDst The pointer to the destination buffer.
+/// @param dstSize The exact size of the decompressed data.
+/// @return `true` if the block was well formed and decompressed to exactly `dstSize` bytes.
+bool celerique::internal::lz4Decompress(
+    const CeleriqueByte* ptrSrc, size_t srcSize, CeleriqueByte* ptrDst, size_t dstSize
+) {
+    /// @brief The current read position.
+    size_t inPos = 0;
+    /// @brief The current write position.
+    size_t outPos = 0;
+
+    while (inPos < srcSize) {
+        /// @brief The token of the sequence.
+        uint8_t token = static_cast<uint8_t>(ptrSrc[inPos++]);
+
+        /// @brief The number of literals in the sequence.
+        size_t numLiterals = token >> 4;
+        if (numLiterals == 15) {
+            /// @brief The current length extension byte.
+            uint8_t lengthByte = 255;
+            while (lengthByte == 255) {
+                if (inPos >= srcSize) return false;
+                lengthByte = static_cast<uint8_t>(ptrSrc[inPos++]);
+                numLiterals += lengthByte;
+            }
+        }
+        if (numLiterals > srcSize - inPos || numLiterals > dstSize - outPos) return false;
+        ::std::memcpy(ptrDst + outPos, ptrSrc + inPos, numLiterals);
+        inPos += numLiterals;
+        outPos += numLiterals;
+
+        // The last sequence has no match.
+        if (inPos == srcSize) break;
+
+        if (srcSize - inPos < 2) return false;
+        /// @brief The distance back to the match.
+        size_t matchOffset = static_cast<uint8_t>(ptrSrc[inPos]) |
+            (static_cast<size_t>(static_cast<uint8_t>(ptrSrc[inPos + 1])) << 8);
+        inPos += 2;
+        if (matchOffset == 0 || matchOffset > outPos) return false;
+
+        /// @brief The length of the match.
+        size_t matchLength = token & 0x0F;
+        if (matchLength == 15) {
+            /// @brief The current length extension byte.
+            uint8_t lengthByte = 255;
+            while (lengthByte == 255) {
+                if (inPos >= srcSize) return false;
+                lengthByte = static_cast<uint8_t>(ptrSrc[inPos++]);
+                matchLength += lengthByte;
+            }
+        }
+        matchLength += minMatchLength;
+        if (matchLength > dstSize - outPos) return false;
+
+        // Matches may overlap the bytes they produce, so copy one byte at a time.
+        for (size_t i = 0; i < matchLength; i++) {
+            ptrDst[outPos + i] = ptrDst[outPos - matchOffset + i];
+        }
+        outPos += matchLength;
+    }
+
+    return outPos == dstSize;
+}
\ No newline at end of file
@@ -0,0 +1,466 @@
+/*
+
+File: ./core/src/math.cpp
+Author: Aldhinn Espinas
+Description: This source file contains the random number generation and procedural noise implementations.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique/math.h>
+#include <celerique/internal/simd.h>
+
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+/// @brief The multiplier of the first Philox lane pair.
+#define PHILOX_MULTIPLIER_0                                                                 0xD2511F53u
+/// @brief The multiplier of the second Philox lane pair.
+#define PHILOX_MULTIPLIER_1                                                                 0xCD9E8D57u
+/// @brief The increment of the first key word every round (the golden ratio).
+#define PHILOX_KEY_INCREMENT_0                                                              0x9E3779B9u
+/// @brief The increment of the second key word every round (the square root of 3, minus 1).
+#define PHILOX_KEY_INCREMENT_1                                                              0xBB67AE85u
+/// @brief The number of Philox rounds.
+#define PHILOX_NUM_ROUNDS                                                                   10
+/// @brief Converts the top 24 bits of a random integer into a float in [0, 1).
+#define RANDOM_UNIT_SCALE                                                                   (1.0f / 16777216.0f)
+
+/// @brief The odd constants decorrelating the lattice coordinates of each axis before hashing.
+static const uint32_t latticeAxisMultipliers[] = {0x8DA6B343u, 0xD8163841u, 0xCB1AB31Fu, 0x165667B1u};
+
+/// @brief Run the Philox4x32-10 bijection.
+/// @param ptrCounter The 4 integers of the counter.
+/// @param ptrKey The 2 integers of the key.
+/// @param ptrOut The destination receiving 4 integers.
+void ::celerique::CounterRandom::philox(const uint32_t* ptrCounter, const uint32_t* ptrKey, uint32_t* ptrOut) {
+    uint32_t counter0 = ptrCounter[0], counter1 = ptrCounter[1], counter2 = ptrCounter[2], counter3 = ptrCounter[3];
+    uint32_t key0 = ptrKey[0], key1 = ptrKey[1];
+    for (size_t round = 0; round < PHILOX_NUM_ROUNDS; round++) {
+        /// @brief The full products of the multiplied lanes.
+        uint64_t product0 = static_cast<uint64_t>(PHILOX_MULTIPLIER_0) * counter0;
+        uint64_t product1 = static_cast<uint64_t>(PHILOX_MULTIPLIER_1) * counter2;
+        counter0 = static_cast<uint32_t>(product1 >> 32) ^ counter1 ^ key0;
+        counter1 = static_cast<uint32_t>(product1);
+        counter2 = static_cast<uint32_t>(product0 >> 32) ^ counter3 ^ key1;
+        counter3 = static_cast<uint32_t>(product0);
+        key0 += PHILOX_KEY_INCREMENT_0;
+        key1 += PHILOX_KEY_INCREMENT_1;
+    }
+    ptrOut[0] = counter0;
+    ptrOut[1] = counter1;
+    ptrOut[2] = counter2;
+    ptrOut[3] = counter3;
+}
+
+/// @brief Run Philox on 4 consecutive blocks at once, one block per SIMD lane.
+/// @param ptrKey The 2 integers of the key.
+/// @param stream The upper half of the counters.
+/// @param firstCounter The lower half of the first block's counter.
+/// @param ptrOut The destination receiving the 16 integers of the blocks in order.
+static void philoxBlocks4(const uint32_t* ptrKey, uint64_t stream, uint64_t firstCounter, uint32_t* ptrOut) {
+    using namespace ::celerique::internal;
+    /// @brief The low and high words of each block's counter.
+    alignas(16) uint32_t arrCounterLow[4], arrCounterHigh[4];
+    for (uint32_t lane = 0; lane < 4; lane++) {
+        arrCounterLow[lane] = static_cast<uint32_t>(firstCounter + lane);
+        arrCounterHigh[lane] = static_cast<uint32_t>((firstCounter + lane) >> 32);
+    }
+    Uint4 counter0 = loadUint4(arrCounterLow), counter1 = loadUint4(arrCounterHigh);
+    Uint4 counter2 = splatUint4(static_cast<uint32_t>(stream)), counter3 = splatUint4(static_cast<uint32_t>(stream >> 32));
+    Uint4 key0 = splatUint4(ptrKey[0]), key1 = splatUint4(ptrKey[1]);
+    const Uint4 multiplier0 = splatUint4(PHILOX_MULTIPLIER_0), multiplier1 = splatUint4(PHILOX_MULTIPLIER_1);
+    const Uint4 keyIncrement0 = splatUint4(PHILOX_KEY_INCREMENT_0), keyIncrement1 = splatUint4(PHILOX_KEY_INCREMENT_1);
+
+    for (size_t round = 0; round < PHILOX_NUM_ROUNDS; round++) {
+        /// @brief The high halves of the products.
+        Uint4 high0 = multiplyHigh(multiplier0, counter0), high1 = multiplyHigh(multiplier1, counter2);
+        /// @brief The low halves of the products.
+        Uint4 low0 = multiplier0 * counter0, low1 = multiplier1 * counter2;
+        counter0 = high1 ^ counter1 ^ key0;
+        counter1 = low1;
+        counter2 = high0 ^ counter3 ^ key1;
+        counter3 = low0;
+        key0 = key0 + keyIncrement0;
+        key1 = key1 + keyIncrement1;
+    }
+
+    // Each word holds one word of every block. Write the blocks one after the other.
+    /// @brief The words of the blocks.
+    alignas(16) uint32_t arrWords[4][4];
+    storeUint4(arrWords[0], counter0);
+    storeUint4(arrWords[1], counter1);
+    storeUint4(arrWords[2], counter2);
+    storeUint4(arrWords[3], counter3);
+    for (size_t block = 0; block < 4; block++) {
+        for (size_t word = 0; word < 4; word++) ptrOut[block * 4 + word] = arrWords[word][block];
+    }
+}
+
+/// @brief Generate 4 random integers.
+/// @param ptrOut The destination receiving 4 integers.
+void ::celerique::CounterRandom::nextUint4(uint32_t* ptrOut) {
+    /// @brief The counter of the block.
+    uint32_t arrCounter[4] = {
+        static_cast<uint32_t>(_counter), static_cast<uint32_t>(_counter >> 32),
+        static_cast<uint32_t>(_stream), static_cast<uint32_t>(_stream >> 32)
+    };
+    philox(arrCounter, _arrKey, ptrOut);
+    _counter++;
+}
+
+/// @brief Generate 4 random floats in [0, 1).
+/// @param ptrOut The destination receiving 4 floats.
+void ::celerique::CounterRandom::nextFloat4(float* ptrOut) {
+    /// @brief The random integers.
+    alignas(16) uint32_t arrRandom[4];
+    nextUint4(arrRandom);
+    internal::storeFloat4(ptrOut, internal::convertToFloat4(internal::loadUint4(arrRandom) >> 8) *
+        internal::splatFloat4(RANDOM_UNIT_SCALE));
+}
+
+/// @brief Generate many random integers, 4 blocks at a time. The values are the same
+/// as calling `nextUint4` repeatedly.
+/// @param ptrOut The destination.
+/// @param count The number of integers. The generator advances by whole blocks.
+void ::celerique::CounterRandom::fillUint(uint32_t* ptrOut, size_t count) {
+    /// @brief The number of integers written.
+    size_t written = 0;
+    for (; written + 16 <= count; written += 16) {
+        philoxBlocks4(_arrKey, _stream, _counter, ptrOut + written);
+        _counter += 4;
+    }
+    /// @brief The last block, for the integers left.
+    uint32_t arrRandom[4];
+    for (; written < count; written += 4) {
+        nextUint4(arrRandom);
+        ::std::memcpy(ptrOut + written, arrRandom, sizeof(uint32_t) * ::std::min<size_t>(4, count - written));
+    }
+}
+
+/// @brief Generate many random floats in [0, 1), 4 blocks at a time. The values are the
+/// same as calling `nextFloat4` repeatedly.
+/// @param ptrOut The destination.
+/// @param count The number of floats. The generator advances by whole blocks.
+void ::celerique::CounterRandom::fillFloat(float* ptrOut, size_t count) {
+    /// @brief The random integers of 4 blocks.
+    alignas(16) uint32_t arrRandom[16];
+    /// @brief Converts the top 24 bits to [0, 1).
+    const internal::Float4 unitScale = internal::splatFloat4(RANDOM_UNIT_SCALE);
+    /// @brief The number of floats written.
+    size_t written = 0;
+    for (; written + 16 <= count; written += 16) {
+        philoxBlocks4(_arrKey, _stream, _counter, arrRandom);
+        _counter += 4;
+        for (size_t block = 0; block < 4; block++) {
+            internal::storeFloat4(ptrOut + written + block * 4,
+                internal::convertToFloat4(internal::loadUint4(arrRandom + block * 4) >> 8) * unitScale);
+        }
+    }
+    /// @brief The last block, for the floats left.
+    float arrFloats[4];
+    for (; written < count; written += 4) {
+        nextFloat4(arrFloats);
+        ::std::memcpy(ptrOut + written, arrFloats, sizeof(float) * ::std::min<size_t>(4, count - written));
+    }
+}
+
+/// @brief Member init constructor.
+/// @param seed The seed.
+/// @param stream The stream. Different streams of the same seed never overlap.
+::celerique::CounterRandom::CounterRandom(uint64_t seed, uint64_t stream) :
+    _arrKey{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)}, _stream(stream) {}
+
+/// @brief Hash lattice coordinates into well distributed bits (the lowbias32 finalizer).
+/// @param value The combined lattice coordinates and seed.
+/// @return The hashed value.
+static inline ::celerique::internal::Uint4 hashLattice(::celerique::internal::Uint4 value) {
+    using namespace ::celerique::internal;
+    value = value ^ (value >> 16);
+    value = value * splatUint4(0x7FEB352Du);
+    value = value ^ (value >> 15);
+    value = value * splatUint4(0x846CA68Bu);
+    return value ^ (value >> 16);
+}
+
+/// @brief The quintic fade curve, with zero first and second derivatives at 0 and 1.
+/// @param t The lanes in [0, 1].
+/// @return `6t^5 - 15t^4 + 10t^3`.
+static inline ::celerique::internal::Float4 fade(::celerique::internal::Float4 t) {
+    using namespace ::celerique::internal;
+    return t * t * t * (t * (t * splatFloat4(6.0f) - splatFloat4(15.0f)) + splatFloat4(10.0f));
+}
+
+/// @brief The dot product of a hashed gradient and an offset. Gradients have components of
+/// ±1, with one component zeroed from 3 dimensions up (the edge midpoints of a hypercube).
+/// @tparam numDimensions The number of dimensions.
+/// @param hash The hashed corner.
+/// @param ptrOffsets The offset from the corner along each axis.
+/// @return The dot product.
+template<::celerique::ArraySize numDimensions>
+static inline ::celerique::internal::Float4 gradientDot(
+    ::celerique::internal::Uint4 hash, const ::celerique::internal::Float4* ptrOffsets
+) {
+    using namespace ::celerique::internal;
+    /// @brief The axis whose component is zero, from the top 16 bits.
+    Uint4 zeroedAxis = ((hash >> 16) * splatUint4(numDimensions)) >> 16;
+    /// @brief The dot product.
+    Float4 dot = splatFloat4(0.0f);
+    for (::celerique::ArraySize axis = 0; axis < numDimensions; axis++) {
+        // Each low bit of the hash flips the sign of one component.
+        /// @brief The component of the dot product.
+        Float4 component = asFloat4(asUint4(ptrOffsets[axis]) ^ ((hash << (31 - axis)) & splatUint4(0x80000000u)));
+        if (numDimensions > 2) {
+            component = maskFloat4(component, equal(zeroedAxis, splatUint4(axis)) ^ splatUint4(UINT32_MAX));
+        }
+        dot = dot + component;
+    }
+    return dot;
+}
+
+/// @brief Value and Perlin noise: a value per corner of the lattice cell, smoothly interpolated.
+/// @tparam numDimensions The number of dimensions.
+/// @tparam isGradient Whether the corners hold gradients (Perlin) rather than values.
+/// @param ptrCoordinates The coordinates of the 4 points along each axis.
+/// @param seed The seed.
+/// @return The noise.
+template<::celerique::ArraySize numDimensions, bool isGradient>
+static ::celerique::internal::Float4 latticeNoise(
+    const ::celerique::internal::Float4* ptrCoordinates, ::celerique::internal::Uint4 seed
+) {
+    using namespace ::celerique::internal;
+    /// @brief The number of corners of a lattice cell.
+    constexpr size_t numCorners = static_cast<size_t>(1) << numDimensions;
+    /// @brief The offset from the lower and upper corners of the cell along each axis.
+    Float4 arrLowerOffsets[numDimensions], arrUpperOffsets[numDimensions];
+    /// @brief The interpolation factor along each axis.
+    Float4 arrFades[numDimensions];
+    /// @brief The hash inputs of the lower and upper corners of the cell along each axis.
+    Uint4 arrLowerLattice[numDimensions], arrUpperLattice[numDimensions];
+    for (::celerique::ArraySize axis = 0; axis < numDimensions; axis++) {
+        /// @brief The lower corner.
+        Float4 lower = floorFloat4(ptrCoordinates[axis]);
+        arrLowerOffsets[axis] = ptrCoordinates[axis] - lower;
+        arrUpperOffsets[axis] = arrLowerOffsets[axis] - splatFloat4(1.0f);
+        arrFades[axis] = fade(arrLowerOffsets[axis]);
+        arrLowerLattice[axis] = truncateToUint4(lower) * splatUint4(latticeAxisMultipliers[axis]);
+        arrUpperLattice[axis] = arrLowerLattice[axis] + splatUint4(latticeAxisMultipliers[axis]);
+    }
+
+    /// @brief The value of each corner. Bit `n` of the index picks the upper corner along axis `n`.
+    Float4 arrCorners[numCorners];
+    for (size_t corner = 0; corner < numCorners; corner++) {
+        /// @brief The hash of the corner.
+        Uint4 hash = seed;
+        /// @brief The offset from the corner.
+        Float4 arrOffsets[numDimensions];
+        for (::celerique::ArraySize axis = 0; axis < numDimensions; axis++) {
+            /// @brief Whether the corner is the upper one along the axis.
+            bool isUpper = ((corner >> axis) & 1) != 0;
+            hash = hash ^ (isUpper ? arrUpperLattice[axis] : arrLowerLattice[axis]);
+            arrOffsets[axis] = isUpper ? arrUpperOffsets[axis] : arrLowerOffsets[axis];
+        }
+        hash = hashLattice(hash);
+        if (isGradient) {
+            arrCorners[corner] = gradientDot<numDimensions>(hash, arrOffsets);
+        } else {
+            arrCorners[corner] = convertToFloat4(hash >> 8) * splatFloat4(2.0f * RANDOM_UNIT_SCALE) - splatFloat4(1.0f);
+        }
+    }
+
+    // Interpolate away one axis at a time.
+    for (::celerique::ArraySize axis = 0; axis < numDimensions; axis++) {
+        for (size_t corner = 0; corner < (numCorners >> (axis + 1)); corner++) {
+            arrCorners[corner] = arrCorners[corner * 2] +
+                (arrCorners[corner * 2 + 1] - arrCorners[corner * 2]) * arrFades[axis];
+        }
+    }
+    // Gradients reach ±1 on all but one axis, up to 1.5 at the center of a 4D cell.
+    return numDimensions == 4 && isGradient ? arrCorners[0] * splatFloat4(2.0f / 3.0f) : arrCorners[0];
+}
+
+/// @brief Simplex noise: gradients at the corners of the simplex containing each point,
+/// weighted by a radial falloff and summed.
+/// @tparam numDimensions The number of dimensions.
+/// @param ptrCoordinates The coordinates of the 4 points along each axis.
+/// @param seed The seed.
+/// @return The noise.
+template<::celerique::ArraySize numDimensions>
+static ::celerique::internal::Float4 simplexNoise(
+    const ::celerique::internal::Float4* ptrCoordinates, ::celerique::internal::Uint4 seed
+) {
+    using namespace ::celerique::internal;
+    /// @brief The factor skewing the simplex grid into a square lattice.
+    const float skew = (::std::sqrt(numDimensions + 1.0f) - 1.0f) / numDimensions;
+    /// @brief The factor unskewing the square lattice into the simplex grid.
+    const float unskew = (1.0f - 1.0f / ::std::sqrt(numDimensions + 1.0f)) / numDimensions;
+    /// @brief The squared radius of influence of a corner.
+    const float radiusSquared = numDimensions == 2 ? 0.5f : 0.6f;
+    /// @brief Scales the sum of the corners to about [-1, 1].
+    const float scale = numDimensions == 2 ? 70.0f : numDimensions == 3 ? 32.0f : 27.0f;
+
+    /// @brief The sum of the coordinates.
+    Float4 coordinateSum = splatFloat4(0.0f);
+    for (::celerique::ArraySize axis = 0; axis < numDimensions; axis++) coordinateSum = coordinateSum + ptrCoordinates[axis];
+    /// @brief The skew of the points.
+    Float4 pointSkew = coordinateSum * splatFloat4(skew);
+
+    /// @brief The first corner of the cell containing the points, in skewed space.
+    Float4 arrCells[numDimensions];
+    /// @brief The sum of the cell coordinates.
+    Float4 cellSum = splatFloat4(0.0f);
+    for (::celerique::ArraySize axis = 0; axis < numDimensions; axis++) {
+        arrCells[axis] = floorFloat4(ptrCoordinates[axis] + pointSkew);
+        cellSum = cellSum + arrCells[axis];
+    }
+    /// @brief The unskew of the cells.
+    Float4 cellUnskew = cellSum * splatFloat4(unskew);
+
+    /// @brief The offset of the points from the first corner.
+    Float4 arrOffsets[numDimensions];
+    /// @brief The hash inputs of the first corner along each axis.
+    Uint4 arrLattice[numDimensions];
+    for (::celerique::ArraySize axis = 0; axis < numDimensions; axis++) {
+        arrOffsets[axis] = ptrCoordinates[axis] - arrCells[axis] + cellUnskew;
+        arrLattice[axis] = truncateToUint4(arrCells[axis]) * splatUint4(latticeAxisMultipliers[axis]);
+    }
+
+    // The simplex steps along the axes from the largest offset to the smallest.
+    /// @brief The number of axes with a larger offset, ties going to the lower axis.
+    Float4 arrRanks[numDimensions];
+    for (::celerique::ArraySize axis = 0; axis < numDimensions; axis++) {
+        arrRanks[axis] = splatFloat4(0.0f);
+        for (::celerique::ArraySize other = 0; other < numDimensions; other++) {
+            if (other == axis) continue;
+            /// @brief Whether the other axis steps first.
+            Uint4 isBefore = other < axis ? greaterEqual(arrOffsets[other], arrOffsets[axis]) :
+                greaterThan(arrOffsets[other], arrOffsets[axis]);
+            arrRanks[axis] = arrRanks[axis] + maskFloat4(splatFloat4(1.0f), isBefore);
+        }
+    }
+
+    /// @brief The sum of the corners.
+    Float4 noise = splatFloat4(0.0f);
+    for (::celerique::ArraySize corner = 0; corner <= numDimensions; corner++) {
+        /// @brief The hash of the corner.
+        Uint4 hash = seed;
+        /// @brief The offset of the points from the corner.
+        Float4 arrCornerOffsets[numDimensions];
+        /// @brief The squared distance from the corner.
+        Float4 distanceSquared = splatFloat4(0.0f);
+        for (::celerique::ArraySize axis = 0; axis < numDimensions; axis++) {
+            /// @brief Whether the corner has stepped along the axis.
+            Uint4 hasStepped = greaterThan(splatFloat4(static_cast<float>(corner)), arrRanks[axis]);
+            arrCornerOffsets[axis] = arrOffsets[axis] - maskFloat4(splatFloat4(1.0f), hasStepped) +
+                splatFloat4(corner * unskew);
+            hash = hash ^ (arrLattice[axis] + (hasStepped & splatUint4(latticeAxisMultipliers[axis])));
+            distanceSquared = distanceSquared + arrCornerOffsets[axis] * arrCornerOffsets[axis];
+        }
+        /// @brief The radial falloff, zero outside the radius of influence.
+        Float4 falloff = splatFloat4(radiusSquared) - distanceSquared;
+        falloff = maskFloat4(falloff, greaterThan(falloff, splatFloat4(0.0f)));
+        falloff = falloff * falloff;
+        noise = noise + falloff * falloff * gradientDot<numDimensions>(hashLattice(hash), arrCornerOffsets);
+    }
+    return noise * splatFloat4(scale);
+}
+
+/// @brief Sample noise at 4 points.
+/// @param type The noise type.
+/// @param numDimensions The dimensions of the points.
+/// @param ptrCoordinates The coordinates of the 4 points along each axis.
+/// @param seed The seed.
+/// @return The noise.
+static ::celerique::internal::Float4 dispatchNoise(
+    ::celerique::NoiseType type, ::celerique::ArraySize numDimensions,
+    const ::celerique::internal::Float4* ptrCoordinates, ::celerique::internal::Uint4 seed
+) {
+    switch (type) {
+    case CELERIQUE_NOISE_TYPE_VALUE:
+        return numDimensions == 2 ? latticeNoise<2, false>(ptrCoordinates, seed) :
+            numDimensions == 3 ? latticeNoise<3, false>(ptrCoordinates, seed) : latticeNoise<4, false>(ptrCoordinates, seed);
+    case CELERIQUE_NOISE_TYPE_PERLIN:
+        return numDimensions == 2 ? latticeNoise<2, true>(ptrCoordinates, seed) :
+            numDimensions == 3 ? latticeNoise<3, true>(ptrCoordinates, seed) : latticeNoise<4, true>(ptrCoordinates, seed);
+    default:
+        return numDimensions == 2 ? simplexNoise<2>(ptrCoordinates, seed) :
+            numDimensions == 3 ? simplexNoise<3>(ptrCoordinates, seed) : simplexNoise<4>(ptrCoordinates, seed);
+    }
+}
+
+/// @brief Check the noise type and dimensions.
+/// @param type The noise type.
+/// @param numDimensions The dimensions of the points.
+static void validateNoise(::celerique::NoiseType type, ::celerique::ArraySize numDimensions) {
+    if (numDimensions < 2 || numDimensions > 4) {
+        ::std::string errorMessage = "Cannot sample " + ::std::to_string(numDimensions) + "-dimensional noise.";
+        celeriqueLogError(errorMessage);
+        throw ::std::out_of_range(errorMessage);
+    }
+    if (type != CELERIQUE_NOISE_TYPE_VALUE && type != CELERIQUE_NOISE_TYPE_PERLIN && type != CELERIQUE_NOISE_TYPE_SIMPLEX) {
+        ::std::string errorMessage = "Unknown noise type " + ::std::to_string(type) + ".";
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
+    }
+}
+
+/// @brief Sample noise at 4 points at once.
+/// @param type The noise type.
+/// @param numDimensions The dimensions of the points: 2, 3 or 4.
+/// @param ptrPoints The coordinates, one axis of the 4 points after the other
+/// (x0 x1 x2 x3 y0 y1 y2 y3 ...), `4 * numDimensions` floats.
+/// @param seed The seed. Different seeds give unrelated noise.
+/// @param ptrOut The destination receiving 4 values in [-1, 1].
+void celerique::sampleNoise(
+    NoiseType type, ArraySize numDimensions, const float* ptrPoints, uint32_t seed, float* ptrOut
+) {
+    validateNoise(type, numDimensions);
+    /// @brief The coordinates of the points along each axis.
+    internal::Float4 arrCoordinates[4];
+    for (ArraySize axis = 0; axis < numDimensions; axis++) arrCoordinates[axis] = internal::loadFloat4(ptrPoints + axis * 4);
+    internal::storeFloat4(ptrOut, dispatchNoise(type, numDimensions, arrCoordinates, internal::splatUint4(seed)));
+}
+
+/// @brief Sample fractal Brownian motion at 4 points at once.
+/// @param type The noise type of every octave.
+/// @param numDimensions The dimensions of the points: 2, 3 or 4.
+/// @param ptrPoints The coordinates, one axis of the 4 points after the other
+/// (x0 x1 x2 x3 y0 y1 y2 y3 ...), `4 * numDimensions` floats.
+/// @param seed The seed. Each octave uses a different seed derived from it.
+/// @param config The layering of the octaves.
+/// @param ptrOut The destination receiving 4 values in [-1, 1].
+void celerique::sampleFbm(
+    NoiseType type, ArraySize numDimensions, const float* ptrPoints, uint32_t seed,
+    const FbmConfig& config, float* ptrOut
+) {
+    validateNoise(type, numDimensions);
+    /// @brief The coordinates of the points along each axis.
+    internal::Float4 arrCoordinates[4];
+    for (ArraySize axis = 0; axis < numDimensions; axis++) arrCoordinates[axis] = internal::loadFloat4(ptrPoints + axis * 4);
+    /// @brief The coordinates of the current octave.
+    internal::Float4 arrOctaveCoordinates[4];
+
+    /// @brief The sum of the octaves.
+    internal::Float4 sum = internal::splatFloat4(0.0f);
+    /// @brief The sum of the amplitudes, normalizing the result to [-1, 1].
+    float amplitudeSum = 0.0f;
+    float amplitude = 1.0f, frequency = 1.0f;
+    for (uint32_t octave = 0; octave < config.numOctaves; octave++) {
+        for (ArraySize axis = 0; axis < numDimensions; axis++) {
+            arrOctaveCoordinates[axis] = arrCoordinates[axis] * internal::splatFloat4(frequency);
+        }
+        sum = sum + dispatchNoise(
+            type, numDimensions, arrOctaveCoordinates, internal::splatUint4(seed + octave * PHILOX_KEY_INCREMENT_0)
+        ) * internal::splatFloat4(amplitude);
+        amplitudeSum += amplitude;
+        amplitude *= config.gain;
+        frequency *= config.lacunarity;
+    }
+    internal::storeFloat4(ptrOut, sum * internal::splatFloat4(amplitudeSum > 0.0f ? 1.0f / amplitudeSum : 0.0f));
+}
+
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
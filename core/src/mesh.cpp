@@ -0,0 +1,1027 @@
+/*
+
+File: ./core/src/mesh.cpp
+Author: Aldhinn Espinas
+Description: This source file contains implementations of the mesh importer.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique/mesh.h>
+#include <celerique/jobs.h>
+#include <celerique/logging.h>
+
+#include <cstring>
+#include <vector>
+
+/// @brief The glTF component type of signed 8-bit integers.
+#define GLTF_COMPONENT_TYPE_BYTE                                                            5120
+/// @brief The glTF component type of unsigned 8-bit integers.
+#define GLTF_COMPONENT_TYPE_UNSIGNED_BYTE                                                   5121
+/// @brief The glTF component type of signed 16-bit integers.
+#define GLTF_COMPONENT_TYPE_SHORT                                                           5122
+/// @brief The glTF component type of unsigned 16-bit integers.
+#define GLTF_COMPONENT_TYPE_UNSIGNED_SHORT                                                  5123
+/// @brief The glTF component type of unsigned 32-bit integers.
+#define GLTF_COMPONENT_TYPE_UNSIGNED_INT                                                    5125
+/// @brief The glTF component type of 32-bit floats.
+#define GLTF_COMPONENT_TYPE_FLOAT                                                           5126
+
+/// @brief The magic number at the start of a binary glTF file ("glTF").
+#define GLB_MAGIC                                                                           0x46546C67
+/// @brief The chunk type of the JSON chunk ("JSON").
+#define GLB_CHUNK_TYPE_JSON                                                                 0x4E4F534A
+/// @brief The chunk type of the binary buffer chunk ("BIN\0").
+#define GLB_CHUNK_TYPE_BIN                                                                  0x004E4942
+
+/// @brief The number of vertices converted per job.
+#define MESH_VERTEX_BATCH_SIZE                                                              16384
+
+/// @brief The names input layouts use to refer to mesh attributes, in attribute bit order.
+static const char* const attributeNames[] = {"position", "normal", "texCoord", "color"};
+/// @brief The number of elements of each attribute generated by `genMeshInputLayouts`.
+static const size_t attributeNumElements[] = {3, 3, 2, 4};
+/// @brief The slot of each attribute's value index within an OBJ face corner.
+static const size_t objCornerSlots[] = {0, 2, 1, 0};
+
+/// @brief Parse the mesh format from the file extension.
+/// @param filePath The file path string value.
+/// @return The mesh format.
+::celerique::MeshFormat celerique::fileExtToMeshFormat(const ::std::string& filePath) {
+    // Find the last occurrence of the dot character
+    size_t dotPosition = filePath.find_last_of('.');
+
+    // If no dot is found, or the dot is the first character, there is no extension.
+    if (dotPosition == std::string::npos || dotPosition == 0) {
+        return CELERIQUE_MESH_FORMAT_NULL;
+    }
+    /// @brief The extension string value.
+    ::std::string extension = filePath.substr(dotPosition + 1);
+
+    if (extension == "obj") return CELERIQUE_MESH_FORMAT_OBJ;
+    if (extension == "glb") return CELERIQUE_MESH_FORMAT_GLB;
+
+    return CELERIQUE_MESH_FORMAT_NULL;
+}
+
+/// @brief Generate tightly packed vertex input layouts for a set of attributes, in the order
+/// position (3 floats), normal (3 floats), texture coordinate (2 floats) and color (4 floats).
+/// @param attributes The attributes to generate layouts for.
+/// @param bindingPoint The binding point of the vertex buffer.
+/// @return The collection of input layouts with consecutive locations starting at 0.
+::std::list<::celerique::InputLayout> celerique::genMeshInputLayouts(MeshAttributes attributes, size_t bindingPoint) {
+    /// @brief The generated input layouts.
+    ::std::list<InputLayout> listInputLayouts;
+    /// @brief The offset of the next layout.
+    size_t offset = 0;
+
+    for (size_t attributeIndex = 0; attributeIndex < 4; attributeIndex++) {
+        if ((attributes & CELERIQUE_LEFT_BIT_SHIFT_1(attributeIndex)) == 0) continue;
+
+        InputLayout inputLayout;
+        inputLayout.bindingPoint = bindingPoint;
+        inputLayout.location = listInputLayouts.size();
+        inputLayout.offset = offset;
+        inputLayout.numElements = attributeNumElements[attributeIndex];
+        inputLayout.inputType = CELERIQUE_PIPELINE_INPUT_TYPE_FLOAT;
+        inputLayout.name = attributeNames[attributeIndex];
+        inputLayout.shaderStage = CELERIQUE_SHADER_STAGE_VERTEX;
+        listInputLayouts.emplace_back(inputLayout);
+
+        offset += sizeof(float) * inputLayout.numElements;
+    }
+
+    return listInputLayouts;
+}
+
+/// @brief The size of a pipeline input type.
+/// @param inputType The pipeline input type.
+/// @return The size in bytes, 0 for unknown types.
+static size_t inputTypeSize(::celerique::PipelineInputType inputType) {
+    switch (inputType) {
+    case CELERIQUE_PIPELINE_INPUT_TYPE_FLOAT:
+        return sizeof(float);
+    case CELERIQUE_PIPELINE_INPUT_TYPE_INT:
+        return sizeof(int);
+    case CELERIQUE_PIPELINE_INPUT_TYPE_DOUBLE:
+        return sizeof(double);
+    case CELERIQUE_PIPELINE_INPUT_TYPE_BOOLEAN:
+        return sizeof(bool);
+    }
+    return 0;
+}
+
+/// @brief The size of a glTF component type.
+/// @param componentType The glTF component type.
+/// @return The size in bytes, 0 for unknown types.
+static size_t componentTypeSize(uint32_t componentType) {
+    switch (componentType) {
+    case GLTF_COMPONENT_TYPE_BYTE:
+    case GLTF_COMPONENT_TYPE_UNSIGNED_BYTE:
+        return 1;
+    case GLTF_COMPONENT_TYPE_SHORT:
+    case GLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
+        return 2;
+    case GLTF_COMPONENT_TYPE_UNSIGNED_INT:
+    case GLTF_COMPONENT_TYPE_FLOAT:
+        return 4;
+    }
+    return 0;
+}
+
+/// @brief Read a single component of an attribute value.
+/// @param source The source of the attribute values.
+/// @param valueIndex The index of the value.
+/// @param componentIndex The index of the component within the value.
+/// @return The component converted to a float.
+static float readComponent(
+    const ::celerique::MeshImporter::AttributeSource& source, size_t valueIndex, size_t componentIndex
+) {
+    /// @brief The pointer to the component.
+    const ::celerique::Byte* ptrComponent = source.ptrBase + valueIndex * source.stride +
+        componentIndex * componentTypeSize(source.componentType);
+
+    switch (source.componentType) {
+    case GLTF_COMPONENT_TYPE_BYTE: {
+        int8_t value;
+        ::std::memcpy(&value, ptrComponent, sizeof(value));
+        if (!source.isNormalized) return static_cast<float>(value);
+        return value < -127 ? -1.0f : static_cast<float>(value) / 127.0f;
+    }
+    case GLTF_COMPONENT_TYPE_UNSIGNED_BYTE: {
+        uint8_t value;
+        ::std::memcpy(&value, ptrComponent, sizeof(value));
+        return source.isNormalized ? static_cast<float>(value) / 255.0f : static_cast<float>(value);
+    }
+    case GLTF_COMPONENT_TYPE_SHORT: {
+        int16_t value;
+        ::std::memcpy(&value, ptrComponent, sizeof(value));
+        if (!source.isNormalized) return static_cast<float>(value);
+        return value < -32767 ? -1.0f : static_cast<float>(value) / 32767.0f;
+    }
+    case GLTF_COMPONENT_TYPE_UNSIGNED_SHORT: {
+        uint16_t value;
+        ::std::memcpy(&value, ptrComponent, sizeof(value));
+        return source.isNormalized ? static_cast<float>(value) / 65535.0f : static_cast<float>(value);
+    }
+    case GLTF_COMPONENT_TYPE_UNSIGNED_INT: {
+        uint32_t value;
+        ::std::memcpy(&value, ptrComponent, sizeof(value));
+        return static_cast<float>(value);
+    }
+    case GLTF_COMPONENT_TYPE_FLOAT: {
+        float value;
+        ::std::memcpy(&value, ptrComponent, sizeof(value));
+        return value;
+    }
+    }
+    return 0.0f;
+}
+
+/// @brief Read a little-endian 32-bit unsigned integer.
+/// @param ptrData The pointer to the integer.
+/// @return The integer value.
+static uint32_t readUint32(const ::celerique::Byte* ptrData) {
+    /// @brief The bytes of the integer.
+    const uint8_t* ptrBytes = reinterpret_cast<const uint8_t*>(ptrData);
+    return static_cast<uint32_t>(ptrBytes[0]) | (static_cast<uint32_t>(ptrBytes[1]) << 8) |
+        (static_cast<uint32_t>(ptrBytes[2]) << 16) | (static_cast<uint32_t>(ptrBytes[3]) << 24);
+}
+
+/// @brief Parse a mesh file. For glTF only the first primitive of the first mesh is imported
+/// and it has to be a triangle list stored in the binary chunk. OBJ faces are triangulated
+/// as fans and every face corner becomes its own vertex.
+/// @param ptrData The pointer to the file contents.
+/// @param size The size of the file contents.
+/// @param format The format of the file.
+/// @return `true` if the mesh was parsed successfully.
+bool celerique::MeshImporter::parse(const Byte* ptrData, size_t size, MeshFormat format) {
+    _format = CELERIQUE_MESH_FORMAT_NULL;
+    _attributes = CELERIQUE_MESH_ATTRIBUTE_NONE;
+    _numVertices = 0;
+    _numIndices = 0;
+    for (AttributeSource& refSource : _attributeSources) refSource = AttributeSource();
+    _indexSource = AttributeSource();
+
+    /// @brief Whether the file was parsed successfully.
+    bool isParsed = false;
+    switch (format) {
+    case CELERIQUE_MESH_FORMAT_OBJ:
+        isParsed = parseObj(ptrData, size);
+        break;
+    case CELERIQUE_MESH_FORMAT_GLB:
+        isParsed = parseGlb(ptrData, size);
+        break;
+    default:
+        celeriqueLogWarning("Unsupported mesh format.");
+        return false;
+    }
+
+    if (!isParsed) {
+        _attributes = CELERIQUE_MESH_ATTRIBUTE_NONE;
+        _numVertices = 0;
+        _numIndices = 0;
+        return false;
+    }
+    _format = format;
+    return true;
+}
+
+/// @brief The number of bytes `writeVertices` needs for a set of input layouts.
+/// @param listInputLayouts The input layouts the vertices are written in.
+/// @return The vertex buffer size.
+size_t celerique::MeshImporter::vertexBufferSize(const ::std::list<InputLayout>& listInputLayouts) const {
+    /// @brief The size of a single vertex.
+    size_t stride = 0;
+    for (const InputLayout& inputLayout : listInputLayouts) {
+        stride += inputTypeSize(inputLayout.inputType) * inputLayout.numElements;
+    }
+    return stride * _numVertices;
+}
+
+/// @brief Convert the vertices straight into the target input layouts. Layouts are matched
+/// to attributes by name; attributes missing from the mesh are written as zeroes.
+/// @param listInputLayouts The input layouts the vertices are written in.
+/// @param ptrDst The destination memory.
+/// @param dstCapacity The size of the destination memory.
+/// @return `true` if every vertex was written.
+bool celerique::MeshImporter::writeVertices(
+    const ::std::list<InputLayout>& listInputLayouts, void* ptrDst, size_t dstCapacity
+) const {
+    /// @brief How a single input layout is written.
+    struct LayoutWrite {
+        /// @brief The index of the attribute the layout is read from, or -1 if it is written as zeroes.
+        int attributeIndex;
+        /// @brief The offset of the layout within a vertex.
+        size_t offset;
+        /// @brief The number of elements of the layout.
+        size_t numElements;
+        /// @brief The type of each element.
+        PipelineInputType inputType;
+        /// @brief The size of each element.
+        size_t elementSize;
+    };
+    /// @brief How every input layout is written.
+    ::std::vector<LayoutWrite> vecLayoutWrites;
+    vecLayoutWrites.reserve(listInputLayouts.size());
+    /// @brief The size of a single vertex.
+    size_t stride = 0;
+
+    for (const InputLayout& inputLayout : listInputLayouts) {
+        LayoutWrite layoutWrite;
+        layoutWrite.attributeIndex = -1;
+        for (size_t attributeIndex = 0; attributeIndex < 4; attributeIndex++) {
+            if ((_attributes & CELERIQUE_LEFT_BIT_SHIFT_1(attributeIndex)) == 0) continue;
+            if (::std::strcmp(inputLayout.name, attributeNames[attributeIndex]) != 0) continue;
+            layoutWrite.attributeIndex = static_cast<int>(attributeIndex);
+            break;
+        }
+        layoutWrite.offset = inputLayout.offset;
+        layoutWrite.numElements = inputLayout.numElements;
+        layoutWrite.inputType = inputLayout.inputType;
+        layoutWrite.elementSize = inputTypeSize(inputLayout.inputType);
+        if (layoutWrite.elementSize == 0) {
+            celeriqueLogWarning("Unsupported input type in mesh vertex layout.");
+            return false;
+        }
+        vecLayoutWrites.emplace_back(layoutWrite);
+        stride += layoutWrite.elementSize * layoutWrite.numElements;
+    }
+    for (const LayoutWrite& layoutWrite : vecLayoutWrites) {
+        if (layoutWrite.offset + layoutWrite.elementSize * layoutWrite.numElements > stride) {
+            celeriqueLogWarning("Mesh vertex layout offsets overflow the vertex stride.");
+            return false;
+        }
+    }
+    if (stride * _numVertices > dstCapacity) {
+        celeriqueLogWarning("Destination memory is too small for the mesh vertices.");
+        return false;
+    }
+    if (_numVertices == 0 || stride == 0) return true;
+
+    /// @brief The destination as bytes.
+    Byte* ptrDstBytes = static_cast<Byte*>(ptrDst);
+    parallelFor(_numVertices, MESH_VERTEX_BATCH_SIZE, [&](size_t begin, size_t end) {
+        for (size_t vertexIndex = begin; vertexIndex < end; vertexIndex++) {
+            /// @brief The pointer to the vertex being written.
+            Byte* ptrVertex = ptrDstBytes + vertexIndex * stride;
+
+            for (const LayoutWrite& layoutWrite : vecLayoutWrites) {
+                /// @brief The pointer to the layout being written.
+                Byte* ptrLayout = ptrVertex + layoutWrite.offset;
+                if (layoutWrite.attributeIndex < 0) {
+                    ::std::memset(ptrLayout, 0, layoutWrite.elementSize * layoutWrite.numElements);
+                    continue;
+                }
+
+                /// @brief The source of the attribute values.
+                const AttributeSource& source = _attributeSources[layoutWrite.attributeIndex];
+                /// @brief The index of the value this vertex reads.
+                int64_t valueIndex = static_cast<int64_t>(vertexIndex);
+                if (_format == CELERIQUE_MESH_FORMAT_OBJ) {
+                    valueIndex = _vecObjCorners[vertexIndex * 3 + objCornerSlots[layoutWrite.attributeIndex]];
+                }
+                if (valueIndex < 0) {
+                    ::std::memset(ptrLayout, 0, layoutWrite.elementSize * layoutWrite.numElements);
+                    continue;
+                }
+
+                // Straight copy when the source already matches the layout.
+                if (
+                    layoutWrite.inputType == CELERIQUE_PIPELINE_INPUT_TYPE_FLOAT &&
+                    source.componentType == GLTF_COMPONENT_TYPE_FLOAT &&
+                    layoutWrite.numElements <= source.numComponents
+                ) {
+                    ::std::memcpy(
+                        ptrLayout, source.ptrBase + static_cast<size_t>(valueIndex) * source.stride,
+                        sizeof(float) * layoutWrite.numElements
+                    );
+                    continue;
+                }
+
+                for (size_t elementIndex = 0; elementIndex < layoutWrite.numElements; elementIndex++) {
+                    /// @brief The converted component. Missing components default to (0, 0, 0, 1).
+                    float value = elementIndex == 3 ? 1.0f : 0.0f;
+                    if (elementIndex < source.numComponents) {
+                        value = readComponent(source, static_cast<size_t>(valueIndex), elementIndex);
+                    }
+                    /// @brief The pointer to the element being written.
+                    Byte* ptrElement = ptrLayout + elementIndex * layoutWrite.elementSize;
+
+                    switch (layoutWrite.inputType) {
+                    case CELERIQUE_PIPELINE_INPUT_TYPE_FLOAT:
+                        ::std::memcpy(ptrElement, &value, sizeof(float));
+                        break;
+                    case CELERIQUE_PIPELINE_INPUT_TYPE_INT: {
+                        int intValue = static_cast<int>(value);
+                        ::std::memcpy(ptrElement, &intValue, sizeof(int));
+                        break;
+                    }
+                    case CELERIQUE_PIPELINE_INPUT_TYPE_DOUBLE: {
+                        double doubleValue = static_cast<double>(value);
+                        ::std::memcpy(ptrElement, &doubleValue, sizeof(double));
+                        break;
+                    }
+                    case CELERIQUE_PIPELINE_INPUT_TYPE_BOOLEAN: {
+                        bool boolValue = value != 0.0f;
+                        ::std::memcpy(ptrElement, &boolValue, sizeof(bool));
+                        break;
+                    }
+                    }
+                }
+            }
+        }
+    });
+
+    return true;
+}
+
+/// @brief Write the triangle list indices as 32-bit unsigned integers.
+/// @param ptrDst The destination memory.
+/// @param dstCapacity The size of the destination memory in bytes.
+/// @return `true` if every index was written.
+bool celerique::MeshImporter::writeIndices(uint32_t* ptrDst, size_t dstCapacity) const {
+    if (_numIndices * sizeof(uint32_t) > dstCapacity) {
+        celeriqueLogWarning("Destination memory is too small for the mesh indices.");
+        return false;
+    }
+
+    if (_format == CELERIQUE_MESH_FORMAT_OBJ) {
+        ::std::memcpy(ptrDst, _vecObjTriangles.data(), _numIndices * sizeof(uint32_t));
+        return true;
+    }
+
+    // Non-indexed glTF primitives draw their vertices in order.
+    if (_indexSource.ptrBase == nullptr) {
+        for (size_t i = 0; i < _numIndices; i++) ptrDst[i] = static_cast<uint32_t>(i);
+        return true;
+    }
+
+    /// @brief The size of each index.
+    size_t indexSize = componentTypeSize(_indexSource.componentType);
+    for (size_t i = 0; i < _numIndices; i++) {
+        /// @brief The pointer to the index.
+        const uint8_t* ptrIndex = reinterpret_cast<const uint8_t*>(_indexSource.ptrBase + i * _indexSource.stride);
+        /// @brief The index value.
+        uint32_t index = ptrIndex[0];
+        if (indexSize >= 2) index |= static_cast<uint32_t>(ptrIndex[1]) << 8;
+        if (indexSize == 4) index |= (static_cast<uint32_t>(ptrIndex[2]) << 16) | (static_cast<uint32_t>(ptrIndex[3]) << 24);
+
+        if (index >= _numVertices) {
+            celeriqueLogWarning("glTF index is out of range.");
+            return false;
+        }
+        ptrDst[i] = index;
+    }
+    return true;
+}
+
+// A minimal allocation free JSON navigator over the glTF JSON chunk. Every function
+// takes a cursor into the document and its end, and returns `nullptr` on malformed input.
+
+/// @brief Skip JSON whitespace.
+/// @param ptrCursor The cursor.
+/// @param ptrEnd The end of the document.
+/// @return The cursor past the whitespace.
+static const char* jsonSkipWhitespace(const char* ptrCursor, const char* ptrEnd) {
+    while (
+        ptrCursor < ptrEnd &&
+        (*ptrCursor == ' ' || *ptrCursor == '\t' || *ptrCursor == '\n' || *ptrCursor == '\r')
+    ) ptrCursor++;
+    return ptrCursor;
+}
+
+/// @brief Skip a JSON string.
+/// @param ptrCursor The cursor at the opening quote.
+/// @param ptrEnd The end of the document.
+/// @return The cursor past the closing quote.
+static const char* jsonSkipString(const char* ptrCursor, const char* ptrEnd) {
+    for (ptrCursor++; ptrCursor < ptrEnd; ptrCursor++) {
+        if (*ptrCursor == '\\') {
+            ptrCursor++;
+            continue;
+        }
+        if (*ptrCursor == '"') return ptrCursor + 1;
+    }
+    return nullptr;
+}
+
+/// @brief Skip a JSON value.
+/// @param ptrCursor The cursor at the value.
+/// @param ptrEnd The end of the document.
+/// @return The cursor past the value.
+static const char* jsonSkipValue(const char* ptrCursor, const char* ptrEnd) {
+    ptrCursor = jsonSkipWhitespace(ptrCursor, ptrEnd);
+    if (ptrCursor >= ptrEnd) return nullptr;
+    if (*ptrCursor == '"') return jsonSkipString(ptrCursor, ptrEnd);
+
+    if (*ptrCursor == '{' || *ptrCursor == '[') {
+        /// @brief The nesting depth of objects and arrays.
+        size_t depth = 0;
+        while (ptrCursor < ptrEnd) {
+            if (*ptrCursor == '"') {
+                ptrCursor = jsonSkipString(ptrCursor, ptrEnd);
+                if (ptrCursor == nullptr) return nullptr;
+                continue;
+            }
+            if (*ptrCursor == '{' || *ptrCursor == '[') depth++;
+            if (*ptrCursor == '}' || *ptrCursor == ']') {
+                if (--depth == 0) return ptrCursor + 1;
+            }
+            ptrCursor++;
+        }
+        return nullptr;
+    }
+
+    // Numbers and literals.
+    while (
+        ptrCursor < ptrEnd && *ptrCursor != ',' && *ptrCursor != '}' && *ptrCursor != ']' &&
+        *ptrCursor != ' ' && *ptrCursor != '\t' && *ptrCursor != '\n' && *ptrCursor != '\r'
+    ) ptrCursor++;
+    return ptrCursor;
+}
+
+/// @brief Find the value of a member of a JSON object.
+/// @param ptrObject The cursor at the object.
+/// @param ptrEnd The end of the document.
+/// @param key The key of the member.
+/// @return The cursor at the value, or `nullptr` if the member does not exist.
+static const char* jsonFindMember(const char* ptrObject, const char* ptrEnd, const char* key) {
+    if (ptrObject == nullptr) return nullptr;
+    /// @brief The length of the key.
+    size_t keyLength = ::std::strlen(key);
+    /// @brief The cursor.
+    const char* ptrCursor = jsonSkipWhitespace(ptrObject, ptrEnd);
+    if (ptrCursor >= ptrEnd || *ptrCursor != '{') return nullptr;
+    ptrCursor++;
+
+    while (true) {
+        ptrCursor = jsonSkipWhitespace(ptrCursor, ptrEnd);
+        if (ptrCursor >= ptrEnd || *ptrCursor != '"') return nullptr;
+        /// @brief The cursor past the key.
+        const char* ptrKeyEnd = jsonSkipString(ptrCursor, ptrEnd);
+        if (ptrKeyEnd == nullptr) return nullptr;
+        /// @brief Whether this is the member being looked for.
+        bool isMatch = static_cast<size_t>(ptrKeyEnd - ptrCursor) == keyLength + 2 &&
+            ::std::memcmp(ptrCursor + 1, key, keyLength) == 0;
+
+        ptrCursor = jsonSkipWhitespace(ptrKeyEnd, ptrEnd);
+        if (ptrCursor >= ptrEnd || *ptrCursor != ':') return nullptr;
+        ptrCursor = jsonSkipWhitespace(ptrCursor + 1, ptrEnd);
+        if (isMatch) return ptrCursor;
+
+        ptrCursor = jsonSkipWhitespace(jsonSkipValue(ptrCursor, ptrEnd), ptrEnd);
+        if (ptrCursor == nullptr || ptrCursor >= ptrEnd || *ptrCursor != ',') return nullptr;
+        ptrCursor++;
+    }
+}
+
+/// @brief Find an element of a JSON array.
+/// @param ptrArray The cursor at the array.
+/// @param ptrEnd The end of the document.
+/// @param index The index of the element.
+/// @return The cursor at the element, or `nullptr` if the element does not exist.
+static const char* jsonArrayElement(const char* ptrArray, const char* ptrEnd, size_t index) {
+    if (ptrArray == nullptr) return nullptr;
+    /// @brief The cursor.
+    const char* ptrCursor = jsonSkipWhitespace(ptrArray, ptrEnd);
+    if (ptrCursor >= ptrEnd || *ptrCursor != '[') return nullptr;
+    ptrCursor = jsonSkipWhitespace(ptrCursor + 1, ptrEnd);
+    if (ptrCursor >= ptrEnd || *ptrCursor == ']') return nullptr;
+
+    for (size_t i = 0; i < index; i++) {
+        ptrCursor = jsonSkipWhitespace(jsonSkipValue(ptrCursor, ptrEnd), ptrEnd);
+        if (ptrCursor == nullptr || ptrCursor >= ptrEnd || *ptrCursor != ',') return nullptr;
+        ptrCursor = jsonSkipWhitespace(ptrCursor + 1, ptrEnd);
+    }
+    return ptrCursor;
+}
+
+/// @brief Read an optional unsigned integer member of a JSON object.
+/// @param ptrObject The cursor at the object.
+/// @param ptrEnd The end of the document.
+/// @param key The key of the member.
+/// @param defaultValue The value used when the member does not exist.
+/// @param value The read value.
+/// @return `false` if the member exists but is not an unsigned integer.
+static bool jsonReadUnsigned(
+    const char* ptrObject, const char* ptrEnd, const char* key, uint64_t defaultValue, uint64_t& value
+) {
+    /// @brief The cursor at the member value.
+    const char* ptrCursor = jsonFindMember(ptrObject, ptrEnd, key);
+    value = defaultValue;
+    if (ptrCursor == nullptr) return true;
+    if (ptrCursor >= ptrEnd || *ptrCursor < '0' || *ptrCursor > '9') return false;
+
+    value = 0;
+    while (ptrCursor < ptrEnd && *ptrCursor >= '0' && *ptrCursor <= '9') {
+        value = value * 10 + static_cast<uint64_t>(*ptrCursor - '0');
+        ptrCursor++;
+    }
+    return true;
+}
+
+/// @brief Resolve a glTF accessor into an attribute source.
+/// @param ptrJson The start of the JSON document.
+/// @param ptrJsonEnd The end of the JSON document.
+/// @param ptrBin The start of the binary chunk.
+/// @param binSize The size of the binary chunk.
+/// @param accessorIndex The index of the accessor.
+/// @param source The resolved source.
+/// @return `true` if the accessor was resolved successfully.
+static bool resolveGltfAccessor(
+    const char* ptrJson, const char* ptrJsonEnd, const ::celerique::Byte* ptrBin, size_t binSize,
+    uint64_t accessorIndex, ::celerique::MeshImporter::AttributeSource& source
+) {
+    /// @brief The accessor object.
+    const char* ptrAccessor = jsonArrayElement(
+        jsonFindMember(ptrJson, ptrJsonEnd, "accessors"), ptrJsonEnd, static_cast<size_t>(accessorIndex)
+    );
+    if (ptrAccessor == nullptr) return false;
+
+    uint64_t bufferViewIndex, accessorOffset, componentType, count;
+    if (!jsonReadUnsigned(ptrAccessor, ptrJsonEnd, "bufferView", UINT64_MAX, bufferViewIndex)) return false;
+    if (!jsonReadUnsigned(ptrAccessor, ptrJsonEnd, "byteOffset", 0, accessorOffset)) return false;
+    if (!jsonReadUnsigned(ptrAccessor, ptrJsonEnd, "componentType", 0, componentType)) return false;
+    if (!jsonReadUnsigned(ptrAccessor, ptrJsonEnd, "count", 0, count)) return false;
+    // Accessors without a buffer view (all zeroes or sparse only) are not supported.
+    if (bufferViewIndex == UINT64_MAX) return false;
+
+    /// @brief The `normalized` member value.
+    const char* ptrNormalized = jsonFindMember(ptrAccessor, ptrJsonEnd, "normalized");
+    source.isNormalized = ptrNormalized != nullptr && ptrJsonEnd - ptrNormalized >= 4 &&
+        ::std::memcmp(ptrNormalized, "true", 4) == 0;
+
+    /// @brief The `type` member value.
+    const char* ptrType = jsonFindMember(ptrAccessor, ptrJsonEnd, "type");
+    if (ptrType == nullptr) return false;
+    /// @brief The length of the `type` member value including quotes.
+    size_t typeLength = static_cast<size_t>(jsonSkipValue(ptrType, ptrJsonEnd) - ptrType);
+    if (typeLength == 8 && ::std::memcmp(ptrType, "\"SCALAR\"", 8) == 0) source.numComponents = 1;
+    else if (typeLength == 6 && ::std::memcmp(ptrType, "\"VEC2\"", 6) == 0) source.numComponents = 2;
+    else if (typeLength == 6 && ::std::memcmp(ptrType, "\"VEC3\"", 6) == 0) source.numComponents = 3;
+    else if (typeLength == 6 && ::std::memcmp(ptrType, "\"VEC4\"", 6) == 0) source.numComponents = 4;
+    else return false;
+
+    /// @brief The size of each component.
+    size_t componentSize = componentTypeSize(static_cast<uint32_t>(componentType));
+    if (componentSize == 0) return false;
+
+    /// @brief The buffer view object.
+    const char* ptrBufferView = jsonArrayElement(
+        jsonFindMember(ptrJson, ptrJsonEnd, "bufferViews"), ptrJsonEnd, static_cast<size_t>(bufferViewIndex)
+    );
+    if (ptrBufferView == nullptr) return false;
+
+    uint64_t bufferIndex, viewOffset, viewLength, viewStride;
+    if (!jsonReadUnsigned(ptrBufferView, ptrJsonEnd, "buffer", 0, bufferIndex)) return false;
+    if (!jsonReadUnsigned(ptrBufferView, ptrJsonEnd, "byteOffset", 0, viewOffset)) return false;
+    if (!jsonReadUnsigned(ptrBufferView, ptrJsonEnd, "byteLength", 0, viewLength)) return false;
+    if (!jsonReadUnsigned(ptrBufferView, ptrJsonEnd, "byteStride", 0, viewStride)) return false;
+    // Only the buffer stored in the binary chunk is supported.
+    if (bufferIndex != 0) return false;
+    if (viewStride == 0) viewStride = componentSize * source.numComponents;
+
+    if (viewOffset > binSize || viewLength > binSize - viewOffset) return false;
+    if (count > 0) {
+        /// @brief The number of bytes the accessor spans within the buffer view.
+        uint64_t accessorSpan = accessorOffset + viewStride * (count - 1) + componentSize * source.numComponents;
+        if (accessorSpan > viewLength) return false;
+    }
+
+    source.ptrBase = ptrBin + viewOffset + accessorOffset;
+    source.stride = static_cast<size_t>(viewStride);
+    source.componentType = static_cast<uint32_t>(componentType);
+    source.count = static_cast<size_t>(count);
+    return true;
+}
+
+/// @brief Parse a binary glTF file.
+/// @param ptrData The pointer to the file contents.
+/// @param size The size of the file contents.
+/// @return `true` if the mesh was parsed successfully.
+bool celerique::MeshImporter::parseGlb(const Byte* ptrData, size_t size) {
+    if (ptrData == nullptr || size < 20 || readUint32(ptrData) != GLB_MAGIC || readUint32(ptrData + 4) != 2) {
+        celeriqueLogWarning("Not a binary glTF 2.0 file.");
+        return false;
+    }
+    /// @brief The size declared by the file header.
+    size_t declaredSize = readUint32(ptrData + 8);
+    if (declaredSize < size) size = declaredSize;
+
+    /// @brief The size of the JSON chunk.
+    size_t jsonSize = readUint32(ptrData + 12);
+    if (readUint32(ptrData + 16) != GLB_CHUNK_TYPE_JSON || jsonSize > size - 20) {
+        celeriqueLogWarning("Binary glTF file is missing its JSON chunk.");
+        return false;
+    }
+    /// @brief The start of the JSON document.
+    const char* ptrJson = reinterpret_cast<const char*>(ptrData + 20);
+    /// @brief The end of the JSON document.
+    const char* ptrJsonEnd = ptrJson + jsonSize;
+
+    /// @brief The start of the binary chunk.
+    const Byte* ptrBin = nullptr;
+    /// @brief The size of the binary chunk.
+    size_t binSize = 0;
+    /// @brief The offset of the binary chunk header.
+    size_t binChunkOffset = 20 + ((jsonSize + 3) & ~static_cast<size_t>(3));
+    if (binChunkOffset + 8 <= size && readUint32(ptrData + binChunkOffset + 4) == GLB_CHUNK_TYPE_BIN) {
+        binSize = readUint32(ptrData + binChunkOffset);
+        if (binSize > size - binChunkOffset - 8) {
+            celeriqueLogWarning("Binary glTF chunk is truncated.");
+            return false;
+        }
+        ptrBin = ptrData + binChunkOffset + 8;
+    }
+
+    /// @brief The first primitive of the first mesh.
+    const char* ptrPrimitive = jsonArrayElement(
+        jsonFindMember(jsonArrayElement(jsonFindMember(ptrJson, ptrJsonEnd, "meshes"), ptrJsonEnd, 0), ptrJsonEnd, "primitives"),
+        ptrJsonEnd, 0
+    );
+    if (ptrPrimitive == nullptr) {
+        celeriqueLogWarning("glTF file has no mesh primitives.");
+        return false;
+    }
+    uint64_t mode;
+    if (!jsonReadUnsigned(ptrPrimitive, ptrJsonEnd, "mode", 4, mode) || mode != 4) {
+        celeriqueLogWarning("Only glTF triangle list primitives are supported.");
+        return false;
+    }
+
+    /// @brief The attributes object of the primitive.
+    const char* ptrAttributes = jsonFindMember(ptrPrimitive, ptrJsonEnd, "attributes");
+    /// @brief The glTF names of the attributes, in attribute bit order.
+    static const char* const gltfAttributeNames[] = {"POSITION", "NORMAL", "TEXCOORD_0", "COLOR_0"};
+    for (size_t attributeIndex = 0; attributeIndex < 4; attributeIndex++) {
+        uint64_t accessorIndex;
+        if (!jsonReadUnsigned(ptrAttributes, ptrJsonEnd, gltfAttributeNames[attributeIndex], UINT64_MAX, accessorIndex)) {
+            celeriqueLogWarning("Malformed glTF primitive attributes.");
+            return false;
+        }
+        if (accessorIndex == UINT64_MAX) continue;
+
+        /// @brief The source of the attribute.
+        AttributeSource& refSource = _attributeSources[attributeIndex];
+        if (!resolveGltfAccessor(ptrJson, ptrJsonEnd, ptrBin, binSize, accessorIndex, refSource)) {
+            celeriqueLogWarning("Unsupported or malformed glTF accessor.");
+            return false;
+        }
+        _attributes |= CELERIQUE_LEFT_BIT_SHIFT_1(attributeIndex);
+    }
+    if ((_attributes & CELERIQUE_MESH_ATTRIBUTE_POSITION) == 0) {
+        celeriqueLogWarning("glTF primitive has no positions.");
+        return false;
+    }
+    _numVertices = _attributeSources[0].count;
+    for (size_t attributeIndex = 1; attributeIndex < 4; attributeIndex++) {
+        if ((_attributes & CELERIQUE_LEFT_BIT_SHIFT_1(attributeIndex)) == 0) continue;
+        if (_attributeSources[attributeIndex].count != _numVertices) {
+            celeriqueLogWarning("glTF primitive attributes differ in count.");
+            return false;
+        }
+    }
+
+    uint64_t indicesAccessorIndex;
+    if (!jsonReadUnsigned(ptrPrimitive, ptrJsonEnd, "indices", UINT64_MAX, indicesAccessorIndex)) {
+        celeriqueLogWarning("Malformed glTF primitive indices.");
+        return false;
+    }
+    if (indicesAccessorIndex == UINT64_MAX) {
+        _numIndices = _numVertices;
+        return true;
+    }
+    if (
+        !resolveGltfAccessor(ptrJson, ptrJsonEnd, ptrBin, binSize, indicesAccessorIndex, _indexSource) ||
+        _indexSource.numComponents != 1 || _indexSource.componentType == GLTF_COMPONENT_TYPE_FLOAT ||
+        _indexSource.componentType == GLTF_COMPONENT_TYPE_BYTE || _indexSource.componentType == GLTF_COMPONENT_TYPE_SHORT
+    ) {
+        celeriqueLogWarning("Unsupported or malformed glTF indices.");
+        return false;
+    }
+    _numIndices = _indexSource.count;
+    return true;
+}
+
+/// @brief Parse a decimal number of an OBJ file.
+/// @param ptrCursor The cursor at the number, moved past it.
+/// @param ptrEnd The end of the file.
+/// @param value The parsed value.
+/// @return `true` if a number was parsed.
+static bool objParseFloat(const char*& ptrCursor, const char* ptrEnd, float& value) {
+    /// @brief Whether the number is negative.
+    bool isNegative = false;
+    if (ptrCursor < ptrEnd && (*ptrCursor == '-' || *ptrCursor == '+')) isNegative = *ptrCursor++ == '-';
+
+    /// @brief The digits of the number.
+    double mantissa = 0.0;
+    /// @brief Whether any digit was read.
+    bool hasDigits = false;
+    while (ptrCursor < ptrEnd && *ptrCursor >= '0' && *ptrCursor <= '9') {
+        mantissa = mantissa * 10.0 + (*ptrCursor++ - '0');
+        hasDigits = true;
+    }
+    if (ptrCursor < ptrEnd && *ptrCursor == '.') {
+        ptrCursor++;
+        /// @brief The place value of the next fractional digit.
+        double placeValue = 0.1;
+        while (ptrCursor < ptrEnd && *ptrCursor >= '0' && *ptrCursor <= '9') {
+            mantissa += (*ptrCursor++ - '0') * placeValue;
+            placeValue *= 0.1;
+            hasDigits = true;
+        }
+    }
+    if (!hasDigits) return false;
+
+    if (ptrCursor < ptrEnd && (*ptrCursor == 'e' || *ptrCursor == 'E')) {
+        ptrCursor++;
+        /// @brief Whether the exponent is negative.
+        bool isExponentNegative = false;
+        if (ptrCursor < ptrEnd && (*ptrCursor == '-' || *ptrCursor == '+')) isExponentNegative = *ptrCursor++ == '-';
+        /// @brief The exponent.
+        int exponent = 0;
+        while (ptrCursor < ptrEnd && *ptrCursor >= '0' && *ptrCursor <= '9' && exponent < 1000) {
+            exponent = exponent * 10 + (*ptrCursor++ - '0');
+        }
+        /// @brief The power of ten of the exponent.
+        double scale = 1.0;
+        for (int i = 0; i < exponent; i++) scale *= 10.0;
+        mantissa = isExponentNegative ? mantissa / scale : mantissa * scale;
+    }
+
+    value = static_cast<float>(isNegative ? -mantissa : mantissa);
+    return true;
+}
+
+/// @brief Parse a (possibly negative) integer of an OBJ file.
+/// @param ptrCursor The cursor at the integer, moved past it.
+/// @param ptrEnd The end of the file.
+/// @param value The parsed value.
+/// @return `true` if an integer was parsed.
+static bool objParseInt(const char*& ptrCursor, const char* ptrEnd, int64_t& value) {
+    /// @brief Whether the integer is negative.
+    bool isNegative = false;
+    if (ptrCursor < ptrEnd && *ptrCursor == '-') {
+        isNegative = true;
+        ptrCursor++;
+    }
+    if (ptrCursor >= ptrEnd || *ptrCursor < '0' || *ptrCursor > '9') return false;
+    value = 0;
+    while (ptrCursor < ptrEnd && *ptrCursor >= '0' && *ptrCursor <= '9' && value < INT32_MAX) {
+        value = value * 10 + (*ptrCursor++ - '0');
+    }
+    if (isNegative) value = -value;
+    return true;
+}
+
+/// @brief Skip spaces and tabs within an OBJ line.
+/// @param ptrCursor The cursor.
+/// @param ptrLineEnd The end of the line.
+/// @return The cursor past the blanks.
+static const char* objSkipBlanks(const char* ptrCursor, const char* ptrLineEnd) {
+    while (ptrCursor < ptrLineEnd && (*ptrCursor == ' ' || *ptrCursor == '\t' || *ptrCursor == '\r')) ptrCursor++;
+    return ptrCursor;
+}
+
+/// @brief Count the whitespace separated tokens of an OBJ line.
+/// @param ptrCursor The cursor past the line keyword.
+/// @param ptrLineEnd The end of the line.
+/// @return The number of tokens.
+static size_t objCountTokens(const char* ptrCursor, const char* ptrLineEnd) {
+    /// @brief The number of tokens.
+    size_t numTokens = 0;
+    while ((ptrCursor = objSkipBlanks(ptrCursor, ptrLineEnd)) < ptrLineEnd) {
+        numTokens++;
+        while (ptrCursor < ptrLineEnd && *ptrCursor != ' ' && *ptrCursor != '\t' && *ptrCursor != '\r') ptrCursor++;
+    }
+    return numTokens;
+}
+
+/// @brief Resolve a 1-based or negative OBJ index into a 0-based one.
+/// @param index The OBJ index.
+/// @param count The number of values declared so far.
+/// @return The 0-based index, or -1 if it is out of range.
+static int32_t objResolveIndex(int64_t index, size_t count) {
+    if (index < 0) index += static_cast<int64_t>(count);
+    else index -= 1;
+    if (index < 0 || index >= static_cast<int64_t>(count)) return -1;
+    return static_cast<int32_t>(index);
+}
+
+/// @brief Parse a Wavefront OBJ file.
+/// @param ptrData The pointer to the file contents.
+/// @param size The size of the file contents.
+/// @return `true` if the mesh was parsed successfully.
+bool celerique::MeshImporter::parseObj(const Byte* ptrData, size_t size) {
+    /// @brief The start of the file.
+    const char* ptrBegin = reinterpret_cast<const char*>(ptrData);
+    /// @brief The end of the file.
+    const char* ptrEnd = ptrBegin + size;
+
+    // First pass: count everything so the second pass never reallocates.
+    size_t numPositions = 0, numNormals = 0, numTexCoords = 0, numCorners = 0, numTriangles = 0;
+    /// @brief Whether positions carry vertex colors, decided by the first position.
+    bool hasColors = false;
+    for (const char* ptrLine = ptrBegin; ptrLine < ptrEnd;) {
+        /// @brief The end of the current line.
+        const char* ptrLineEnd = static_cast<const char*>(::std::memchr(ptrLine, '\n', ptrEnd - ptrLine));
+        if (ptrLineEnd == nullptr) ptrLineEnd = ptrEnd;
+        /// @brief The cursor at the line keyword.
+        const char* ptrCursor = objSkipBlanks(ptrLine, ptrLineEnd);
+
+        if (ptrLineEnd - ptrCursor >= 2 && ptrCursor[0] == 'v' && (ptrCursor[1] == ' ' || ptrCursor[1] == '\t')) {
+            if (numPositions == 0) hasColors = objCountTokens(ptrCursor + 1, ptrLineEnd) >= 6;
+            numPositions++;
+        } else if (ptrLineEnd - ptrCursor >= 3 && ptrCursor[0] == 'v' && ptrCursor[1] == 'n') {
+            numNormals++;
+        } else if (ptrLineEnd - ptrCursor >= 3 && ptrCursor[0] == 'v' && ptrCursor[1] == 't') {
+            numTexCoords++;
+        } else if (ptrLineEnd - ptrCursor >= 2 && ptrCursor[0] == 'f' && (ptrCursor[1] == ' ' || ptrCursor[1] == '\t')) {
+            /// @brief The number of corners of the face.
+            size_t numFaceCorners = objCountTokens(ptrCursor + 1, ptrLineEnd);
+            if (numFaceCorners >= 3) {
+                numCorners += numFaceCorners;
+                numTriangles += numFaceCorners - 2;
+            }
+        }
+        ptrLine = ptrLineEnd + 1;
+    }
+    if (numCorners > UINT32_MAX || numPositions > INT32_MAX || numNormals > INT32_MAX || numTexCoords > INT32_MAX) {
+        celeriqueLogWarning("OBJ mesh is too large.");
+        return false;
+    }
+
+    _vecObjPositions.clear();
+    _vecObjPositions.reserve(numPositions * 3);
+    _vecObjColors.clear();
+    _vecObjColors.reserve(hasColors ? numPositions * 3 : 0);
+    _vecObjNormals.clear();
+    _vecObjNormals.reserve(numNormals * 3);
+    _vecObjTexCoords.clear();
+    _vecObjTexCoords.reserve(numTexCoords * 2);
+    _vecObjCorners.clear();
+    _vecObjCorners.reserve(numCorners * 3);
+    _vecObjTriangles.clear();
+    _vecObjTriangles.reserve(numTriangles * 3);
+
+    // Second pass: parse into the reserved storage.
+    for (const char* ptrLine = ptrBegin; ptrLine < ptrEnd;) {
+        /// @brief The end of the current line.
+        const char* ptrLineEnd = static_cast<const char*>(::std::memchr(ptrLine, '\n', ptrEnd - ptrLine));
+        if (ptrLineEnd == nullptr) ptrLineEnd = ptrEnd;
+        /// @brief The cursor within the current line.
+        const char* ptrCursor = objSkipBlanks(ptrLine, ptrLineEnd);
+        ptrLine = ptrLineEnd + 1;
+        if (ptrLineEnd - ptrCursor < 2) continue;
+
+        /// @brief The values destination and count of a `v`, `vn` or `vt` line.
+        ::std::vector<float>* ptrVecValues = nullptr;
+        size_t numValues = 0;
+        if (ptrCursor[0] == 'v' && (ptrCursor[1] == ' ' || ptrCursor[1] == '\t')) {
+            ptrVecValues = &_vecObjPositions;
+            numValues = 3;
+            ptrCursor += 1;
+        } else if (ptrCursor[0] == 'v' && ptrCursor[1] == 'n') {
+            ptrVecValues = &_vecObjNormals;
+            numValues = 3;
+            ptrCursor += 2;
+        } else if (ptrCursor[0] == 'v' && ptrCursor[1] == 't') {
+            ptrVecValues = &_vecObjTexCoords;
+            numValues = 2;
+            ptrCursor += 2;
+        }
+
+        if (ptrVecValues != nullptr) {
+            for (size_t i = 0; i < numValues; i++) {
+                float value = 0.0f;
+                ptrCursor = objSkipBlanks(ptrCursor, ptrLineEnd);
+                if (!objParseFloat(ptrCursor, ptrLineEnd, value) && ptrVecValues != &_vecObjTexCoords) {
+                    celeriqueLogWarning("Malformed OBJ vertex line.");
+                    return false;
+                }
+                ptrVecValues->emplace_back(value);
+            }
+            if (ptrVecValues == &_vecObjPositions && hasColors) {
+                for (size_t i = 0; i < 3; i++) {
+                    float value = 1.0f;
+                    ptrCursor = objSkipBlanks(ptrCursor, ptrLineEnd);
+                    objParseFloat(ptrCursor, ptrLineEnd, value);
+                    _vecObjColors.emplace_back(value);
+                }
+            }
+            continue;
+        }
+
+        if (ptrCursor[0] != 'f' || (ptrCursor[1] != ' ' && ptrCursor[1] != '\t')) continue;
+        ptrCursor += 1;
+
+        /// @brief The index of the first corner of the face.
+        size_t firstCorner = _vecObjCorners.size() / 3;
+        while ((ptrCursor = objSkipBlanks(ptrCursor, ptrLineEnd)) < ptrLineEnd) {
+            /// @brief The position, texture coordinate and normal indices of the corner.
+            int32_t corner[3] = {-1, -1, -1};
+            /// @brief The number of values declared of each kind.
+            const size_t counts[3] = {
+                _vecObjPositions.size() / 3, _vecObjTexCoords.size() / 2, _vecObjNormals.size() / 3
+            };
+            for (size_t slot = 0; slot < 3; slot++) {
+                int64_t index;
+                if (objParseInt(ptrCursor, ptrLineEnd, index)) {
+                    corner[slot] = objResolveIndex(index, counts[slot]);
+                    if (corner[slot] < 0) {
+                        celeriqueLogWarning("OBJ face index is out of range.");
+                        return false;
+                    }
+                } else if (slot == 0) {
+                    celeriqueLogWarning("Malformed OBJ face.");
+                    return false;
+                }
+                if (ptrCursor >= ptrLineEnd || *ptrCursor != '/') break;
+                ptrCursor++;
+            }
+            // Skip anything left of a malformed corner.
+            while (ptrCursor < ptrLineEnd && *ptrCursor != ' ' && *ptrCursor != '\t' && *ptrCursor != '\r') ptrCursor++;
+            _vecObjCorners.insert(_vecObjCorners.end(), corner, corner + 3);
+        }
+
+        /// @brief The number of corners of the face.
+        size_t numFaceCorners = _vecObjCorners.size() / 3 - firstCorner;
+        if (numFaceCorners < 3) {
+            _vecObjCorners.resize(firstCorner * 3);
+            continue;
+        }
+        for (size_t i = 1; i + 1 < numFaceCorners; i++) {
+            _vecObjTriangles.emplace_back(static_cast<uint32_t>(firstCorner));
+            _vecObjTriangles.emplace_back(static_cast<uint32_t>(firstCorner + i));
+            _vecObjTriangles.emplace_back(static_cast<uint32_t>(firstCorner + i + 1));
+        }
+    }
+
+    _numVertices = _vecObjCorners.size() / 3;
+    _numIndices = _vecObjTriangles.size();
+    if (_numVertices == 0) {
+        celeriqueLogWarning("OBJ file has no faces.");
+        return false;
+    }
+
+    /// @brief The OBJ value arrays, in attribute bit order.
+    const ::std::vector<float>* const vecPtrValues[] = {&_vecObjPositions, &_vecObjNormals, &_vecObjTexCoords, &_vecObjColors};
+    /// @brief The number of floats per value, in attribute bit order.
+    static const size_t numComponents[] = {3, 3, 2, 3};
+    for (size_t attributeIndex = 0; attributeIndex < 4; attributeIndex++) {
+        if (vecPtrValues[attributeIndex]->empty()) continue;
+        /// @brief The source of the attribute.
+        AttributeSource& refSource = _attributeSources[attributeIndex];
+        refSource.ptrBase = reinterpret_cast<const Byte*>(vecPtrValues[attributeIndex]->data());
+        refSource.stride = sizeof(float) * numComponents[attributeIndex];
+        refSource.componentType = GLTF_COMPONENT_TYPE_FLOAT;
+        refSource.numComponents = numComponents[attributeIndex];
+        refSource.count = vecPtrValues[attributeIndex]->size() / numComponents[attributeIndex];
+        _attributes |= CELERIQUE_LEFT_BIT_SHIFT_1(attributeIndex);
+    }
+    return true;
+}
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
@@ -0,0 +1,330 @@
+/*
+
+File: ./core/src/particles.cpp
+Author: Aldhinn Espinas
+Description: This source file contains the particle system implementations.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique/particles.h>
+#include <celerique/jobs.h>
+#include <celerique/logging.h>
+#include <celerique/internal/simd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+/// @brief The number of particles processed per job. Must be a multiple of 4.
+#define PARTICLE_BATCH_SIZE                                                                 16384
+/// @brief The number of components of a particle.
+#define PARTICLE_NUM_COMPONENTS                                                             8
+/// @brief The first of the position components (x, y, z).
+#define PARTICLE_COMPONENT_POSITION                                                         0
+/// @brief The first of the velocity components (x, y, z).
+#define PARTICLE_COMPONENT_VELOCITY                                                         3
+/// @brief The fraction of the lifetime elapsed, dead at 1.
+#define PARTICLE_COMPONENT_LIFE                                                             6
+/// @brief The fraction of the lifetime elapsed per second.
+#define PARTICLE_COMPONENT_LIFE_RATE                                                        7
+
+/// @brief The names of the instance attributes generated by `genParticleInstanceLayouts`.
+static const char* const instanceAttributeNames[] = {"position", "size", "color"};
+/// @brief The number of elements of each instance attribute.
+static const size_t instanceAttributeNumElements[] = {3, 1, 4};
+/// @brief The number of set bits of every 4 bit value.
+static const size_t numSetBits[] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+
+/// @brief Hash a counter into a well distributed value (the PCG output permutation).
+/// @param value The counter.
+/// @return The hashed value.
+static inline uint32_t hashCounter(uint32_t value) {
+    /// @brief The state after one linear congruential step.
+    uint32_t state = value * 747796405u + 2891336453u;
+    /// @brief The permuted state.
+    uint32_t word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+    return (word >> 22u) ^ word;
+}
+
+/// @brief A random value in [0, 1) for a particle, the same every time for the same arguments.
+/// @param seed The seed of the emitter.
+/// @param particleCounter The number of particles spawned before this one.
+/// @param stream Which of the particle's random values.
+/// @return The random value.
+static inline float randomUnit(uint32_t seed, uint32_t particleCounter, uint32_t stream) {
+    return static_cast<float>(hashCounter(seed ^ hashCounter(particleCounter * 4u + stream)) >> 8) * (1.0f / 16777216.0f);
+}
+
+/// @brief Generate the per-instance input layouts of the data written by `ParticleEmitter::writeInstances`,
+/// in the order position (3 floats), size (1 float) and color (4 floats).
+/// @param bindingPoint The binding point of the instance buffer.
+/// @return The collection of input layouts with consecutive locations starting at 0.
+::std::list<::celerique::InputLayout> celerique::genParticleInstanceLayouts(size_t bindingPoint) {
+    /// @brief The generated input layouts.
+    ::std::list<InputLayout> listInputLayouts;
+    /// @brief The offset of the next layout.
+    size_t offset = 0;
+
+    for (size_t attributeIndex = 0; attributeIndex < 3; attributeIndex++) {
+        InputLayout inputLayout;
+        inputLayout.bindingPoint = bindingPoint;
+        inputLayout.location = attributeIndex;
+        inputLayout.offset = offset;
+        inputLayout.numElements = instanceAttributeNumElements[attributeIndex];
+        inputLayout.inputType = CELERIQUE_PIPELINE_INPUT_TYPE_FLOAT;
+        inputLayout.name = instanceAttributeNames[attributeIndex];
+        inputLayout.shaderStage = CELERIQUE_SHADER_STAGE_VERTEX;
+        listInputLayouts.emplace_back(inputLayout);
+
+        offset += sizeof(float) * inputLayout.numElements;
+    }
+
+    return listInputLayouts;
+}
+
+/// @brief Spawn particles immediately, up to the maximum number of live particles.
+/// @param numParticles The number of particles to be spawned.
+/// @return The number of particles spawned.
+size_t celerique::ParticleEmitter::emit(size_t numParticles) {
+    numParticles = ::std::min(numParticles, _config.maxParticles - _numParticles);
+    /// @brief The first new particle.
+    size_t first = _numParticles;
+    /// @brief The number of particles spawned before the first new one.
+    uint32_t firstCounter = _numEmitted;
+    /// @brief The component arrays of the live particles.
+    float* arrPtrComponents[PARTICLE_NUM_COMPONENTS];
+    for (size_t component = 0; component < PARTICLE_NUM_COMPONENTS; component++) {
+        arrPtrComponents[component] = componentArray(_currentBuffer, component);
+    }
+
+    parallelFor(numParticles, PARTICLE_BATCH_SIZE, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            /// @brief The number of particles spawned before this one.
+            uint32_t counter = firstCounter + static_cast<uint32_t>(i);
+            for (ArraySize axis = 0; axis < 3; axis++) {
+                arrPtrComponents[PARTICLE_COMPONENT_POSITION + axis][first + i] = _config.position[axis];
+                arrPtrComponents[PARTICLE_COMPONENT_VELOCITY + axis][first + i] = _config.minVelocity[axis] +
+                    (_config.maxVelocity[axis] - _config.minVelocity[axis]) * randomUnit(_config.seed, counter, axis);
+            }
+            /// @brief The lifetime of the particle in seconds.
+            float lifetime = _config.minLifetime + (_config.maxLifetime - _config.minLifetime) * randomUnit(_config.seed, counter, 3);
+            arrPtrComponents[PARTICLE_COMPONENT_LIFE][first + i] = 0.0f;
+            arrPtrComponents[PARTICLE_COMPONENT_LIFE_RATE][first + i] = 1.0f / lifetime;
+        }
+    });
+
+    _numParticles += numParticles;
+    _numEmitted += static_cast<uint32_t>(numParticles);
+    return numParticles;
+}
+
+/// @brief Age, move and kill the live particles, then spawn new ones at the emission rate.
+/// @param deltaTime The elapsed time in seconds.
+/// @return The number of live particles.
+size_t celerique::ParticleEmitter::update(float deltaTime) {
+    /// @brief The number of batches of particles.
+    size_t numBatches = (_numParticles + PARTICLE_BATCH_SIZE - 1) / PARTICLE_BATCH_SIZE;
+    /// @brief The number of survivors of each batch, turned into the first survivor's destination.
+    ::std::vector<size_t> vecBatchOffsets(numBatches + 1, 0);
+    /// @brief The component arrays of the live particles.
+    float* arrPtrSrc[PARTICLE_NUM_COMPONENTS];
+    /// @brief The component arrays receiving the survivors.
+    float* arrPtrDst[PARTICLE_NUM_COMPONENTS];
+    for (size_t component = 0; component < PARTICLE_NUM_COMPONENTS; component++) {
+        arrPtrSrc[component] = componentArray(_currentBuffer, component);
+        arrPtrDst[component] = componentArray(1 - _currentBuffer, component);
+    }
+    /// @brief The velocity change per step along each axis.
+    float arrVelocityStep[3] = {
+        _config.acceleration[0] * deltaTime, _config.acceleration[1] * deltaTime, _config.acceleration[2] * deltaTime
+    };
+    /// @brief The number of live particles.
+    size_t numParticles = _numParticles;
+
+    // Integrate and count the survivors. The arrays are padded to a multiple of 4,
+    // so the last group of 4 is simulated whole and only its live lanes are counted.
+    parallelFor(numParticles, PARTICLE_BATCH_SIZE, [&](size_t begin, size_t end) {
+        /// @brief The number of survivors of this batch.
+        size_t numSurvivors = 0;
+#if defined(CELERIQUE_SIMD_SSE)
+        const __m128 timeStep = _mm_set1_ps(deltaTime), one = _mm_set1_ps(1.0f);
+        const __m128 arrVelocitySteps[3] = {
+            _mm_set1_ps(arrVelocityStep[0]), _mm_set1_ps(arrVelocityStep[1]), _mm_set1_ps(arrVelocityStep[2])
+        };
+        for (size_t i = begin; i < end; i += 4) {
+            for (size_t axis = 0; axis < 3; axis++) {
+                float* ptrVelocity = arrPtrSrc[PARTICLE_COMPONENT_VELOCITY + axis] + i;
+                float* ptrPosition = arrPtrSrc[PARTICLE_COMPONENT_POSITION + axis] + i;
+                /// @brief The velocity after this step.
+                __m128 velocity = _mm_add_ps(_mm_loadu_ps(ptrVelocity), arrVelocitySteps[axis]);
+                _mm_storeu_ps(ptrVelocity, velocity);
+                _mm_storeu_ps(ptrPosition, _mm_add_ps(_mm_loadu_ps(ptrPosition), _mm_mul_ps(velocity, timeStep)));
+            }
+            float* ptrLife = arrPtrSrc[PARTICLE_COMPONENT_LIFE] + i;
+            /// @brief The fraction of the lifetime elapsed after this step.
+            __m128 life = _mm_add_ps(
+                _mm_loadu_ps(ptrLife), _mm_mul_ps(_mm_loadu_ps(arrPtrSrc[PARTICLE_COMPONENT_LIFE_RATE] + i), timeStep)
+            );
+            _mm_storeu_ps(ptrLife, life);
+            /// @brief The lanes within the batch.
+            int laneMask = end - i >= 4 ? 0xF : (1 << (end - i)) - 1;
+            numSurvivors += numSetBits[_mm_movemask_ps(_mm_cmplt_ps(life, one)) & laneMask];
+        }
+#elif defined(CELERIQUE_SIMD_NEON)
+        const float32x4_t one = vdupq_n_f32(1.0f);
+        const float32x4_t arrVelocitySteps[3] = {
+            vdupq_n_f32(arrVelocityStep[0]), vdupq_n_f32(arrVelocityStep[1]), vdupq_n_f32(arrVelocityStep[2])
+        };
+        for (size_t i = begin; i < end; i += 4) {
+            for (size_t axis = 0; axis < 3; axis++) {
+                float* ptrVelocity = arrPtrSrc[PARTICLE_COMPONENT_VELOCITY + axis] + i;
+                float* ptrPosition = arrPtrSrc[PARTICLE_COMPONENT_POSITION + axis] + i;
+                /// @brief The velocity after this step.
+                float32x4_t velocity = vaddq_f32(vld1q_f32(ptrVelocity), arrVelocitySteps[axis]);
+                vst1q_f32(ptrVelocity, velocity);
+                vst1q_f32(ptrPosition, vmlaq_n_f32(vld1q_f32(ptrPosition), velocity, deltaTime));
+            }
+            float* ptrLife = arrPtrSrc[PARTICLE_COMPONENT_LIFE] + i;
+            /// @brief The fraction of the lifetime elapsed after this step.
+            float32x4_t life = vmlaq_n_f32(vld1q_f32(ptrLife), vld1q_f32(arrPtrSrc[PARTICLE_COMPONENT_LIFE_RATE] + i), deltaTime);
+            vst1q_f32(ptrLife, life);
+            /// @brief The lanes of the live particles, 1 each.
+            uint32_t arrIsAlive[4];
+            vst1q_u32(arrIsAlive, vshrq_n_u32(vcltq_f32(life, one), 31));
+            for (size_t lane = 0; lane < 4 && i + lane < end; lane++) numSurvivors += arrIsAlive[lane];
+        }
+#else
+        for (size_t i = begin; i < end; i++) {
+            for (size_t axis = 0; axis < 3; axis++) {
+                arrPtrSrc[PARTICLE_COMPONENT_VELOCITY + axis][i] += arrVelocityStep[axis];
+                arrPtrSrc[PARTICLE_COMPONENT_POSITION + axis][i] += arrPtrSrc[PARTICLE_COMPONENT_VELOCITY + axis][i] * deltaTime;
+            }
+            arrPtrSrc[PARTICLE_COMPONENT_LIFE][i] += arrPtrSrc[PARTICLE_COMPONENT_LIFE_RATE][i] * deltaTime;
+            numSurvivors += arrPtrSrc[PARTICLE_COMPONENT_LIFE][i] < 1.0f;
+        }
+#endif
+        vecBatchOffsets[begin / PARTICLE_BATCH_SIZE + 1] = numSurvivors;
+    });
+
+    for (size_t batch = 0; batch < numBatches; batch++) vecBatchOffsets[batch + 1] += vecBatchOffsets[batch];
+
+    // Compact the survivors into the other set of arrays, each batch into its own range.
+    // Survivor indices are gathered without branching: every particle is written to the
+    // next slot, which only advances past the live ones.
+    parallelFor(numParticles, PARTICLE_BATCH_SIZE, [&](size_t begin, size_t end) {
+        /// @brief The first destination of this batch's survivors.
+        size_t dstOffset = vecBatchOffsets[begin / PARTICLE_BATCH_SIZE];
+        /// @brief The indices of this batch's survivors, plus a slot for the last dead particle.
+        ::std::vector<uint32_t> vecSurvivors(end - begin + 1);
+        /// @brief The number of survivors so far.
+        size_t numSurvivors = 0;
+        const float* ptrLife = arrPtrSrc[PARTICLE_COMPONENT_LIFE];
+        for (size_t i = begin; i < end; i++) {
+            vecSurvivors[numSurvivors] = static_cast<uint32_t>(i);
+            numSurvivors += ptrLife[i] < 1.0f;
+        }
+        for (size_t component = 0; component < PARTICLE_NUM_COMPONENTS; component++) {
+            const float* ptrSrc = arrPtrSrc[component];
+            float* ptrDst = arrPtrDst[component] + dstOffset;
+            for (size_t j = 0; j < numSurvivors; j++) ptrDst[j] = ptrSrc[vecSurvivors[j]];
+        }
+    });
+
+    _currentBuffer = 1 - _currentBuffer;
+    _numParticles = vecBatchOffsets[numBatches];
+
+    _emissionRemainder += _config.emissionRate * deltaTime;
+    /// @brief The whole number of particles due.
+    float numDue = ::std::floor(_emissionRemainder);
+    _emissionRemainder -= numDue;
+    emit(static_cast<size_t>(numDue));
+    return _numParticles;
+}
+
+/// @brief Write the instance data of every live particle, `CELERIQUE_PARTICLE_INSTANCE_SIZE`
+/// bytes each as laid out by `genParticleInstanceLayouts`, for one instanced draw.
+/// @param ptrDst The destination, such as a mapped per-frame instance buffer. Must be 4 byte aligned.
+/// @param dstCapacity The size of the destination in bytes.
+/// @return `false` if the destination is too small.
+bool celerique::ParticleEmitter::writeInstances(void* ptrDst, size_t dstCapacity) const {
+    if (instanceDataSize() > dstCapacity) {
+        celeriqueLogWarning("Destination memory is too small for the particle instances.");
+        return false;
+    }
+    /// @brief The destination as floats, 8 per particle.
+    float* ptrInstances = reinterpret_cast<float*>(ptrDst);
+    const float* ptrPositionX = componentArray(PARTICLE_COMPONENT_POSITION + 0);
+    const float* ptrPositionY = componentArray(PARTICLE_COMPONENT_POSITION + 1);
+    const float* ptrPositionZ = componentArray(PARTICLE_COMPONENT_POSITION + 2);
+    const float* ptrLife = componentArray(PARTICLE_COMPONENT_LIFE);
+    /// @brief The size and color when spawned, then their change over a lifetime.
+    float arrStart[5], arrChange[5];
+    arrStart[0] = _config.startSize;
+    arrChange[0] = _config.endSize - _config.startSize;
+    for (ArraySize channel = 0; channel < 4; channel++) {
+        arrStart[1 + channel] = _config.startColor[channel];
+        arrChange[1 + channel] = _config.endColor[channel] - _config.startColor[channel];
+    }
+
+    parallelFor(_numParticles, PARTICLE_BATCH_SIZE, [&](size_t begin, size_t end) {
+        size_t i = begin;
+#if defined(CELERIQUE_SIMD_SSE)
+        // Interpolate 4 particles at a time, then transpose them into instances.
+        __m128 arrStarts[5], arrChanges[5];
+        for (size_t value = 0; value < 5; value++) {
+            arrStarts[value] = _mm_set1_ps(arrStart[value]);
+            arrChanges[value] = _mm_set1_ps(arrChange[value]);
+        }
+        for (; i + 4 <= end; i += 4) {
+            /// @brief The fraction of the lifetime elapsed.
+            __m128 life = _mm_loadu_ps(ptrLife + i);
+            __m128 rowX = _mm_loadu_ps(ptrPositionX + i), rowY = _mm_loadu_ps(ptrPositionY + i);
+            __m128 rowZ = _mm_loadu_ps(ptrPositionZ + i), rowSize = _mm_add_ps(arrStarts[0], _mm_mul_ps(arrChanges[0], life));
+            __m128 rowR = _mm_add_ps(arrStarts[1], _mm_mul_ps(arrChanges[1], life));
+            __m128 rowG = _mm_add_ps(arrStarts[2], _mm_mul_ps(arrChanges[2], life));
+            __m128 rowB = _mm_add_ps(arrStarts[3], _mm_mul_ps(arrChanges[3], life));
+            __m128 rowA = _mm_add_ps(arrStarts[4], _mm_mul_ps(arrChanges[4], life));
+            _MM_TRANSPOSE4_PS(rowX, rowY, rowZ, rowSize);
+            _MM_TRANSPOSE4_PS(rowR, rowG, rowB, rowA);
+            float* ptrInstance = ptrInstances + i * 8;
+            _mm_storeu_ps(ptrInstance + 0, rowX);
+            _mm_storeu_ps(ptrInstance + 4, rowR);
+            _mm_storeu_ps(ptrInstance + 8, rowY);
+            _mm_storeu_ps(ptrInstance + 12, rowG);
+            _mm_storeu_ps(ptrInstance + 16, rowZ);
+            _mm_storeu_ps(ptrInstance + 20, rowB);
+            _mm_storeu_ps(ptrInstance + 24, rowSize);
+            _mm_storeu_ps(ptrInstance + 28, rowA);
+        }
+#endif
+        for (; i < end; i++) {
+            float* ptrInstance = ptrInstances + i * 8;
+            ptrInstance[0] = ptrPositionX[i];
+            ptrInstance[1] = ptrPositionY[i];
+            ptrInstance[2] = ptrPositionZ[i];
+            for (size_t value = 0; value < 5; value++) ptrInstance[3 + value] = arrStart[value] + arrChange[value] * ptrLife[i];
+        }
+    });
+    return true;
+}
+
+/// @brief Member init constructor.
+/// @param config How the emitter spawns and animates its particles.
+::celerique::ParticleEmitter::ParticleEmitter(const ParticleEmitterConfig& config) :
+    _config(config), _capacity((config.maxParticles + 3) / 4 * 4) {
+    if (!(config.minLifetime > 0.0f) || config.maxLifetime < config.minLifetime) {
+        /// @brief The error message.
+        ::std::string errorMessage = "Particle lifetimes must be positive and the maximum must not be below the minimum.";
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
+    }
+    for (::std::vector<float>& vecComponents : _arrVecComponents) {
+        vecComponents.resize(_capacity * PARTICLE_NUM_COMPONENTS, 0.0f);
+    }
+}
+
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
@@ -13,6 +13,9 @@ License: Mozilla Public License 2.0. (See ./LICENSE).
 
 #include <fstream>
 #include <mutex>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
 
 /// @brief Load a shader program from the file path of the binary specified.
 /// @param binaryPath The file path of the binary where the shader is to be loaded from.
@@ -74,6 +77,14 @@ License: Mozilla Public License 2.0. (See ./LICENSE).
 /// @param ptrBuffer The pointer to the heap allocated buffer containing the shader program.
 ::celerique::ShaderProgram::ShaderProgram(size_t size, ::celerique::Byte* ptrBuffer) : _size(size), _ptrBuffer(ptrBuffer) {}
 
+/// @brief Borrowing constructor. The buffer is not freed by this container.
+/// @param size The size of the buffer containing the shader program.
+/// @param ptrBuffer The pointer to the buffer containing the shader program.
+/// @param ptrOwner The shared pointer to whatever owns the buffer, kept alive by this container.
+::celerique::ShaderProgram::ShaderProgram(
+    size_t size, ::celerique::Byte* ptrBuffer, ::std::shared_ptr<const void>&& ptrOwner
+) : _size(size), _ptrBuffer(ptrBuffer), _ptrOwner(::std::move(ptrOwner)) {}
+
 #if defined(_MSC_VER) && defined(CELERIQUE_ENGINE_LINKED_SHARED)
 /// @brief Copy constructor.
 /// @param other The other instance to be copied.
@@ -87,7 +98,7 @@ License: Mozilla Public License 2.0. (See ./LICENSE).
 /// @param other The r-value reference to the other shader program
 /// container instance where the data is moving from.
 ::celerique::ShaderProgram::ShaderProgram(ShaderProgram&& other) : _size(other._size),
-_ptrBuffer(other._ptrBuffer) {
+_ptrBuffer(other._ptrBuffer), _ptrOwner(::std::move(other._ptrOwner)) {
     other._ptrBuffer = nullptr;
 }
 
@@ -96,11 +107,12 @@ _ptrBuffer(other._ptrBuffer) {
 /// container instance where the data is moving from.
 /// @return The reference to this instance.
 ::celerique::ShaderProgram& celerique::ShaderProgram::operator=(ShaderProgram&& other) {
-    // If there currently is a shader program being loaded.
-    if (_ptrBuffer != nullptr) delete[] _ptrBuffer;
+    // If there currently is a shader program being loaded that this container owns.
+    if (_ptrBuffer != nullptr && _ptrOwner == nullptr) delete[] _ptrBuffer;
 
     _size = other._size;
     _ptrBuffer = other._ptrBuffer;
+    _ptrOwner = ::std::move(other._ptrOwner);
     other._ptrBuffer = nullptr;
 
     return *this;
@@ -108,7 +120,8 @@ _ptrBuffer(other._ptrBuffer) {
 
 /// @brief Destructor.
 ::celerique::ShaderProgram::~ShaderProgram() {
-    if (_ptrBuffer != nullptr) {
+    // Borrowed buffers are released together with `_ptrOwner`.
+    if (_ptrBuffer != nullptr && _ptrOwner == nullptr) {
         delete[] _ptrBuffer;
         _ptrBuffer = nullptr;
     }
@@ -217,6 +230,62 @@ size_t celerique::PipelineConfig::stride() const {
     return stride;
 }
 
+/// @brief Copy data from the CPU to a range of the GPU buffer, keeping the rest of its data.
+/// @param bufferId The unique identifier of the GPU buffer.
+/// @param offset The byte offset of the range within the GPU buffer.
+/// @param ptrDataSrc The pointer to where the data to be copied to the GPU resides.
+/// @param dataSize The size of the data to be copied.
+void celerique::IGpuResources::copyToBufferRegion(
+    GpuBufferID bufferId, size_t offset, const void* ptrDataSrc, size_t dataSize
+) {
+    /// @brief The single range to be overwritten.
+    GpuBufferRegion region;
+    region.bufferId = bufferId;
+    region.offset = offset;
+    region.ptrDataSrc = ptrDataSrc;
+    region.dataSize = dataSize;
+    copyToBufferRegions({region});
+}
+
+/// @brief Copy data from the CPU to many ranges of GPU buffers at once. By default, ranges starting
+/// at the beginning of their buffer are copied one by one and any other range is an error.
+/// @param vecRegions The ranges to be overwritten. Ranges of the same buffer must not overlap.
+void celerique::IGpuResources::copyToBufferRegions(const ::std::vector<GpuBufferRegion>& vecRegions) {
+    /// @brief The buffers already written by a non-empty range.
+    ::std::unordered_set<GpuBufferID> setWrittenBufferIds;
+    // Check every range before copying any.
+    for (const GpuBufferRegion& region : vecRegions) {
+        if (region.offset != 0) {
+            ::std::string errorMessage = "Copying to a buffer at an offset is not supported by this GPU resources interface.";
+            celeriqueLogError(errorMessage);
+            throw ::std::runtime_error(errorMessage);
+        }
+        // Every range starts at the beginning of its buffer, so two non-empty ranges of one buffer overlap.
+        if (region.dataSize > 0 && !setWrittenBufferIds.insert(region.bufferId).second) {
+            ::std::string errorMessage = "Ranges copied to the same buffer must not overlap.";
+            celeriqueLogError(errorMessage);
+            throw ::std::runtime_error(errorMessage);
+        }
+    }
+    for (const GpuBufferRegion& region : vecRegions) {
+        copyToBuffer(region.bufferId, const_cast<void*>(region.ptrDataSrc), region.dataSize);
+    }
+}
+
+/// @brief Get the pointer to the copy of a dynamic GPU buffer for the current frame.
+/// @param bufferId The unique identifier of a GPU buffer created with `CELERIQUE_GPU_BUFFER_USAGE_DYNAMIC`.
+/// @return `nullptr`, as dynamic buffers are not supported by default.
+void* celerique::IGpuResources::mapDynamicBuffer(GpuBufferID /* bufferId */) {
+    return nullptr;
+}
+
+/// @brief Get the offset of the copy of a dynamic GPU buffer last written.
+/// @param bufferId The unique identifier of a GPU buffer created with `CELERIQUE_GPU_BUFFER_USAGE_DYNAMIC`.
+/// @return 0, as dynamic buffers are not supported by default.
+size_t celerique::IGpuResources::dynamicBufferOffset(GpuBufferID /* bufferId */) {
+    return 0;
+}
+
 /// @brief Pure virtual destructor.
 ::celerique::IGpuResources::~IGpuResources() {}
 
@@ -0,0 +1,365 @@
+/*
+
+File: ./core/src/recorder.cpp
+Author: Aldhinn Espinas
+Description: This source file contains the crash flight recorder implementations.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique/recorder.h>
+#include <celerique/logging.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <fstream>
+
+#if defined(CELERIQUE_FOR_WINDOWS)
+#include <windows.h>
+#elif defined(CELERIQUE_FOR_POSIX_SYSTEMS)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/// @brief The magic number at the start of a flight recorder dump ("CLFR").
+#define FLIGHT_DUMP_MAGIC                                                                   0x52464C43
+/// @brief The version of the flight recorder dump layout.
+#define FLIGHT_DUMP_VERSION                                                                 1
+/// @brief The number of bytes kept for the path of the installed dump file.
+#define FLIGHT_DUMP_PATH_SIZE                                                               4096
+/// @brief The number of records copied at once while dumping.
+#define FLIGHT_DUMP_CHUNK_SIZE                                                              32
+
+/// @brief The start of a flight recorder dump, followed by the records.
+struct FlightDumpHeader {
+    /// @brief `FLIGHT_DUMP_MAGIC`.
+    uint32_t magic;
+    /// @brief `FLIGHT_DUMP_VERSION`.
+    uint16_t version;
+    /// @brief The size of each record.
+    uint16_t recordSize;
+    /// @brief Why the dump was written.
+    ::celerique::FlightDumpReason reason;
+    /// @brief The signal that was raised, for `CELERIQUE_FLIGHT_DUMP_REASON_SIGNAL`.
+    int32_t signalNumber;
+};
+
+/// @brief The flight recorder of a thread, handed to another thread once it exits.
+struct ThreadFlightRing {
+    /// @brief The number of records written so far. Only written by the recording thread.
+    ::std::atomic<uint64_t> atomicHead = 0;
+    /// @brief Whether a live thread records into this ring.
+    ::std::atomic<bool> atomicIsInUse = true;
+    /// @brief The records, the newest at `atomicHead - 1`.
+    ::celerique::FlightRecord arrRecords[CELERIQUE_FLIGHT_RECORDER_CAPACITY];
+};
+
+static_assert(sizeof(::celerique::FlightRecord) == 128, "Flight records must fill two cache lines.");
+static_assert(
+    (CELERIQUE_FLIGHT_RECORDER_CAPACITY & (CELERIQUE_FLIGHT_RECORDER_CAPACITY - 1)) == 0,
+    "The flight recorder capacity must be a power of 2."
+);
+
+/// @brief The ring of every thread that ever recorded. Rings are never freed, so dumps can read them at any time.
+static ::std::atomic<ThreadFlightRing*> arrAtomicPtrRings[CELERIQUE_FLIGHT_RECORDER_MAX_THREADS];
+/// @brief The number of slots of `arrAtomicPtrRings` handed out, possibly past the end.
+static ::std::atomic<uint32_t> atomicNumRings = 0;
+/// @brief The path passed to `installFlightRecorderDumps`, null terminated.
+static char arrDumpPath[FLIGHT_DUMP_PATH_SIZE];
+/// @brief Whether `arrDumpPath` holds a path.
+static ::std::atomic<bool> atomicIsDumpInstalled = false;
+/// @brief Whether the process is already dying, so a terminate followed by `SIGABRT` dumps only once.
+static ::std::atomic<bool> atomicIsCrashing = false;
+/// @brief The terminate handler replaced by `installFlightRecorderDumps`.
+static ::std::terminate_handler previousTerminateHandler = nullptr;
+
+/// @brief The calling thread's ring, null until its first record or if every slot is taken.
+/// Trivially initialized, so reading it costs no initialization check.
+static thread_local ThreadFlightRing* ptrThreadRing = nullptr;
+/// @brief The slot of `ptrThreadRing` in `arrAtomicPtrRings`.
+static thread_local uint32_t threadRingIndex = 0;
+/// @brief Whether the calling thread already tried to acquire a ring.
+static thread_local bool hasThreadAcquiredRing = false;
+
+/// @brief The calling thread's hold on its ring, given back when the thread exits.
+struct ThreadFlightRingLease {
+    /// @brief Default constructor. Takes over the ring of an exited thread or creates one.
+    ThreadFlightRingLease() {
+        /// @brief The number of slots handed out.
+        uint32_t numRings = ::std::min<uint32_t>(
+            atomicNumRings.load(::std::memory_order_acquire), CELERIQUE_FLIGHT_RECORDER_MAX_THREADS
+        );
+        for (uint32_t ringIndex = 0; ringIndex < numRings; ringIndex++) {
+            /// @brief The ring in the slot.
+            ThreadFlightRing* ptrCandidate = arrAtomicPtrRings[ringIndex].load(::std::memory_order_acquire);
+            /// @brief Whether the ring is in use, expected not to be.
+            bool isInUse = false;
+            if (ptrCandidate != nullptr && ptrCandidate->atomicIsInUse.compare_exchange_strong(isInUse, true)) {
+                ptrThreadRing = ptrCandidate;
+                threadRingIndex = ringIndex;
+                return;
+            }
+        }
+        /// @brief The slot handed to the calling thread.
+        uint32_t ringIndex = atomicNumRings.fetch_add(1, ::std::memory_order_acq_rel);
+        if (ringIndex >= CELERIQUE_FLIGHT_RECORDER_MAX_THREADS) return;
+        ptrThreadRing = new ThreadFlightRing;
+        threadRingIndex = ringIndex;
+        arrAtomicPtrRings[ringIndex].store(ptrThreadRing, ::std::memory_order_release);
+    }
+    /// @brief Destructor. Gives the ring back, keeping its records.
+    ~ThreadFlightRingLease() {
+        if (ptrThreadRing != nullptr) ptrThreadRing->atomicIsInUse.store(false, ::std::memory_order_release);
+        ptrThreadRing = nullptr;
+    }
+};
+
+/// @brief Acquire a ring for the calling thread on its first record.
+static void acquireThreadRing() {
+    hasThreadAcquiredRing = true;
+    /// @brief The calling thread's hold on its ring.
+    thread_local ThreadFlightRingLease lease;
+}
+
+/// @brief Write bytes to a file opened for dumping. Async signal safe.
+/// @param fileHandle The platform specific file handle.
+/// @param ptrData The pointer to the bytes.
+/// @param size The number of bytes.
+/// @return `false` if not every byte could be written.
+static bool writeDumpBytes(CeleriquePointer fileHandle, const void* ptrData, size_t size) {
+    /// @brief The bytes left to write.
+    const char* ptrBytes = reinterpret_cast<const char*>(ptrData);
+    while (size > 0) {
+#if defined(CELERIQUE_FOR_WINDOWS)
+        /// @brief The number of bytes written by the call.
+        DWORD numWritten = 0;
+        if (!WriteFile(reinterpret_cast<HANDLE>(fileHandle), ptrBytes, static_cast<DWORD>(size), &numWritten, NULL)) {
+            return false;
+        }
+#elif defined(CELERIQUE_FOR_POSIX_SYSTEMS)
+        /// @brief The number of bytes written by the call.
+        ssize_t numWritten = ::write(static_cast<int>(fileHandle), ptrBytes, size);
+        if (numWritten <= 0) return false;
+#else
+        return false;
+#endif
+        ptrBytes += numWritten;
+        size -= static_cast<size_t>(numWritten);
+    }
+    return true;
+}
+
+/// @brief Write every thread's flight recorder to a file. Async signal safe.
+/// @param path The path of the file.
+/// @param reason Why the dump is written.
+/// @param signalNumber The signal that was raised, for `CELERIQUE_FLIGHT_DUMP_REASON_SIGNAL`.
+/// @return `false` if the file could not be written.
+static bool writeFlightDump(const char* path, ::celerique::FlightDumpReason reason, int32_t signalNumber) {
+    /// @brief The platform specific handle to the dump file.
+    CeleriquePointer fileHandle = 0;
+#if defined(CELERIQUE_FOR_WINDOWS)
+    /// @brief The handle to the created file.
+    HANDLE createdFileHandle = CreateFileA(path, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (createdFileHandle == INVALID_HANDLE_VALUE) return false;
+    fileHandle = reinterpret_cast<CeleriquePointer>(createdFileHandle);
+#elif defined(CELERIQUE_FOR_POSIX_SYSTEMS)
+    /// @brief The descriptor of the created file.
+    int fileDescriptor = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fileDescriptor < 0) return false;
+    fileHandle = static_cast<CeleriquePointer>(fileDescriptor);
+#else
+    return false;
+#endif
+
+    /// @brief The header of the dump.
+    FlightDumpHeader header = {
+        FLIGHT_DUMP_MAGIC, FLIGHT_DUMP_VERSION, sizeof(::celerique::FlightRecord), reason, signalNumber
+    };
+    /// @brief Whether every byte was written so far.
+    bool isWritten = writeDumpBytes(fileHandle, &header, sizeof(header));
+    /// @brief The records being copied. Copying first keeps the time a record can be overwritten while read short.
+    ::celerique::FlightRecord arrChunk[FLIGHT_DUMP_CHUNK_SIZE];
+    /// @brief The number of slots handed out.
+    uint32_t numRings = ::std::min<uint32_t>(
+        atomicNumRings.load(::std::memory_order_acquire), CELERIQUE_FLIGHT_RECORDER_MAX_THREADS
+    );
+    for (uint32_t ringIndex = 0; isWritten && ringIndex < numRings; ringIndex++) {
+        /// @brief The ring in the slot.
+        ThreadFlightRing* ptrRing = arrAtomicPtrRings[ringIndex].load(::std::memory_order_acquire);
+        if (ptrRing == nullptr) continue;
+        /// @brief The number of records written to the ring so far.
+        uint64_t head = ptrRing->atomicHead.load(::std::memory_order_acquire);
+        /// @brief The oldest record still in the ring.
+        uint64_t first = head > CELERIQUE_FLIGHT_RECORDER_CAPACITY ? head - CELERIQUE_FLIGHT_RECORDER_CAPACITY : 0;
+        for (uint64_t chunkBegin = first; isWritten && chunkBegin < head; chunkBegin += FLIGHT_DUMP_CHUNK_SIZE) {
+            /// @brief Past the last record of the chunk.
+            uint64_t chunkEnd = ::std::min<uint64_t>(chunkBegin + FLIGHT_DUMP_CHUNK_SIZE, head);
+            for (uint64_t recordIndex = chunkBegin; recordIndex < chunkEnd; recordIndex++) {
+                ::std::memcpy(
+                    &arrChunk[recordIndex - chunkBegin],
+                    &ptrRing->arrRecords[recordIndex & (CELERIQUE_FLIGHT_RECORDER_CAPACITY - 1)],
+                    sizeof(::celerique::FlightRecord)
+                );
+            }
+            // Records the thread started overwriting while they were copied are left out.
+            ::std::atomic_thread_fence(::std::memory_order_acquire);
+            /// @brief The number of records written to the ring after copying.
+            uint64_t headAfter = ptrRing->atomicHead.load(::std::memory_order_relaxed);
+            /// @brief The oldest copied record not overwritten meanwhile.
+            uint64_t validBegin = ::std::max<uint64_t>(
+                chunkBegin, headAfter >= CELERIQUE_FLIGHT_RECORDER_CAPACITY ? headAfter - CELERIQUE_FLIGHT_RECORDER_CAPACITY + 1 : 0
+            );
+            if (validBegin >= chunkEnd) continue;
+            isWritten = writeDumpBytes(
+                fileHandle, &arrChunk[validBegin - chunkBegin], (chunkEnd - validBegin) * sizeof(::celerique::FlightRecord)
+            );
+        }
+    }
+
+#if defined(CELERIQUE_FOR_WINDOWS)
+    CloseHandle(reinterpret_cast<HANDLE>(fileHandle));
+#elif defined(CELERIQUE_FOR_POSIX_SYSTEMS)
+    ::close(static_cast<int>(fileHandle));
+#endif
+    return isWritten;
+}
+
+/// @brief The terminate handler dumping the flight recorders, recording the uncaught exception first.
+static void onTerminate() {
+    if (!atomicIsCrashing.exchange(true)) {
+        /// @brief The exception being handled, if any.
+        ::std::exception_ptr ptrException = ::std::current_exception();
+        if (ptrException != nullptr) {
+            try {
+                ::std::rethrow_exception(ptrException);
+            } catch (const ::std::exception& exception) {
+                ::celerique::flightRecord(
+                    CELERIQUE_FLIGHT_RECORD_KIND_LOG, CELERIQUE_LOG_MESSAGE_SEVERITY_FATAL, 0,
+                    exception.what(), ::std::strlen(exception.what())
+                );
+            } catch (...) {}
+        }
+        ::celerique::internal::dumpInstalledFlightRecorder(CELERIQUE_FLIGHT_DUMP_REASON_TERMINATE);
+    }
+    if (previousTerminateHandler != nullptr) previousTerminateHandler();
+    ::std::abort();
+}
+
+/// @brief The fatal signal handler dumping the flight recorders, then raising the signal
+/// again with its default action restored.
+/// @param signalNumber The signal raised.
+static void onFatalSignal(int signalNumber) {
+    if (!atomicIsCrashing.exchange(true)) {
+        ::celerique::internal::dumpInstalledFlightRecorder(CELERIQUE_FLIGHT_DUMP_REASON_SIGNAL, signalNumber);
+    }
+    ::std::raise(signalNumber);
+}
+
+/// @brief Append a record to the calling thread's flight recorder, overwriting its oldest record once full.
+/// @param kind What the record is about.
+/// @param detail A detail depending on the kind.
+/// @param value A value depending on the kind.
+/// @param ptrText The text, or null.
+/// @param textSize The number of text bytes, truncated to `CELERIQUE_FLIGHT_RECORD_TEXT_SIZE`.
+void ::celerique::flightRecord(FlightRecordKind kind, uint8_t detail, uint64_t value, const char* ptrText, size_t textSize) {
+    if (!hasThreadAcquiredRing) acquireThreadRing();
+    if (ptrThreadRing == nullptr) return;
+    /// @brief The number of records written so far.
+    uint64_t head = ptrThreadRing->atomicHead.load(::std::memory_order_relaxed);
+    // Keep the overwrite after the previous head update, so dumps notice it.
+    ::std::atomic_thread_fence(::std::memory_order_release);
+    /// @brief The record being overwritten.
+    FlightRecord& record = ptrThreadRing->arrRecords[head & (CELERIQUE_FLIGHT_RECORDER_CAPACITY - 1)];
+    record.timeNanoSecs = static_cast<uint64_t>(::std::chrono::duration_cast<::std::chrono::nanoseconds>(
+        ::std::chrono::steady_clock::now().time_since_epoch()
+    ).count());
+    record.value = value;
+    record.kind = kind;
+    record.detail = detail;
+    record.textSize = static_cast<uint16_t>(ptrText != nullptr ? ::std::min<size_t>(textSize, CELERIQUE_FLIGHT_RECORD_TEXT_SIZE) : 0);
+    record.threadIndex = threadRingIndex;
+    if (record.textSize > 0) ::std::memcpy(record.arrText, ptrText, record.textSize);
+    ptrThreadRing->atomicHead.store(head + 1, ::std::memory_order_release);
+}
+
+/// @brief Write every thread's flight recorder to a file.
+/// @param path The path of the file, or null for the one passed to `installFlightRecorderDumps`.
+/// @return `false` if there is no path or the file could not be written.
+bool celerique::dumpFlightRecorder(const char* path) {
+    if (path == nullptr) return internal::dumpInstalledFlightRecorder(CELERIQUE_FLIGHT_DUMP_REASON_REQUESTED);
+    return writeFlightDump(path, CELERIQUE_FLIGHT_DUMP_REASON_REQUESTED, 0);
+}
+
+/// @brief Dump the flight recorders to a file when a fatal message is logged, `::std::terminate` is
+/// called or a fatal signal is raised.
+/// @param path The path of the file, replaced by every dump.
+void ::celerique::installFlightRecorderDumps(const ::std::string& path) {
+    if (path.empty() || path.size() >= FLIGHT_DUMP_PATH_SIZE) {
+        celeriqueLogWarning("Invalid flight recorder dump path: " + path);
+        return;
+    }
+    atomicIsDumpInstalled.store(false, ::std::memory_order_release);
+    ::std::memcpy(arrDumpPath, path.c_str(), path.size() + 1);
+    atomicIsDumpInstalled.store(true, ::std::memory_order_release);
+
+    /// @brief Whether the handlers were installed by an earlier call.
+    static ::std::atomic<bool> atomicAreHandlersInstalled = false;
+    if (atomicAreHandlersInstalled.exchange(true)) return;
+    previousTerminateHandler = ::std::set_terminate(onTerminate);
+#if defined(CELERIQUE_FOR_POSIX_SYSTEMS)
+    /// @brief The fatal signal action, restoring the default action when run.
+    struct sigaction fatalSignalAction = {};
+    fatalSignalAction.sa_handler = onFatalSignal;
+    fatalSignalAction.sa_flags = SA_RESETHAND | SA_NODEFER;
+    sigemptyset(&fatalSignalAction.sa_mask);
+    for (int signalNumber : {SIGSEGV, SIGBUS, SIGILL, SIGFPE, SIGABRT}) {
+        sigaction(signalNumber, &fatalSignalAction, nullptr);
+    }
+#else
+    // Handlers installed with `signal` are reset to the default action when run.
+    for (int signalNumber : {SIGSEGV, SIGILL, SIGFPE, SIGABRT}) ::std::signal(signalNumber, onFatalSignal);
+#endif
+}
+
+/// @brief Read a flight recorder dump.
+/// @param path The path of the file.
+/// @param dump The dump to be overwritten.
+/// @return `false` if the file could not be read or is not a flight recorder dump.
+bool celerique::readFlightRecorderDump(const ::std::string& path, FlightDump& dump) {
+    /// @brief The dump file.
+    ::std::ifstream dumpFile(path, ::std::ios::binary | ::std::ios::ate);
+    if (!dumpFile.is_open()) return false;
+    /// @brief The size of the dump file.
+    size_t fileSize = static_cast<size_t>(dumpFile.tellg());
+    dumpFile.seekg(0);
+    /// @brief The header of the dump.
+    FlightDumpHeader header = {};
+    if (fileSize < sizeof(header) || !dumpFile.read(reinterpret_cast<char*>(&header), sizeof(header))) return false;
+    if (header.magic != FLIGHT_DUMP_MAGIC || header.version != FLIGHT_DUMP_VERSION ||
+    header.recordSize != sizeof(FlightRecord) || (fileSize - sizeof(header)) % sizeof(FlightRecord) != 0) return false;
+
+    dump.reason = header.reason;
+    dump.signalNumber = header.signalNumber;
+    dump.vecRecords.resize((fileSize - sizeof(header)) / sizeof(FlightRecord));
+    return static_cast<bool>(dumpFile.read(
+        reinterpret_cast<char*>(dump.vecRecords.data()), dump.vecRecords.size() * sizeof(FlightRecord)
+    ));
+}
+
+/// @brief Write every thread's flight recorder to the file passed to `installFlightRecorderDumps`, if any.
+/// @param reason Why the dump is written.
+/// @param signalNumber The signal that was raised, for `CELERIQUE_FLIGHT_DUMP_REASON_SIGNAL`.
+/// @return `false` if there is no path or the file could not be written.
+bool celerique::internal::dumpInstalledFlightRecorder(FlightDumpReason reason, int32_t signalNumber) {
+    if (!atomicIsDumpInstalled.load(::std::memory_order_acquire)) return false;
+    return writeFlightDump(arrDumpPath, reason, signalNumber);
+}
+
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
@@ -0,0 +1,117 @@
+/*
+
+File: ./core/src/render.cpp
+Author: Aldhinn Espinas
+Description: This source file contains the render snapshot implementations.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique/render.h>
+
+#include <cstring>
+
+/// @brief Clear the recorded data for a new frame, keeping the allocated capacity.
+/// @param frameIndex The index of the frame being recorded.
+void ::celerique::RenderSnapshot::reset(uint64_t frameIndex) {
+    _frameIndex = frameIndex;
+    _vecUniformUpdates.clear();
+    _vecUniformBytes.clear();
+    _vecDrawCalls.clear();
+    _vecVertexBytes.clear();
+    _vecIndices.clear();
+}
+
+/// @brief Record a uniform update. The data is copied into the snapshot.
+/// @param graphicsPipelineConfigId The unique identifier to the graphics pipeline configuration.
+/// @param bindingPoint The binding point of the uniform.
+/// @param ptrData The pointer to the buffer containing the new data.
+/// @param sizeData The size of the new data to be passed.
+void ::celerique::RenderSnapshot::updateUniform(
+    PipelineConfigID graphicsPipelineConfigId, size_t bindingPoint, const void* ptrData, size_t sizeData
+) {
+    /// @brief Where the data starts in the uniform bytes.
+    size_t offset = _vecUniformBytes.size();
+    _vecUniformBytes.resize(offset + sizeData);
+    if (sizeData > 0) ::std::memcpy(_vecUniformBytes.data() + offset, ptrData, sizeData);
+    _vecUniformUpdates.push_back({graphicsPipelineConfigId, bindingPoint, offset, sizeData});
+}
+
+/// @brief Record a draw call. The vertex and index buffers are copied into the snapshot, so
+/// the layer may change them as soon as this returns.
+/// @param graphicsPipelineConfigId The identifier for the graphics pipeline configuration to be used for drawing.
+/// @param numVerticesToDraw The number of vertices to be drawn.
+/// @param vertexStride The size of the individual vertex input.
+/// @param numVertexElements The number of individual vertices to draw.
+/// @param ptrVertexBuffer The pointer to the vertex buffer.
+/// @param ptrIndexBuffer The pointer to the index buffer, holding `numVerticesToDraw` indices.
+/// @param drawVersion The version of the vertices and indices, changed whenever their contents change. 0 when unversioned.
+void ::celerique::RenderSnapshot::draw(
+    PipelineConfigID graphicsPipelineConfigId, size_t numVerticesToDraw, size_t vertexStride,
+    size_t numVertexElements, const void* ptrVertexBuffer, const uint32_t* ptrIndexBuffer, uint64_t drawVersion
+) {
+    /// @brief Where the vertex data starts in the vertex bytes.
+    size_t vertexOffset = _vecVertexBytes.size();
+    if (ptrVertexBuffer != nullptr) {
+        /// @brief The size of the vertex data.
+        size_t vertexBufferSize = vertexStride * numVertexElements;
+        _vecVertexBytes.resize(vertexOffset + vertexBufferSize);
+        if (vertexBufferSize > 0) ::std::memcpy(_vecVertexBytes.data() + vertexOffset, ptrVertexBuffer, vertexBufferSize);
+    }
+    /// @brief Where the indices start in the indices.
+    size_t indexOffset = _vecIndices.size();
+    if (ptrIndexBuffer != nullptr) {
+        _vecIndices.insert(_vecIndices.end(), ptrIndexBuffer, ptrIndexBuffer + numVerticesToDraw);
+    }
+    _vecDrawCalls.push_back({
+        graphicsPipelineConfigId, numVerticesToDraw, vertexStride, numVertexElements,
+        vertexOffset, indexOffset, ptrVertexBuffer != nullptr, ptrIndexBuffer != nullptr, drawVersion,
+        _vecUniformUpdates.size()
+    });
+}
+
+/// @brief Record transforms, such as the world matrices exported from a scene, as a uniform update
+/// of the specified binding point. The matrices are copied into the snapshot.
+/// @param graphicsPipelineConfigId The unique identifier to the graphics pipeline configuration.
+/// @param bindingPoint The binding point of the uniform holding the matrices.
+/// @param ptrMatrices The matrices, 16 floats each.
+/// @param numMatrices The number of matrices.
+void ::celerique::RenderSnapshot::addTransforms(
+    PipelineConfigID graphicsPipelineConfigId, size_t bindingPoint, const float* ptrMatrices, size_t numMatrices
+) {
+    updateUniform(graphicsPipelineConfigId, bindingPoint, ptrMatrices, numMatrices * 16 * sizeof(float));
+}
+
+/// @brief Replay the uniform updates and draw calls in the order they were recorded.
+/// @param graphicsApi The graphics API to submit to.
+void ::celerique::RenderSnapshot::submit(IGraphicsAPI& graphicsApi) const {
+    /// @brief The number of uniform updates submitted so far.
+    size_t numUniformUpdatesSubmitted = 0;
+    /// @brief Submit the uniform updates recorded before the specified count.
+    auto submitUniformUpdatesUntil = [&](size_t numUniformUpdates) {
+        for (; numUniformUpdatesSubmitted < numUniformUpdates; numUniformUpdatesSubmitted++) {
+            const SnapshotUniformUpdate& uniformUpdate = _vecUniformUpdates[numUniformUpdatesSubmitted];
+            // The graphics API only reads the data, it just does not take a const pointer.
+            graphicsApi.updateUniform(
+                uniformUpdate.graphicsPipelineConfigId, uniformUpdate.bindingPoint,
+                const_cast<Byte*>(_vecUniformBytes.data()) + uniformUpdate.offset, uniformUpdate.size
+            );
+        }
+    };
+
+    for (const SnapshotDrawCall& drawCall : _vecDrawCalls) {
+        submitUniformUpdatesUntil(drawCall.numUniformUpdatesBefore);
+        // The graphics API only reads the buffers too.
+        graphicsApi.draw(
+            drawCall.graphicsPipelineConfigId, drawCall.numVerticesToDraw, drawCall.vertexStride, drawCall.numVertexElements,
+            drawCall.hasVertexBuffer ? const_cast<Byte*>(_vecVertexBytes.data()) + drawCall.vertexOffset : nullptr,
+            drawCall.hasIndexBuffer ? const_cast<uint32_t*>(_vecIndices.data()) + drawCall.indexOffset : nullptr,
+            drawCall.drawVersion
+        );
+    }
+    submitUniformUpdatesUntil(_vecUniformUpdates.size());
+}
+
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
@@ -0,0 +1,273 @@
+/*
+
+File: ./core/src/state.cpp
+Author: Aldhinn Espinas
+Description: This source file contains the state snapshot implementations.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique/state.h>
+#include <celerique/logging.h>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+/// @brief The magic number at the start of every state snapshot ("CLST").
+#define STATE_SNAPSHOT_MAGIC                                                                0x54534C43
+
+/// @brief The header at the start of a state snapshot.
+struct alignas(CELERIQUE_STATE_SNAPSHOT_ALIGNMENT) StateSnapshotHeader {
+    /// @brief Always `STATE_SNAPSHOT_MAGIC`.
+    uint32_t magic;
+    /// @brief The version of the snapshot layout.
+    uint32_t version;
+    /// @brief The number of sections following the header.
+    uint64_t numSections;
+};
+
+/// @brief The header in front of every section's data.
+struct alignas(CELERIQUE_STATE_SNAPSHOT_ALIGNMENT) StateSectionHeader {
+    /// @brief The key the section is looked up with.
+    uint64_t key;
+    /// @brief The size of the section's data, without padding.
+    uint64_t size;
+    /// @brief The version of the section's own layout.
+    uint32_t version;
+};
+
+/// @brief The number of delta blocks compared at once before narrowing down to the blocks that differ.
+#define STATE_DELTA_BLOCKS_PER_SPAN                                                         64
+
+/// @brief Round a size up to the snapshot alignment.
+/// @param size The size.
+/// @return The aligned size.
+static inline size_t alignSize(size_t size) {
+    return (size + CELERIQUE_STATE_SNAPSHOT_ALIGNMENT - 1) & ~static_cast<size_t>(CELERIQUE_STATE_SNAPSHOT_ALIGNMENT - 1);
+}
+
+/// @brief Hash the snapshot header and every section header, which a delta's blocks are only valid against.
+/// @param ptrArena The pointer to the snapshot's arena, holding whole sections.
+/// @param arenaSize The size of the arena.
+/// @return The 64-bit FNV-1a hash of the layout.
+static uint64_t hashLayout(const ::celerique::Byte* ptrArena, size_t arenaSize) {
+    /// @brief The running hash.
+    uint64_t hash = 14695981039346656037ull;
+    /// @brief Mix the bytes of a value into the hash.
+    auto mix = [&hash](const void* ptrValue, size_t valueSize) {
+        for (size_t i = 0; i < valueSize; i++) {
+            hash ^= static_cast<uint64_t>(static_cast<const unsigned char*>(ptrValue)[i]);
+            hash *= 1099511628211ull;
+        }
+    };
+    /// @brief The header of the snapshot.
+    StateSnapshotHeader header;
+    ::std::memcpy(&header, ptrArena, sizeof(header));
+    mix(&header.magic, sizeof(header.magic));
+    mix(&header.version, sizeof(header.version));
+    mix(&header.numSections, sizeof(header.numSections));
+    for (size_t offset = sizeof(StateSnapshotHeader); offset < arenaSize;) {
+        /// @brief The header of the current section.
+        StateSectionHeader sectionHeader;
+        ::std::memcpy(&sectionHeader, ptrArena + offset, sizeof(sectionHeader));
+        mix(&sectionHeader.key, sizeof(sectionHeader.key));
+        mix(&sectionHeader.size, sizeof(sectionHeader.size));
+        mix(&sectionHeader.version, sizeof(sectionHeader.version));
+        offset += sizeof(StateSectionHeader) + alignSize(static_cast<size_t>(sectionHeader.size));
+    }
+    return hash;
+}
+
+/// @brief Empty the snapshot, keeping the allocated capacity.
+void ::celerique::StateSnapshot::clear() {
+    _vecArena.assign(sizeof(StateSnapshotHeader), 0);
+    /// @brief The header of the empty snapshot.
+    StateSnapshotHeader header = {STATE_SNAPSHOT_MAGIC, CELERIQUE_STATE_SNAPSHOT_VERSION, 0};
+    ::std::memcpy(_vecArena.data(), &header, sizeof(header));
+}
+
+/// @brief Reserve a section to be written in place.
+/// @param key The key the section is looked up with. Unique within the snapshot.
+/// @param size The size of the section's data.
+/// @param version The version of the section's own layout, returned to the reader.
+/// @return The pointer to the section's data, aligned to `CELERIQUE_STATE_SNAPSHOT_ALIGNMENT`
+/// and valid until the next section is added.
+::celerique::Byte* celerique::StateSnapshot::appendSection(uint64_t key, size_t size, uint32_t version) {
+    /// @brief Where the new section's header starts.
+    size_t offset = _vecArena.size();
+    // Zero filled, so padding never shows up as a change in deltas.
+    _vecArena.resize(offset + sizeof(StateSectionHeader) + alignSize(size), 0);
+
+    /// @brief The header of the new section, zeroed first so its padding is copied as zeros too.
+    StateSectionHeader sectionHeader;
+    ::std::memset(&sectionHeader, 0, sizeof(sectionHeader));
+    sectionHeader.key = key;
+    sectionHeader.size = size;
+    sectionHeader.version = version;
+    ::std::memcpy(_vecArena.data() + offset, &sectionHeader, sizeof(sectionHeader));
+    /// @brief The header of the snapshot.
+    StateSnapshotHeader header;
+    ::std::memcpy(&header, _vecArena.data(), sizeof(header));
+    header.numSections++;
+    ::std::memcpy(_vecArena.data(), &header, sizeof(header));
+
+    return _vecArena.data() + offset + sizeof(StateSectionHeader);
+}
+
+/// @brief Copy data into a new section.
+/// @param key The key the section is looked up with. Unique within the snapshot.
+/// @param ptrData The pointer to the data.
+/// @param size The size of the data.
+/// @param version The version of the section's own layout, returned to the reader.
+void ::celerique::StateSnapshot::writeSection(uint64_t key, const void* ptrData, size_t size, uint32_t version) {
+    /// @brief The section's data.
+    Byte* ptrSection = appendSection(key, size, version);
+    if (size > 0) ::std::memcpy(ptrSection, ptrData, size);
+}
+
+/// @brief Find a section.
+/// @param key The key of the section.
+/// @param ptrSize Receives the size of the section's data, if not null.
+/// @param ptrVersion Receives the version of the section's layout, if not null.
+/// @return The pointer to the section's data, or null if the snapshot has no such section.
+const ::celerique::Byte* celerique::StateSnapshot::section(uint64_t key, size_t* ptrSize, uint32_t* ptrVersion) const {
+    for (size_t offset = sizeof(StateSnapshotHeader); offset < _vecArena.size();) {
+        /// @brief The header of the current section.
+        StateSectionHeader sectionHeader;
+        ::std::memcpy(&sectionHeader, _vecArena.data() + offset, sizeof(sectionHeader));
+        if (sectionHeader.key == key) {
+            if (ptrSize != nullptr) *ptrSize = static_cast<size_t>(sectionHeader.size);
+            if (ptrVersion != nullptr) *ptrVersion = sectionHeader.version;
+            return _vecArena.data() + offset + sizeof(StateSectionHeader);
+        }
+        offset += sizeof(StateSectionHeader) + alignSize(static_cast<size_t>(sectionHeader.size));
+    }
+    return nullptr;
+}
+
+/// @brief Replace the snapshot with bytes copied from another snapshot's `data`.
+/// @param ptrData The pointer to the bytes.
+/// @param size The number of bytes.
+/// @return `false` if the bytes are not a snapshot of this version, leaving the snapshot empty.
+bool celerique::StateSnapshot::assign(const Byte* ptrData, size_t size) {
+    clear();
+    /// @brief The header of the snapshot being assigned.
+    StateSnapshotHeader header;
+    if (ptrData == nullptr || size < sizeof(header)) {
+        celeriqueLogWarning("State snapshot is too small to hold a header.");
+        return false;
+    }
+    ::std::memcpy(&header, ptrData, sizeof(header));
+    if (header.magic != STATE_SNAPSHOT_MAGIC || header.version != CELERIQUE_STATE_SNAPSHOT_VERSION) {
+        celeriqueLogWarning("State snapshot is not of version " + ::std::to_string(CELERIQUE_STATE_SNAPSHOT_VERSION) + ".");
+        return false;
+    }
+
+    // Every section has to lie within the bytes, so lookups never read past the arena.
+    /// @brief The number of sections found.
+    uint64_t numSections = 0;
+    /// @brief Where the current section's header starts.
+    size_t offset = sizeof(header);
+    while (offset < size) {
+        /// @brief The header of the current section.
+        StateSectionHeader sectionHeader;
+        if (size - offset < sizeof(sectionHeader)) break;
+        ::std::memcpy(&sectionHeader, ptrData + offset, sizeof(sectionHeader));
+        if (sectionHeader.size > size - offset - sizeof(sectionHeader)) break;
+        offset += sizeof(sectionHeader) + alignSize(static_cast<size_t>(sectionHeader.size));
+        numSections++;
+    }
+    if (offset != size || numSections != header.numSections) {
+        celeriqueLogWarning("State snapshot sections do not match its size.");
+        return false;
+    }
+
+    _vecArena.assign(ptrData, ptrData + size);
+    return true;
+}
+
+/// @brief Record the blocks differing from a previous snapshot.
+/// @param previous The previous snapshot, typically of the previous frame.
+/// @param delta The delta to be overwritten, keeping its allocated capacity.
+void ::celerique::StateSnapshot::diff(const StateSnapshot& previous, StateDelta& delta) const {
+    delta._baseSize = previous.size();
+    delta._baseLayoutHash = hashLayout(previous.data(), previous.size());
+    delta._targetSize = size();
+    delta._vecBlockIndices.clear();
+    delta._vecBlockBytes.clear();
+
+    /// @brief The number of blocks in this snapshot, the last one possibly partial.
+    size_t numBlocks = (size() + CELERIQUE_STATE_DELTA_BLOCK_SIZE - 1) / CELERIQUE_STATE_DELTA_BLOCK_SIZE;
+    /// @brief The size of the spans compared at once.
+    const size_t spanSize = CELERIQUE_STATE_DELTA_BLOCK_SIZE * STATE_DELTA_BLOCKS_PER_SPAN;
+    for (size_t blockIndex = 0; blockIndex < numBlocks; blockIndex++) {
+        // Most of the state is unchanged from frame to frame, so whole spans are skipped with one comparison.
+        if (blockIndex % STATE_DELTA_BLOCKS_PER_SPAN == 0) {
+            /// @brief Where the span starts.
+            size_t spanOffset = blockIndex * CELERIQUE_STATE_DELTA_BLOCK_SIZE;
+            /// @brief The size of the span.
+            size_t spanLength = ::std::min(spanSize, size() - spanOffset);
+            if (spanOffset + spanLength <= previous.size() &&
+                ::std::memcmp(data() + spanOffset, previous.data() + spanOffset, spanLength) == 0) {
+                blockIndex += STATE_DELTA_BLOCKS_PER_SPAN - 1;
+                continue;
+            }
+        }
+        /// @brief Where the block starts.
+        size_t offset = blockIndex * CELERIQUE_STATE_DELTA_BLOCK_SIZE;
+        /// @brief The size of the block.
+        size_t blockSize = ::std::min(static_cast<size_t>(CELERIQUE_STATE_DELTA_BLOCK_SIZE), size() - offset);
+        if (offset + blockSize <= previous.size() &&
+            ::std::memcmp(data() + offset, previous.data() + offset, blockSize) == 0) continue;
+
+        delta._vecBlockIndices.emplace_back(static_cast<uint32_t>(blockIndex));
+        /// @brief Where the block's contents start in the delta.
+        size_t bytesOffset = delta._vecBlockBytes.size();
+        delta._vecBlockBytes.resize(bytesOffset + CELERIQUE_STATE_DELTA_BLOCK_SIZE, 0);
+        ::std::memcpy(delta._vecBlockBytes.data() + bytesOffset, data() + offset, blockSize);
+    }
+}
+
+/// @brief Turn this snapshot into the one a delta was recorded from.
+/// @param delta The delta recorded against this snapshot's contents.
+/// @return `false` if the delta was recorded against a snapshot of another size or layout.
+bool celerique::StateSnapshot::applyDelta(const StateDelta& delta) {
+    if (delta._baseSize != size()) {
+        celeriqueLogWarning("State delta was recorded against a snapshot of another size.");
+        return false;
+    }
+    if (delta._baseLayoutHash != hashLayout(data(), size())) {
+        celeriqueLogWarning("State delta was recorded against a snapshot with other sections.");
+        return false;
+    }
+
+    _vecArena.resize(delta._targetSize, 0);
+    for (size_t i = 0; i < delta._vecBlockIndices.size(); i++) {
+        /// @brief Where the block starts.
+        size_t offset = static_cast<size_t>(delta._vecBlockIndices[i]) * CELERIQUE_STATE_DELTA_BLOCK_SIZE;
+        ::std::memcpy(
+            _vecArena.data() + offset, delta._vecBlockBytes.data() + i * CELERIQUE_STATE_DELTA_BLOCK_SIZE,
+            ::std::min(static_cast<size_t>(CELERIQUE_STATE_DELTA_BLOCK_SIZE), delta._targetSize - offset)
+        );
+    }
+    return true;
+}
+
+/// @brief The number of sections written.
+/// @return The number of sections.
+size_t celerique::StateSnapshot::numSections() const {
+    /// @brief The header of the snapshot.
+    StateSnapshotHeader header;
+    ::std::memcpy(&header, _vecArena.data(), sizeof(header));
+    return static_cast<size_t>(header.numSections);
+}
+
+/// @brief Default constructor. Creates an empty snapshot.
+::celerique::StateSnapshot::StateSnapshot() {
+    clear();
+}
+
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
@@ -0,0 +1,179 @@
+/*
+
+File: ./core/src/tasks.cpp
+Author: Aldhinn Espinas
+Description: This source file contains the coroutine task scheduler implementations.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique/internal/tasks.h>
+
+#if defined(CELERIQUE_COROUTINES_ENABLED)
+#include <celerique/internal/engine.h>
+#include <celerique/jobs.h>
+#include <celerique/logging.h>
+
+#include <string>
+
+namespace {
+    /// @brief A coroutine owning its own frame, destroyed as soon as it finishes.
+    struct DetachedCoroutine {
+        /// @brief The promise of a detached coroutine.
+        struct promise_type : public ::celerique::internal::ScheduledPromiseBase {
+            /// @brief Create the detached coroutine referring to this promise.
+            /// @return The detached coroutine.
+            inline DetachedCoroutine get_return_object() noexcept {
+                return {::std::coroutine_handle<promise_type>::from_promise(*this)};
+            }
+            /// @brief Started by `spawnTask` on a job worker.
+            /// @return An always suspending awaiter.
+            inline ::std::suspend_always initial_suspend() const noexcept { return {}; }
+            /// @brief Destroy the frame when done.
+            /// @return A never suspending awaiter.
+            inline ::std::suspend_never final_suspend() const noexcept { return {}; }
+            /// @brief Nothing to keep.
+            inline void return_void() const noexcept {}
+            /// @brief Exceptions are caught in `runDetached`.
+            inline void unhandled_exception() const noexcept {}
+        };
+
+        /// @brief The handle to the coroutine.
+        ::std::coroutine_handle<promise_type> handle;
+    };
+
+    /// @brief Run a task to completion, logging the exception it throws.
+    /// @param task The task to be run.
+    /// @return The detached coroutine running the task.
+    DetachedCoroutine runDetached(::celerique::Task<void> task) {
+        try {
+            co_await task;
+        } catch (const ::std::exception& exception) {
+            celeriqueLogError(::std::string("A spawned task threw: ") + exception.what());
+        } catch (...) {
+            celeriqueLogError("A spawned task threw an unknown exception.");
+        }
+    }
+}
+
+/// @brief Keep a suspended coroutine until its condition holds.
+/// @param isReady The condition. Null holds on the next engine update.
+/// @param handle The handle to the suspended coroutine.
+void ::celerique::internal::TaskScheduler::resumeWhen(
+    ::std::function<bool()>&& isReady, ::std::coroutine_handle<> handle
+) {
+    ::std::lock_guard<::std::mutex> writeLock(_suspendedTasksMutex);
+    _vecSuspendedTasks.push_back({::std::move(isReady), handle});
+}
+
+/// @brief Resume every coroutine whose condition holds on the job workers.
+/// Called at the start of every update of the engine owning the scheduler.
+void ::celerique::internal::TaskScheduler::onFrame() {
+    /// @brief The suspended coroutines whose condition holds.
+    ::std::vector<::std::coroutine_handle<>> vecReadyHandles;
+    {
+        ::std::lock_guard<::std::mutex> writeLock(_suspendedTasksMutex);
+        /// @brief The end of the coroutines still waiting.
+        size_t numWaiting = 0;
+        for (SuspendedTask& suspendedTask : _vecSuspendedTasks) {
+            if (!suspendedTask.isReady || suspendedTask.isReady()) {
+                vecReadyHandles.push_back(suspendedTask.handle);
+            } else {
+                _vecSuspendedTasks[numWaiting++] = ::std::move(suspendedTask);
+            }
+        }
+        _vecSuspendedTasks.resize(numWaiting);
+    }
+    // Coroutines suspending again while these are submitted wait for the next update.
+    for (::std::coroutine_handle<> handle : vecReadyHandles) {
+        getJobWorkers().submit([handle]() { handle.resume(); });
+    }
+}
+
+/// @brief Destructor.
+::celerique::internal::TaskScheduler::~TaskScheduler() {
+    if (!_vecSuspendedTasks.empty()) {
+        celeriqueLogWarning(
+            ::std::to_string(_vecSuspendedTasks.size()) + " tasks were still suspended at exit."
+        );
+    }
+}
+
+/// @brief Resume a suspended coroutine on a job worker once the condition holds.
+/// Conditions are checked at the start of every update of the scheduler's engine.
+/// @param ptrScheduler The scheduler of the engine the coroutine runs on, or `nullptr` for the process default engine's.
+/// @param isReady The condition. Null resumes on the next engine update.
+/// @param handle The handle to the suspended coroutine.
+void ::celerique::internal::resumeWhen(
+    TaskScheduler* ptrScheduler, ::std::function<bool()>&& isReady, ::std::coroutine_handle<> handle
+) {
+    if (ptrScheduler == nullptr) ptrScheduler = &Engine::getRef().taskScheduler();
+    ptrScheduler->resumeWhen(::std::move(isReady), handle);
+}
+
+/// @brief Start a task on a job worker, its suspensions resumed by a scheduler's updates.
+/// @param ptrScheduler The scheduler of the engine the task runs on, or `nullptr` for the process default engine's.
+/// @param task The task to be started.
+void ::celerique::internal::spawnTask(TaskScheduler* ptrScheduler, Task<void>&& task) {
+    /// @brief The coroutine owning the task.
+    DetachedCoroutine detachedCoroutine = runDetached(::std::move(task));
+    detachedCoroutine.handle.promise().ptrScheduler = ptrScheduler;
+    getJobWorkers().submit([handle = detachedCoroutine.handle]() { handle.resume(); });
+}
+
+/// @brief Whether the asset already finished loading or failed.
+/// @return `true` if the awaiting coroutine may continue without suspending.
+bool ::celerique::AssetLoadAwaiter::await_ready() const {
+    /// @brief The current state of the asset.
+    AssetState state = _assetHandle.state();
+    return state != CELERIQUE_ASSET_STATE_QUEUED && state != CELERIQUE_ASSET_STATE_LOADING;
+}
+
+/// @brief Start a task on a job worker, its suspensions resumed by the process default engine's updates.
+/// The task is destroyed once it finished, and an exception it throws is logged as an error.
+/// @param task The task to be started.
+void ::celerique::spawnTask(Task<void>&& task) {
+    internal::spawnTask(nullptr, ::std::move(task));
+}
+
+/// @brief Suspend the awaiting coroutine until the next update of its engine.
+/// @return The awaiter to be awaited.
+::celerique::ConditionAwaiter celerique::nextFrame() {
+    return ConditionAwaiter(nullptr);
+}
+
+/// @brief Suspend the awaiting coroutine for at least the specified duration, resuming on the
+/// first update of its engine after it elapsed.
+/// @param duration The duration to wait.
+/// @return The awaiter to be awaited.
+::celerique::ConditionAwaiter celerique::delay(::std::chrono::nanoseconds duration) {
+    /// @brief The point in time the wait ends.
+    ::std::chrono::steady_clock::time_point deadline = ::std::chrono::steady_clock::now() + duration;
+    return ConditionAwaiter([deadline]() { return ::std::chrono::steady_clock::now() >= deadline; });
+}
+
+/// @brief Suspend the awaiting coroutine until an asset finished loading or failed.
+/// @param assetHandle The handle to the asset being waited on.
+/// @return The awaiter to be awaited, producing the asset state.
+::celerique::AssetLoadAwaiter celerique::waitForAsset(const AssetHandle& assetHandle) {
+    return AssetLoadAwaiter(assetHandle);
+}
+
+/// @brief Suspend the awaiting coroutine until a GPU timeline, such as a timeline semaphore,
+/// reached a value.
+/// @param completedValue Queries the value the timeline reached, such as `vkGetSemaphoreCounterValue`.
+/// Called on the update thread of the awaiting coroutine's engine.
+/// @param value The value to wait for.
+/// @return The awaiter to be awaited.
+::celerique::ConditionAwaiter celerique::waitForTimelineValue(
+    ::std::function<uint64_t()>&& completedValue, uint64_t value
+) {
+    return ConditionAwaiter([completedValue = ::std::move(completedValue), value]() {
+        return completedValue() >= value;
+    });
+}
+#endif
+
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
@@ -0,0 +1,454 @@
+/*
+
+File: ./core/src/texture.cpp
+Author: Aldhinn Espinas
+Description: This source file contains implementations of block compressed textures.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique/texture.h>
+#include <celerique/jobs.h>
+#include <celerique/logging.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+/// @brief The size of the KTX2 header, index included.
+#define KTX2_HEADER_SIZE                                                                    80
+/// @brief The size of a single KTX2 level index entry.
+#define KTX2_LEVEL_INDEX_ENTRY_SIZE                                                         24
+/// @brief The number of block rows compressed per job.
+#define TEXTURE_BLOCK_ROW_BATCH_SIZE                                                        8
+
+/// @brief The bytes identifying a KTX2 file.
+static const uint8_t ktx2Identifier[12] = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+
+/// @brief Determines whether a texture format is stored in 4x4 blocks.
+/// @param format The texture format.
+/// @return `true` for block compressed formats.
+bool celerique::isBlockCompressed(TextureFormat format) {
+    return format >= CELERIQUE_TEXTURE_FORMAT_BC1_UNORM && format <= CELERIQUE_TEXTURE_FORMAT_ASTC_4X4_SRGB;
+}
+
+/// @brief The number of bytes a mip level of a texture format takes up.
+/// @param format The texture format.
+/// @param width The width of the mip level in pixels.
+/// @param height The height of the mip level in pixels.
+/// @return The size in bytes, 0 for unknown formats.
+size_t celerique::textureLevelSize(TextureFormat format, uint32_t width, uint32_t height) {
+    /// @brief The number of 4x4 blocks covering the mip level.
+    size_t numBlocks = static_cast<size_t>((width + 3) / 4) * ((height + 3) / 4);
+
+    switch (format) {
+    case CELERIQUE_TEXTURE_FORMAT_RGBA8_UNORM:
+    case CELERIQUE_TEXTURE_FORMAT_RGBA8_SRGB:
+        return static_cast<size_t>(width) * height * 4;
+    case CELERIQUE_TEXTURE_FORMAT_BC1_UNORM:
+    case CELERIQUE_TEXTURE_FORMAT_BC1_SRGB:
+        return numBlocks * 8;
+    case CELERIQUE_TEXTURE_FORMAT_BC3_UNORM:
+    case CELERIQUE_TEXTURE_FORMAT_BC3_SRGB:
+    case CELERIQUE_TEXTURE_FORMAT_BC5_UNORM:
+    case CELERIQUE_TEXTURE_FORMAT_BC7_UNORM:
+    case CELERIQUE_TEXTURE_FORMAT_BC7_SRGB:
+    case CELERIQUE_TEXTURE_FORMAT_ETC2_RGBA8_UNORM:
+    case CELERIQUE_TEXTURE_FORMAT_ETC2_RGBA8_SRGB:
+    case CELERIQUE_TEXTURE_FORMAT_ASTC_4X4_UNORM:
+    case CELERIQUE_TEXTURE_FORMAT_ASTC_4X4_SRGB:
+        return numBlocks * 16;
+    }
+    return 0;
+}
+
+/// @brief Member init constructor.
+/// @param format The format of the texture.
+/// @param vecMipLevels The mip levels, largest first.
+/// @param ptrOwner The shared pointer to whatever owns the mip level data.
+::celerique::Texture::Texture(
+    TextureFormat format, ::std::vector<TextureMipLevel>&& vecMipLevels, ::std::shared_ptr<const void>&& ptrOwner
+) : _format(format), _vecMipLevels(::std::move(vecMipLevels)), _ptrOwner(::std::move(ptrOwner)) {}
+
+/// @brief The number of bytes uploaded for every mip level.
+/// @return The size in bytes.
+size_t celerique::Texture::size() const {
+    /// @brief The collected size.
+    size_t size = 0;
+    for (const TextureMipLevel& mipLevel : _vecMipLevels) size += mipLevel.size;
+    return size;
+}
+
+/// @brief The number of bytes the mip levels would take up as uncompressed RGBA8.
+/// @return The size in bytes.
+size_t celerique::Texture::uncompressedSize() const {
+    /// @brief The collected size.
+    size_t size = 0;
+    for (const TextureMipLevel& mipLevel : _vecMipLevels) {
+        size += textureLevelSize(CELERIQUE_TEXTURE_FORMAT_RGBA8_UNORM, mipLevel.width, mipLevel.height);
+    }
+    return size;
+}
+
+/// @brief Map a Vulkan format code stored in a KTX2 file to a texture format.
+/// @param vkFormat The `VkFormat` value.
+/// @return The texture format, null for unsupported formats.
+static ::celerique::TextureFormat textureFormatFromVkFormat(uint32_t vkFormat) {
+    switch (vkFormat) {
+    case 37: return CELERIQUE_TEXTURE_FORMAT_RGBA8_UNORM;           // VK_FORMAT_R8G8B8A8_UNORM
+    case 43: return CELERIQUE_TEXTURE_FORMAT_RGBA8_SRGB;            // VK_FORMAT_R8G8B8A8_SRGB
+    case 131: case 133: return CELERIQUE_TEXTURE_FORMAT_BC1_UNORM;  // VK_FORMAT_BC1_RGB(A)_UNORM_BLOCK
+    case 132: case 134: return CELERIQUE_TEXTURE_FORMAT_BC1_SRGB;   // VK_FORMAT_BC1_RGB(A)_SRGB_BLOCK
+    case 137: return CELERIQUE_TEXTURE_FORMAT_BC3_UNORM;            // VK_FORMAT_BC3_UNORM_BLOCK
+    case 138: return CELERIQUE_TEXTURE_FORMAT_BC3_SRGB;             // VK_FORMAT_BC3_SRGB_BLOCK
+    case 141: return CELERIQUE_TEXTURE_FORMAT_BC5_UNORM;            // VK_FORMAT_BC5_UNORM_BLOCK
+    case 145: return CELERIQUE_TEXTURE_FORMAT_BC7_UNORM;            // VK_FORMAT_BC7_UNORM_BLOCK
+    case 146: return CELERIQUE_TEXTURE_FORMAT_BC7_SRGB;             // VK_FORMAT_BC7_SRGB_BLOCK
+    case 151: return CELERIQUE_TEXTURE_FORMAT_ETC2_RGBA8_UNORM;     // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK
+    case 152: return CELERIQUE_TEXTURE_FORMAT_ETC2_RGBA8_SRGB;      // VK_FORMAT_ETC2_R8G8B8A8_SRGB_BLOCK
+    case 157: return CELERIQUE_TEXTURE_FORMAT_ASTC_4X4_UNORM;       // VK_FORMAT_ASTC_4x4_UNORM_BLOCK
+    case 158: return CELERIQUE_TEXTURE_FORMAT_ASTC_4X4_SRGB;        // VK_FORMAT_ASTC_4x4_SRGB_BLOCK
+    }
+    return CELERIQUE_TEXTURE_FORMAT_NULL;
+}
+
+/// @brief The format family a device has to support to sample a texture format.
+/// @param format The texture format.
+/// @return The format support bit, none for uncompressed formats.
+static ::celerique::TextureFormatSupport requiredFormatSupport(::celerique::TextureFormat format) {
+    switch (format) {
+    case CELERIQUE_TEXTURE_FORMAT_BC1_UNORM:
+    case CELERIQUE_TEXTURE_FORMAT_BC1_SRGB:
+        return CELERIQUE_TEXTURE_FORMAT_SUPPORT_BC1;
+    case CELERIQUE_TEXTURE_FORMAT_BC3_UNORM:
+    case CELERIQUE_TEXTURE_FORMAT_BC3_SRGB:
+        return CELERIQUE_TEXTURE_FORMAT_SUPPORT_BC3;
+    case CELERIQUE_TEXTURE_FORMAT_BC5_UNORM:
+        return CELERIQUE_TEXTURE_FORMAT_SUPPORT_BC5;
+    case CELERIQUE_TEXTURE_FORMAT_BC7_UNORM:
+    case CELERIQUE_TEXTURE_FORMAT_BC7_SRGB:
+        return CELERIQUE_TEXTURE_FORMAT_SUPPORT_BC7;
+    case CELERIQUE_TEXTURE_FORMAT_ETC2_RGBA8_UNORM:
+    case CELERIQUE_TEXTURE_FORMAT_ETC2_RGBA8_SRGB:
+        return CELERIQUE_TEXTURE_FORMAT_SUPPORT_ETC2;
+    case CELERIQUE_TEXTURE_FORMAT_ASTC_4X4_UNORM:
+    case CELERIQUE_TEXTURE_FORMAT_ASTC_4X4_SRGB:
+        return CELERIQUE_TEXTURE_FORMAT_SUPPORT_ASTC_4X4;
+    }
+    return CELERIQUE_TEXTURE_FORMAT_SUPPORT_NONE;
+}
+
+/// @brief Read a little-endian unsigned integer.
+/// @param ptrData The pointer to the integer.
+/// @param size The size of the integer in bytes.
+/// @return The integer value.
+static uint64_t readLittleEndian(const ::celerique::Byte* ptrData, size_t size) {
+    /// @brief The bytes of the integer.
+    const uint8_t* ptrBytes = reinterpret_cast<const uint8_t*>(ptrData);
+    /// @brief The integer value.
+    uint64_t value = 0;
+    for (size_t i = 0; i < size; i++) value |= static_cast<uint64_t>(ptrBytes[i]) << (i * 8);
+    return value;
+}
+
+/// @brief Convert an 8-bit RGB color to RGB565.
+/// @param ptrRgb The pointer to the color.
+/// @return The packed color.
+static uint16_t packRgb565(const uint8_t* ptrRgb) {
+    return static_cast<uint16_t>(
+        (((ptrRgb[0] * 31 + 127) / 255) << 11) | (((ptrRgb[1] * 63 + 127) / 255) << 5) | ((ptrRgb[2] * 31 + 127) / 255)
+    );
+}
+
+/// @brief Convert an RGB565 color to 8-bit RGB.
+/// @param color The packed color.
+/// @param ptrRgb The pointer receiving the color.
+static void unpackRgb565(uint16_t color, int* ptrRgb) {
+    /// @brief The 5-bit red, 6-bit green & 5-bit blue channels.
+    int red = (color >> 11) & 0x1F, green = (color >> 5) & 0x3F, blue = color & 0x1F;
+    ptrRgb[0] = (red << 3) | (red >> 2);
+    ptrRgb[1] = (green << 2) | (green >> 4);
+    ptrRgb[2] = (blue << 3) | (blue >> 2);
+}
+
+/// @brief Compress a 4x4 block of pixels to a BC1 color block (always in 4 color mode).
+/// Endpoints are taken from the inset bounding box of the block's colors.
+/// @param pixels The RGBA pixels of the block, row by row.
+/// @param ptrDst The 8 bytes receiving the block.
+static void encodeBc1ColorBlock(const uint8_t pixels[16][4], uint8_t* ptrDst) {
+    /// @brief The per channel minimum & maximum.
+    uint8_t minColor[3] = {255, 255, 255}, maxColor[3] = {0, 0, 0};
+    for (size_t i = 0; i < 16; i++) {
+        for (size_t channel = 0; channel < 3; channel++) {
+            minColor[channel] = ::std::min(minColor[channel], pixels[i][channel]);
+            maxColor[channel] = ::std::max(maxColor[channel], pixels[i][channel]);
+        }
+    }
+    // Inset the bounding box by 1/16 of its size to reduce the error at the extremes.
+    for (size_t channel = 0; channel < 3; channel++) {
+        /// @brief The inset of the channel.
+        int inset = (maxColor[channel] - minColor[channel]) >> 4;
+        minColor[channel] = static_cast<uint8_t>(minColor[channel] + inset);
+        maxColor[channel] = static_cast<uint8_t>(maxColor[channel] - inset);
+    }
+
+    /// @brief The packed endpoints. 4 color mode requires the first to be greater.
+    uint16_t color0 = packRgb565(maxColor), color1 = packRgb565(minColor);
+    if (color0 < color1) ::std::swap(color0, color1);
+    /// @brief The indices of every pixel into the palette.
+    uint32_t indices = 0;
+
+    if (color0 != color1) {
+        /// @brief The palette of the block.
+        int palette[4][3];
+        unpackRgb565(color0, palette[0]);
+        unpackRgb565(color1, palette[1]);
+        for (size_t channel = 0; channel < 3; channel++) {
+            palette[2][channel] = (2 * palette[0][channel] + palette[1][channel]) / 3;
+            palette[3][channel] = (palette[0][channel] + 2 * palette[1][channel]) / 3;
+        }
+        for (size_t i = 0; i < 16; i++) {
+            /// @brief The closest palette entry and its distance.
+            uint32_t bestIndex = 0;
+            int bestDistance = INT32_MAX;
+            for (uint32_t paletteIndex = 0; paletteIndex < 4; paletteIndex++) {
+                /// @brief The squared distance to the palette entry.
+                int distance = 0;
+                for (size_t channel = 0; channel < 3; channel++) {
+                    int difference = pixels[i][channel] - palette[paletteIndex][channel];
+                    distance += difference * difference;
+                }
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    bestIndex = paletteIndex;
+                }
+            }
+            indices |= bestIndex << (i * 2);
+        }
+    }
+
+    ptrDst[0] = static_cast<uint8_t>(color0 & 0xFF);
+    ptrDst[1] = static_cast<uint8_t>(color0 >> 8);
+    ptrDst[2] = static_cast<uint8_t>(color1 & 0xFF);
+    ptrDst[3] = static_cast<uint8_t>(color1 >> 8);
+    for (size_t i = 0; i < 4; i++) ptrDst[4 + i] = static_cast<uint8_t>((indices >> (i * 8)) & 0xFF);
+}
+
+/// @brief Compress the alpha of a 4x4 block of pixels to a BC3 (BC4) alpha block (8 value mode).
+/// @param pixels The RGBA pixels of the block, row by row.
+/// @param ptrDst The 8 bytes receiving the block.
+static void encodeBc3AlphaBlock(const uint8_t pixels[16][4], uint8_t* ptrDst) {
+    /// @brief The minimum & maximum alpha.
+    uint8_t minAlpha = 255, maxAlpha = 0;
+    for (size_t i = 0; i < 16; i++) {
+        minAlpha = ::std::min(minAlpha, pixels[i][3]);
+        maxAlpha = ::std::max(maxAlpha, pixels[i][3]);
+    }
+    /// @brief The indices of every pixel into the palette.
+    uint64_t indices = 0;
+
+    if (maxAlpha != minAlpha) {
+        /// @brief The palette of the block.
+        int palette[8] = {maxAlpha, minAlpha};
+        for (int i = 2; i < 8; i++) palette[i] = ((8 - i) * maxAlpha + (i - 1) * minAlpha) / 7;
+        for (size_t i = 0; i < 16; i++) {
+            /// @brief The closest palette entry and its distance.
+            uint64_t bestIndex = 0;
+            int bestDistance = INT32_MAX;
+            for (uint64_t paletteIndex = 0; paletteIndex < 8; paletteIndex++) {
+                /// @brief The distance to the palette entry.
+                int distance = ::std::abs(pixels[i][3] - palette[paletteIndex]);
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    bestIndex = paletteIndex;
+                }
+            }
+            indices |= bestIndex << (i * 3);
+        }
+    }
+
+    ptrDst[0] = maxAlpha;
+    ptrDst[1] = minAlpha;
+    for (size_t i = 0; i < 6; i++) ptrDst[2 + i] = static_cast<uint8_t>((indices >> (i * 8)) & 0xFF);
+}
+
+/// @brief Compress an RGBA8 mip level to BC1 or BC3, in parallel on the job workers.
+/// @param ptrSrc The RGBA8 pixels.
+/// @param width The width of the mip level.
+/// @param height The height of the mip level.
+/// @param hasAlpha `true` to compress to BC3, `false` for BC1.
+/// @param ptrDst The memory receiving the blocks.
+static void compressMipLevel(const uint8_t* ptrSrc, uint32_t width, uint32_t height, bool hasAlpha, uint8_t* ptrDst) {
+    /// @brief The number of blocks per row & column.
+    size_t numBlocksX = (width + 3) / 4, numBlocksY = (height + 3) / 4;
+    /// @brief The size of a single block.
+    size_t blockSize = hasAlpha ? 16 : 8;
+
+    ::celerique::parallelFor(numBlocksY, TEXTURE_BLOCK_ROW_BATCH_SIZE, [&](size_t begin, size_t end) {
+        /// @brief The pixels of the current block.
+        uint8_t pixels[16][4];
+        for (size_t blockY = begin; blockY < end; blockY++) {
+            for (size_t blockX = 0; blockX < numBlocksX; blockX++) {
+                // Gather the block, replicating edge pixels of partial blocks.
+                for (size_t y = 0; y < 4; y++) {
+                    /// @brief The source row, clamped to the mip level.
+                    size_t srcY = ::std::min<size_t>(blockY * 4 + y, height - 1);
+                    for (size_t x = 0; x < 4; x++) {
+                        /// @brief The source column, clamped to the mip level.
+                        size_t srcX = ::std::min<size_t>(blockX * 4 + x, width - 1);
+                        ::std::memcpy(pixels[y * 4 + x], ptrSrc + (srcY * width + srcX) * 4, 4);
+                    }
+                }
+
+                /// @brief The block being written.
+                uint8_t* ptrBlock = ptrDst + (blockY * numBlocksX + blockX) * blockSize;
+                if (hasAlpha) {
+                    encodeBc3AlphaBlock(pixels, ptrBlock);
+                    ptrBlock += 8;
+                }
+                encodeBc1ColorBlock(pixels, ptrBlock);
+            }
+        }
+    });
+}
+
+/// @brief Load a KTX2 texture for a device. Block compressed payloads the device supports
+/// are referenced in place. Uncompressed RGBA8 payloads are compressed in parallel on the
+/// job workers to BC1 (opaque) or BC3, if supported, and kept as RGBA8 otherwise.
+/// @param ptrData The pointer to the file contents.
+/// @param size The size of the file contents.
+/// @param formatSupport The block compressed formats the device supports.
+/// @param ptrOwner The shared pointer to whatever owns the file contents, kept alive by the texture.
+/// @return The shared pointer to the texture or `nullptr` if the file can not be used on the device.
+::std::shared_ptr<::celerique::Texture> celerique::loadKtx2Texture(
+    const Byte* ptrData, size_t size, TextureFormatSupport formatSupport, ::std::shared_ptr<const void> ptrOwner
+) {
+    if (ptrData == nullptr || size < KTX2_HEADER_SIZE || ::std::memcmp(ptrData, ktx2Identifier, sizeof(ktx2Identifier)) != 0) {
+        celeriqueLogWarning("Not a KTX2 file.");
+        return nullptr;
+    }
+
+    /// @brief The `VkFormat` of the payload.
+    uint32_t vkFormat = static_cast<uint32_t>(readLittleEndian(ptrData + 12, 4));
+    /// @brief The dimensions of the largest mip level.
+    uint32_t width = static_cast<uint32_t>(readLittleEndian(ptrData + 20, 4));
+    uint32_t height = static_cast<uint32_t>(readLittleEndian(ptrData + 24, 4));
+    /// @brief The depth, array layers & cube faces.
+    uint32_t depth = static_cast<uint32_t>(readLittleEndian(ptrData + 28, 4));
+    uint32_t numLayers = static_cast<uint32_t>(readLittleEndian(ptrData + 32, 4));
+    uint32_t numFaces = static_cast<uint32_t>(readLittleEndian(ptrData + 36, 4));
+    /// @brief The number of mip levels (0 asks for a generated chain, which has to be stored too).
+    uint32_t numLevels = ::std::max<uint32_t>(1, static_cast<uint32_t>(readLittleEndian(ptrData + 40, 4)));
+    /// @brief The supercompression applied to the levels.
+    uint32_t supercompressionScheme = static_cast<uint32_t>(readLittleEndian(ptrData + 44, 4));
+
+    if (depth > 1 || numLayers > 1 || numFaces != 1 || width == 0 || height == 0 || numLevels > 32) {
+        celeriqueLogWarning("Only single 2D KTX2 textures are supported.");
+        return nullptr;
+    }
+    /// @brief The format of the payload.
+    TextureFormat srcFormat = textureFormatFromVkFormat(vkFormat);
+    if (srcFormat == CELERIQUE_TEXTURE_FORMAT_NULL || supercompressionScheme != 0) {
+        celeriqueLogWarning("Unsupported KTX2 payload. Basis Universal and supercompressed textures need transcoding offline.");
+        return nullptr;
+    }
+    if (size < KTX2_HEADER_SIZE + static_cast<size_t>(numLevels) * KTX2_LEVEL_INDEX_ENTRY_SIZE) {
+        celeriqueLogWarning("KTX2 level index is truncated.");
+        return nullptr;
+    }
+
+    /// @brief The mip levels referring to the file contents.
+    ::std::vector<TextureMipLevel> vecMipLevels(numLevels);
+    for (uint32_t level = 0; level < numLevels; level++) {
+        /// @brief The level index entry.
+        const Byte* ptrLevelIndex = ptrData + KTX2_HEADER_SIZE + level * KTX2_LEVEL_INDEX_ENTRY_SIZE;
+        /// @brief The location of the level's data.
+        uint64_t offset = readLittleEndian(ptrLevelIndex, 8), length = readLittleEndian(ptrLevelIndex + 8, 8);
+
+        TextureMipLevel& refMipLevel = vecMipLevels[level];
+        refMipLevel.width = ::std::max<uint32_t>(1, width >> level);
+        refMipLevel.height = ::std::max<uint32_t>(1, height >> level);
+        refMipLevel.size = textureLevelSize(srcFormat, refMipLevel.width, refMipLevel.height);
+        if (offset > size || length > size - offset || length < refMipLevel.size) {
+            celeriqueLogWarning("KTX2 mip level is out of bounds.");
+            return nullptr;
+        }
+        refMipLevel.ptrData = ptrData + offset;
+    }
+
+    // Block compressed payloads are uploaded as they are, when the device can sample them.
+    if (isBlockCompressed(srcFormat)) {
+        if ((formatSupport & requiredFormatSupport(srcFormat)) == 0) {
+            celeriqueLogWarning("The device does not support the KTX2 texture's block compressed format.");
+            return nullptr;
+        }
+        return ::std::make_shared<Texture>(srcFormat, ::std::move(vecMipLevels), ::std::move(ptrOwner));
+    }
+
+    /// @brief Whether every pixel is opaque, so the texture fits BC1.
+    bool isOpaque = true;
+    for (const TextureMipLevel& mipLevel : vecMipLevels) {
+        /// @brief The pixels of the mip level.
+        const uint8_t* ptrPixels = reinterpret_cast<const uint8_t*>(mipLevel.ptrData);
+        for (size_t i = 3; i < mipLevel.size && isOpaque; i += 4) isOpaque = ptrPixels[i] == 255;
+        if (!isOpaque) break;
+    }
+    /// @brief Whether the texture is sRGB encoded.
+    bool isSrgb = srcFormat == CELERIQUE_TEXTURE_FORMAT_RGBA8_SRGB;
+    /// @brief The format the texture is uploaded in.
+    TextureFormat dstFormat = srcFormat;
+    if (isOpaque && (formatSupport & CELERIQUE_TEXTURE_FORMAT_SUPPORT_BC1) != 0) {
+        dstFormat = isSrgb ? CELERIQUE_TEXTURE_FORMAT_BC1_SRGB : CELERIQUE_TEXTURE_FORMAT_BC1_UNORM;
+    } else if ((formatSupport & CELERIQUE_TEXTURE_FORMAT_SUPPORT_BC3) != 0) {
+        dstFormat = isSrgb ? CELERIQUE_TEXTURE_FORMAT_BC3_SRGB : CELERIQUE_TEXTURE_FORMAT_BC3_UNORM;
+    }
+    if (dstFormat == srcFormat) {
+        return ::std::make_shared<Texture>(srcFormat, ::std::move(vecMipLevels), ::std::move(ptrOwner));
+    }
+
+    /// @brief The compressed mip levels, back to back.
+    size_t compressedSize = 0;
+    for (const TextureMipLevel& mipLevel : vecMipLevels) {
+        compressedSize += textureLevelSize(dstFormat, mipLevel.width, mipLevel.height);
+    }
+    ::std::shared_ptr<::std::vector<Byte>> ptrVecCompressed = ::std::make_shared<::std::vector<Byte>>(compressedSize);
+    /// @brief The offset of the next compressed mip level.
+    size_t offset = 0;
+    for (TextureMipLevel& refMipLevel : vecMipLevels) {
+        /// @brief The destination of the mip level.
+        Byte* ptrDst = ptrVecCompressed->data() + offset;
+        compressMipLevel(
+            reinterpret_cast<const uint8_t*>(refMipLevel.ptrData), refMipLevel.width, refMipLevel.height,
+            !isOpaque, reinterpret_cast<uint8_t*>(ptrDst)
+        );
+        refMipLevel.ptrData = ptrDst;
+        refMipLevel.size = textureLevelSize(dstFormat, refMipLevel.width, refMipLevel.height);
+        offset += refMipLevel.size;
+    }
+    return ::std::make_shared<Texture>(dstFormat, ::std::move(vecMipLevels), ::std::move(ptrVecCompressed));
+}
+
+/// @brief Create an asset decoder that loads KTX2 textures, for `loadAsset`.
+/// The loaded asset's data is a `Texture`.
+/// @param formatSupport The block compressed formats the device supports.
+/// @return The asset decoder.
+::celerique::AssetDecoder celerique::ktx2TextureDecoder(TextureFormatSupport formatSupport) {
+    return [formatSupport](::std::vector<Byte>&& fileContents) -> ::std::shared_ptr<void> {
+        /// @brief The file contents, kept alive by textures referring to them in place.
+        ::std::shared_ptr<::std::vector<Byte>> ptrVecFileContents = ::std::make_shared<::std::vector<Byte>>(
+            ::std::move(fileContents)
+        );
+        ::std::shared_ptr<Texture> ptrTexture = loadKtx2Texture(
+            ptrVecFileContents->data(), ptrVecFileContents->size(), formatSupport, ptrVecFileContents
+        );
+        if (ptrTexture == nullptr) {
+            throw ::std::runtime_error("Failed to load KTX2 texture.");
+        }
+        return ptrTexture;
+    };
+}
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
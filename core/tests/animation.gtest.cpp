@@ -0,0 +1,197 @@
+/*
+
+File: ./core/tests/animation.gtest.cpp
+Author: Aldhinn Espinas
+Description: This tests the skeletal animation functionalities.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique/animation.h>
+#include <celerique/logging.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace celerique {
+    /// @brief The GTest unit test suite for the skeletal animation.
+    class AnimationUnitTestCpp : public ::testing::Test {
+    protected:
+        /// @brief Generate a clip of joints swinging about the z axis, sampled at 30 frames per second.
+        /// @param numJoints The number of joints.
+        /// @param duration The length of the clip in seconds.
+        /// @param frequency The swings per second.
+        /// @return The raw animation.
+        static RawAnimation genSwingAnimation(size_t numJoints, float duration, float frequency) {
+            RawAnimation rawAnimation;
+            rawAnimation.duration = duration;
+            rawAnimation.vecJointTracks.resize(numJoints);
+            /// @brief The number of frames.
+            size_t numFrames = static_cast<size_t>(duration * 30.0f) + 1;
+            for (size_t joint = 0; joint < numJoints; joint++) {
+                RawJointTrack& refTrack = rawAnimation.vecJointTracks[joint];
+                for (size_t frame = 0; frame < numFrames; frame++) {
+                    /// @brief The time of the frame.
+                    float time = duration * frame / (numFrames - 1);
+                    /// @brief Half the swing angle.
+                    float halfAngle = 0.25f * ::std::sin(6.2831853f * frequency * time + joint * 0.1f);
+                    refTrack.vecTranslationKeys.push_back({time, Vec3{0.0f, 1.0f, 0.0f}});
+                    refTrack.vecRotationKeys.push_back({time, Vec4{0.0f, 0.0f, ::std::sin(halfAngle), ::std::cos(halfAngle)}});
+                }
+            }
+            return rawAnimation;
+        }
+    };
+
+    TEST_F(AnimationUnitTestCpp, clipCompression) {
+        RawAnimation rawAnimation;
+        rawAnimation.duration = 2.0f;
+        rawAnimation.vecJointTracks.resize(1);
+        RawJointTrack& refTrack = rawAnimation.vecJointTracks[0];
+        for (size_t frame = 0; frame <= 60; frame++) {
+            /// @brief The time of the frame.
+            float time = frame / 30.0f;
+            refTrack.vecTranslationKeys.push_back({time, Vec3{time, 2.0f * time, -time}});
+            refTrack.vecRotationKeys.push_back({time, Vec4{0.0f, 0.0f, ::std::sin(time * 0.5f), ::std::cos(time * 0.5f)}});
+            refTrack.vecScaleKeys.push_back({time, Vec3{2.0f, 2.0f, 2.0f}});
+        }
+        AnimationClip clip(rawAnimation, 0.001f);
+        GTEST_ASSERT_EQ(clip.numJoints(), 1);
+        // A linear translation keeps its ends, a constant scale a single key,
+        // and a rotation fewer keys than authored.
+        GTEST_ASSERT_LT(clip.numKeys(), 2 + 61 + 1);
+        GTEST_ASSERT_LT(clip.compressedSize(), 61 * 3 * sizeof(RawRotationKey));
+
+        JointPose pose;
+        for (size_t step = 0; step <= 20; step++) {
+            /// @brief The time sampled.
+            float time = step * 0.1f;
+            clip.sample(time, &pose);
+            ASSERT_NEAR(pose.translation[0], time, 1e-3f);
+            ASSERT_NEAR(pose.translation[1], 2.0f * time, 1e-3f);
+            ASSERT_NEAR(pose.translation[2], -time, 1e-3f);
+            ASSERT_NEAR(pose.rotation[2], ::std::sin(time * 0.5f), 2e-3f);
+            ASSERT_NEAR(pose.rotation[3], ::std::cos(time * 0.5f), 2e-3f);
+            ASSERT_NEAR(pose.scale[1], 2.0f, 1e-5f);
+        }
+        // Times outside the clip are clamped.
+        clip.sample(5.0f, &pose);
+        ASSERT_NEAR(pose.translation[0], 2.0f, 1e-3f);
+
+        ::std::swap(refTrack.vecScaleKeys[3], refTrack.vecScaleKeys[4]);
+        GTEST_TEST_THROW_(AnimationClip{rawAnimation}, ::std::runtime_error, GTEST_FATAL_FAILURE_);
+        GTEST_TEST_THROW_((Skeleton{{1, CELERIQUE_JOINT_INDEX_NULL}}), ::std::runtime_error, GTEST_FATAL_FAILURE_);
+    }
+
+    TEST_F(AnimationUnitTestCpp, posesAndPalettes) {
+        // Two joints one unit apart along y.
+        Skeleton skeleton(
+            {CELERIQUE_JOINT_INDEX_NULL, 0},
+            {
+                1.0f, 0.0f, 0.0f, 0.0f,  0.0f, 1.0f, 0.0f, 0.0f,  0.0f, 0.0f, 1.0f, 0.0f,  0.0f, 0.0f, 0.0f, 1.0f,
+                1.0f, 0.0f, 0.0f, 0.0f,  0.0f, 1.0f, 0.0f, -1.0f, 0.0f, 0.0f, 1.0f, 0.0f,  0.0f, 0.0f, 0.0f, 1.0f
+            }
+        );
+        JointPose arrBindPose[2];
+        arrBindPose[1].translation[1] = 1.0f;
+        /// @brief The model matrices.
+        float arrModelMatrices[2 * 16];
+        /// @brief The skinning palette.
+        float arrPalette[2 * 12];
+
+        // The bind pose skins nothing.
+        buildModelMatrices(skeleton, arrBindPose, arrModelMatrices);
+        GTEST_ASSERT_TRUE(writeSkinningPalette(skeleton, arrModelMatrices, arrPalette, sizeof(arrPalette)));
+        for (size_t joint = 0; joint < 2; joint++) {
+            for (size_t i = 0; i < 12; i++) ASSERT_NEAR(arrPalette[joint * 12 + i], i % 5 == 0 ? 1.0f : 0.0f, 1e-6f);
+        }
+        GTEST_ASSERT_FALSE(writeSkinningPalette(skeleton, arrModelMatrices, arrPalette, sizeof(arrPalette) - 1));
+
+        // Turning the root a quarter about z carries the child to -x.
+        JointPose arrTurnedPose[2];
+        arrTurnedPose[0].rotation[2] = ::std::sin(0.7853982f);
+        arrTurnedPose[0].rotation[3] = ::std::cos(0.7853982f);
+        arrTurnedPose[1].translation[1] = 1.0f;
+        buildModelMatrices(skeleton, arrTurnedPose, arrModelMatrices);
+        ASSERT_NEAR(arrModelMatrices[16 + 3], -1.0f, 1e-5f);
+        ASSERT_NEAR(arrModelMatrices[16 + 7], 0.0f, 1e-5f);
+
+        // Halfway is an eighth turn.
+        JointPose arrBlendedPose[2];
+        blendPoses(arrBindPose, arrTurnedPose, 0.5f, 2, arrBlendedPose);
+        ASSERT_NEAR(arrBlendedPose[0].rotation[2], ::std::sin(0.3926991f), 1e-5f);
+        ASSERT_NEAR(arrBlendedPose[0].rotation[3], ::std::cos(0.3926991f), 1e-5f);
+        ASSERT_NEAR(arrBlendedPose[1].translation[1], 1.0f, 1e-6f);
+    }
+
+    TEST_F(AnimationUnitTestCpp, thousandCharactersAnimationTime) {
+        /// @brief The number of joints of the skeleton.
+        const size_t numJoints = 64;
+        /// @brief The number of characters animated.
+        const size_t numCharacters = 1000;
+        /// @brief A chain of joints.
+        ::std::vector<uint32_t> vecParentIndices(numJoints);
+        for (size_t joint = 0; joint < numJoints; joint++) {
+            vecParentIndices[joint] = joint == 0 ? CELERIQUE_JOINT_INDEX_NULL : static_cast<uint32_t>(joint - 1);
+        }
+        Skeleton skeleton(::std::move(vecParentIndices));
+
+        /// @brief The time compression started.
+        ::std::chrono::steady_clock::time_point compressStart = ::std::chrono::steady_clock::now();
+        AnimationClip walkClip(genSwingAnimation(numJoints, 2.0f, 1.0f));
+        AnimationClip runClip(genSwingAnimation(numJoints, 1.0f, 2.0f));
+        /// @brief The time compression finished.
+        ::std::chrono::steady_clock::time_point compressEnd = ::std::chrono::steady_clock::now();
+
+        /// @brief What each character plays.
+        ::std::vector<CharacterAnimation> vecCharacters(numCharacters);
+        for (size_t character = 0; character < numCharacters; character++) {
+            vecCharacters[character].ptrClip = &walkClip;
+            vecCharacters[character].time = (character % 100) * 0.02f;
+            vecCharacters[character].ptrBlendClip = &runClip;
+            vecCharacters[character].blendTime = (character % 50) * 0.02f;
+            vecCharacters[character].blendWeight = (character % 10) * 0.1f;
+        }
+        /// @brief The skinning palettes of every character.
+        ::std::vector<float> vecPalettes(numCharacters * numJoints * 12);
+        GTEST_ASSERT_FALSE(animateCharacters(
+            skeleton, vecCharacters.data(), numCharacters, vecPalettes.data(), vecPalettes.size() * sizeof(float) - 1
+        ));
+
+        /// @brief The time animation started.
+        ::std::chrono::steady_clock::time_point start = ::std::chrono::steady_clock::now();
+        for (size_t frame = 0; frame < 10; frame++) {
+            GTEST_ASSERT_TRUE(animateCharacters(
+                skeleton, vecCharacters.data(), numCharacters, vecPalettes.data(), vecPalettes.size() * sizeof(float)
+            ));
+        }
+        /// @brief The time animation finished.
+        ::std::chrono::steady_clock::time_point end = ::std::chrono::steady_clock::now();
+
+        // Rotations and unit translations keep every bone one unit long.
+        for (size_t joint = 1; joint < numJoints; joint++) {
+            /// @brief The palette of the last character.
+            const float* ptrPalette = &vecPalettes[(numCharacters - 1) * numJoints * 12];
+            /// @brief The offset between the joint and its parent.
+            float dx = ptrPalette[joint * 12 + 3] - ptrPalette[(joint - 1) * 12 + 3];
+            float dy = ptrPalette[joint * 12 + 7] - ptrPalette[(joint - 1) * 12 + 7];
+            ASSERT_NEAR(dx * dx + dy * dy, 1.0f, 1e-3f);
+        }
+
+        /// @brief The size of the raw keyframes.
+        size_t rawSize = numJoints * (61 + 31) * (sizeof(RawVec3Key) + sizeof(RawRotationKey));
+        celeriqueLogInfo(
+            ::std::to_string(numCharacters) + " characters of " + ::std::to_string(numJoints) + " joints: " +
+            ::std::to_string(::std::chrono::duration_cast<::std::chrono::microseconds>(end - start).count() / 10) +
+            " microseconds per frame. Compression: " + ::std::to_string(rawSize) + " to " +
+            ::std::to_string(walkClip.compressedSize() + runClip.compressedSize()) + " bytes in " +
+            ::std::to_string(::std::chrono::duration_cast<::std::chrono::microseconds>(compressEnd - compressStart).count()) +
+            " microseconds."
+        );
+    }
+}
\ No newline at end of file
@@ -0,0 +1,151 @@
+/*
+
+File: ./core/tests/archive.gtest.cpp
+Author: Aldhinn Espinas
+Description: This tests the packed asset archive functionalities.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique/archive.h>
+#include <celerique/internal/lz4.h>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace celerique {
+    /// @brief The GTest unit test suite for packed asset archives.
+    class ArchiveUnitTestCpp : public ::testing::Test {
+    protected:
+        /// @brief The path of an archive file inside the temporary directory.
+        /// @param fileName The name of the archive file.
+        /// @return The full path.
+        static ::std::string tempPath(const ::std::string& fileName) {
+            return (::std::filesystem::temp_directory_path() / fileName).string();
+        }
+
+        /// @brief Generate bytes that compress well.
+        /// @param size The number of bytes.
+        /// @return The generated bytes.
+        static ::std::vector<Byte> repetitiveBytes(size_t size) {
+            /// @brief The generated bytes.
+            ::std::vector<Byte> vecBytes(size);
+            for (size_t i = 0; i < size; i++) vecBytes[i] = static_cast<Byte>("celerique"[i % 9]);
+            return vecBytes;
+        }
+
+        /// @brief Generate bytes that do not compress.
+        /// @param size The number of bytes.
+        /// @return The generated bytes.
+        static ::std::vector<Byte> randomBytes(size_t size) {
+            /// @brief The generated bytes.
+            ::std::vector<Byte> vecBytes(size);
+            ::std::mt19937 generator(42);
+            for (Byte& refByte : vecBytes) refByte = static_cast<Byte>(generator() & 0xFF);
+            return vecBytes;
+        }
+    };
+
+    TEST_F(ArchiveUnitTestCpp, lz4RoundTrip) {
+        for (const ::std::vector<Byte>& vecSrc : {
+            ::std::vector<Byte>(), repetitiveBytes(7), repetitiveBytes(100000), randomBytes(5000)
+        }) {
+            ::std::vector<Byte> vecCompressed(internal::lz4CompressBound(vecSrc.size()));
+            /// @brief The size of the compressed block.
+            size_t compressedSize = internal::lz4Compress(vecSrc.data(), vecSrc.size(), vecCompressed.data());
+            GTEST_ASSERT_LE(compressedSize, vecCompressed.size());
+
+            ::std::vector<Byte> vecDecompressed(vecSrc.size());
+            GTEST_ASSERT_TRUE(internal::lz4Decompress(
+                vecCompressed.data(), compressedSize, vecDecompressed.data(), vecDecompressed.size()
+            ));
+            GTEST_ASSERT_EQ(vecDecompressed, vecSrc);
+        }
+
+        /// @brief Repetitive data should shrink considerably.
+        ::std::vector<Byte> vecSrc = repetitiveBytes(100000);
+        ::std::vector<Byte> vecCompressed(internal::lz4CompressBound(vecSrc.size()));
+        GTEST_ASSERT_LT(internal::lz4Compress(vecSrc.data(), vecSrc.size(), vecCompressed.data()), vecSrc.size() / 10);
+    }
+
+    TEST_F(ArchiveUnitTestCpp, entriesRoundTrip) {
+        /// @brief An uncompressed entry.
+        ::std::vector<Byte> vecShader = randomBytes(1000);
+        /// @brief A compressed entry spanning many chunks.
+        ::std::vector<Byte> vecMesh = repetitiveBytes(300000);
+        /// @brief A compressed entry that does not compress.
+        ::std::vector<Byte> vecNoise = randomBytes(70000);
+
+        ArchiveWriter writer;
+        writer.addEntry("shaders/cube.vert.spv", vecShader.data(), vecShader.size());
+        writer.addEntry("meshes/cube.bin", vecMesh.data(), vecMesh.size(), CELERIQUE_ARCHIVE_COMPRESSION_LZ4, 4096);
+        writer.addEntry("textures/noise.bin", vecNoise.data(), vecNoise.size(), CELERIQUE_ARCHIVE_COMPRESSION_LZ4);
+        writer.addEntry("empty.bin", nullptr, 0, CELERIQUE_ARCHIVE_COMPRESSION_LZ4);
+        /// @brief The path of the archive.
+        ::std::string archivePath = tempPath("celerique_archive_round_trip.pak");
+        GTEST_ASSERT_TRUE(writer.write(archivePath));
+        // The compressed mesh makes the archive smaller than its contents.
+        GTEST_ASSERT_LT(::std::filesystem::file_size(archivePath), vecShader.size() + vecMesh.size());
+
+        ::std::shared_ptr<Archive> ptrArchive = openArchive(archivePath);
+        GTEST_ASSERT_NE(ptrArchive, nullptr);
+        GTEST_ASSERT_EQ(ptrArchive->numEntries(), 4);
+        GTEST_ASSERT_FALSE(ptrArchive->contains("missing.bin"));
+        GTEST_ASSERT_EQ(ptrArchive->entrySize("meshes/cube.bin"), vecMesh.size());
+
+        GTEST_ASSERT_EQ(ptrArchive->read("shaders/cube.vert.spv"), vecShader);
+        GTEST_ASSERT_EQ(ptrArchive->read("meshes/cube.bin"), vecMesh);
+        GTEST_ASSERT_EQ(ptrArchive->read("textures/noise.bin"), vecNoise);
+        GTEST_ASSERT_TRUE(ptrArchive->read("empty.bin").empty());
+
+        // Only uncompressed entries are served in place, aligned.
+        const Byte* ptrShader = ptrArchive->entryData("shaders/cube.vert.spv");
+        GTEST_ASSERT_NE(ptrShader, nullptr);
+        GTEST_ASSERT_EQ(reinterpret_cast<uintptr_t>(ptrShader) % CELERIQUE_ARCHIVE_ALIGNMENT, 0);
+        GTEST_ASSERT_EQ(ptrArchive->entryData("meshes/cube.bin"), nullptr);
+    }
+
+    TEST_F(ArchiveUnitTestCpp, shaderProgramIsZeroCopy) {
+        /// @brief The shader entry.
+        ::std::vector<Byte> vecShader = randomBytes(256);
+        ArchiveWriter writer;
+        writer.addEntry("cube.frag.spv", vecShader.data(), vecShader.size());
+        /// @brief The path of the archive.
+        ::std::string archivePath = tempPath("celerique_archive_shader.pak");
+        GTEST_ASSERT_TRUE(writer.write(archivePath));
+
+        ::std::shared_ptr<Archive> ptrArchive = openArchive(archivePath);
+        GTEST_ASSERT_NE(ptrArchive, nullptr);
+        /// @brief The shader program served from the archive.
+        ShaderProgram shaderProgram = ptrArchive->shaderProgram("cube.frag.spv");
+        GTEST_ASSERT_EQ(shaderProgram.ptrBuffer(), ptrArchive->entryData("cube.frag.spv"));
+
+        // The shader program keeps the mapping alive on its own.
+        ptrArchive.reset();
+        GTEST_ASSERT_EQ(shaderProgram.size(), vecShader.size());
+        GTEST_ASSERT_EQ(::std::vector<Byte>(shaderProgram.ptrBuffer(), shaderProgram.ptrBuffer() + shaderProgram.size()), vecShader);
+    }
+
+    TEST_F(ArchiveUnitTestCpp, invalidArchivesAreRejected) {
+        GTEST_ASSERT_EQ(openArchive(tempPath("celerique_archive_does_not_exist.pak")), nullptr);
+
+        /// @brief The path of a file that is not an archive.
+        ::std::string notArchivePath = tempPath("celerique_archive_invalid.pak");
+        {
+            ::std::ofstream streamFile(notArchivePath, ::std::ios::binary);
+            streamFile << ::std::string(128, 'x');
+        }
+        GTEST_ASSERT_EQ(openArchive(notArchivePath), nullptr);
+
+        /// @brief Colliding names are refused at pack time.
+        ArchiveWriter writer;
+        writer.addEntry("a", nullptr, 0);
+        GTEST_TEST_THROW_(writer.addEntry("a", nullptr, 0), ::std::runtime_error, GTEST_FATAL_FAILURE_);
+    }
+}
\ No newline at end of file
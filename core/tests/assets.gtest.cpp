@@ -0,0 +1,148 @@
+/*
+
+File: ./core/tests/assets.gtest.cpp
+Author: Aldhinn Espinas
+Description: This tests the asynchronous asset loading functionalities.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique/assets.h>
+#include <celerique/events/engine.h>
+#include <celerique/internal/assets.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <fstream>
+#include <filesystem>
+#include <stdexcept>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace celerique {
+    /// @brief The GTest unit test suite for the asset loading system.
+    class AssetsUnitTestCpp : public ::testing::Test {
+    protected:
+        /// @brief Write a temporary file to load assets from.
+        /// @param fileName The name of the file inside the temporary directory.
+        /// @param contents The contents to be written.
+        /// @return The path of the written file.
+        static ::std::string writeTempFile(const ::std::string& fileName, const ::std::string& contents) {
+            /// @brief The path of the file to be written.
+            ::std::filesystem::path filePath = ::std::filesystem::temp_directory_path() / fileName;
+            ::std::ofstream streamFile(filePath, ::std::ios::binary);
+            streamFile << contents;
+            return filePath.string();
+        }
+
+        /// @brief Block until the asset leaves the queued and loading states.
+        /// @param handle The handle to the asset being waited on.
+        static void waitForAsset(const AssetHandle& handle) {
+            /// @brief The point in time at which waiting is given up.
+            auto deadline = ::std::chrono::steady_clock::now() + ::std::chrono::seconds(5);
+            while (::std::chrono::steady_clock::now() < deadline) {
+                AssetState state = handle.state();
+                if (state == CELERIQUE_ASSET_STATE_READY || state == CELERIQUE_ASSET_STATE_FAILED) return;
+                ::std::this_thread::sleep_for(::std::chrono::milliseconds(1));
+            }
+        }
+    };
+
+    TEST_F(AssetsUnitTestCpp, rawBytesAreLoaded) {
+        /// @brief The path of the asset file.
+        ::std::string filePath = writeTempFile("celerique_assets_raw.bin", "celerique");
+        /// @brief The handle to the loaded asset.
+        AssetHandle handle = loadAsset(filePath);
+        waitForAsset(handle);
+
+        GTEST_ASSERT_EQ(handle.state(), CELERIQUE_ASSET_STATE_READY);
+        /// @brief The loaded file contents.
+        ::std::shared_ptr<::std::vector<Byte>> ptrContents = handle.data<::std::vector<Byte>>();
+        GTEST_ASSERT_NE(ptrContents, nullptr);
+        GTEST_ASSERT_EQ(::std::string(ptrContents->begin(), ptrContents->end()), "celerique");
+    }
+
+    TEST_F(AssetsUnitTestCpp, decoderRunsOnLoadedBytes) {
+        /// @brief The path of the asset file.
+        ::std::string filePath = writeTempFile("celerique_assets_decoded.txt", "12345");
+        /// @brief The handle to the loaded asset.
+        AssetHandle handle = loadAsset(filePath, CELERIQUE_ASSET_PRIORITY_HIGH,
+            [](::std::vector<Byte>&& fileContents) -> ::std::shared_ptr<void> {
+                return ::std::make_shared<int>(::std::stoi(::std::string(fileContents.begin(), fileContents.end())));
+            }
+        );
+        waitForAsset(handle);
+
+        GTEST_ASSERT_EQ(handle.state(), CELERIQUE_ASSET_STATE_READY);
+        GTEST_ASSERT_EQ(*handle.data<int>(), 12345);
+    }
+
+    TEST_F(AssetsUnitTestCpp, failedLoadsAreReported) {
+        /// @brief The handle to an asset with no backing file.
+        AssetHandle missingHandle = loadAsset("celerique/this/file/does/not/exist.bin");
+        /// @brief The handle to an asset whose decoder throws.
+        AssetHandle throwingHandle = loadAsset(
+            writeTempFile("celerique_assets_throwing.bin", "x"), CELERIQUE_ASSET_PRIORITY_LOW,
+            [](::std::vector<Byte>&&) -> ::std::shared_ptr<void> {
+                throw ::std::runtime_error("Unsupported asset.");
+            }
+        );
+        waitForAsset(missingHandle);
+        waitForAsset(throwingHandle);
+
+        GTEST_ASSERT_EQ(missingHandle.state(), CELERIQUE_ASSET_STATE_FAILED);
+        GTEST_ASSERT_EQ(throwingHandle.state(), CELERIQUE_ASSET_STATE_FAILED);
+        GTEST_ASSERT_EQ(missingHandle.data<void>(), nullptr);
+    }
+
+    TEST_F(AssetsUnitTestCpp, handlesShareAndReleaseAssets) {
+        /// @brief The path of the asset file.
+        ::std::string filePath = writeTempFile("celerique_assets_shared.bin", "shared");
+        /// @brief The identifier of the asset while it was alive.
+        AssetID assetId = CELERIQUE_ASSET_ID_NULL;
+        {
+            /// @brief The first handle to the asset.
+            AssetHandle firstHandle = loadAsset(filePath);
+            /// @brief The second request for the same file.
+            AssetHandle secondHandle = loadAsset(filePath);
+            GTEST_ASSERT_EQ(firstHandle.id(), secondHandle.id());
+
+            /// @brief A copy of the first handle.
+            AssetHandle copiedHandle = firstHandle;
+            assetId = copiedHandle.id();
+            waitForAsset(copiedHandle);
+            GTEST_ASSERT_EQ(copiedHandle.state(), CELERIQUE_ASSET_STATE_READY);
+        }
+        // Every handle went out of scope.
+        GTEST_ASSERT_EQ(AssetHandle().state(), CELERIQUE_ASSET_STATE_NULL);
+        GTEST_ASSERT_EQ(internal::AssetManager::getRef().state(assetId), CELERIQUE_ASSET_STATE_NULL);
+    }
+
+    TEST_F(AssetsUnitTestCpp, completionIsBroadcastOnDispatch) {
+        // Flush completions left over from other tests.
+        internal::AssetManager::getRef().dispatchCompletedLoads();
+
+        /// @brief The number of `AssetLoaded` events received by the listener.
+        ::std::shared_ptr<::std::atomic<size_t>> ptrNumLoadedEvents = ::std::make_shared<::std::atomic<size_t>>(0);
+        internal::AssetManager::getRef().addEventListener([ptrNumLoadedEvents](::std::shared_ptr<EventBase> ptrEvent) {
+            EventDispatcher dispatcher(ptrEvent);
+            dispatcher.dispatch<event::AssetLoaded>([ptrNumLoadedEvents](::std::shared_ptr<EventBase>) {
+                ptrNumLoadedEvents->fetch_add(1);
+            });
+        });
+
+        /// @brief The handle to the loaded asset.
+        AssetHandle handle = loadAsset(writeTempFile("celerique_assets_event.bin", "event"));
+        waitForAsset(handle);
+        // Nothing is delivered until the completions are dispatched.
+        GTEST_ASSERT_EQ(ptrNumLoadedEvents->load(), 0);
+
+        internal::AssetManager::getRef().dispatchCompletedLoads();
+        GTEST_ASSERT_EQ(ptrNumLoadedEvents->load(), 1);
+    }
+}
\ No newline at end of file
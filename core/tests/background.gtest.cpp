@@ -0,0 +1,98 @@
+/*
+
+File: ./core/tests/background.gtest.cpp
+Author: Aldhinn Espinas
+Description: This tests the background work scheduler functionalities.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace celerique {
+    /// @brief The GTest unit test suite for the background work scheduler.
+    class BackgroundUnitTestCpp : public ::testing::Test {};
+
+    TEST_F(BackgroundUnitTestCpp, slicesRunByPriorityAndRoundRobin) {
+        /// @brief The work each slice ran, in order.
+        ::std::vector<::std::string> vecSlices;
+        /// @brief The number of slices the low priority work ran.
+        size_t numLowSlices = 0;
+        submitBackgroundTask([&]() {
+            vecSlices.push_back("low");
+            return ++numLowSlices == 2;
+        }, CELERIQUE_BACKGROUND_PRIORITY_LOW);
+        /// @brief The number of slices each normal priority work ran.
+        size_t arrNumNormalSlices[2] = {0, 0};
+        for (size_t i = 0; i < 2; i++) {
+            submitBackgroundTask([&, i]() {
+                vecSlices.push_back("normal" + ::std::to_string(i));
+                return ++arrNumNormalSlices[i] == 2;
+            });
+        }
+        submitBackgroundTask([&]() {
+            vecSlices.push_back("high");
+            return true;
+        }, CELERIQUE_BACKGROUND_PRIORITY_HIGH);
+        submitBackgroundTask([&]() -> bool { throw ::std::runtime_error("Thrown from background work."); });
+        GTEST_ASSERT_EQ(backgroundSchedulerStats().numPendingTasks, 5);
+        GTEST_TEST_THROW_(submitBackgroundTask([]() { return true; }, 7), ::std::out_of_range, GTEST_FATAL_FAILURE_);
+
+        // Without a target frame time there is no budget, so every update runs a single slice.
+        setTargetFrameTime(::std::chrono::nanoseconds::zero());
+        /// @brief The statistics before the updates.
+        BackgroundSchedulerStats statsBefore = backgroundSchedulerStats();
+        for (size_t i = 0; i < 9; i++) onUpdate();
+        /// @brief The statistics after the updates.
+        BackgroundSchedulerStats statsAfter = backgroundSchedulerStats();
+
+        /// @brief The expected order of the slices. The throwing work is dropped after its first slice.
+        ::std::vector<::std::string> vecExpectedSlices = {
+            "high", "normal0", "normal1", "normal0", "normal1", "low", "low"
+        };
+        GTEST_ASSERT_EQ(vecSlices, vecExpectedSlices);
+        GTEST_ASSERT_EQ(statsAfter.numPendingTasks, 0);
+        GTEST_ASSERT_EQ(statsAfter.numSlicesRun - statsBefore.numSlicesRun, 8);
+        GTEST_ASSERT_EQ(statsAfter.numTasksCompleted - statsBefore.numTasksCompleted, 4);
+        GTEST_ASSERT_EQ(statsAfter.numTasksFailed - statsBefore.numTasksFailed, 1);
+    }
+
+    TEST_F(BackgroundUnitTestCpp, slicesFillTheRemainingFrameTime) {
+        /// @brief The number of slices run.
+        size_t numSlices = 0;
+        submitBackgroundTask([&]() {
+            ::std::this_thread::sleep_for(::std::chrono::milliseconds(1));
+            return ++numSlices == 1000;
+        });
+
+        setTargetFrameTime(::std::chrono::milliseconds(20));
+        onUpdate();
+        setTargetFrameTime(::std::chrono::nanoseconds::zero());
+        /// @brief The statistics after the update.
+        BackgroundSchedulerStats stats = backgroundSchedulerStats();
+
+        // Several slices fit in the frame, but not the whole work.
+        GTEST_ASSERT_LT(1, numSlices);
+        GTEST_ASSERT_LT(numSlices, 21);
+        GTEST_ASSERT_EQ(stats.numPendingTasks, 1);
+        GTEST_ASSERT_LE(stats.lastBudget, ::std::chrono::milliseconds(20));
+        GTEST_ASSERT_LE(stats.lastBudget, stats.lastUsed);
+        celeriqueLogInfo(
+            ::std::to_string(numSlices) + " slices in a 20 millisecond frame. Average utilization: " +
+            ::std::to_string(stats.averageUtilization) + "."
+        );
+
+        // Let the rest finish so later tests start with no backlog.
+        submitBackgroundTask([&]() { numSlices = 999; return true; }, CELERIQUE_BACKGROUND_PRIORITY_HIGH);
+        while (backgroundSchedulerStats().numPendingTasks > 0) onUpdate();
+    }
+}
\ No newline at end of file
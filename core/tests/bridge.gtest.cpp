@@ -0,0 +1,201 @@
+/*
+
+File: ./core/tests/bridge.gtest.cpp
+Author: Aldhinn Espinas
+Description: This tests the shared memory event rings and the event bridge layer.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+
+#if defined(CELERIQUE_FOR_POSIX_SYSTEMS)
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
+
+namespace celerique {
+    /// @brief The GTest unit test suite for the event bridge.
+    class BridgeUnitTestCpp : public ::testing::Test {};
+
+    /// @brief An application defined event crossing processes.
+    class ScoreChanged final : public virtual EventBase {
+    public:
+        /// @brief Init constructor.
+        /// @param score The new score.
+        inline ScoreChanged(int64_t score) : _score(score) {}
+
+        /// @brief The new score.
+        /// @return `_score` value.
+        inline int64_t score() const { return _score; }
+
+        CELERIQUE_IMPL_EVENT(ScoreChanged, CELERIQUE_EVENT_CATEGORY_ENGINE);
+
+    private:
+        /// @brief The new score.
+        int64_t _score;
+    };
+
+    /// @brief An application layer adding up injected mouse movements, answering a focus with a key press.
+    class MouseSummingApplicationLayer : public virtual ApplicationLayerBase {
+    public:
+        void onUpdate(::std::shared_ptr<IUpdateData> /* ptrUpdateData */) override {}
+        void onEvent(::std::shared_ptr<EventBase> ptrEvent) override {
+            if (ptrEvent->typeID() == ::std::type_index(typeid(event::MouseMoved))) {
+                _sumDeltaX += dynamic_cast<event::MouseMoved&>(*ptrEvent).deltaX();
+                _numMoves++;
+            } else if (ptrEvent->typeID() == ::std::type_index(typeid(event::WindowFocused))) {
+                broadcast(::std::make_shared<event::KeyboardKeyPressed>(static_cast<event::KeyCode>(_numMoves % 200)));
+            }
+        }
+
+        /// @brief The sum of the horizontal movements.
+        int64_t _sumDeltaX = 0;
+        /// @brief The number of movements.
+        size_t _numMoves = 0;
+    };
+
+    TEST_F(BridgeUnitTestCpp, recordsRoundTripEvents) {
+        BridgeEventRecord record;
+        GTEST_ASSERT_TRUE(serializeBridgeEvent(event::MouseClicked(CELERIQUE_MOUSE_BUTTON_RIGHT, 12, -7), record));
+        GTEST_ASSERT_EQ(record.type, CELERIQUE_BRIDGE_EVENT_TYPE_MOUSE_CLICKED);
+        /// @brief The event read back.
+        ::std::shared_ptr<EventBase> ptrEvent = deserializeBridgeEvent(record);
+        GTEST_ASSERT_NE(ptrEvent, nullptr);
+        GTEST_ASSERT_EQ(ptrEvent->typeID(), ::std::type_index(typeid(event::MouseClicked)));
+        /// @brief The click read back.
+        event::MouseClicked& click = dynamic_cast<event::MouseClicked&>(*ptrEvent);
+        GTEST_ASSERT_EQ(click.button(), CELERIQUE_MOUSE_BUTTON_RIGHT);
+        GTEST_ASSERT_EQ(click.xPos(), 12);
+        GTEST_ASSERT_EQ(click.yPos(), -7);
+
+        GTEST_ASSERT_TRUE(serializeBridgeEvent(event::MouseScrolled(0.5f, -2.0f), record));
+        ptrEvent = deserializeBridgeEvent(record);
+        GTEST_ASSERT_EQ(dynamic_cast<event::MouseScrolled&>(*ptrEvent).deltaY(), -2.0f);
+        GTEST_ASSERT_TRUE(serializeBridgeEvent(event::EngineShutdown(), record));
+        GTEST_ASSERT_EQ(record.payloadSize, 0);
+        GTEST_ASSERT_EQ(deserializeBridgeEvent(record)->typeID(), ::std::type_index(typeid(event::EngineShutdown)));
+
+        // Application defined events cross once registered; truncated payloads are refused.
+        GTEST_ASSERT_FALSE(serializeBridgeEvent(ScoreChanged(10), record));
+        registerBridgeEventType(
+            CELERIQUE_BRIDGE_EVENT_TYPE_CUSTOM, ::std::type_index(typeid(ScoreChanged)),
+            [](const EventBase& event, BridgeEventRecord& record) {
+                return record.write(dynamic_cast<const ScoreChanged&>(event).score());
+            },
+            [](const BridgeEventRecord& record) -> ::std::shared_ptr<EventBase> {
+                size_t offset = 0;
+                int64_t score;
+                if (!record.read(offset, score)) return nullptr;
+                return ::std::make_shared<ScoreChanged>(score);
+            }
+        );
+        GTEST_ASSERT_TRUE(serializeBridgeEvent(ScoreChanged(-123456789012), record));
+        GTEST_ASSERT_EQ(dynamic_cast<ScoreChanged&>(*deserializeBridgeEvent(record)).score(), -123456789012);
+        record.payloadSize = 4;
+        GTEST_ASSERT_EQ(deserializeBridgeEvent(record), nullptr);
+        record.type = CELERIQUE_BRIDGE_EVENT_TYPE_CUSTOM + 1;
+        GTEST_ASSERT_EQ(deserializeBridgeEvent(record), nullptr);
+    }
+
+#if defined(CELERIQUE_FOR_POSIX_SYSTEMS)
+    TEST_F(BridgeUnitTestCpp, injectedEventsAreNeverSentBack) {
+        /// @brief A suffix keeping concurrent test runs apart.
+        ::std::string suffix = ::std::to_string(::getpid());
+        /// @brief The rings of the bridge.
+        ::std::shared_ptr<SharedEventRing> ptrInboundRing = createEventRing("/celerique-test-echo-in-" + suffix, 8);
+        ::std::shared_ptr<SharedEventRing> ptrOutboundRing = createEventRing("/celerique-test-echo-out-" + suffix, 8);
+        GTEST_ASSERT_NE(ptrInboundRing, nullptr);
+        GTEST_ASSERT_NE(ptrOutboundRing, nullptr);
+
+        EngineContext engineContext;
+        engineContext.addAppLayer(::std::make_unique<EventBridgeLayer>(ptrInboundRing, ptrOutboundRing));
+        /// @brief The record being injected.
+        BridgeEventRecord record;
+        serializeBridgeEvent(event::WindowFocused(), record);
+        GTEST_ASSERT_TRUE(ptrInboundRing->tryPush(record));
+        engineContext.onUpdate();
+        engineContext.onUpdate();
+        GTEST_ASSERT_EQ(ptrOutboundRing->size(), 0);
+
+        /// @brief A bridge receiving events after their broadcast ended, as batching layers do.
+        EventBridgeLayer lateBridgeLayer(nullptr, ptrOutboundRing);
+        /// @brief An event injected through another bridge.
+        ::std::shared_ptr<EventBase> ptrBridgedEvent = ::std::make_shared<event::WindowFocused>();
+        ptrBridgedEvent->markBridged();
+        lateBridgeLayer.onEvent(ptrBridgedEvent);
+        GTEST_ASSERT_EQ(ptrOutboundRing->size(), 0);
+        lateBridgeLayer.onEvent(::std::make_shared<event::WindowFocused>());
+        GTEST_ASSERT_EQ(ptrOutboundRing->size(), 1);
+    }
+
+    TEST_F(BridgeUnitTestCpp, driverProcessInjectsAndReadsEvents) {
+        /// @brief The number of movements the driver injects, several times the ring's capacity.
+        const size_t numMoves = 20000;
+        /// @brief A suffix keeping concurrent test runs apart.
+        ::std::string suffix = ::std::to_string(::getpid());
+        /// @brief The engine's side of the rings.
+        ::std::shared_ptr<SharedEventRing> ptrInboundRing = createEventRing("/celerique-test-in-" + suffix, 1000);
+        ::std::shared_ptr<SharedEventRing> ptrOutboundRing = createEventRing("/celerique-test-out-" + suffix, 64);
+        GTEST_ASSERT_NE(ptrInboundRing, nullptr);
+        GTEST_ASSERT_NE(ptrOutboundRing, nullptr);
+        GTEST_ASSERT_EQ(ptrInboundRing->capacity(), 1024);
+        GTEST_ASSERT_EQ(createEventRing(ptrInboundRing->name(), 8), nullptr);
+        // The driver's side, opened before forking so the driver process only touches shared memory.
+        ::std::shared_ptr<SharedEventRing> ptrDriverInjectRing = openEventRing(ptrInboundRing->name());
+        ::std::shared_ptr<SharedEventRing> ptrDriverReadRing = openEventRing(ptrOutboundRing->name());
+        GTEST_ASSERT_NE(ptrDriverInjectRing, nullptr);
+        GTEST_ASSERT_NE(ptrDriverReadRing, nullptr);
+
+        /// @brief The identifier of the driver process.
+        pid_t driverPid = ::fork();
+        GTEST_ASSERT_GE(driverPid, 0);
+        if (driverPid == 0) {
+            // Driver process: inject movements and a focus, wait for the engine's answer, then shut it down.
+            BridgeEventRecord record;
+            for (size_t i = 0; i < numMoves; i++) {
+                serializeBridgeEvent(event::MouseMoved(static_cast<event::PixelUnits>(i % 7), 1), record);
+                if (!ptrDriverInjectRing->push(record, ::std::chrono::seconds(10))) ::_exit(1);
+            }
+            serializeBridgeEvent(event::WindowFocused(), record);
+            if (!ptrDriverInjectRing->push(record, ::std::chrono::seconds(10))) ::_exit(2);
+            if (!ptrDriverReadRing->pop(record, ::std::chrono::seconds(10))) ::_exit(3);
+            if (record.type != CELERIQUE_BRIDGE_EVENT_TYPE_KEYBOARD_KEY_PRESSED) ::_exit(4);
+            /// @brief The key the engine answered with.
+            event::KeyCode keyCode = 0;
+            size_t offset = 0;
+            record.read(offset, keyCode);
+            serializeBridgeEvent(event::EngineShutdown(), record);
+            if (!ptrDriverInjectRing->push(record, ::std::chrono::seconds(10))) ::_exit(5);
+            ::_exit(keyCode == numMoves % 200 ? 0 : 6);
+        }
+
+        EngineContext engineContext;
+        /// @brief The layer receiving the injected events.
+        ::std::unique_ptr<ApplicationLayerBase> ptrAppLayer = ::std::make_unique<MouseSummingApplicationLayer>();
+        MouseSummingApplicationLayer* ptrSummingLayer = dynamic_cast<MouseSummingApplicationLayer*>(ptrAppLayer.get());
+        engineContext.addAppLayer(::std::move(ptrAppLayer));
+        engineContext.addAppLayer(::std::make_unique<EventBridgeLayer>(ptrInboundRing, ptrOutboundRing));
+        // Runs until the driver injects the shutdown.
+        engineContext.run();
+
+        /// @brief The exit status of the driver process.
+        int driverStatus = 0;
+        GTEST_ASSERT_EQ(::waitpid(driverPid, &driverStatus, 0), driverPid);
+        GTEST_ASSERT_TRUE(WIFEXITED(driverStatus));
+        GTEST_ASSERT_EQ(WEXITSTATUS(driverStatus), 0);
+        GTEST_ASSERT_EQ(ptrSummingLayer->_numMoves, numMoves);
+        /// @brief The expected sum of the horizontal movements.
+        int64_t expectedSumDeltaX = 0;
+        for (size_t i = 0; i < numMoves; i++) expectedSumDeltaX += static_cast<int64_t>(i % 7);
+        GTEST_ASSERT_EQ(ptrSummingLayer->_sumDeltaX, expectedSumDeltaX);
+        GTEST_ASSERT_EQ(ptrInboundRing->size(), 0);
+    }
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,206 @@
+/*
+
+File: ./core/tests/broadphase.gtest.cpp
+Author: Aldhinn Espinas
+Description: This tests the collision broadphase functionalities.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique/broadphase.h>
+#include <celerique/logging.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace celerique {
+    /// @brief The GTest unit test suite for the collision broadphase.
+    class BroadphaseUnitTestCpp : public ::testing::Test {
+    protected:
+        /// @brief A box of the given size at the given minimum corner.
+        /// @param x The minimum x.
+        /// @param y The minimum y.
+        /// @param z The minimum z.
+        /// @param size The edge length of the box.
+        /// @return The box.
+        static Aabb3 box(float x, float y, float z, float size = 1.0f) {
+            return Aabb3{{x, y, z}, {x + size, y + size, z + size}};
+        }
+
+        /// @brief Scatter boxes over a flat world, like characters and props on a level.
+        /// The world is sized so each body overlaps one or two others on average.
+        /// @param numBodies The number of boxes.
+        /// @param randomEngine The random number generator.
+        /// @return The boxes.
+        static ::std::vector<Aabb3> scatterBoxes(size_t numBodies, ::std::mt19937& randomEngine) {
+            /// @brief The extent of the world along x and z.
+            float worldSize = 0.75f * ::std::sqrt(static_cast<float>(numBodies));
+            ::std::uniform_real_distribution<float> horizontal(0.0f, worldSize);
+            ::std::uniform_real_distribution<float> vertical(0.0f, 4.0f);
+            ::std::uniform_real_distribution<float> size(0.5f, 1.5f);
+            /// @brief The boxes.
+            ::std::vector<Aabb3> vecBoxes;
+            vecBoxes.reserve(numBodies);
+            for (size_t i = 0; i < numBodies; i++) {
+                vecBoxes.emplace_back(box(horizontal(randomEngine), vertical(randomEngine), horizontal(randomEngine), size(randomEngine)));
+            }
+            return vecBoxes;
+        }
+
+        /// @brief Find the overlapping pairs by testing every pair of bodies.
+        /// @param broadphase The broadphase holding the bodies.
+        /// @param vecBodyIds The bodies to be tested.
+        /// @return The sorted pairs.
+        static ::std::vector<BroadphasePair> bruteForcePairs(
+            const Broadphase& broadphase, const ::std::vector<BroadphaseBodyID>& vecBodyIds
+        ) {
+            /// @brief The overlapping pairs.
+            ::std::vector<BroadphasePair> vecPairs;
+            for (size_t i = 0; i < vecBodyIds.size(); i++) {
+                for (size_t j = i + 1; j < vecBodyIds.size(); j++) {
+                    if (!broadphase.bounds(vecBodyIds[i]).overlaps(broadphase.bounds(vecBodyIds[j]))) continue;
+                    vecPairs.emplace_back(BroadphasePair{
+                        ::std::min(vecBodyIds[i], vecBodyIds[j]), ::std::max(vecBodyIds[i], vecBodyIds[j])
+                    });
+                }
+            }
+            ::std::sort(vecPairs.begin(), vecPairs.end());
+            return vecPairs;
+        }
+
+        /// @brief Check a broadphase against the brute force pairs while bodies move, appear and disappear.
+        /// @param broadphase The broadphase to be checked.
+        static void checkAgainstBruteForce(Broadphase& broadphase) {
+            ::std::mt19937 randomEngine(7);
+            ::std::uniform_real_distribution<float> step(-0.3f, 0.3f);
+            /// @brief The boxes of the bodies.
+            ::std::vector<Aabb3> vecBoxes = scatterBoxes(1500, randomEngine);
+            // A ground plane far larger than any grid cell.
+            vecBoxes.emplace_back(Aabb3{{-1.0f, -1.0f, -1.0f}, {100.0f, 0.2f, 100.0f}});
+            /// @brief The bodies.
+            ::std::vector<BroadphaseBodyID> vecBodyIds;
+            for (const Aabb3& bounds : vecBoxes) vecBodyIds.emplace_back(broadphase.addBody(bounds));
+
+            for (size_t frame = 0; frame < 4; frame++) {
+                broadphase.update();
+                GTEST_ASSERT_TRUE(broadphase.pairs() == bruteForcePairs(broadphase, vecBodyIds));
+                for (size_t i = 0; i + 1 < vecBodyIds.size(); i++) {
+                    /// @brief The moved box.
+                    Aabb3 bounds = broadphase.bounds(vecBodyIds[i]);
+                    for (ArraySize axis = 0; axis < 3; axis++) {
+                        float delta = step(randomEngine);
+                        bounds.min[axis] += delta;
+                        bounds.max[axis] += delta;
+                    }
+                    broadphase.updateBody(vecBodyIds[i], bounds);
+                }
+                broadphase.removeBody(vecBodyIds[frame]);
+                vecBodyIds.erase(vecBodyIds.begin() + frame);
+                vecBodyIds.emplace_back(broadphase.addBody(box(10.0f, 1.0f, 10.0f, 3.0f)));
+            }
+        }
+
+        /// @brief Time the first and a following update of many moving bodies.
+        /// @param method The algorithm used to find overlapping bodies.
+        /// @param numBodies The number of bodies.
+        static void benchmark(BroadphaseMethod method, size_t numBodies) {
+            ::std::mt19937 randomEngine(static_cast<unsigned int>(numBodies));
+            ::std::uniform_real_distribution<float> step(-0.05f, 0.05f);
+            /// @brief The boxes of the bodies.
+            ::std::vector<Aabb3> vecBoxes = scatterBoxes(numBodies, randomEngine);
+            Broadphase broadphase(method, 2.0f);
+            /// @brief The bodies.
+            ::std::vector<BroadphaseBodyID> vecBodyIds;
+            for (const Aabb3& bounds : vecBoxes) vecBodyIds.emplace_back(broadphase.addBody(bounds));
+
+            /// @brief The time the first update started.
+            ::std::chrono::steady_clock::time_point start = ::std::chrono::steady_clock::now();
+            /// @brief The number of pairs found by the first update.
+            size_t numPairs = broadphase.update();
+            /// @brief The time the first update finished.
+            ::std::chrono::steady_clock::time_point firstEnd = ::std::chrono::steady_clock::now();
+            for (size_t i = 0; i < numBodies; i++) {
+                for (ArraySize axis = 0; axis < 3; axis++) {
+                    float delta = step(randomEngine);
+                    vecBoxes[i].min[axis] += delta;
+                    vecBoxes[i].max[axis] += delta;
+                }
+                broadphase.updateBody(vecBodyIds[i], vecBoxes[i]);
+            }
+            /// @brief The time the moving update started.
+            ::std::chrono::steady_clock::time_point moveStart = ::std::chrono::steady_clock::now();
+            broadphase.update();
+            /// @brief The time the moving update finished.
+            ::std::chrono::steady_clock::time_point moveEnd = ::std::chrono::steady_clock::now();
+            GTEST_ASSERT_TRUE(numPairs > 0);
+            GTEST_ASSERT_EQ(broadphase.pairs().size(), numPairs + broadphase.addedPairs().size() - broadphase.removedPairs().size());
+
+            celeriqueLogInfo(
+                ::std::string(method == CELERIQUE_BROADPHASE_METHOD_SWEEP_AND_PRUNE ? "Sweep and prune" : "Spatial hash") +
+                " of " + ::std::to_string(numBodies) + " bodies, " + ::std::to_string(numPairs) + " pairs. First update: " +
+                ::std::to_string(::std::chrono::duration_cast<::std::chrono::microseconds>(firstEnd - start).count()) +
+                " microseconds. Moving update: " +
+                ::std::to_string(::std::chrono::duration_cast<::std::chrono::microseconds>(moveEnd - moveStart).count()) +
+                " microseconds, " + ::std::to_string(broadphase.addedPairs().size()) + " added and " +
+                ::std::to_string(broadphase.removedPairs().size()) + " removed pairs."
+            );
+        }
+    };
+
+    TEST_F(BroadphaseUnitTestCpp, pairDeltas) {
+        Broadphase broadphase;
+        BroadphaseBodyID bodyA = broadphase.addBody(box(0.0f, 0.0f, 0.0f));
+        BroadphaseBodyID bodyB = broadphase.addBody(box(0.5f, 0.5f, 0.5f));
+        BroadphaseBodyID bodyC = broadphase.addBody(box(5.0f, 0.0f, 0.0f));
+        GTEST_ASSERT_EQ(broadphase.update(), 1);
+        GTEST_ASSERT_TRUE(broadphase.addedPairs() == ::std::vector<BroadphasePair>({{bodyA, bodyB}}));
+        GTEST_ASSERT_TRUE(broadphase.removedPairs().empty());
+
+        // Nothing moved, nothing changed.
+        GTEST_ASSERT_EQ(broadphase.update(), 1);
+        GTEST_ASSERT_TRUE(broadphase.addedPairs().empty());
+        GTEST_ASSERT_TRUE(broadphase.removedPairs().empty());
+
+        // Touching boxes overlap.
+        broadphase.updateBody(bodyC, box(1.5f, 1.0f, 0.5f));
+        GTEST_ASSERT_EQ(broadphase.update(), 2);
+        GTEST_ASSERT_TRUE(broadphase.addedPairs() == ::std::vector<BroadphasePair>({{bodyB, bodyC}}));
+
+        // Removing a body removes its pairs, and its identifier is only reused afterwards.
+        broadphase.removeBody(bodyB);
+        GTEST_ASSERT_FALSE(broadphase.contains(bodyB));
+        BroadphaseBodyID bodyD = broadphase.addBody(box(0.0f, 0.0f, 0.0f));
+        GTEST_ASSERT_NE(bodyD, bodyB);
+        GTEST_ASSERT_EQ(broadphase.update(), 1);
+        GTEST_ASSERT_TRUE(broadphase.addedPairs() == ::std::vector<BroadphasePair>({{bodyA, bodyD}}));
+        GTEST_ASSERT_TRUE(broadphase.removedPairs() == ::std::vector<BroadphasePair>({{bodyA, bodyB}, {bodyB, bodyC}}));
+        GTEST_ASSERT_EQ(broadphase.addBody(box(-9.0f, 0.0f, 0.0f)), bodyB);
+
+        GTEST_TEST_THROW_(broadphase.removeBody(1000), ::std::out_of_range, GTEST_FATAL_FAILURE_);
+        GTEST_TEST_THROW_(Broadphase(CELERIQUE_BROADPHASE_METHOD_SPATIAL_HASH, 0.0f), ::std::runtime_error, GTEST_FATAL_FAILURE_);
+    }
+
+    TEST_F(BroadphaseUnitTestCpp, sweepAndPruneMatchesBruteForce) {
+        Broadphase broadphase(CELERIQUE_BROADPHASE_METHOD_SWEEP_AND_PRUNE);
+        checkAgainstBruteForce(broadphase);
+    }
+
+    TEST_F(BroadphaseUnitTestCpp, spatialHashMatchesBruteForce) {
+        Broadphase broadphase(CELERIQUE_BROADPHASE_METHOD_SPATIAL_HASH, 1.5f);
+        checkAgainstBruteForce(broadphase);
+    }
+
+    TEST_F(BroadphaseUnitTestCpp, manyBodiesUpdateTime) {
+        for (size_t numBodies : {10000, 50000, 200000}) {
+            benchmark(CELERIQUE_BROADPHASE_METHOD_SWEEP_AND_PRUNE, numBodies);
+            benchmark(CELERIQUE_BROADPHASE_METHOD_SPATIAL_HASH, numBodies);
+        }
+    }
+}
\ No newline at end of file
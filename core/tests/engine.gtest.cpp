@@ -9,10 +9,17 @@ License: Mozilla Public License 2.0. (See ./LICENSE).
 */
 
 #include <celerique.h>
+#include <celerique/internal/engine.h>
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 #include <utility>
 #include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <fstream>
+#include <filesystem>
 
 namespace celerique {
     /// @brief The GTest unit test suite for testing engine functionalities.
@@ -75,6 +82,284 @@ namespace celerique {
         ::std::atomic<uint32_t> _atomicOnUpdateCount = 0;
     };
 
+    /// @brief An application layer recording its frame index as a uniform, rendered on the render thread.
+    class SnapshotApplicationLayer : public virtual ApplicationLayerBase {
+    public:
+        void onUpdate(::std::shared_ptr<IUpdateData> ptrUpdateData) override {
+            // Shutdown engine after 20 update calls.
+            if (++_numUpdates >= 20) {
+                broadcast(
+                    ::std::make_shared<::celerique::event::EngineShutdown>(),
+                    CELERIQUE_EVENT_HANDLING_STRATEGY_BLOCKING
+                );
+            }
+        }
+        void onWriteSnapshot(RenderSnapshot& snapshot) override {
+            /// @brief The frame index recorded as uniform data.
+            uint64_t frameIndex = snapshot.frameIndex();
+            snapshot.updateUniform(1, 0, &frameIndex, sizeof(frameIndex));
+            snapshot.draw(1, 36);
+            _numWritten++;
+        }
+        void onRender(const RenderSnapshot& snapshot) override {
+            /// @brief The frame index read back from the uniform data.
+            uint64_t frameIndex;
+            ::std::memcpy(&frameIndex, snapshot.uniformBytes().data(), sizeof(frameIndex));
+            if (frameIndex == snapshot.frameIndex() && snapshot.drawCalls().size() == 1 &&
+            snapshot.drawCalls()[0].numUniformUpdatesBefore == 1) {
+                _vecRenderedFrameIndices.push_back(frameIndex);
+            }
+            _renderThreadId = ::std::this_thread::get_id();
+        }
+
+        /// @brief The number of snapshots written.
+        size_t _numWritten = 0;
+        /// @brief The frame index of every well formed snapshot rendered.
+        ::std::vector<uint64_t> _vecRenderedFrameIndices;
+        /// @brief The thread `onRender` was last called on.
+        ::std::thread::id _renderThreadId;
+
+    // Private member variables.
+    private:
+        /// @brief The amount of times onUpdate was called.
+        size_t _numUpdates = 0;
+    };
+
+    /// @brief An application layer counting its updates.
+    class CountingApplicationLayer : public virtual ApplicationLayerBase {
+    public:
+        void onUpdate(::std::shared_ptr<IUpdateData> ptrUpdateData) override { _atomicNumUpdates++; }
+
+        /// @brief The amount of times onUpdate was called.
+        ::std::atomic<uint32_t> _atomicNumUpdates = 0;
+    };
+    /// @brief An application layer recording the frames it was updated on and the time it was given.
+    class CadenceApplicationLayer : public virtual ApplicationLayerBase {
+    public:
+        void onUpdate(::std::shared_ptr<IUpdateData> ptrUpdateData) override {
+            _numUpdates++;
+            /// @brief The engine update data.
+            EngineUpdateData* ptrEngineUpdateData = dynamic_cast<EngineUpdateData*>(ptrUpdateData.get());
+            if (ptrEngineUpdateData != nullptr) _totalElapsedMilliSecs += ptrEngineUpdateData->elapsedMilliSecs();
+        }
+
+        /// @brief Member init constructor.
+        /// @param cadence How often the engine updates the layer.
+        CadenceApplicationLayer(const LayerUpdateCadence& cadence) { _updateCadence = cadence; }
+
+        /// @brief The amount of times onUpdate was called.
+        size_t _numUpdates = 0;
+        /// @brief The sum of the elapsed time given to onUpdate.
+        int64_t _totalElapsedMilliSecs = 0;
+    };
+    /// @brief An application layer shutting its engine down after a number of updates.
+    class ShutdownAfterApplicationLayer : public virtual ApplicationLayerBase {
+    public:
+        void onUpdate(::std::shared_ptr<IUpdateData> ptrUpdateData) override {
+            if (_numUpdates == 0) _updateThreadId = ::std::this_thread::get_id();
+            if (::std::this_thread::get_id() != _updateThreadId) _didChangeThread = true;
+            if (++_numUpdates == _numUpdatesBeforeShutdown) {
+                broadcast(
+                    ::std::make_shared<::celerique::event::EngineShutdown>(),
+                    CELERIQUE_EVENT_HANDLING_STRATEGY_BLOCKING
+                );
+            }
+        }
+
+        /// @brief Member init constructor.
+        /// @param numUpdatesBeforeShutdown The number of updates after which the engine is shut down.
+        ShutdownAfterApplicationLayer(size_t numUpdatesBeforeShutdown) :
+        _numUpdatesBeforeShutdown(numUpdatesBeforeShutdown) {}
+
+        /// @brief The amount of times onUpdate was called.
+        size_t _numUpdates = 0;
+        /// @brief The thread of the first update.
+        ::std::thread::id _updateThreadId;
+        /// @brief Whether an update came from another thread than the first.
+        bool _didChangeThread = false;
+
+    // Private member variables.
+    private:
+        /// @brief The number of updates after which the engine is shut down.
+        size_t _numUpdatesBeforeShutdown;
+    };
+    /// @brief An application layer loading assets from its first update and recording their completion events.
+    class LoadingApplicationLayer : public virtual ApplicationLayerBase {
+    public:
+        void onUpdate(::std::shared_ptr<IUpdateData> ptrUpdateData) override {
+            if (_vecFilePaths.empty()) return;
+            for (const ::std::string& filePath : _vecFilePaths) _vecHandles.emplace_back(loadAsset(filePath));
+            _vecFilePaths.clear();
+        }
+        void onEvent(::std::shared_ptr<EventBase> ptrEvent) override {
+            if (ptrEvent->typeID() == ::std::type_index(typeid(::celerique::event::AssetLoaded))) {
+                _vecLoadedAssetIds.push_back(dynamic_cast<::celerique::event::AssetLoaded*>(ptrEvent.get())->assetId());
+            } else if (ptrEvent->typeID() == ::std::type_index(typeid(::celerique::event::AssetLoadFailed))) {
+                _vecFailedAssetIds.push_back(dynamic_cast<::celerique::event::AssetLoadFailed*>(ptrEvent.get())->assetId());
+            }
+        }
+
+        /// @brief Member init constructor.
+        /// @param vecFilePaths The paths of the files to load assets from.
+        LoadingApplicationLayer(::std::vector<::std::string>&& vecFilePaths) : _vecFilePaths(::std::move(vecFilePaths)) {}
+
+        /// @brief The handles to the requested assets.
+        ::std::vector<AssetHandle> _vecHandles;
+        /// @brief The identifiers of the assets reported loaded.
+        ::std::vector<AssetID> _vecLoadedAssetIds;
+        /// @brief The identifiers of the assets reported failed.
+        ::std::vector<AssetID> _vecFailedAssetIds;
+
+    // Private member variables.
+    private:
+        /// @brief The paths of the files still to be loaded.
+        ::std::vector<::std::string> _vecFilePaths;
+    };
+    /// @brief An application layer adding another layer from its first update and a window from its first window event.
+    class SpawningApplicationLayer : public virtual ApplicationLayerBase {
+    public:
+        void onUpdate(::std::shared_ptr<IUpdateData> ptrUpdateData) override {
+            if (_ptrSpawnedLayer != nullptr) return;
+            /// @brief The layer added from this update.
+            ::std::unique_ptr<ApplicationLayerBase> ptrAppLayer = ::std::make_unique<CountingApplicationLayer>();
+            _ptrSpawnedLayer = dynamic_cast<CountingApplicationLayer*>(ptrAppLayer.get());
+            addAppLayer(::std::move(ptrAppLayer));
+        }
+        void onEvent(::std::shared_ptr<EventBase> ptrEvent) override {
+            if (_ptrSpawnedWindow != nullptr || (ptrEvent->category() & CELERIQUE_EVENT_CATEGORY_WINDOW) == 0) return;
+            /// @brief The window added from this event.
+            ::std::unique_ptr<WindowBase> ptrWindow = ::std::make_unique<MockEngineWindow>();
+            _ptrSpawnedWindow = dynamic_cast<MockEngineWindow*>(ptrWindow.get());
+            addWindow(::std::move(ptrWindow));
+        }
+
+        /// @brief The layer added from the first update.
+        CountingApplicationLayer* _ptrSpawnedLayer = nullptr;
+        /// @brief The window added from the first window event.
+        MockEngineWindow* _ptrSpawnedWindow = nullptr;
+    };
+    /// @brief A window broadcasting the events it is handed.
+    class EmittingWindow : public virtual WindowBase {
+    public:
+        void onUpdate(::std::shared_ptr<IUpdateData> ptrUpdateData) override {}
+
+        /// @brief Broadcast an event as if the platform reported it.
+        /// @param ptrEvent The shared pointer to the event.
+        void emit(const ::std::shared_ptr<EventBase>& ptrEvent) { broadcast(ptrEvent); }
+    };
+    /// @brief An application layer recording the source window of every event it receives.
+    class RoutedApplicationLayer : public virtual ApplicationLayerBase {
+    public:
+        void onUpdate(::std::shared_ptr<IUpdateData> ptrUpdateData) override {}
+        void onEvent(::std::shared_ptr<EventBase> ptrEvent) override {
+            _vecSourceWindowIds.push_back(ptrEvent->sourceWindowId());
+        }
+
+        /// @brief Broadcast an event not coming from a window.
+        /// @param ptrEvent The shared pointer to the event.
+        void emit(const ::std::shared_ptr<EventBase>& ptrEvent) { broadcast(ptrEvent); }
+
+        /// @brief Member init constructor.
+        /// @param vecSubscribedWindowIds The windows whose events the layer receives. Empty receives every window's.
+        RoutedApplicationLayer(::std::vector<WindowID>&& vecSubscribedWindowIds) {
+            _vecSubscribedWindowIds = ::std::move(vecSubscribedWindowIds);
+        }
+
+        /// @brief The source window of every event received, in order.
+        ::std::vector<WindowID> _vecSourceWindowIds;
+    };
+    /// @brief An application layer receiving its events in batches, recording every span.
+    class BatchingApplicationLayer : public virtual ApplicationLayerBase {
+    public:
+        void onUpdate(::std::shared_ptr<IUpdateData> ptrUpdateData) override {}
+        void onEvent(::std::shared_ptr<EventBase> ptrEvent) override { _numEvents++; }
+        void onEventBatch(const EventSpan& span) override {
+            _vecSpanSizes.push_back(span.size());
+            if (!span.is<::celerique::event::MouseMoved>()) return;
+            for (size_t i = 0; i < span.size(); i++) {
+                _totalDeltaX += span.get<::celerique::event::MouseMoved>(i).deltaX();
+            }
+        }
+
+        /// @brief Default constructor.
+        BatchingApplicationLayer() { _isBatchingEvents = true; }
+
+        /// @brief The number of events received through `onEvent`.
+        size_t _numEvents = 0;
+        /// @brief The size of every span received, in order.
+        ::std::vector<size_t> _vecSpanSizes;
+        /// @brief The sum of the horizontal mouse deltas received.
+        double _totalDeltaX = 0.0;
+    };
+
+    TEST_F(EngineUnitTestCpp, tripleBufferMailboxHandOff) {
+        /// @brief The mailbox under test.
+        TripleBufferMailbox<uint64_t> mailbox;
+        GTEST_ASSERT_EQ(mailbox.consume(), nullptr);
+        mailbox.writeSlot() = 1;
+        GTEST_ASSERT_FALSE(mailbox.publish());
+        GTEST_ASSERT_TRUE(mailbox.hasFresh());
+        GTEST_ASSERT_EQ(*mailbox.consume(), 1);
+        GTEST_ASSERT_EQ(mailbox.consume(), nullptr);
+        // A value not taken yet is replaced by a newer one.
+        mailbox.writeSlot() = 2;
+        GTEST_ASSERT_FALSE(mailbox.publish());
+        mailbox.writeSlot() = 3;
+        GTEST_ASSERT_TRUE(mailbox.publish());
+        GTEST_ASSERT_EQ(*mailbox.consume(), 3);
+
+        /// @brief The number of values published by the producer thread.
+        const uint64_t numValues = 100000;
+        /// @brief The thread publishing increasing values.
+        ::std::thread producer([&]() {
+            for (uint64_t value = 4; value <= numValues; value++) {
+                mailbox.writeSlot() = value;
+                mailbox.publish();
+            }
+        });
+        /// @brief The last value taken.
+        uint64_t lastValue = 3;
+        while (lastValue < numValues) {
+            /// @brief The newest value published.
+            const uint64_t* ptrValue = mailbox.consume();
+            if (ptrValue == nullptr) continue;
+            // Values may be skipped but never torn or seen out of order.
+            GTEST_ASSERT_LT(lastValue, *ptrValue);
+            lastValue = *ptrValue;
+        }
+        producer.join();
+    }
+
+    TEST_F(EngineUnitTestCpp, snapshotsOwnTheirDrawData) {
+        /// @brief The vertices drawn.
+        float arrVertices[6] = {0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+        /// @brief The indices drawn.
+        uint32_t arrIndices[3] = {0, 1, 2};
+        /// @brief The transform recorded.
+        float arrTransform[16] = {1.0f};
+        /// @brief The snapshot under test.
+        RenderSnapshot snapshot;
+        snapshot.reset(7);
+        snapshot.addTransforms(1, 2, arrTransform, 1);
+        snapshot.draw(1, 3, 2 * sizeof(float), 3, arrVertices, arrIndices, 5);
+        // The layer may change its buffers right after recording.
+        arrVertices[0] = 100.0f;
+        arrIndices[0] = 100;
+
+        GTEST_ASSERT_EQ(snapshot.drawCalls().size(), 1);
+        GTEST_ASSERT_EQ(snapshot.drawCalls()[0].numUniformUpdatesBefore, 1);
+        GTEST_ASSERT_EQ(snapshot.drawCalls()[0].drawVersion, 5);
+        GTEST_ASSERT_EQ(snapshot.uniformUpdates()[0].bindingPoint, 2);
+        GTEST_ASSERT_EQ(snapshot.uniformUpdates()[0].size, sizeof(arrTransform));
+        GTEST_ASSERT_EQ(snapshot.vertexBytes().size(), sizeof(arrVertices));
+        GTEST_ASSERT_EQ(reinterpret_cast<const float*>(snapshot.vertexBytes().data())[0], 0.0f);
+        GTEST_ASSERT_EQ(snapshot.indices(), (::std::vector<uint32_t>{0, 1, 2}));
+        // Reusing the snapshot keeps nothing from the previous frame.
+        snapshot.reset(8);
+        GTEST_ASSERT_TRUE(snapshot.vertexBytes().empty());
+        GTEST_ASSERT_TRUE(snapshot.indices().empty());
+    }
+
     TEST_F(EngineUnitTestCpp, windowGetsUpdateWhenEngineUpdates) {
         /// @brief Mock window interface pointer.
         ::std::unique_ptr<WindowBase> ptrWindow = ::std::make_unique<MockEngineWindow>();
@@ -106,4 +391,291 @@ namespace celerique {
         }
         GTEST_ASSERT_TRUE(ptrMockAppLayer->didUpdate());
     }
+
+    TEST_F(EngineUnitTestCpp, renderThreadRendersEverySnapshotInThroughputMode) {
+        /// @brief The application layer recording snapshots.
+        ::std::unique_ptr<ApplicationLayerBase> ptrAppLayer = ::std::make_unique<SnapshotApplicationLayer>();
+        /// @brief The snapshot layer, read after the run.
+        SnapshotApplicationLayer* ptrSnapshotLayer = dynamic_cast<SnapshotApplicationLayer*>(ptrAppLayer.get());
+        addAppLayer(::std::move(ptrAppLayer));
+        setRenderThreadMode(CELERIQUE_RENDER_THREAD_MODE_THROUGHPUT);
+        run();
+        setRenderThreadMode(CELERIQUE_RENDER_THREAD_MODE_NONE);
+
+        // Other layers may have ended the run early, but every snapshot written was rendered in order.
+        GTEST_ASSERT_LE(1, ptrSnapshotLayer->_numWritten);
+        GTEST_ASSERT_EQ(ptrSnapshotLayer->_vecRenderedFrameIndices.size(), ptrSnapshotLayer->_numWritten);
+        for (size_t i = 1; i < ptrSnapshotLayer->_vecRenderedFrameIndices.size(); i++) {
+            GTEST_ASSERT_EQ(
+                ptrSnapshotLayer->_vecRenderedFrameIndices[i], ptrSnapshotLayer->_vecRenderedFrameIndices[i - 1] + 1
+            );
+        }
+        GTEST_ASSERT_NE(ptrSnapshotLayer->_renderThreadId, ::std::this_thread::get_id());
+    }
+
+    TEST_F(EngineUnitTestCpp, layersAndWindowsAddedFromCallbacksJoinNextUpdate) {
+        /// @brief The application layer adding a layer and a window.
+        ::std::unique_ptr<ApplicationLayerBase> ptrAppLayer = ::std::make_unique<SpawningApplicationLayer>();
+        /// @brief The spawning layer, read after the updates.
+        SpawningApplicationLayer* ptrSpawningLayer = dynamic_cast<SpawningApplicationLayer*>(ptrAppLayer.get());
+        addAppLayer(::std::move(ptrAppLayer));
+
+        // Adds the spawning layer, whose update queues the counting layer.
+        onUpdate();
+        GTEST_ASSERT_NE(ptrSpawningLayer->_ptrSpawnedLayer, nullptr);
+        GTEST_ASSERT_EQ(ptrSpawningLayer->_ptrSpawnedLayer->_atomicNumUpdates.load(), 0);
+        onUpdate();
+        GTEST_ASSERT_EQ(ptrSpawningLayer->_ptrSpawnedLayer->_atomicNumUpdates.load(), 1);
+
+        // Adding from an event handler does not deadlock either.
+        internal::Engine::getRef().onEvent(::std::make_shared<::celerique::event::WindowFocused>());
+        GTEST_ASSERT_NE(ptrSpawningLayer->_ptrSpawnedWindow, nullptr);
+        GTEST_ASSERT_FALSE(ptrSpawningLayer->_ptrSpawnedWindow->didUpdate());
+        onUpdate();
+        GTEST_ASSERT_TRUE(ptrSpawningLayer->_ptrSpawnedWindow->didUpdate());
+    }
+
+    TEST_F(EngineUnitTestCpp, lowRateLayersAreStaggeredAndGivenTheirElapsedTime) {
+        /// @brief The layers updated every 4th frame with a phase picked by the engine.
+        ::std::vector<CadenceApplicationLayer*> vecPtrQuarterLayers;
+        for (size_t i = 0; i < 4; i++) {
+            /// @brief The layer being added.
+            ::std::unique_ptr<ApplicationLayerBase> ptrAppLayer =
+                ::std::make_unique<CadenceApplicationLayer>(LayerUpdateCadence{4, 0.0, -1.0});
+            vecPtrQuarterLayers.push_back(dynamic_cast<CadenceApplicationLayer*>(ptrAppLayer.get()));
+            addAppLayer(::std::move(ptrAppLayer));
+        }
+        /// @brief The layer updated 10 times per second.
+        ::std::unique_ptr<ApplicationLayerBase> ptrAppLayer =
+            ::std::make_unique<CadenceApplicationLayer>(LayerUpdateCadence{1, 10.0, 0.0});
+        /// @brief The rate based layer, read after the updates.
+        CadenceApplicationLayer* ptrRateLayer = dynamic_cast<CadenceApplicationLayer*>(ptrAppLayer.get());
+        addAppLayer(::std::move(ptrAppLayer));
+
+        // One second at 40 updates per second.
+        for (size_t frame = 0; frame < 40; frame++) {
+            /// @brief The number of quarter rate updates before this frame.
+            size_t numQuarterUpdatesBefore = 0;
+            for (CadenceApplicationLayer* ptrLayer : vecPtrQuarterLayers) numQuarterUpdatesBefore += ptrLayer->_numUpdates;
+            onUpdate(::std::make_shared<EngineUpdateData>(::std::chrono::milliseconds(25)));
+            /// @brief The number of quarter rate updates after this frame.
+            size_t numQuarterUpdatesAfter = 0;
+            for (CadenceApplicationLayer* ptrLayer : vecPtrQuarterLayers) numQuarterUpdatesAfter += ptrLayer->_numUpdates;
+            // Staggered, exactly one of the quarter rate layers updates on every frame.
+            GTEST_ASSERT_EQ(numQuarterUpdatesAfter - numQuarterUpdatesBefore, 1);
+        }
+        for (CadenceApplicationLayer* ptrLayer : vecPtrQuarterLayers) {
+            GTEST_ASSERT_EQ(ptrLayer->_numUpdates, 10);
+            GTEST_ASSERT_LE(ptrLayer->_totalElapsedMilliSecs, 1000);
+            GTEST_ASSERT_LE(1000 - 75, ptrLayer->_totalElapsedMilliSecs);
+        }
+        GTEST_ASSERT_TRUE(ptrRateLayer->_numUpdates == 10 || ptrRateLayer->_numUpdates == 11);
+        GTEST_ASSERT_LE(ptrRateLayer->_totalElapsedMilliSecs, 1000);
+        GTEST_ASSERT_LE(1000 - 100, ptrRateLayer->_totalElapsedMilliSecs);
+    }
+
+    TEST_F(EngineUnitTestCpp, independentEngineContextsRunSideBySide) {
+        /// @brief The engine instances, one per simulation.
+        EngineContext arrContexts[2];
+        /// @brief The number of updates each instance runs before shutting down.
+        const size_t arrNumUpdates[2] = {5, 50};
+        /// @brief The layer of each instance.
+        ShutdownAfterApplicationLayer* arrPtrLayers[2];
+        for (size_t i = 0; i < 2; i++) {
+            /// @brief The layer being added.
+            ::std::unique_ptr<ApplicationLayerBase> ptrAppLayer =
+                ::std::make_unique<ShutdownAfterApplicationLayer>(arrNumUpdates[i]);
+            arrPtrLayers[i] = dynamic_cast<ShutdownAfterApplicationLayer*>(ptrAppLayer.get());
+            arrContexts[i].addAppLayer(::std::move(ptrAppLayer));
+        }
+        /// @brief The number of slices of the first instance's background work.
+        size_t numBackgroundSlices = 0;
+        arrContexts[0].submitBackgroundTask([&]() { return ++numBackgroundSlices == 3; });
+
+        /// @brief The threads running each instance.
+        ::std::thread arrThreads[2];
+        for (size_t i = 0; i < 2; i++) arrThreads[i] = ::std::thread([&arrContexts, i]() { arrContexts[i].run(); });
+        for (::std::thread& refThread : arrThreads) refThread.join();
+
+        // Each shutdown only ended its own instance, and each layer only ran on its instance's thread.
+        for (size_t i = 0; i < 2; i++) {
+            GTEST_ASSERT_EQ(arrPtrLayers[i]->_numUpdates, arrNumUpdates[i]);
+            GTEST_ASSERT_FALSE(arrPtrLayers[i]->_didChangeThread);
+        }
+        GTEST_ASSERT_NE(arrPtrLayers[0]->_updateThreadId, arrPtrLayers[1]->_updateThreadId);
+        GTEST_ASSERT_EQ(numBackgroundSlices, 3);
+        GTEST_ASSERT_EQ(arrContexts[0].backgroundSchedulerStats().numTasksCompleted, 1);
+        GTEST_ASSERT_EQ(arrContexts[1].backgroundSchedulerStats().numSlicesRun, 0);
+    }
+
+    TEST_F(EngineUnitTestCpp, windowEventsOnlyReachLayersSubscribedToTheirWindow) {
+        /// @brief The engine instance.
+        EngineContext context;
+        /// @brief The windows.
+        EmittingWindow* arrPtrWindows[3];
+        for (EmittingWindow*& refPtrWindow : arrPtrWindows) {
+            /// @brief The window being added.
+            ::std::unique_ptr<WindowBase> ptrWindow = ::std::make_unique<EmittingWindow>();
+            refPtrWindow = dynamic_cast<EmittingWindow*>(ptrWindow.get());
+            context.addWindow(::std::move(ptrWindow));
+        }
+        GTEST_ASSERT_NE(arrPtrWindows[0]->windowId(), CELERIQUE_WINDOW_ID_NULL);
+        GTEST_ASSERT_NE(arrPtrWindows[0]->windowId(), arrPtrWindows[1]->windowId());
+        GTEST_ASSERT_NE(arrPtrWindows[1]->windowId(), arrPtrWindows[2]->windowId());
+
+        /// @brief The layers subscribed to the first window, to none and to the second window.
+        RoutedApplicationLayer* arrPtrLayers[3];
+        /// @brief The windows each layer subscribes to.
+        ::std::vector<WindowID> arrVecSubscribedWindowIds[3] = {
+            {arrPtrWindows[0]->windowId()}, {}, {arrPtrWindows[1]->windowId()}
+        };
+        for (size_t i = 0; i < 3; i++) {
+            /// @brief The layer being added.
+            ::std::unique_ptr<ApplicationLayerBase> ptrAppLayer =
+                ::std::make_unique<RoutedApplicationLayer>(::std::move(arrVecSubscribedWindowIds[i]));
+            arrPtrLayers[i] = dynamic_cast<RoutedApplicationLayer*>(ptrAppLayer.get());
+            context.addAppLayer(::std::move(ptrAppLayer));
+        }
+        // Apply the queued additions.
+        context.onUpdate();
+
+        for (EmittingWindow* ptrWindow : arrPtrWindows) {
+            ptrWindow->emit(::std::make_shared<::celerique::event::WindowFocused>());
+            ptrWindow->emit(::std::make_shared<::celerique::event::MouseMoved>(1, 2));
+        }
+        arrPtrLayers[1]->emit(::std::make_shared<::celerique::event::WindowFocused>());
+
+        // The subscribed layers only received their window's events and the one not coming from a window.
+        GTEST_ASSERT_EQ(arrPtrLayers[0]->_vecSourceWindowIds, ::std::vector<WindowID>({
+            arrPtrWindows[0]->windowId(), arrPtrWindows[0]->windowId(), CELERIQUE_WINDOW_ID_NULL
+        }));
+        GTEST_ASSERT_EQ(arrPtrLayers[2]->_vecSourceWindowIds, ::std::vector<WindowID>({
+            arrPtrWindows[1]->windowId(), arrPtrWindows[1]->windowId(), CELERIQUE_WINDOW_ID_NULL
+        }));
+        // The unsubscribed layer received every event, stamped with its window.
+        GTEST_ASSERT_EQ(arrPtrLayers[1]->_vecSourceWindowIds, ::std::vector<WindowID>({
+            arrPtrWindows[0]->windowId(), arrPtrWindows[0]->windowId(),
+            arrPtrWindows[1]->windowId(), arrPtrWindows[1]->windowId(),
+            arrPtrWindows[2]->windowId(), arrPtrWindows[2]->windowId(), CELERIQUE_WINDOW_ID_NULL
+        }));
+    }
+
+    TEST_F(EngineUnitTestCpp, batchingLayersReceiveSameTypeEventsAsSpansOnTheNextUpdate) {
+        /// @brief The engine instance.
+        EngineContext context;
+        /// @brief The layer receiving its events one by one, also broadcasting the events.
+        RoutedApplicationLayer* ptrImmediateLayer;
+        /// @brief The layer batching its events.
+        BatchingApplicationLayer* ptrBatchingLayer;
+        {
+            /// @brief The layer being added.
+            ::std::unique_ptr<ApplicationLayerBase> ptrAppLayer = ::std::make_unique<BatchingApplicationLayer>();
+            ptrBatchingLayer = dynamic_cast<BatchingApplicationLayer*>(ptrAppLayer.get());
+            context.addAppLayer(::std::move(ptrAppLayer));
+            ptrAppLayer = ::std::make_unique<RoutedApplicationLayer>(::std::vector<WindowID>());
+            ptrImmediateLayer = dynamic_cast<RoutedApplicationLayer*>(ptrAppLayer.get());
+            context.addAppLayer(::std::move(ptrAppLayer));
+        }
+        // Apply the queued additions.
+        context.onUpdate();
+
+        /// @brief The number of mouse moves broadcast.
+        const size_t numMouseMoves = 10000;
+        for (size_t i = 0; i < numMouseMoves; i++) {
+            ptrImmediateLayer->emit(::std::make_shared<::celerique::event::MouseMoved>(1, 0));
+            if (i % 1000 == 0) ptrImmediateLayer->emit(::std::make_shared<::celerique::event::WindowFocused>());
+        }
+        // The immediate layer got every event as it was broadcast, the batching layer none yet.
+        GTEST_ASSERT_EQ(ptrImmediateLayer->_vecSourceWindowIds.size(), numMouseMoves + 10);
+        GTEST_ASSERT_TRUE(ptrBatchingLayer->_vecSpanSizes.empty());
+
+        /// @brief When the batches started being delivered.
+        ::std::chrono::steady_clock::time_point start = ::std::chrono::steady_clock::now();
+        context.onUpdate();
+        celeriqueLogInfo(
+            "Delivered " + ::std::to_string(numMouseMoves + 10) + " events in batches in " + ::std::to_string(
+                ::std::chrono::duration_cast<::std::chrono::microseconds>(::std::chrono::steady_clock::now() - start).count()
+            ) + " microseconds."
+        );
+
+        // One span per event type, none through `onEvent`.
+        GTEST_ASSERT_EQ(ptrBatchingLayer->_vecSpanSizes.size(), 2);
+        GTEST_ASSERT_EQ(ptrBatchingLayer->_vecSpanSizes[0] + ptrBatchingLayer->_vecSpanSizes[1], numMouseMoves + 10);
+        GTEST_ASSERT_EQ(ptrBatchingLayer->_totalDeltaX, static_cast<double>(numMouseMoves));
+        GTEST_ASSERT_EQ(ptrBatchingLayer->_numEvents, 0);
+
+        // Nothing is delivered twice.
+        context.onUpdate();
+        GTEST_ASSERT_EQ(ptrBatchingLayer->_vecSpanSizes.size(), 2);
+    }
+
+    TEST_F(EngineUnitTestCpp, assetLoadsCompleteOnTheRequestingEngineContext) {
+        /// @brief The path of the asset file.
+        ::std::filesystem::path filePath = ::std::filesystem::temp_directory_path() / "celerique_engine_context_asset.bin";
+        ::std::ofstream(filePath, ::std::ios::binary) << "context";
+        /// @brief The engine instances, only the first one loading assets.
+        EngineContext arrContexts[2];
+        /// @brief The layer of each instance.
+        LoadingApplicationLayer* arrPtrLayers[2];
+        /// @brief The files each layer loads.
+        ::std::vector<::std::string> arrVecFilePaths[2] = {
+            {filePath.string(), "celerique/this/file/does/not/exist.bin"}, {}
+        };
+        for (size_t i = 0; i < 2; i++) {
+            /// @brief The layer being added.
+            ::std::unique_ptr<ApplicationLayerBase> ptrAppLayer =
+                ::std::make_unique<LoadingApplicationLayer>(::std::move(arrVecFilePaths[i]));
+            arrPtrLayers[i] = dynamic_cast<LoadingApplicationLayer*>(ptrAppLayer.get());
+            arrContexts[i].addAppLayer(::std::move(ptrAppLayer));
+        }
+
+        /// @brief The point in time at which waiting is given up.
+        auto deadline = ::std::chrono::steady_clock::now() + ::std::chrono::seconds(5);
+        while (::std::chrono::steady_clock::now() < deadline) {
+            for (EngineContext& refContext : arrContexts) refContext.onUpdate();
+            if (arrPtrLayers[0]->_vecLoadedAssetIds.size() + arrPtrLayers[0]->_vecFailedAssetIds.size() == 2) break;
+            ::std::this_thread::sleep_for(::std::chrono::milliseconds(1));
+        }
+
+        // Each completion reached the requesting instance's layer once.
+        GTEST_ASSERT_EQ(arrPtrLayers[0]->_vecHandles.size(), 2);
+        GTEST_ASSERT_EQ(arrPtrLayers[0]->_vecLoadedAssetIds, ::std::vector<AssetID>({arrPtrLayers[0]->_vecHandles[0].id()}));
+        GTEST_ASSERT_EQ(arrPtrLayers[0]->_vecFailedAssetIds, ::std::vector<AssetID>({arrPtrLayers[0]->_vecHandles[1].id()}));
+        // The other instance received nothing.
+        GTEST_ASSERT_TRUE(arrPtrLayers[1]->_vecLoadedAssetIds.empty());
+        GTEST_ASSERT_TRUE(arrPtrLayers[1]->_vecFailedAssetIds.empty());
+    }
+
+    TEST_F(EngineUnitTestCpp, assetsRequestedAgainCompleteOnTheRequestingEngineContext) {
+        /// @brief The path of the asset file.
+        ::std::filesystem::path filePath = ::std::filesystem::temp_directory_path() / "celerique_engine_context_reload.bin";
+        ::std::ofstream(filePath, ::std::ios::binary) << "reload";
+        /// @brief The engine instance.
+        EngineContext context;
+        /// @brief The layer receiving the completion events.
+        ::std::unique_ptr<ApplicationLayerBase> ptrAppLayer = ::std::make_unique<LoadingApplicationLayer>(
+            ::std::vector<::std::string>()
+        );
+        /// @brief The layer, read after the updates.
+        LoadingApplicationLayer* ptrLoadingLayer = dynamic_cast<LoadingApplicationLayer*>(ptrAppLayer.get());
+        context.addAppLayer(::std::move(ptrAppLayer));
+
+        /// @brief The handles to the asset, each requested from another thread than the updates.
+        ::std::vector<AssetHandle> vecHandles;
+        for (size_t i = 0; i < 2; i++) {
+            ::std::thread([&]() { vecHandles.emplace_back(context.loadAsset(filePath.string())); }).join();
+            /// @brief The point in time at which waiting is given up.
+            auto deadline = ::std::chrono::steady_clock::now() + ::std::chrono::seconds(5);
+            while (ptrLoadingLayer->_vecLoadedAssetIds.size() <= i && ::std::chrono::steady_clock::now() < deadline) {
+                context.onUpdate();
+                ::std::this_thread::sleep_for(::std::chrono::milliseconds(1));
+            }
+        }
+
+        // The second request found the asset loaded and completed right away.
+        GTEST_ASSERT_EQ(vecHandles[0].id(), vecHandles[1].id());
+        GTEST_ASSERT_EQ(ptrLoadingLayer->_vecLoadedAssetIds, ::std::vector<AssetID>({vecHandles[0].id(), vecHandles[0].id()}));
+        context.onUpdate();
+        GTEST_ASSERT_EQ(ptrLoadingLayer->_vecLoadedAssetIds.size(), 2);
+    }
 }
\ No newline at end of file
@@ -23,7 +23,7 @@ namespace celerique {
         MOCK_METHOD1(removeGraphicsPipelineConfig, void(PipelineConfigID));
         MOCK_METHOD0(clearGraphicsPipelineConfigs, void());
         MOCK_METHOD4(updateUniform, void(PipelineConfigID, size_t, void*, size_t));
-        MOCK_METHOD6(draw, void(PipelineConfigID, size_t, size_t, size_t, void*, uint32_t*));
+        MOCK_METHOD7(draw, void(PipelineConfigID, size_t, size_t, size_t, void*, uint32_t*, uint64_t));
         MOCK_METHOD2(addWindow, void(UiProtocol, Pointer));
         MOCK_METHOD1(removeWindow, void(Pointer));
         MOCK_METHOD1(reCreateSwapChain, void(Pointer));
@@ -83,4 +83,26 @@ namespace celerique {
         _ptrWindow->useGraphicsApi(_ptrGraphicsApi);
         _ptrWindow.reset();
     }
+
+    TEST_F(GraphicsUnitTestCpp, bufferRegionsAtTheStartFallBackToWholeCopies) {
+        /// @brief The pointer to the mock graphics API.
+        MockGraphicsApi* ptrMockGraphicsApi = dynamic_cast<MockGraphicsApi*>(_ptrGraphicsApi.get());
+        // Only ranges starting at the beginning of their buffer are copied.
+        EXPECT_CALL(*ptrMockGraphicsApi, copyToBuffer).Times(2);
+
+        /// @brief The source of the data to be copied.
+        char dataSrc[] = "dataSrc";
+        _ptrGraphicsApi->copyToBufferRegion(1, 0, dataSrc, sizeof(dataSrc));
+        _ptrGraphicsApi->copyToBufferRegions({{2, 0, dataSrc, sizeof(dataSrc)}});
+        // No range is copied when one of them is at an offset.
+        GTEST_TEST_THROW_(
+            _ptrGraphicsApi->copyToBufferRegions({{1, 0, dataSrc, sizeof(dataSrc)}, {1, 4, dataSrc, sizeof(dataSrc)}}),
+            ::std::runtime_error, GTEST_FATAL_FAILURE_
+        );
+        // No range is copied when two of them overlap.
+        GTEST_TEST_THROW_(
+            _ptrGraphicsApi->copyToBufferRegions({{2, 0, dataSrc, sizeof(dataSrc)}, {2, 0, dataSrc, sizeof(dataSrc)}}),
+            ::std::runtime_error, GTEST_FATAL_FAILURE_
+        );
+    }
 }
\ No newline at end of file
@@ -0,0 +1,53 @@
+/*
+
+File: ./core/tests/jobs.gtest.cpp
+Author: Aldhinn Espinas
+Description: This tests the job worker functionalities.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique/jobs.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+
+namespace celerique {
+    /// @brief The GTest unit test suite for the job workers.
+    class JobsUnitTestCpp : public ::testing::Test {};
+
+    TEST_F(JobsUnitTestCpp, everySubmittedJobRuns) {
+        /// @brief The number of jobs to be submitted.
+        const size_t numJobs = 1000;
+        /// @brief The number of jobs that ran.
+        ::std::atomic<size_t> numJobsRan = 0;
+
+        ThreadPool threadPool(4);
+        GTEST_ASSERT_EQ(threadPool.numWorkers(), 4);
+        for (size_t i = 0; i < numJobs; i++) {
+            threadPool.submit([&]() { numJobsRan.fetch_add(1); });
+        }
+        threadPool.waitIdle();
+
+        GTEST_ASSERT_EQ(numJobsRan.load(), numJobs);
+    }
+
+    TEST_F(JobsUnitTestCpp, throwingJobDoesNotKillWorker) {
+        /// @brief The state indicating whether the job after the throwing one ran.
+        ::std::atomic<bool> didRun = false;
+
+        ThreadPool threadPool(1);
+        threadPool.submit([]() { throw ::std::runtime_error("Job failure."); });
+        threadPool.submit([&]() { didRun.store(true); });
+        threadPool.waitIdle();
+
+        GTEST_ASSERT_TRUE(didRun.load());
+    }
+
+    TEST_F(JobsUnitTestCpp, sharedJobWorkersExist) {
+        GTEST_ASSERT_GT(getJobWorkers().numWorkers(), 0);
+    }
+}
\ No newline at end of file
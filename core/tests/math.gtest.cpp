@@ -11,6 +11,11 @@ License: Mozilla Public License 2.0. (See ./LICENSE).
 #include <celerique/math.h>
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <vector>
+
 namespace celerique {
     /// @brief The GTest unit test suite for math.
     class MathUnitTestCpp : public ::testing::Test {};
@@ -285,4 +290,162 @@ namespace celerique {
         GTEST_ASSERT_EQ(identity3x3 * some3x3Matrix4, some3x3Matrix4);
         GTEST_ASSERT_EQ(some3x3Matrix4 * identity3x3, some3x3Matrix4);
     }
+
+    TEST_F(MathUnitTestCpp, columnMajorMatrices) {
+        Mat4x4 rowMajor({{1, 2, 3, 4}, {5, 6, 7, 8}, {9, 10, 11, 12}, {13, 14, 15, 16}});
+        ColumnMajorMat4x4 columnMajor({{1, 2, 3, 4}, {5, 6, 7, 8}, {9, 10, 11, 12}, {13, 14, 15, 16}});
+
+        // The same elements, stored in different orders.
+        for (ArraySize rowIndex = 0; rowIndex < 4; rowIndex++) {
+            for (ArraySize colIndex = 0; colIndex < 4; colIndex++) {
+                GTEST_ASSERT_EQ(rowMajor(rowIndex, colIndex), columnMajor(rowIndex, colIndex));
+                GTEST_ASSERT_EQ(rowMajor.data()[rowIndex * 4 + colIndex], columnMajor.data()[colIndex * 4 + rowIndex]);
+            }
+        }
+        GTEST_ASSERT_TRUE(ColumnMajorMat4x4(rowMajor) == columnMajor);
+        GTEST_ASSERT_TRUE(Mat4x4(columnMajor) == rowMajor);
+        GTEST_ASSERT_TRUE(ColumnMajorMat4x4::isStd140Layout());
+        GTEST_ASSERT_FALSE(ColumnMajorMat3x3::isStd140Layout());
+
+        // Products agree with the row-major implementation.
+        ColumnMajorMat4x4 otherColumnMajor({{2, 0, 1, 0}, {0, 3, 0, 1}, {1, 0, 0, 2}, {0, 1, 1, 0}});
+        Mat4x4 expectedProduct = rowMajor * Mat4x4(otherColumnMajor);
+        GTEST_ASSERT_TRUE(Mat4x4(columnMajor * otherColumnMajor) == expectedProduct);
+        Vec4 someVec4({1.0f, -1.0f, 2.0f, 0.5f});
+        GTEST_ASSERT_TRUE(columnMajor * someVec4 == rowMajor * someVec4);
+
+        // Non-square matrices store columns of `numRows` elements.
+        Matrix<2, 3, float, CELERIQUE_MATRIX_STORAGE_ORDER_COLUMN_MAJOR> columnMajor2x3({{1, 2, 3}, {4, 5, 6}});
+        GTEST_ASSERT_EQ(columnMajor2x3.data()[1], 4.0f);
+        GTEST_ASSERT_EQ(columnMajor2x3.data()[4], 3.0f);
+        GTEST_ASSERT_TRUE(columnMajor2x3 * Vec3({1.0f, 1.0f, 1.0f}) == Vec2({6.0f, 15.0f}));
+        GTEST_TEST_THROW_(columnMajor2x3(2, 0), ::std::out_of_range, GTEST_FATAL_FAILURE_);
+    }
+
+    TEST_F(MathUnitTestCpp, counterRandomReproducible) {
+        // Known answers of Philox4x32-10.
+        uint32_t arrCounter[4] = {0, 0, 0, 0}, arrKey[2] = {0, 0}, arrOut[4];
+        CounterRandom::philox(arrCounter, arrKey, arrOut);
+        GTEST_ASSERT_EQ(arrOut[0], 0x6627E8D5u);
+        GTEST_ASSERT_EQ(arrOut[3], 0x9B00DBD8u);
+        uint32_t arrMaxCounter[4] = {UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX}, arrMaxKey[2] = {UINT32_MAX, UINT32_MAX};
+        CounterRandom::philox(arrMaxCounter, arrMaxKey, arrOut);
+        GTEST_ASSERT_EQ(arrOut[0], 0x408F276Du);
+        GTEST_ASSERT_EQ(arrOut[3], 0x6D5451FDu);
+
+        // Bulk generation matches generating one block at a time, and advances by whole blocks.
+        CounterRandom bulkRandom(42, 7), blockRandom(42, 7);
+        ::std::vector<uint32_t> vecBulk(37);
+        bulkRandom.fillUint(vecBulk.data(), vecBulk.size());
+        for (size_t i = 0; i < vecBulk.size(); i += 4) {
+            blockRandom.nextUint4(arrOut);
+            for (size_t j = i; j < ::std::min<size_t>(i + 4, vecBulk.size()); j++) GTEST_ASSERT_EQ(vecBulk[j], arrOut[j - i]);
+        }
+        GTEST_ASSERT_EQ(bulkRandom.counter(), 10);
+        GTEST_ASSERT_EQ(blockRandom.counter(), 10);
+
+        // Seeking replays, other streams differ.
+        ::std::vector<float> vecFloats(64), vecReplay(64);
+        bulkRandom.seek(3);
+        bulkRandom.fillFloat(vecFloats.data(), vecFloats.size());
+        bulkRandom.seek(3);
+        for (size_t i = 0; i < vecReplay.size(); i += 4) bulkRandom.nextFloat4(&vecReplay[i]);
+        GTEST_ASSERT_TRUE(vecFloats == vecReplay);
+        for (float value : vecFloats) GTEST_ASSERT_TRUE(value >= 0.0f && value < 1.0f);
+        CounterRandom otherStream(42, 8);
+        otherStream.seek(3);
+        otherStream.fillFloat(vecReplay.data(), vecReplay.size());
+        GTEST_ASSERT_FALSE(vecFloats == vecReplay);
+    }
+
+    TEST_F(MathUnitTestCpp, noiseProperties) {
+        CounterRandom random(1);
+        /// @brief The coordinates of 4 points.
+        float arrPoints[16];
+        /// @brief The noise at the points.
+        float arrNoise[4], arrOtherNoise[4];
+        for (NoiseType type = CELERIQUE_NOISE_TYPE_VALUE; type <= CELERIQUE_NOISE_TYPE_SIMPLEX; type++) {
+            for (ArraySize numDimensions = 2; numDimensions <= 4; numDimensions++) {
+                for (size_t sample = 0; sample < 10000; sample++) {
+                    random.fillFloat(arrPoints, 16);
+                    for (float& refCoordinate : arrPoints) refCoordinate = refCoordinate * 200.0f - 100.0f;
+                    sampleNoise(type, numDimensions, arrPoints, 3, arrNoise);
+                    for (float value : arrNoise) GTEST_ASSERT_TRUE(value >= -1.0f && value <= 1.0f);
+
+                    // Lanes are independent: the first point moved to the last lane gives the same value.
+                    for (ArraySize axis = 0; axis < numDimensions; axis++) arrPoints[axis * 4 + 3] = arrPoints[axis * 4];
+                    sampleNoise(type, numDimensions, arrPoints, 3, arrOtherNoise);
+                    GTEST_ASSERT_EQ(arrOtherNoise[3], arrNoise[0]);
+
+                    // Noise is continuous.
+                    for (ArraySize axis = 0; axis < numDimensions; axis++) arrPoints[axis * 4 + 3] += 1e-3f;
+                    sampleNoise(type, numDimensions, arrPoints, 3, arrOtherNoise);
+                    ASSERT_NEAR(arrOtherNoise[3], arrNoise[0], 0.05f);
+                }
+            }
+        }
+
+        // Perlin noise is zero at the lattice points, and the seed changes the noise.
+        float arrLatticePoints[16] = {0.0f, 1.0f, -3.0f, 7.0f, 2.0f, -5.0f, 4.0f, 0.0f, 1.0f, 1.0f, -1.0f, 9.0f};
+        sampleNoise(CELERIQUE_NOISE_TYPE_PERLIN, 3, arrLatticePoints, 11, arrNoise);
+        for (float value : arrNoise) GTEST_ASSERT_EQ(value, 0.0f);
+        float arrOffLattice[8] = {0.3f, 1.7f, -2.2f, 5.5f, 0.1f, -0.4f, 8.9f, 3.3f};
+        sampleNoise(CELERIQUE_NOISE_TYPE_SIMPLEX, 2, arrOffLattice, 1, arrNoise);
+        sampleNoise(CELERIQUE_NOISE_TYPE_SIMPLEX, 2, arrOffLattice, 2, arrOtherNoise);
+        GTEST_ASSERT_NE(arrNoise[0], arrOtherNoise[0]);
+
+        // Fractal Brownian motion stays in range.
+        FbmConfig fbmConfig;
+        for (size_t sample = 0; sample < 1000; sample++) {
+            random.fillFloat(arrPoints, 12);
+            sampleFbm(CELERIQUE_NOISE_TYPE_PERLIN, 3, arrPoints, 5, fbmConfig, arrNoise);
+            for (float value : arrNoise) GTEST_ASSERT_TRUE(value >= -1.0f && value <= 1.0f);
+        }
+
+        GTEST_TEST_THROW_(sampleNoise(CELERIQUE_NOISE_TYPE_VALUE, 5, arrPoints, 0, arrNoise), ::std::out_of_range, GTEST_FATAL_FAILURE_);
+        GTEST_TEST_THROW_(sampleNoise(0x7F, 2, arrPoints, 0, arrNoise), ::std::runtime_error, GTEST_FATAL_FAILURE_);
+    }
+
+    TEST_F(MathUnitTestCpp, randomAndNoiseThroughput) {
+        /// @brief The number of values generated per benchmark.
+        const size_t numValues = 1 << 22;
+        ::std::vector<float> vecValues(numValues);
+        CounterRandom random(2024);
+
+        /// @brief The time generation started.
+        ::std::chrono::steady_clock::time_point start = ::std::chrono::steady_clock::now();
+        random.fillFloat(vecValues.data(), numValues);
+        /// @brief The time generation finished.
+        ::std::chrono::steady_clock::time_point end = ::std::chrono::steady_clock::now();
+        celeriqueLogInfo(
+            "Random floats: " + ::std::to_string(static_cast<double>(numValues) / ::std::max<int64_t>(1,
+            ::std::chrono::duration_cast<::std::chrono::microseconds>(end - start).count())) + " million per second."
+        );
+
+        /// @brief The names of the noise types.
+        const char* arrTypeNames[] = {"", "Value", "Perlin", "Simplex"};
+        /// @brief The coordinates of 4 points.
+        float arrPoints[16];
+        /// @brief The sum of the noise, keeping the samples from being optimized away.
+        float checksum = 0.0f;
+        for (NoiseType type = CELERIQUE_NOISE_TYPE_VALUE; type <= CELERIQUE_NOISE_TYPE_SIMPLEX; type++) {
+            for (ArraySize numDimensions = 2; numDimensions <= 4; numDimensions++) {
+                start = ::std::chrono::steady_clock::now();
+                for (size_t point = 0; point < numValues / 16; point += 4) {
+                    for (ArraySize axis = 0; axis < numDimensions; axis++) {
+                        for (size_t lane = 0; lane < 4; lane++) arrPoints[axis * 4 + lane] = vecValues[(point + lane) * 4 + axis] * 64.0f;
+                    }
+                    sampleNoise(type, numDimensions, arrPoints, 9, &vecValues[point * 4]);
+                    checksum += vecValues[point * 4];
+                }
+                end = ::std::chrono::steady_clock::now();
+                celeriqueLogInfo(
+                    ::std::string(arrTypeNames[type]) + " noise " + ::std::to_string(numDimensions) + "D: " +
+                    ::std::to_string(static_cast<double>(numValues / 16) / ::std::max<int64_t>(1,
+                    ::std::chrono::duration_cast<::std::chrono::microseconds>(end - start).count())) + " million points per second."
+                );
+            }
+        }
+        GTEST_ASSERT_TRUE(::std::isfinite(checksum));
+    }
 }
\ No newline at end of file
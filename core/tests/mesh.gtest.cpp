@@ -0,0 +1,265 @@
+/*
+
+File: ./core/tests/mesh.gtest.cpp
+Author: Aldhinn Espinas
+Description: This tests the mesh importer functionalities.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique/mesh.h>
+#include <celerique/logging.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace celerique {
+    /// @brief The GTest unit test suite for the mesh importer.
+    class MeshUnitTestCpp : public ::testing::Test {
+    protected:
+        /// @brief View a string as bytes.
+        /// @param str The string value.
+        /// @return The pointer to the bytes.
+        static const Byte* bytes(const ::std::string& str) {
+            return reinterpret_cast<const Byte*>(str.data());
+        }
+
+        /// @brief Append a little-endian 32-bit unsigned integer.
+        /// @param vecBytes The byte container.
+        /// @param value The integer value.
+        static void appendUint32(::std::vector<Byte>& vecBytes, uint32_t value) {
+            for (size_t i = 0; i < 4; i++) vecBytes.emplace_back(static_cast<Byte>((value >> (i * 8)) & 0xFF));
+        }
+
+        /// @brief Build a binary glTF file.
+        /// @param json The JSON chunk.
+        /// @param vecBin The binary chunk.
+        /// @return The file contents.
+        static ::std::vector<Byte> buildGlb(::std::string json, ::std::vector<Byte> vecBin) {
+            while (json.size() % 4 != 0) json.push_back(' ');
+            while (vecBin.size() % 4 != 0) vecBin.push_back(0);
+
+            /// @brief The file contents.
+            ::std::vector<Byte> vecGlb;
+            appendUint32(vecGlb, 0x46546C67);
+            appendUint32(vecGlb, 2);
+            appendUint32(vecGlb, static_cast<uint32_t>(28 + json.size() + vecBin.size()));
+            appendUint32(vecGlb, static_cast<uint32_t>(json.size()));
+            appendUint32(vecGlb, 0x4E4F534A);
+            vecGlb.insert(vecGlb.end(), json.begin(), json.end());
+            appendUint32(vecGlb, static_cast<uint32_t>(vecBin.size()));
+            appendUint32(vecGlb, 0x004E4942);
+            vecGlb.insert(vecGlb.end(), vecBin.begin(), vecBin.end());
+            return vecGlb;
+        }
+    };
+
+    TEST_F(MeshUnitTestCpp, fileExtensions) {
+        GTEST_ASSERT_EQ(fileExtToMeshFormat("meshes/cube.obj"), CELERIQUE_MESH_FORMAT_OBJ);
+        GTEST_ASSERT_EQ(fileExtToMeshFormat("meshes/cube.glb"), CELERIQUE_MESH_FORMAT_GLB);
+        GTEST_ASSERT_EQ(fileExtToMeshFormat("meshes/cube.gltf"), CELERIQUE_MESH_FORMAT_NULL);
+        GTEST_ASSERT_EQ(fileExtToMeshFormat("cube"), CELERIQUE_MESH_FORMAT_NULL);
+    }
+
+    TEST_F(MeshUnitTestCpp, objQuad) {
+        /// @brief A textured quad with relative and absolute indices.
+        ::std::string obj =
+            "# quad\n"
+            "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\n"
+            "vt 0 0\nvt 1 0\nvt 1 1\nvt 0 1\n"
+            "vn 0 0 1\n"
+            "f 1/1/1 2/2/1 -2/-2/-1 4/4/1\r\n";
+
+        MeshImporter importer;
+        GTEST_ASSERT_TRUE(importer.parse(bytes(obj), obj.size(), CELERIQUE_MESH_FORMAT_OBJ));
+        GTEST_ASSERT_EQ(importer.attributes(),
+            CELERIQUE_MESH_ATTRIBUTE_POSITION | CELERIQUE_MESH_ATTRIBUTE_NORMAL | CELERIQUE_MESH_ATTRIBUTE_TEX_COORD);
+        GTEST_ASSERT_EQ(importer.numVertices(), 4);
+        GTEST_ASSERT_EQ(importer.numIndices(), 6);
+
+        /// @brief The generated layouts: position, normal & texture coordinate.
+        ::std::list<InputLayout> listInputLayouts = importer.inputLayouts();
+        GTEST_ASSERT_EQ(listInputLayouts.size(), 3);
+        GTEST_ASSERT_EQ(listInputLayouts.back().offset, 6 * sizeof(float));
+        GTEST_ASSERT_EQ(importer.vertexBufferSize(listInputLayouts), 4 * 8 * sizeof(float));
+
+        ::std::vector<float> vecVertices(4 * 8);
+        GTEST_ASSERT_TRUE(importer.writeVertices(listInputLayouts, vecVertices.data(), vecVertices.size() * sizeof(float)));
+        /// @brief The third vertex: (1, 1, 0), (0, 0, 1), (1, 1).
+        const float expected[] = {1.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f};
+        GTEST_ASSERT_EQ(::std::memcmp(vecVertices.data() + 2 * 8, expected, sizeof(expected)), 0);
+
+        ::std::vector<uint32_t> vecIndices(6);
+        GTEST_ASSERT_TRUE(importer.writeIndices(vecIndices.data(), vecIndices.size() * sizeof(uint32_t)));
+        GTEST_ASSERT_EQ(vecIndices, (::std::vector<uint32_t>{0, 1, 2, 0, 2, 3}));
+
+        // Too little destination memory is refused.
+        GTEST_ASSERT_FALSE(importer.writeVertices(listInputLayouts, vecVertices.data(), sizeof(float)));
+        GTEST_ASSERT_FALSE(importer.writeIndices(vecIndices.data(), sizeof(uint32_t)));
+
+        /// @brief A face referring to a missing position.
+        ::std::string invalidObj = "v 0 0 0\nf 1 2 3\n";
+        GTEST_ASSERT_FALSE(importer.parse(bytes(invalidObj), invalidObj.size(), CELERIQUE_MESH_FORMAT_OBJ));
+        GTEST_ASSERT_EQ(importer.numVertices(), 0);
+    }
+
+    TEST_F(MeshUnitTestCpp, glbIndexedTriangle) {
+        /// @brief Positions as floats, colors as normalized bytes & 16-bit indices.
+        ::std::vector<Byte> vecBin;
+        const float positions[] = {0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f};
+        vecBin.insert(vecBin.end(), reinterpret_cast<const Byte*>(positions), reinterpret_cast<const Byte*>(positions) + sizeof(positions));
+        const uint8_t colors[] = {255, 0, 0, 255, 0, 255, 0, 255, 0, 0, 255, 255};
+        vecBin.insert(vecBin.end(), reinterpret_cast<const Byte*>(colors), reinterpret_cast<const Byte*>(colors) + sizeof(colors));
+        const uint16_t indices[] = {2, 1, 0};
+        vecBin.insert(vecBin.end(), reinterpret_cast<const Byte*>(indices), reinterpret_cast<const Byte*>(indices) + sizeof(indices));
+
+        /// @brief The JSON chunk.
+        ::std::string json = R"({
+            "asset": {"version": "2.0"},
+            "meshes": [{"name": "tri", "primitives": [{"attributes": {"COLOR_0": 1, "POSITION": 0}, "indices": 2}]}],
+            "accessors": [
+                {"bufferView": 0, "componentType": 5126, "count": 3, "type": "VEC3", "max": [1, 1, 0]},
+                {"bufferView": 1, "componentType": 5121, "normalized": true, "count": 3, "type": "VEC4"},
+                {"bufferView": 2, "componentType": 5123, "count": 3, "type": "SCALAR"}
+            ],
+            "bufferViews": [
+                {"buffer": 0, "byteOffset": 0, "byteLength": 36},
+                {"buffer": 0, "byteOffset": 36, "byteLength": 12},
+                {"buffer": 0, "byteOffset": 48, "byteLength": 6}
+            ],
+            "buffers": [{"byteLength": 54}]
+        })";
+        /// @brief The file contents.
+        ::std::vector<Byte> vecGlb = buildGlb(json, vecBin);
+
+        MeshImporter importer;
+        GTEST_ASSERT_TRUE(importer.parse(vecGlb.data(), vecGlb.size(), CELERIQUE_MESH_FORMAT_GLB));
+        GTEST_ASSERT_EQ(importer.attributes(), CELERIQUE_MESH_ATTRIBUTE_POSITION | CELERIQUE_MESH_ATTRIBUTE_COLOR);
+        GTEST_ASSERT_EQ(importer.numVertices(), 3);
+        GTEST_ASSERT_EQ(importer.numIndices(), 3);
+
+        /// @brief The generated layouts: position & color.
+        ::std::list<InputLayout> listInputLayouts = importer.inputLayouts();
+        ::std::vector<float> vecVertices(3 * 7);
+        GTEST_ASSERT_TRUE(importer.writeVertices(listInputLayouts, vecVertices.data(), vecVertices.size() * sizeof(float)));
+        /// @brief The second vertex: (1, 0, 0), green.
+        const float expected[] = {1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 1.0f};
+        GTEST_ASSERT_EQ(::std::memcmp(vecVertices.data() + 7, expected, sizeof(expected)), 0);
+
+        ::std::vector<uint32_t> vecIndices(3);
+        GTEST_ASSERT_TRUE(importer.writeIndices(vecIndices.data(), vecIndices.size() * sizeof(uint32_t)));
+        GTEST_ASSERT_EQ(vecIndices, (::std::vector<uint32_t>{2, 1, 0}));
+
+        // A truncated binary chunk is rejected.
+        vecGlb.resize(vecGlb.size() - 8);
+        GTEST_ASSERT_FALSE(importer.parse(vecGlb.data(), vecGlb.size(), CELERIQUE_MESH_FORMAT_GLB));
+    }
+
+    TEST_F(MeshUnitTestCpp, customInputLayouts) {
+        /// @brief A triangle without normals.
+        ::std::string obj = "v 1 2 3\nv 4 5 6\nv 7 8 9\nf 1 2 3\n";
+        MeshImporter importer;
+        GTEST_ASSERT_TRUE(importer.parse(bytes(obj), obj.size(), CELERIQUE_MESH_FORMAT_OBJ));
+
+        /// @brief A normal (missing, so zeroed) followed by an integer position with a 4th element.
+        ::std::list<InputLayout> listInputLayouts;
+        InputLayout normalLayout;
+        normalLayout.location = 0;
+        normalLayout.offset = 0;
+        normalLayout.numElements = 3;
+        normalLayout.inputType = CELERIQUE_PIPELINE_INPUT_TYPE_FLOAT;
+        normalLayout.name = "normal";
+        listInputLayouts.emplace_back(normalLayout);
+        InputLayout positionLayout;
+        positionLayout.location = 1;
+        positionLayout.offset = 3 * sizeof(float);
+        positionLayout.numElements = 4;
+        positionLayout.inputType = CELERIQUE_PIPELINE_INPUT_TYPE_INT;
+        positionLayout.name = "position";
+        listInputLayouts.emplace_back(positionLayout);
+
+        /// @brief The size of a single vertex.
+        size_t stride = 3 * sizeof(float) + 4 * sizeof(int);
+        GTEST_ASSERT_EQ(importer.vertexBufferSize(listInputLayouts), 3 * stride);
+        ::std::vector<Byte> vecVertices(3 * stride, 0xFF);
+        GTEST_ASSERT_TRUE(importer.writeVertices(listInputLayouts, vecVertices.data(), vecVertices.size()));
+
+        float normal[3];
+        ::std::memcpy(normal, vecVertices.data() + stride, sizeof(normal));
+        GTEST_ASSERT_EQ(normal[0], 0.0f);
+        GTEST_ASSERT_EQ(normal[2], 0.0f);
+        int position[4];
+        ::std::memcpy(position, vecVertices.data() + stride + 3 * sizeof(float), sizeof(position));
+        GTEST_ASSERT_EQ(position[0], 4);
+        GTEST_ASSERT_EQ(position[2], 6);
+        GTEST_ASSERT_EQ(position[3], 1);
+
+        // Overlapping layouts past the stride are refused.
+        listInputLayouts.back().offset = 100;
+        GTEST_ASSERT_FALSE(importer.writeVertices(listInputLayouts, vecVertices.data(), vecVertices.size()));
+    }
+
+    TEST_F(MeshUnitTestCpp, largeMeshLoadTime) {
+        /// @brief The number of quads along each side of the grid.
+        const size_t gridSize = 400;
+        /// @brief A large textured grid.
+        ::std::string obj;
+        obj.reserve(gridSize * gridSize * 96);
+        for (size_t y = 0; y <= gridSize; y++) {
+            for (size_t x = 0; x <= gridSize; x++) {
+                obj += "v " + ::std::to_string(x * 0.25) + " " + ::std::to_string(y * 0.25) + " 0.0\n";
+                obj += "vt " + ::std::to_string(static_cast<double>(x) / gridSize) + " " +
+                    ::std::to_string(static_cast<double>(y) / gridSize) + "\n";
+            }
+        }
+        obj += "vn 0 0 1\n";
+        for (size_t y = 0; y < gridSize; y++) {
+            for (size_t x = 0; x < gridSize; x++) {
+                /// @brief The 1-based index of the quad's first corner.
+                size_t first = y * (gridSize + 1) + x + 1;
+                /// @brief The corners of the quad.
+                size_t corners[] = {first, first + 1, first + gridSize + 2, first + gridSize + 1};
+                obj += "f";
+                for (size_t corner : corners) {
+                    obj += " " + ::std::to_string(corner) + "/" + ::std::to_string(corner) + "/1";
+                }
+                obj += "\n";
+            }
+        }
+
+        /// @brief The time the import started.
+        ::std::chrono::steady_clock::time_point start = ::std::chrono::steady_clock::now();
+        MeshImporter importer;
+        GTEST_ASSERT_TRUE(importer.parse(bytes(obj), obj.size(), CELERIQUE_MESH_FORMAT_OBJ));
+        /// @brief The time parsing finished.
+        ::std::chrono::steady_clock::time_point parsed = ::std::chrono::steady_clock::now();
+
+        ::std::list<InputLayout> listInputLayouts = importer.inputLayouts();
+        /// @brief Stands in for mapped staging memory.
+        ::std::vector<Byte> vecStaging(importer.vertexBufferSize(listInputLayouts) + importer.numIndices() * sizeof(uint32_t));
+        GTEST_ASSERT_TRUE(importer.writeVertices(listInputLayouts, vecStaging.data(), vecStaging.size()));
+        /// @brief The size of the vertices.
+        size_t verticesSize = importer.vertexBufferSize(listInputLayouts);
+        GTEST_ASSERT_TRUE(importer.writeIndices(
+            reinterpret_cast<uint32_t*>(vecStaging.data() + verticesSize), vecStaging.size() - verticesSize
+        ));
+        /// @brief The time the import finished.
+        ::std::chrono::steady_clock::time_point end = ::std::chrono::steady_clock::now();
+
+        GTEST_ASSERT_EQ(importer.numVertices(), gridSize * gridSize * 4);
+        GTEST_ASSERT_EQ(importer.numIndices(), gridSize * gridSize * 6);
+        celeriqueLogInfo(
+            "Imported " + ::std::to_string(obj.size() / (1024 * 1024)) + " MiB OBJ with " +
+            ::std::to_string(importer.numVertices()) + " vertices. Parse: " +
+            ::std::to_string(::std::chrono::duration_cast<::std::chrono::milliseconds>(parsed - start).count()) +
+            " milliseconds. Write: " +
+            ::std::to_string(::std::chrono::duration_cast<::std::chrono::milliseconds>(end - parsed).count()) +
+            " milliseconds."
+        );
+    }
+}
\ No newline at end of file
@@ -0,0 +1,148 @@
+/*
+
+File: ./core/tests/particles.gtest.cpp
+Author: Aldhinn Espinas
+Description: This tests the particle system functionalities.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique/particles.h>
+#include <celerique/logging.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace celerique {
+    /// @brief The GTest unit test suite for the particle system.
+    class ParticlesUnitTestCpp : public ::testing::Test {};
+
+    TEST_F(ParticlesUnitTestCpp, particlesMoveAgeAndDie) {
+        ParticleEmitterConfig config;
+        config.position = {1.0f, 2.0f, 3.0f};
+        config.minVelocity = {1.0f, 0.0f, 0.0f};
+        config.maxVelocity = {1.0f, 0.0f, 0.0f};
+        config.acceleration = {0.0f, -10.0f, 0.0f};
+        config.minLifetime = 1.0f;
+        config.maxLifetime = 3.0f;
+        config.maxParticles = 103;
+        ParticleEmitter emitter(config);
+        GTEST_ASSERT_EQ(emitter.emit(200), 103);
+        GTEST_ASSERT_EQ(emitter.emit(1), 0);
+
+        GTEST_ASSERT_EQ(emitter.update(0.5f), 103);
+        /// @brief The instance data of every particle.
+        ::std::vector<float> vecInstances(emitter.instanceDataSize() / sizeof(float));
+        GTEST_ASSERT_TRUE(emitter.writeInstances(vecInstances.data(), emitter.instanceDataSize()));
+        for (size_t i = 0; i < emitter.numParticles(); i++) {
+            ASSERT_NEAR(vecInstances[i * 8 + 0], 1.5f, 1e-5f);
+            ASSERT_NEAR(vecInstances[i * 8 + 1], 2.0f - 2.5f, 1e-5f);
+            ASSERT_NEAR(vecInstances[i * 8 + 2], 3.0f, 1e-5f);
+        }
+
+        // Lifetimes are spread between 1 and 3 seconds, so some die at every step
+        // and the survivors stay packed at the front.
+        /// @brief The number of particles before each step.
+        size_t numBefore = emitter.numParticles();
+        for (size_t step = 0; step < 6; step++) {
+            /// @brief The number of particles after the step.
+            size_t numAfter = emitter.update(0.5f);
+            GTEST_ASSERT_LE(numAfter, numBefore);
+            vecInstances.assign(emitter.instanceDataSize() / sizeof(float), 0.0f);
+            GTEST_ASSERT_TRUE(emitter.writeInstances(vecInstances.data(), emitter.instanceDataSize()));
+            for (size_t i = 0; i < numAfter; i++) {
+                // Alpha fades from 1 to 0 over a lifetime.
+                GTEST_ASSERT_TRUE(vecInstances[i * 8 + 7] > 0.0f && vecInstances[i * 8 + 7] <= 1.0f);
+            }
+            numBefore = numAfter;
+        }
+        GTEST_ASSERT_EQ(numBefore, 0);
+    }
+
+    TEST_F(ParticlesUnitTestCpp, emissionRate) {
+        ParticleEmitterConfig config;
+        config.emissionRate = 64.0f;
+        config.minLifetime = 10.0f;
+        config.maxLifetime = 10.0f;
+        ParticleEmitter emitter(config);
+        GTEST_ASSERT_EQ(emitter.update(0.25f), 16);
+        // Fractions of a particle carry over to the next update.
+        GTEST_ASSERT_EQ(emitter.update(0.0078125f), 16);
+        GTEST_ASSERT_EQ(emitter.update(0.0078125f), 17);
+
+        config.minLifetime = 0.0f;
+        GTEST_TEST_THROW_(ParticleEmitter{config}, ::std::runtime_error, GTEST_FATAL_FAILURE_);
+    }
+
+    TEST_F(ParticlesUnitTestCpp, instanceLayout) {
+        ParticleEmitterConfig config;
+        config.minVelocity = {0.0f, 0.0f, 0.0f};
+        config.maxVelocity = {0.0f, 0.0f, 0.0f};
+        config.minLifetime = 2.0f;
+        config.maxLifetime = 2.0f;
+        config.startSize = 1.0f;
+        config.endSize = 3.0f;
+        config.startColor = {1.0f, 0.0f, 0.0f, 1.0f};
+        config.endColor = {0.0f, 0.0f, 1.0f, 0.0f};
+        ParticleEmitter emitter(config);
+        emitter.emit(6);
+        emitter.update(0.5f);
+
+        /// @brief One instance more than needed, to catch overruns.
+        float arrInstances[7 * 8];
+        ::std::fill(::std::begin(arrInstances), ::std::end(arrInstances), -1.0f);
+        GTEST_ASSERT_FALSE(emitter.writeInstances(arrInstances, CELERIQUE_PARTICLE_INSTANCE_SIZE * 5));
+        GTEST_ASSERT_TRUE(emitter.writeInstances(arrInstances, sizeof(arrInstances)));
+        for (size_t i = 0; i < 6; i++) {
+            ASSERT_NEAR(arrInstances[i * 8 + 3], 1.5f, 1e-5f);
+            ASSERT_NEAR(arrInstances[i * 8 + 4], 0.75f, 1e-5f);
+            ASSERT_NEAR(arrInstances[i * 8 + 6], 0.25f, 1e-5f);
+            ASSERT_NEAR(arrInstances[i * 8 + 7], 0.75f, 1e-5f);
+        }
+        GTEST_ASSERT_EQ(arrInstances[6 * 8], -1.0f);
+
+        /// @brief The generated instance layouts.
+        ::std::list<InputLayout> listLayouts = genParticleInstanceLayouts(1);
+        GTEST_ASSERT_EQ(listLayouts.size(), 3);
+        GTEST_ASSERT_EQ(listLayouts.back().offset + listLayouts.back().numElements * sizeof(float), CELERIQUE_PARTICLE_INSTANCE_SIZE);
+        GTEST_ASSERT_EQ(listLayouts.front().bindingPoint, 1);
+    }
+
+    TEST_F(ParticlesUnitTestCpp, millionParticlesUpdateTime) {
+        ParticleEmitterConfig config;
+        config.acceleration = {0.0f, -9.8f, 0.0f};
+        config.minLifetime = 0.05f;
+        config.maxLifetime = 5.0f;
+        config.emissionRate = 100000.0f;
+        config.maxParticles = 1000000;
+        ParticleEmitter emitter(config);
+        emitter.emit(config.maxParticles);
+        /// @brief The destination of the instance data.
+        ::std::vector<Byte> vecInstances(config.maxParticles * CELERIQUE_PARTICLE_INSTANCE_SIZE);
+
+        /// @brief The time the simulation started.
+        ::std::chrono::steady_clock::time_point start = ::std::chrono::steady_clock::now();
+        for (size_t frame = 0; frame < 10; frame++) emitter.update(1.0f / 60.0f);
+        /// @brief The time the simulation finished.
+        ::std::chrono::steady_clock::time_point updateEnd = ::std::chrono::steady_clock::now();
+        GTEST_ASSERT_TRUE(emitter.writeInstances(vecInstances.data(), vecInstances.size()));
+        /// @brief The time the instance data was written.
+        ::std::chrono::steady_clock::time_point writeEnd = ::std::chrono::steady_clock::now();
+        GTEST_ASSERT_LT(emitter.numParticles(), config.maxParticles);
+
+        celeriqueLogInfo(
+            ::std::to_string(emitter.numParticles()) + " particles. Update: " +
+            ::std::to_string(::std::chrono::duration_cast<::std::chrono::microseconds>(updateEnd - start).count() / 10) +
+            " microseconds per frame. Instance write: " +
+            ::std::to_string(::std::chrono::duration_cast<::std::chrono::microseconds>(writeEnd - updateEnd).count()) +
+            " microseconds."
+        );
+    }
+}
\ No newline at end of file
@@ -0,0 +1,206 @@
+/*
+
+File: ./core/tests/recorder.gtest.cpp
+Author: Aldhinn Espinas
+Description: This tests the crash flight recorder.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <csignal>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#if defined(CELERIQUE_FOR_POSIX_SYSTEMS)
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
+
+namespace celerique {
+    /// @brief The GTest unit test suite for the flight recorder.
+    class RecorderUnitTestCpp : public ::testing::Test {
+    protected:
+        /// @brief The path of a dump file inside the temporary directory.
+        /// @param fileName The name of the file.
+        /// @return The path.
+        static ::std::string tempPath(const ::std::string& fileName) {
+            return (::std::filesystem::temp_directory_path() / fileName).string();
+        }
+        /// @brief Find the newest record of a kind with a text.
+        /// @param dump The dump to search.
+        /// @param kind The kind of the record.
+        /// @param text The text of the record.
+        /// @return The pointer to the record, or null if there is none.
+        static const FlightRecord* findRecord(const FlightDump& dump, FlightRecordKind kind, const ::std::string& text) {
+            for (auto recordRIterator = dump.vecRecords.rbegin(); recordRIterator != dump.vecRecords.rend(); recordRIterator++) {
+                if (recordRIterator->kind == kind && recordRIterator->text() == text) return &*recordRIterator;
+            }
+            return nullptr;
+        }
+    };
+
+    /// @brief An application layer doing nothing.
+    class IdleApplicationLayer : public virtual ApplicationLayerBase {
+    public:
+        void onUpdate(::std::shared_ptr<IUpdateData> ptrUpdateData) override {}
+    };
+
+    TEST_F(RecorderUnitTestCpp, logsFramesAndEventsOfEveryThreadAreDumped) {
+        celeriqueLogInfo("Flight recorder main thread message.");
+        ::std::thread([]() { celeriqueLogInfo("Flight recorder worker thread message."); }).join();
+        {
+            /// @brief The engine instance, recording its frames and events.
+            EngineContext context;
+            context.addAppLayer(::std::make_unique<IdleApplicationLayer>());
+            context.onUpdate();
+        }
+
+        /// @brief The path of the dump.
+        ::std::string dumpPath = tempPath("celerique_recorder_threads.bin");
+        GTEST_ASSERT_TRUE(dumpFlightRecorder(dumpPath.c_str()));
+        /// @brief The dump read back.
+        FlightDump dump;
+        GTEST_ASSERT_TRUE(readFlightRecorderDump(dumpPath, dump));
+        GTEST_ASSERT_EQ(dump.reason, CELERIQUE_FLIGHT_DUMP_REASON_REQUESTED);
+
+        /// @brief The message logged on this thread.
+        const FlightRecord* ptrMainRecord = findRecord(
+            dump, CELERIQUE_FLIGHT_RECORD_KIND_LOG, "Flight recorder main thread message."
+        );
+        /// @brief The message logged on the other thread.
+        const FlightRecord* ptrWorkerRecord = findRecord(
+            dump, CELERIQUE_FLIGHT_RECORD_KIND_LOG, "Flight recorder worker thread message."
+        );
+        GTEST_ASSERT_NE(ptrMainRecord, nullptr);
+        GTEST_ASSERT_NE(ptrWorkerRecord, nullptr);
+        GTEST_ASSERT_EQ(ptrMainRecord->detail, CELERIQUE_LOG_MESSAGE_SEVERITY_INFO);
+        GTEST_ASSERT_NE(ptrMainRecord->threadIndex, ptrWorkerRecord->threadIndex);
+        GTEST_ASSERT_LE(ptrMainRecord->timeNanoSecs, ptrWorkerRecord->timeNanoSecs);
+        // The engine's frame boundary was recorded on this thread after the message.
+        GTEST_ASSERT_NE(findRecord(dump, CELERIQUE_FLIGHT_RECORD_KIND_FRAME, ""), nullptr);
+        GTEST_ASSERT_FALSE(readFlightRecorderDump(tempPath("celerique_recorder_does_not_exist.bin"), dump));
+    }
+
+    TEST_F(RecorderUnitTestCpp, eachThreadKeepsItsNewestRecords) {
+        /// @brief A kind no other test records.
+        const FlightRecordKind kind = CELERIQUE_FLIGHT_RECORD_KIND_CUSTOM + 1;
+        /// @brief The number of records written, several times what a thread keeps.
+        const uint64_t numRecords = 3 * CELERIQUE_FLIGHT_RECORDER_CAPACITY;
+        /// @brief The text of every record, longer than a record holds.
+        const ::std::string text(2 * CELERIQUE_FLIGHT_RECORD_TEXT_SIZE, 'x');
+        ::std::thread([&]() {
+            for (uint64_t i = 0; i < numRecords; i++) flightRecord(kind, 0, i, text.c_str(), text.size());
+        }).join();
+
+        /// @brief The path of the dump.
+        ::std::string dumpPath = tempPath("celerique_recorder_newest.bin");
+        GTEST_ASSERT_TRUE(dumpFlightRecorder(dumpPath.c_str()));
+        /// @brief The dump read back.
+        FlightDump dump;
+        GTEST_ASSERT_TRUE(readFlightRecorderDump(dumpPath, dump));
+        /// @brief The number of records of the kind dumped.
+        uint64_t numDumped = 0;
+        for (const FlightRecord& record : dump.vecRecords) {
+            if (record.kind != kind) continue;
+            // The oldest slot is left out, as a live thread could be overwriting it.
+            GTEST_ASSERT_EQ(record.value, numRecords - CELERIQUE_FLIGHT_RECORDER_CAPACITY + 1 + numDumped++);
+            GTEST_ASSERT_EQ(record.textSize, CELERIQUE_FLIGHT_RECORD_TEXT_SIZE);
+        }
+        GTEST_ASSERT_EQ(numDumped, CELERIQUE_FLIGHT_RECORDER_CAPACITY - 1);
+    }
+
+    TEST_F(RecorderUnitTestCpp, recordingBenchmark) {
+        /// @brief The number of records written.
+        const size_t numRecords = 1000000;
+        /// @brief The text of every record.
+        const char text[] = "MouseMoved";
+        /// @brief When recording started.
+        ::std::chrono::steady_clock::time_point start = ::std::chrono::steady_clock::now();
+        for (size_t i = 0; i < numRecords; i++) {
+            flightRecord(CELERIQUE_FLIGHT_RECORD_KIND_CUSTOM, 0, i, text, sizeof(text) - 1);
+        }
+        /// @brief The time spent recording.
+        int64_t elapsedNanoSecs = ::std::chrono::duration_cast<::std::chrono::nanoseconds>(
+            ::std::chrono::steady_clock::now() - start
+        ).count();
+        celeriqueLogInfo(
+            "Recorded " + ::std::to_string(numRecords) + " flight records at " +
+            ::std::to_string(static_cast<double>(elapsedNanoSecs) / numRecords) + " nanoseconds each."
+        );
+    }
+
+#if defined(CELERIQUE_FOR_POSIX_SYSTEMS)
+    TEST_F(RecorderUnitTestCpp, dyingProcessesDumpTheirRecords) {
+        /// @brief The ways the child processes die.
+        enum class Death { FatalLog, Terminate, Signal };
+        /// @brief The dump reason expected for each death.
+        const FlightDumpReason arrReasons[3] = {
+            CELERIQUE_FLIGHT_DUMP_REASON_FATAL_LOG, CELERIQUE_FLIGHT_DUMP_REASON_TERMINATE, CELERIQUE_FLIGHT_DUMP_REASON_SIGNAL
+        };
+        for (Death death : {Death::FatalLog, Death::Terminate, Death::Signal}) {
+            /// @brief The path of the dump, apart for concurrent test runs.
+            ::std::string dumpPath = tempPath(
+                "celerique_recorder_death_" + ::std::to_string(::getpid()) + "_" +
+                ::std::to_string(static_cast<int>(death)) + ".bin"
+            );
+            ::std::filesystem::remove(dumpPath);
+
+            /// @brief The identifier of the child process.
+            pid_t childPid = ::fork();
+            GTEST_ASSERT_GE(childPid, 0);
+            if (childPid == 0) {
+                installFlightRecorderDumps(dumpPath);
+                celeriqueLogWarning("About to die.");
+                switch (death) {
+                case Death::FatalLog:
+                    celeriqueLogFatal("Lost the device.");
+                    ::_exit(0);
+                case Death::Terminate:
+                    // An exception escaping a thread terminates.
+                    ::std::thread([]() { throw ::std::runtime_error("Failed to submit to the queue."); }).join();
+                    ::_exit(1);
+                case Death::Signal:
+                    ::raise(SIGSEGV);
+                    ::_exit(1);
+                }
+            }
+
+            /// @brief The exit status of the child process.
+            int childStatus = 0;
+            GTEST_ASSERT_EQ(::waitpid(childPid, &childStatus, 0), childPid);
+            /// @brief The dump the child wrote.
+            FlightDump dump;
+            GTEST_ASSERT_TRUE(readFlightRecorderDump(dumpPath, dump));
+            GTEST_ASSERT_EQ(dump.reason, arrReasons[static_cast<int>(death)]);
+            GTEST_ASSERT_NE(findRecord(dump, CELERIQUE_FLIGHT_RECORD_KIND_LOG, "About to die."), nullptr);
+            switch (death) {
+            case Death::FatalLog:
+                GTEST_ASSERT_TRUE(WIFEXITED(childStatus));
+                GTEST_ASSERT_NE(findRecord(dump, CELERIQUE_FLIGHT_RECORD_KIND_LOG, "Lost the device."), nullptr);
+                break;
+            case Death::Terminate:
+                GTEST_ASSERT_TRUE(WIFSIGNALED(childStatus));
+                GTEST_ASSERT_EQ(WTERMSIG(childStatus), SIGABRT);
+                GTEST_ASSERT_NE(
+                    findRecord(dump, CELERIQUE_FLIGHT_RECORD_KIND_LOG, "Failed to submit to the queue."), nullptr
+                );
+                break;
+            case Death::Signal:
+                GTEST_ASSERT_TRUE(WIFSIGNALED(childStatus));
+                GTEST_ASSERT_EQ(WTERMSIG(childStatus), SIGSEGV);
+                GTEST_ASSERT_EQ(dump.signalNumber, SIGSEGV);
+                break;
+            }
+            ::std::filesystem::remove(dumpPath);
+        }
+    }
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,160 @@
+/*
+
+File: ./core/tests/scene.gtest.cpp
+Author: Aldhinn Espinas
+Description: This tests the scene graph functionalities.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique/scene.h>
+#include <celerique/logging.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace celerique {
+    /// @brief The GTest unit test suite for the scene graph.
+    class SceneUnitTestCpp : public ::testing::Test {
+    protected:
+        /// @brief A transform that only translates.
+        /// @param x The translation along the x axis.
+        /// @param y The translation along the y axis.
+        /// @param z The translation along the z axis.
+        /// @return The transform.
+        static Transform translation(float x, float y, float z) {
+            Transform transform;
+            transform.translation = {x, y, z};
+            return transform;
+        }
+    };
+
+    TEST_F(SceneUnitTestCpp, worldTransformsCompose) {
+        Scene scene;
+        /// @brief Root rotated 90 degrees about z and moved along x.
+        Transform rootTransform = translation(10.0f, 0.0f, 0.0f);
+        rootTransform.rotation = {0.0f, 0.0f, ::std::sin(0.785398163f), ::std::cos(0.785398163f)};
+        SceneNodeID rootId = scene.createNode(CELERIQUE_SCENE_NODE_ID_NULL, rootTransform);
+        SceneNodeID childId = scene.createNode(rootId, translation(1.0f, 0.0f, 0.0f));
+        /// @brief Scaled child of the child.
+        Transform grandChildTransform = translation(0.0f, 2.0f, 0.0f);
+        grandChildTransform.scale = {3.0f, 3.0f, 3.0f};
+        SceneNodeID grandChildId = scene.createNode(childId, grandChildTransform);
+        GTEST_ASSERT_EQ(scene.parent(grandChildId), childId);
+        GTEST_ASSERT_EQ(scene.updateWorldTransforms(), 3);
+
+        // The child's x offset becomes a y offset after the root's rotation.
+        Mat4x4 childWorld = scene.worldMatrix(childId);
+        ASSERT_NEAR(childWorld(0, 3), 10.0f, 1e-5f);
+        ASSERT_NEAR(childWorld(1, 3), 1.0f, 1e-5f);
+        Mat4x4 grandChildWorld = scene.worldMatrix(grandChildId);
+        ASSERT_NEAR(grandChildWorld(0, 3), 8.0f, 1e-5f);
+        ASSERT_NEAR(grandChildWorld(1, 3), 1.0f, 1e-5f);
+        ASSERT_NEAR(grandChildWorld(1, 0), 3.0f, 1e-5f);
+
+        // Matches composing the matrices by hand.
+        Mat4x4 expected = scene.worldMatrix(rootId) * Mat4x4({{1, 0, 0, 1}, {0, 1, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 1}});
+        for (ArraySize row = 0; row < 4; row++) {
+            for (ArraySize col = 0; col < 4; col++) ASSERT_NEAR(childWorld(row, col), expected(row, col), 1e-5f);
+        }
+
+        GTEST_TEST_THROW_(scene.worldMatrix(1000), ::std::out_of_range, GTEST_FATAL_FAILURE_);
+    }
+
+    TEST_F(SceneUnitTestCpp, onlyDirtySubtreesAreRecomputed) {
+        Scene scene;
+        SceneNodeID rootA = scene.createNode();
+        SceneNodeID rootB = scene.createNode();
+        SceneNodeID childA = scene.createNode(rootA, translation(0.0f, 1.0f, 0.0f));
+        scene.createNode(rootB);
+        scene.createNode(childA);
+        GTEST_ASSERT_EQ(scene.updateWorldTransforms(), 5);
+        GTEST_ASSERT_EQ(scene.updateWorldTransforms(), 0);
+
+        // Moving a root recomputes it and its descendants only.
+        scene.setLocalTransform(rootA, translation(5.0f, 0.0f, 0.0f));
+        GTEST_ASSERT_EQ(scene.updateWorldTransforms(), 3);
+        ASSERT_NEAR(scene.worldMatrix(childA)(0, 3), 5.0f, 1e-5f);
+        ASSERT_NEAR(scene.worldMatrix(childA)(1, 3), 1.0f, 1e-5f);
+    }
+
+    TEST_F(SceneUnitTestCpp, structuralChanges) {
+        Scene scene;
+        SceneNodeID rootA = scene.createNode(CELERIQUE_SCENE_NODE_ID_NULL, translation(1.0f, 0.0f, 0.0f));
+        SceneNodeID rootB = scene.createNode(CELERIQUE_SCENE_NODE_ID_NULL, translation(0.0f, 1.0f, 0.0f));
+        SceneNodeID child = scene.createNode(rootA, translation(0.0f, 0.0f, 1.0f));
+        SceneNodeID grandChild = scene.createNode(child);
+        scene.updateWorldTransforms();
+
+        // Re-parenting moves the whole subtree.
+        GTEST_ASSERT_TRUE(scene.setParent(child, rootB));
+        GTEST_ASSERT_FALSE(scene.setParent(rootB, grandChild));
+        scene.updateWorldTransforms();
+        ASSERT_NEAR(scene.worldMatrix(grandChild)(0, 3), 0.0f, 1e-5f);
+        ASSERT_NEAR(scene.worldMatrix(grandChild)(1, 3), 1.0f, 1e-5f);
+        ASSERT_NEAR(scene.worldMatrix(grandChild)(2, 3), 1.0f, 1e-5f);
+
+        // Destroying a node destroys its descendants.
+        scene.destroyNode(rootB);
+        GTEST_ASSERT_EQ(scene.numNodes(), 1);
+        GTEST_ASSERT_TRUE(scene.contains(rootA));
+        GTEST_ASSERT_FALSE(scene.contains(grandChild));
+        GTEST_ASSERT_EQ(scene.createNode(grandChild), CELERIQUE_SCENE_NODE_ID_NULL);
+
+        // Exported matrices are contiguous.
+        SceneNodeID newChild = scene.createNode(rootA, translation(0.0f, 2.0f, 0.0f));
+        scene.updateWorldTransforms();
+        const SceneNodeID exportedIds[] = {newChild, rootA};
+        float matrices[32];
+        GTEST_ASSERT_TRUE(scene.exportWorldMatrices(exportedIds, 2, matrices, sizeof(matrices)));
+        GTEST_ASSERT_EQ(matrices[3], 1.0f);
+        GTEST_ASSERT_EQ(matrices[7], 2.0f);
+        GTEST_ASSERT_EQ(matrices[16 + 3], 1.0f);
+        GTEST_ASSERT_FALSE(scene.exportWorldMatrices(exportedIds, 2, matrices, sizeof(float) * 16));
+        // Column-major export puts the translation in the last column, as GLSL expects.
+        GTEST_ASSERT_TRUE(scene.exportWorldMatrices(
+            exportedIds, 2, matrices, sizeof(matrices), CELERIQUE_MATRIX_STORAGE_ORDER_COLUMN_MAJOR
+        ));
+        GTEST_ASSERT_EQ(matrices[12], 1.0f);
+        GTEST_ASSERT_EQ(matrices[13], 2.0f);
+        GTEST_ASSERT_EQ(matrices[3], 0.0f);
+    }
+
+    TEST_F(SceneUnitTestCpp, largeSceneUpdateTime) {
+        Scene scene;
+        /// @brief 100 roots with 10 children each, each child having 100 leaves.
+        ::std::vector<SceneNodeID> vecRootIds;
+        for (size_t root = 0; root < 100; root++) {
+            vecRootIds.emplace_back(scene.createNode(CELERIQUE_SCENE_NODE_ID_NULL, translation(static_cast<float>(root), 0.0f, 0.0f)));
+            for (size_t child = 0; child < 10; child++) {
+                SceneNodeID childId = scene.createNode(vecRootIds.back(), translation(0.0f, static_cast<float>(child), 0.0f));
+                for (size_t leaf = 0; leaf < 100; leaf++) {
+                    scene.createNode(childId, translation(0.0f, 0.0f, static_cast<float>(leaf)));
+                }
+            }
+        }
+
+        /// @brief The time the full update started.
+        ::std::chrono::steady_clock::time_point start = ::std::chrono::steady_clock::now();
+        GTEST_ASSERT_EQ(scene.updateWorldTransforms(), scene.numNodes());
+        /// @brief The time the full update finished.
+        ::std::chrono::steady_clock::time_point fullEnd = ::std::chrono::steady_clock::now();
+        scene.setLocalTransform(vecRootIds.front(), translation(-1.0f, 0.0f, 0.0f));
+        GTEST_ASSERT_EQ(scene.updateWorldTransforms(), 1 + 10 + 1000);
+        /// @brief The time the partial update finished.
+        ::std::chrono::steady_clock::time_point partialEnd = ::std::chrono::steady_clock::now();
+
+        celeriqueLogInfo(
+            "Scene of " + ::std::to_string(scene.numNodes()) + " nodes. Full update: " +
+            ::std::to_string(::std::chrono::duration_cast<::std::chrono::microseconds>(fullEnd - start).count()) +
+            " microseconds. Single root update: " +
+            ::std::to_string(::std::chrono::duration_cast<::std::chrono::microseconds>(partialEnd - fullEnd).count()) +
+            " microseconds."
+        );
+    }
+}
\ No newline at end of file
@@ -0,0 +1,265 @@
+/*
+
+File: ./core/tests/state.gtest.cpp
+Author: Aldhinn Espinas
+Description: This tests the state snapshot functionalities.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace celerique {
+    /// @brief The GTest unit test suite for the state snapshots.
+    class StateUnitTestCpp : public ::testing::Test {
+    protected:
+        /// @brief A transform that only translates.
+        /// @param x The translation along the x axis.
+        /// @param y The translation along the y axis.
+        /// @param z The translation along the z axis.
+        /// @return The transform.
+        static Transform translation(float x, float y, float z) {
+            Transform transform;
+            transform.translation = {x, y, z};
+            return transform;
+        }
+        /// @brief Build a scene of chains, each node translated from its parent.
+        /// @param scene The scene to be filled.
+        /// @param numChains The number of root nodes.
+        /// @param chainLength The number of nodes per chain.
+        static void genChains(Scene& scene, size_t numChains, size_t chainLength) {
+            for (size_t chain = 0; chain < numChains; chain++) {
+                SceneNodeID parentId = CELERIQUE_SCENE_NODE_ID_NULL;
+                for (size_t link = 0; link < chainLength; link++) {
+                    parentId = scene.createNode(parentId, translation(static_cast<float>(chain), 1.0f, 0.0f));
+                }
+            }
+        }
+    };
+
+    /// @brief An application layer counting its updates, checkpointing the count.
+    class CountingStateApplicationLayer : public virtual ApplicationLayerBase {
+    public:
+        void onUpdate(::std::shared_ptr<IUpdateData> ptrUpdateData) override { _numUpdates++; }
+        void onEvent(::std::shared_ptr<EventBase> ptrEvent) override {}
+        void onSaveState(StateSnapshot& snapshot) override {
+            snapshot.writeSection(stateKey, &_numUpdates, sizeof(_numUpdates));
+        }
+        void onRestoreState(const StateSnapshot& snapshot) override {
+            /// @brief The layer's section.
+            const Byte* ptrSection = snapshot.section(stateKey);
+            if (ptrSection != nullptr) ::std::memcpy(&_numUpdates, ptrSection, sizeof(_numUpdates));
+        }
+
+        /// @brief The key of the layer's section.
+        static constexpr uint64_t stateKey = 1;
+        /// @brief The amount of times onUpdate was called.
+        uint64_t _numUpdates = 0;
+    };
+
+    TEST_F(StateUnitTestCpp, snapshotsRelocateAsBytes) {
+        StateSnapshot snapshot;
+        /// @brief The data of the first section.
+        const uint32_t arrValues[3] = {7, 8, 9};
+        snapshot.writeSection(42, arrValues, sizeof(arrValues), 3);
+        ::std::memcpy(snapshot.appendSection(43, 5), "hello", 5);
+        GTEST_ASSERT_EQ(snapshot.numSections(), 2);
+        GTEST_ASSERT_EQ(snapshot.size() % CELERIQUE_STATE_SNAPSHOT_ALIGNMENT, 0);
+
+        // Copied elsewhere and back, the bytes are the same snapshot.
+        /// @brief The copied bytes.
+        ::std::vector<Byte> vecCopy(snapshot.data(), snapshot.data() + snapshot.size());
+        StateSnapshot restored;
+        GTEST_ASSERT_TRUE(restored.assign(vecCopy.data(), vecCopy.size()));
+        /// @brief The size of the section read.
+        size_t size = 0;
+        /// @brief The version of the section read.
+        uint32_t version = 0;
+        /// @brief The first section.
+        const Byte* ptrSection = restored.section(42, &size, &version);
+        GTEST_ASSERT_NE(ptrSection, nullptr);
+        GTEST_ASSERT_EQ(reinterpret_cast<uintptr_t>(ptrSection) % CELERIQUE_STATE_SNAPSHOT_ALIGNMENT, 0);
+        GTEST_ASSERT_EQ(size, sizeof(arrValues));
+        GTEST_ASSERT_EQ(version, 3);
+        GTEST_ASSERT_EQ(::std::memcmp(ptrSection, arrValues, sizeof(arrValues)), 0);
+        GTEST_ASSERT_EQ(::std::memcmp(restored.section(43), "hello", 5), 0);
+        GTEST_ASSERT_EQ(restored.section(44), nullptr);
+
+        // Truncated or foreign bytes are refused.
+        GTEST_ASSERT_FALSE(restored.assign(vecCopy.data(), vecCopy.size() - CELERIQUE_STATE_SNAPSHOT_ALIGNMENT));
+        GTEST_ASSERT_EQ(restored.numSections(), 0);
+        vecCopy[4] = static_cast<Byte>(CELERIQUE_STATE_SNAPSHOT_VERSION + 1);
+        GTEST_ASSERT_FALSE(restored.assign(vecCopy.data(), vecCopy.size()));
+    }
+
+    TEST_F(StateUnitTestCpp, sceneRollsBackToCheckpoint) {
+        Scene scene;
+        genChains(scene, 4, 5);
+        scene.updateWorldTransforms();
+        /// @brief A node in the middle of the first chain.
+        SceneNodeID middleId = scene.nodeIds()[8];
+        /// @brief Its world matrix at the checkpoint.
+        Mat4x4 checkpointWorld = scene.worldMatrix(middleId);
+        StateSnapshot snapshot;
+        scene.saveState(snapshot, 7);
+
+        // Diverge: move a node, destroy a chain, add new nodes.
+        scene.setLocalTransform(middleId, translation(100.0f, 0.0f, 0.0f));
+        scene.destroyNode(scene.nodeIds()[0]);
+        genChains(scene, 2, 3);
+        scene.updateWorldTransforms();
+        GTEST_ASSERT_NE(scene.numNodes(), 20);
+
+        GTEST_ASSERT_TRUE(scene.restoreState(snapshot, 7));
+        GTEST_ASSERT_EQ(scene.numNodes(), 20);
+        GTEST_ASSERT_EQ(scene.worldMatrix(middleId), checkpointWorld);
+        // The restored scene keeps working, identifiers included.
+        GTEST_ASSERT_EQ(scene.updateWorldTransforms(), 0);
+        GTEST_ASSERT_EQ(scene.createNode(), 21);
+        GTEST_ASSERT_FALSE(scene.restoreState(snapshot, 8));
+    }
+
+    TEST_F(StateUnitTestCpp, deltasRebuildTheNextSnapshot) {
+        Scene scene;
+        genChains(scene, 64, 16);
+        scene.updateWorldTransforms();
+        StateSnapshot previous;
+        scene.saveState(previous, 1);
+
+        // One moved leaf only changes its transform, matrix and dirty flag.
+        scene.setLocalTransform(scene.nodeIds().back(), translation(5.0f, 5.0f, 5.0f));
+        scene.updateWorldTransforms();
+        StateSnapshot current;
+        scene.saveState(current, 1);
+        StateDelta delta;
+        current.diff(previous, delta);
+        GTEST_ASSERT_GT(delta.numChangedBlocks(), 0);
+        GTEST_ASSERT_LE(delta.numChangedBlocks(), 4);
+
+        StateSnapshot rebuilt;
+        GTEST_ASSERT_TRUE(rebuilt.assign(previous.data(), previous.size()));
+        GTEST_ASSERT_TRUE(rebuilt.applyDelta(delta));
+        GTEST_ASSERT_EQ(rebuilt.size(), current.size());
+        GTEST_ASSERT_EQ(::std::memcmp(rebuilt.data(), current.data(), current.size()), 0);
+
+        // Growing scenes are rebuilt too, but only from the snapshot the delta was recorded against.
+        genChains(scene, 1, 3);
+        StateSnapshot grown;
+        scene.saveState(grown, 1);
+        grown.diff(current, delta);
+        GTEST_ASSERT_FALSE(StateSnapshot().applyDelta(delta));
+        GTEST_ASSERT_TRUE(rebuilt.applyDelta(delta));
+        GTEST_ASSERT_EQ(::std::memcmp(rebuilt.data(), grown.data(), grown.size()), 0);
+    }
+
+    TEST_F(StateUnitTestCpp, deltasOnlyApplyToTheSectionsTheyWereRecordedAgainst) {
+        /// @brief The data of every section.
+        uint64_t arrValues[2] = {1, 2};
+        StateSnapshot previous;
+        previous.writeSection(1, arrValues, sizeof(arrValues));
+        StateSnapshot current;
+        current.writeSection(1, arrValues, sizeof(arrValues));
+        // Snapshots written the same way are equal down to their padding.
+        GTEST_ASSERT_EQ(previous.size(), current.size());
+        GTEST_ASSERT_EQ(::std::memcmp(previous.data(), current.data(), current.size()), 0);
+
+        arrValues[1] = 3;
+        current.clear();
+        current.writeSection(1, arrValues, sizeof(arrValues));
+        StateDelta delta;
+        current.diff(previous, delta);
+        GTEST_ASSERT_EQ(delta.numChangedBlocks(), 1);
+
+        // A snapshot of the same size under another key is not the one the delta was recorded against.
+        StateSnapshot other;
+        other.writeSection(2, arrValues, sizeof(arrValues));
+        GTEST_ASSERT_EQ(other.size(), previous.size());
+        GTEST_ASSERT_FALSE(other.applyDelta(delta));
+        GTEST_ASSERT_TRUE(previous.applyDelta(delta));
+        GTEST_ASSERT_EQ(::std::memcmp(previous.data(), current.data(), current.size()), 0);
+    }
+
+    TEST_F(StateUnitTestCpp, engineCheckpointsLayers) {
+        EngineContext engineContext;
+        /// @brief The layer being checkpointed.
+        ::std::unique_ptr<ApplicationLayerBase> ptrAppLayer = ::std::make_unique<CountingStateApplicationLayer>();
+        /// @brief The layer as its own type.
+        CountingStateApplicationLayer* ptrCountingLayer = dynamic_cast<CountingStateApplicationLayer*>(ptrAppLayer.get());
+        engineContext.addAppLayer(::std::move(ptrAppLayer));
+
+        for (size_t i = 0; i < 3; i++) engineContext.onUpdate();
+        StateSnapshot snapshot;
+        engineContext.saveState(snapshot);
+        GTEST_ASSERT_EQ(snapshot.numSections(), 2);
+        for (size_t i = 0; i < 5; i++) engineContext.onUpdate();
+        GTEST_ASSERT_EQ(ptrCountingLayer->_numUpdates, 8);
+
+        engineContext.restoreState(snapshot);
+        GTEST_ASSERT_EQ(ptrCountingLayer->_numUpdates, 3);
+    }
+
+    TEST_F(StateUnitTestCpp, largeSceneSnapshotAndRestoreTime) {
+        /// @brief The number of frames checkpointed.
+        const size_t numFrames = 60;
+        Scene scene;
+        genChains(scene, 10000, 10);
+        scene.updateWorldTransforms();
+
+        StateSnapshot arrSnapshots[2];
+        StateDelta delta;
+        /// @brief The time spent checkpointing, diffing and restoring.
+        ::std::chrono::nanoseconds saveTime(0), diffTime(0), restoreTime(0);
+        /// @brief The bytes recorded by the deltas.
+        size_t totalDeltaSize = 0;
+        for (size_t frame = 0; frame < numFrames; frame++) {
+            // A few hundred nodes move each frame, as in a typical simulation step.
+            for (size_t i = 0; i < 256; i++) {
+                /// @brief The node being moved.
+                SceneNodeID nodeId = scene.nodeIds()[(frame * 7919 + i * 389) % scene.numNodes()];
+                scene.setLocalTransform(nodeId, translation(static_cast<float>(frame), static_cast<float>(i), 0.0f));
+            }
+            scene.updateWorldTransforms();
+
+            /// @brief This frame's snapshot.
+            StateSnapshot& current = arrSnapshots[frame % 2];
+            ::std::chrono::steady_clock::time_point start = ::std::chrono::steady_clock::now();
+            current.clear();
+            scene.saveState(current, 1);
+            ::std::chrono::steady_clock::time_point saved = ::std::chrono::steady_clock::now();
+            if (frame > 0) {
+                current.diff(arrSnapshots[(frame + 1) % 2], delta);
+                totalDeltaSize += delta.size();
+            }
+            ::std::chrono::steady_clock::time_point diffed = ::std::chrono::steady_clock::now();
+            GTEST_ASSERT_TRUE(scene.restoreState(current, 1));
+            ::std::chrono::steady_clock::time_point restored = ::std::chrono::steady_clock::now();
+
+            saveTime += saved - start;
+            diffTime += diffed - saved;
+            restoreTime += restored - diffed;
+        }
+
+        // Restoring the newest checkpoint left the scene as it was.
+        GTEST_ASSERT_EQ(scene.numNodes(), 100000);
+        GTEST_ASSERT_EQ(scene.updateWorldTransforms(), 0);
+        GTEST_ASSERT_LT(totalDeltaSize / (numFrames - 1), arrSnapshots[0].size());
+        celeriqueLogInfo(
+            ::std::to_string(scene.numNodes()) + " nodes, " + ::std::to_string(arrSnapshots[0].size()) +
+            " bytes per snapshot. Snapshot: " +
+            ::std::to_string(::std::chrono::duration_cast<::std::chrono::microseconds>(saveTime).count() / numFrames) +
+            " microseconds. Delta: " +
+            ::std::to_string(::std::chrono::duration_cast<::std::chrono::microseconds>(diffTime).count() / numFrames) +
+            " microseconds, " + ::std::to_string(totalDeltaSize / (numFrames - 1)) + " bytes. Restore: " +
+            ::std::to_string(::std::chrono::duration_cast<::std::chrono::microseconds>(restoreTime).count() / numFrames) +
+            " microseconds."
+        );
+    }
+}
\ No newline at end of file
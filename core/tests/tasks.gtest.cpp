@@ -0,0 +1,155 @@
+/*
+
+File: ./core/tests/tasks.gtest.cpp
+Author: Aldhinn Espinas
+Description: This tests the coroutine task functionalities.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique.h>
+
+#include <gtest/gtest.h>
+
+#if defined(CELERIQUE_COROUTINES_ENABLED)
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace celerique {
+    /// @brief The GTest unit test suite for the coroutine tasks.
+    class TasksUnitTestCpp : public ::testing::Test {
+    protected:
+        /// @brief Update the engine until the state is set, giving up after 5 seconds.
+        /// @param atomicIsDone The state set by the task being waited on.
+        static void updateUntil(const ::std::atomic<bool>& atomicIsDone) {
+            /// @brief The point in time at which waiting is given up.
+            auto deadline = ::std::chrono::steady_clock::now() + ::std::chrono::seconds(5);
+            while (!atomicIsDone.load() && ::std::chrono::steady_clock::now() < deadline) {
+                onUpdate();
+                ::std::this_thread::sleep_for(::std::chrono::milliseconds(1));
+            }
+        }
+    };
+
+    /// @brief Add two numbers an engine update later.
+    static Task<int> addNextFrame(int lhs, int rhs) {
+        co_await nextFrame();
+        co_return lhs + rhs;
+    }
+
+    /// @brief Throw an engine update later.
+    static Task<void> throwNextFrame() {
+        co_await nextFrame();
+        throw ::std::runtime_error("Thrown from a task.");
+    }
+
+    /// @brief Await a task, a timer, a GPU timeline and an asset load one after the other.
+    static Task<void> runWorkflow(
+        const ::std::string& filePath, ::std::atomic<uint64_t>& atomicTimelineValue, ::std::atomic<int>& atomicSum,
+        ::std::atomic<bool>& atomicDidCatch, ::std::atomic<AssetState>& atomicAssetState, ::std::atomic<bool>& atomicIsDone
+    ) {
+        atomicSum.store(co_await addNextFrame(2, 3));
+        try {
+            co_await throwNextFrame();
+        } catch (const ::std::runtime_error&) {
+            atomicDidCatch.store(true);
+        }
+        co_await delay(::std::chrono::milliseconds(2));
+        co_await waitForTimelineValue([&atomicTimelineValue]() { return atomicTimelineValue.load(); }, 3);
+        atomicAssetState.store(co_await waitForAsset(loadAsset(filePath)));
+        atomicIsDone.store(true);
+    }
+
+    /// @brief Wait two engine updates, then count the task as resumed.
+    static Task<void> countAfterTwoFrames(
+        int numTasks, ::std::atomic<int>& atomicNumResumed, ::std::atomic<bool>& atomicIsDone
+    ) {
+        co_await nextFrame();
+        co_await nextFrame();
+        if (atomicNumResumed.fetch_add(1) + 1 == numTasks) atomicIsDone.store(true);
+    }
+
+    TEST_F(TasksUnitTestCpp, tasksAwaitFramesTimersTimelinesAndAssets) {
+        /// @brief The path of the asset file.
+        ::std::string filePath = (::std::filesystem::temp_directory_path() / "celerique_tasks.bin").string();
+        {
+            ::std::ofstream file(filePath, ::std::ios::binary);
+            file << "celerique";
+        }
+        /// @brief The value a fake GPU timeline reached.
+        ::std::atomic<uint64_t> atomicTimelineValue = 0;
+        /// @brief The sum produced by the awaited task.
+        ::std::atomic<int> atomicSum = 0;
+        /// @brief Whether the awaited task's exception was caught.
+        ::std::atomic<bool> atomicDidCatch = false;
+        /// @brief The state of the awaited asset.
+        ::std::atomic<AssetState> atomicAssetState = CELERIQUE_ASSET_STATE_NULL;
+        /// @brief Whether the workflow finished.
+        ::std::atomic<bool> atomicIsDone = false;
+
+        spawnTask(runWorkflow(
+            filePath, atomicTimelineValue, atomicSum, atomicDidCatch, atomicAssetState, atomicIsDone
+        ));
+
+        // The timeline holds the task back until it reaches 3.
+        for (size_t i = 0; i < 20; i++) {
+            onUpdate();
+            ::std::this_thread::sleep_for(::std::chrono::milliseconds(1));
+        }
+        GTEST_ASSERT_EQ(atomicSum.load(), 5);
+        GTEST_ASSERT_TRUE(atomicDidCatch.load());
+        GTEST_ASSERT_FALSE(atomicIsDone.load());
+        atomicTimelineValue.store(3);
+        updateUntil(atomicIsDone);
+
+        GTEST_ASSERT_TRUE(atomicIsDone.load());
+        GTEST_ASSERT_EQ(atomicAssetState.load(), CELERIQUE_ASSET_STATE_READY);
+    }
+
+    TEST_F(TasksUnitTestCpp, tasksResumeOnTheEngineContextTheyWereSpawnedOn) {
+        /// @brief The engine instance the task runs on.
+        EngineContext context;
+        /// @brief The number of tasks past their first update.
+        ::std::atomic<int> atomicNumResumed = 0;
+        /// @brief Whether the task finished.
+        ::std::atomic<bool> atomicIsDone = false;
+        context.spawnTask(countAfterTwoFrames(1, atomicNumResumed, atomicIsDone));
+
+        // Updates of the process default engine leave the task suspended.
+        for (size_t i = 0; i < 20; i++) {
+            onUpdate();
+            ::std::this_thread::sleep_for(::std::chrono::milliseconds(1));
+        }
+        GTEST_ASSERT_FALSE(atomicIsDone.load());
+
+        /// @brief The point in time at which waiting is given up.
+        auto deadline = ::std::chrono::steady_clock::now() + ::std::chrono::seconds(5);
+        while (!atomicIsDone.load() && ::std::chrono::steady_clock::now() < deadline) {
+            context.onUpdate();
+            ::std::this_thread::sleep_for(::std::chrono::milliseconds(1));
+        }
+        GTEST_ASSERT_TRUE(atomicIsDone.load());
+    }
+
+    TEST_F(TasksUnitTestCpp, suspendedTasksTakeNoThread) {
+        /// @brief The number of tasks spawned, far more than there are job workers.
+        const int numTasks = 1000;
+        /// @brief The number of tasks past their first update.
+        ::std::atomic<int> atomicNumResumed = 0;
+        /// @brief Whether every task finished.
+        ::std::atomic<bool> atomicIsDone = false;
+
+        for (int i = 0; i < numTasks; i++) {
+            spawnTask(countAfterTwoFrames(numTasks, atomicNumResumed, atomicIsDone));
+        }
+        updateUntil(atomicIsDone);
+        GTEST_ASSERT_EQ(atomicNumResumed.load(), numTasks);
+    }
+}
+#endif
\ No newline at end of file
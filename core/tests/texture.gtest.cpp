@@ -0,0 +1,197 @@
+/*
+
+File: ./core/tests/texture.gtest.cpp
+Author: Aldhinn Espinas
+Description: This tests the block compressed texture functionalities.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique/texture.h>
+#include <celerique/logging.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace celerique {
+    /// @brief The GTest unit test suite for block compressed textures.
+    class TextureUnitTestCpp : public ::testing::Test {
+    protected:
+        /// @brief Append a little-endian unsigned integer.
+        /// @param vecBytes The byte container.
+        /// @param value The integer value.
+        /// @param size The size of the integer in bytes.
+        static void appendLittleEndian(::std::vector<Byte>& vecBytes, uint64_t value, size_t size) {
+            for (size_t i = 0; i < size; i++) vecBytes.emplace_back(static_cast<Byte>((value >> (i * 8)) & 0xFF));
+        }
+
+        /// @brief Build a KTX2 file of a single 2D texture.
+        /// @param vkFormat The `VkFormat` of the payload.
+        /// @param width The width of the largest mip level.
+        /// @param height The height of the largest mip level.
+        /// @param vecLevels The payload of every mip level, largest first.
+        /// @param supercompressionScheme The supercompression scheme written in the header.
+        /// @return The file contents.
+        static ::std::vector<Byte> buildKtx2(
+            uint32_t vkFormat, uint32_t width, uint32_t height, const ::std::vector<::std::vector<Byte>>& vecLevels,
+            uint32_t supercompressionScheme = 0
+        ) {
+            /// @brief The file contents.
+            ::std::vector<Byte> vecKtx2;
+            const uint8_t identifier[12] = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'};
+            for (uint8_t byte : identifier) vecKtx2.emplace_back(static_cast<Byte>(byte));
+            for (uint32_t value : {vkFormat, 1u, width, height, 0u, 0u, 1u, static_cast<uint32_t>(vecLevels.size()), supercompressionScheme}) {
+                appendLittleEndian(vecKtx2, value, 4);
+            }
+            // Empty data format descriptor, key/value data & supercompression global data.
+            for (size_t i = 0; i < 4; i++) appendLittleEndian(vecKtx2, 0, 4);
+            for (size_t i = 0; i < 2; i++) appendLittleEndian(vecKtx2, 0, 8);
+
+            /// @brief The offset of the next level's data.
+            size_t offset = vecKtx2.size() + vecLevels.size() * 24;
+            for (const ::std::vector<Byte>& vecLevel : vecLevels) {
+                appendLittleEndian(vecKtx2, offset, 8);
+                appendLittleEndian(vecKtx2, vecLevel.size(), 8);
+                appendLittleEndian(vecKtx2, vecLevel.size(), 8);
+                offset += vecLevel.size();
+            }
+            for (const ::std::vector<Byte>& vecLevel : vecLevels) vecKtx2.insert(vecKtx2.end(), vecLevel.begin(), vecLevel.end());
+            return vecKtx2;
+        }
+
+        /// @brief Generate a full mip chain of a single color.
+        /// @param width The width of the largest mip level.
+        /// @param height The height of the largest mip level.
+        /// @param color The RGBA color.
+        /// @return The RGBA8 payload of every mip level.
+        static ::std::vector<::std::vector<Byte>> solidMipChain(uint32_t width, uint32_t height, const uint8_t color[4]) {
+            ::std::vector<::std::vector<Byte>> vecLevels;
+            while (true) {
+                ::std::vector<Byte> vecLevel(static_cast<size_t>(width) * height * 4);
+                for (size_t i = 0; i < vecLevel.size(); i++) vecLevel[i] = static_cast<Byte>(color[i % 4]);
+                vecLevels.emplace_back(::std::move(vecLevel));
+                if (width == 1 && height == 1) break;
+                width = ::std::max<uint32_t>(1, width / 2);
+                height = ::std::max<uint32_t>(1, height / 2);
+            }
+            return vecLevels;
+        }
+    };
+
+    TEST_F(TextureUnitTestCpp, levelSizes) {
+        GTEST_ASSERT_EQ(textureLevelSize(CELERIQUE_TEXTURE_FORMAT_RGBA8_UNORM, 5, 3), 60);
+        GTEST_ASSERT_EQ(textureLevelSize(CELERIQUE_TEXTURE_FORMAT_BC1_UNORM, 5, 5), 4 * 8);
+        GTEST_ASSERT_EQ(textureLevelSize(CELERIQUE_TEXTURE_FORMAT_BC7_SRGB, 1, 1), 16);
+        GTEST_ASSERT_TRUE(isBlockCompressed(CELERIQUE_TEXTURE_FORMAT_ASTC_4X4_UNORM));
+        GTEST_ASSERT_FALSE(isBlockCompressed(CELERIQUE_TEXTURE_FORMAT_RGBA8_SRGB));
+    }
+
+    TEST_F(TextureUnitTestCpp, blockCompressedPayloadIsReferencedInPlace) {
+        /// @brief An 8x8 BC7 texture with 2 mip levels.
+        ::std::vector<Byte> vecKtx2 = buildKtx2(145, 8, 8, {::std::vector<Byte>(64, 1), ::std::vector<Byte>(16, 2)});
+
+        ::std::shared_ptr<Texture> ptrTexture = loadKtx2Texture(vecKtx2.data(), vecKtx2.size(), CELERIQUE_TEXTURE_FORMAT_SUPPORT_BCN);
+        GTEST_ASSERT_NE(ptrTexture, nullptr);
+        GTEST_ASSERT_EQ(ptrTexture->format(), CELERIQUE_TEXTURE_FORMAT_BC7_UNORM);
+        GTEST_ASSERT_EQ(ptrTexture->mipLevels().size(), 2);
+        GTEST_ASSERT_EQ(ptrTexture->mipLevels()[1].width, 4);
+        GTEST_ASSERT_EQ(ptrTexture->size(), 80);
+        GTEST_ASSERT_EQ(ptrTexture->uncompressedSize(), 320);
+        GTEST_ASSERT_EQ(ptrTexture->mipLevels()[0].ptrData, vecKtx2.data() + vecKtx2.size() - 80);
+
+        // A device without BC7 can not use it and there is no transcoder between block formats.
+        GTEST_ASSERT_EQ(loadKtx2Texture(vecKtx2.data(), vecKtx2.size(), CELERIQUE_TEXTURE_FORMAT_SUPPORT_ETC2), nullptr);
+        // Supercompressed (Basis Universal) payloads are rejected.
+        ::std::vector<Byte> vecBasis = buildKtx2(0, 8, 8, {::std::vector<Byte>(64, 1)}, 1);
+        GTEST_ASSERT_EQ(loadKtx2Texture(vecBasis.data(), vecBasis.size(), CELERIQUE_TEXTURE_FORMAT_SUPPORT_BCN), nullptr);
+        // Truncated files are rejected.
+        GTEST_ASSERT_EQ(loadKtx2Texture(vecKtx2.data(), vecKtx2.size() - 1, CELERIQUE_TEXTURE_FORMAT_SUPPORT_BCN), nullptr);
+    }
+
+    TEST_F(TextureUnitTestCpp, rgba8IsCompressedForTheDevice) {
+        const uint8_t opaqueRed[4] = {255, 0, 0, 255};
+        /// @brief A 6x6 opaque texture, so the edge blocks are partial.
+        ::std::vector<Byte> vecOpaque = buildKtx2(37, 6, 6, solidMipChain(6, 6, opaqueRed));
+
+        ::std::shared_ptr<Texture> ptrTexture = loadKtx2Texture(vecOpaque.data(), vecOpaque.size(), CELERIQUE_TEXTURE_FORMAT_SUPPORT_BCN);
+        GTEST_ASSERT_NE(ptrTexture, nullptr);
+        GTEST_ASSERT_EQ(ptrTexture->format(), CELERIQUE_TEXTURE_FORMAT_BC1_UNORM);
+        GTEST_ASSERT_EQ(ptrTexture->mipLevels().size(), 3);
+        GTEST_ASSERT_EQ(ptrTexture->mipLevels()[0].size, 4 * 8);
+        /// @brief The first block: pure red endpoints (RGB565 0xF800), every index 0.
+        const uint8_t* ptrBlock = reinterpret_cast<const uint8_t*>(ptrTexture->mipLevels()[0].ptrData);
+        GTEST_ASSERT_EQ(ptrBlock[0] | (ptrBlock[1] << 8), 0xF800);
+        GTEST_ASSERT_EQ(ptrBlock[4] | ptrBlock[5] | ptrBlock[6] | ptrBlock[7], 0);
+
+        const uint8_t translucentGreen[4] = {0, 255, 0, 128};
+        ::std::vector<Byte> vecTranslucent = buildKtx2(43, 4, 4, solidMipChain(4, 4, translucentGreen));
+        ptrTexture = loadKtx2Texture(vecTranslucent.data(), vecTranslucent.size(), CELERIQUE_TEXTURE_FORMAT_SUPPORT_BCN);
+        GTEST_ASSERT_NE(ptrTexture, nullptr);
+        GTEST_ASSERT_EQ(ptrTexture->format(), CELERIQUE_TEXTURE_FORMAT_BC3_SRGB);
+        GTEST_ASSERT_EQ(static_cast<uint8_t>(ptrTexture->mipLevels()[0].ptrData[0]), 128);
+
+        // Without block compression support the pixels are uploaded as they are.
+        ptrTexture = loadKtx2Texture(vecTranslucent.data(), vecTranslucent.size(), CELERIQUE_TEXTURE_FORMAT_SUPPORT_NONE);
+        GTEST_ASSERT_NE(ptrTexture, nullptr);
+        GTEST_ASSERT_EQ(ptrTexture->format(), CELERIQUE_TEXTURE_FORMAT_RGBA8_SRGB);
+        GTEST_ASSERT_EQ(ptrTexture->size(), ptrTexture->uncompressedSize());
+    }
+
+    TEST_F(TextureUnitTestCpp, assetDecoder) {
+        const uint8_t opaqueBlue[4] = {0, 0, 255, 255};
+        /// @brief The decoder as `loadAsset` runs it.
+        AssetDecoder decoder = ktx2TextureDecoder(CELERIQUE_TEXTURE_FORMAT_SUPPORT_BC1);
+        ::std::shared_ptr<Texture> ptrTexture = ::std::static_pointer_cast<Texture>(
+            decoder(buildKtx2(37, 16, 16, solidMipChain(16, 16, opaqueBlue)))
+        );
+        GTEST_ASSERT_NE(ptrTexture, nullptr);
+        GTEST_ASSERT_EQ(ptrTexture->format(), CELERIQUE_TEXTURE_FORMAT_BC1_UNORM);
+
+        GTEST_TEST_THROW_(decoder(::std::vector<Byte>(16)), ::std::runtime_error, GTEST_FATAL_FAILURE_);
+    }
+
+    TEST_F(TextureUnitTestCpp, largeTextureLoadTime) {
+        /// @brief The size of the largest mip level.
+        const uint32_t textureSize = 2048;
+        /// @brief A full mip chain of an opaque gradient.
+        ::std::vector<::std::vector<Byte>> vecLevels;
+        for (uint32_t levelSize = textureSize; levelSize >= 1; levelSize /= 2) {
+            ::std::vector<Byte> vecLevel(static_cast<size_t>(levelSize) * levelSize * 4);
+            for (size_t y = 0; y < levelSize; y++) {
+                for (size_t x = 0; x < levelSize; x++) {
+                    Byte* ptrPixel = vecLevel.data() + (y * levelSize + x) * 4;
+                    ptrPixel[0] = static_cast<Byte>(x * 255 / levelSize);
+                    ptrPixel[1] = static_cast<Byte>(y * 255 / levelSize);
+                    ptrPixel[2] = static_cast<Byte>((x ^ y) & 0xFF);
+                    ptrPixel[3] = static_cast<Byte>(255);
+                }
+            }
+            vecLevels.emplace_back(::std::move(vecLevel));
+        }
+        ::std::vector<Byte> vecKtx2 = buildKtx2(43, textureSize, textureSize, vecLevels);
+
+        /// @brief The time the load started.
+        ::std::chrono::steady_clock::time_point start = ::std::chrono::steady_clock::now();
+        ::std::shared_ptr<Texture> ptrTexture = loadKtx2Texture(vecKtx2.data(), vecKtx2.size(), CELERIQUE_TEXTURE_FORMAT_SUPPORT_BCN);
+        /// @brief The time the load finished.
+        ::std::chrono::steady_clock::time_point end = ::std::chrono::steady_clock::now();
+
+        GTEST_ASSERT_NE(ptrTexture, nullptr);
+        GTEST_ASSERT_EQ(ptrTexture->format(), CELERIQUE_TEXTURE_FORMAT_BC1_SRGB);
+        // BC1 takes up an eighth of RGBA8.
+        GTEST_ASSERT_EQ(ptrTexture->mipLevels()[0].size * 8, static_cast<size_t>(textureSize) * textureSize * 4);
+        celeriqueLogInfo(
+            "Loaded " + ::std::to_string(textureSize) + "x" + ::std::to_string(textureSize) + " texture with " +
+            ::std::to_string(ptrTexture->mipLevels().size()) + " mip levels in " +
+            ::std::to_string(::std::chrono::duration_cast<::std::chrono::milliseconds>(end - start).count()) +
+            " milliseconds. Memory saved: " +
+            ::std::to_string((ptrTexture->uncompressedSize() - ptrTexture->size()) / 1024) + " KiB of " +
+            ::std::to_string(ptrTexture->uncompressedSize() / 1024) + " KiB."
+        );
+    }
+}
\ No newline at end of file
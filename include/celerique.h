@@ -18,6 +18,21 @@ License: Mozilla Public License 2.0. (See ./LICENSE).
 #include <celerique/events.h>
 #include <celerique/math.h>
 #include <celerique/graphics.h>
+#include <celerique/jobs.h>
+#include <celerique/assets.h>
+#include <celerique/archive.h>
+#include <celerique/mesh.h>
+#include <celerique/texture.h>
+#include <celerique/scene.h>
+#include <celerique/broadphase.h>
+#include <celerique/particles.h>
+#include <celerique/animation.h>
+#include <celerique/render.h>
+#include <celerique/tasks.h>
+#include <celerique/background.h>
+#include <celerique/state.h>
+#include <celerique/bridge.h>
+#include <celerique/recorder.h>
 
 #include <celerique/events/cursor.h>
 #include <celerique/events/keyboard.h>
@@ -39,25 +54,49 @@ License: Mozilla Public License 2.0. (See ./LICENSE).
 
 // Begin C++ Only Region.
 #if defined(__cplusplus)
+#include <atomic>
 #include <chrono>
+#include <mutex>
 
 namespace celerique {
     /// @brief The container for the engine's update argument data.
     class EngineUpdateData;
     /// @brief The interface for an application layer.
     class ApplicationLayerBase;
+    namespace internal {
+        /// @brief The class description of the engine's internal implementations.
+        class Engine;
+    }
 
     /// @brief Updates the state of the engine.
     /// @param ptrArg The shared pointer to the update data container.
     CELERIQUE_SHARED_SYMBOL void onUpdate(::std::shared_ptr<EngineUpdateData> ptrUpdateData = nullptr);
-    /// @brief Add an application layer to be managed by the engine.
+    /// @brief Add an application layer to be managed by the engine. Safe to call from any thread, including
+    /// from a layer's `onUpdate` or `onEvent`. It is added before the next update.
     /// @param ptrAppLayer The unique pointer to the application layer instance.
     CELERIQUE_SHARED_SYMBOL void addAppLayer(::std::unique_ptr<ApplicationLayerBase>&& ptrAppLayer);
-    /// @brief Add a graphical user interface window to be managed by the engine.
+    /// @brief Add a graphical user interface window to be managed by the engine. Safe to call from any thread, including
+    /// from a layer's `onUpdate` or `onEvent`. It is added before the next update.
     /// @param ptrWindow The unique pointer to the window instance.
     CELERIQUE_SHARED_SYMBOL void addWindow(::std::unique_ptr<WindowBase>&& ptrWindow);
     /// @brief Creates and run the application run loop.
     CELERIQUE_SHARED_SYMBOL void run();
+    /// @brief Set the time each iteration of the application run loop aims to take. Iterations finishing early
+    /// spend the rest on background work, then sleep.
+    /// @param targetFrameTime The target frame time. Zero runs iterations back to back, with no background budget.
+    CELERIQUE_SHARED_SYMBOL void setTargetFrameTime(::std::chrono::nanoseconds targetFrameTime);
+    /// @brief Set where and how the application layers' render snapshots are rendered.
+    /// Takes effect the next time the application run loop starts.
+    /// @param renderThreadMode The render thread mode.
+    CELERIQUE_SHARED_SYMBOL void setRenderThreadMode(RenderThreadMode renderThreadMode);
+    /// @brief Checkpoint the engine and every application layer into a state snapshot, replacing its contents.
+    /// Must be called on the update thread, such as from a layer's `onUpdate`.
+    /// @param snapshot The snapshot to write into.
+    CELERIQUE_SHARED_SYMBOL void saveEngineState(StateSnapshot& snapshot);
+    /// @brief Roll the engine and every application layer back to a state snapshot.
+    /// Must be called on the update thread, such as from a layer's `onUpdate`.
+    /// @param snapshot The snapshot to read from.
+    CELERIQUE_SHARED_SYMBOL void restoreEngineState(const StateSnapshot& snapshot);
 
     /// @brief The container for the engine's update argument data.
     class CELERIQUE_SHARED_SYMBOL EngineUpdateData : public virtual IUpdateData {
@@ -79,13 +118,206 @@ namespace celerique {
         ::std::chrono::nanoseconds _elapsedNanoSecs;
     };
 
+    /// @brief How often the engine updates an application layer.
+    struct LayerUpdateCadence {
+        /// @brief Update on every Nth engine update. 1 updates on every engine update.
+        uint32_t everyNthFrame = 1;
+        /// @brief The number of updates per second, used instead of `everyNthFrame` when positive.
+        double targetRate = 0.0;
+        /// @brief How far into its period the layer's updates are delayed, as a fraction in `[0, 1)`.
+        /// Negative lets the engine pick a phase that staggers low rate layers across frames.
+        double phase = -1.0;
+    };
+
     /// @brief The base class for an application layer.
     class ApplicationLayerBase : public virtual IStateful, public virtual IEventListener,
     public virtual EventBroadcasterBase {
+    public:
+        /// @brief Record what the layer renders this frame. Called on the update thread after every layer updated.
+        /// @param snapshot The snapshot to record into, cleared for this frame.
+        virtual void onWriteSnapshot(RenderSnapshot& snapshot);
+        /// @brief Submit a snapshot the layer recorded. When a render thread mode is set, this is called on the
+        /// render thread while the update thread updates the next frame, so it must only use the snapshot and the
+        /// graphics API, not state `onUpdate` changes.
+        /// @param snapshot The snapshot to render.
+        virtual void onRender(const RenderSnapshot& snapshot);
+        /// @brief Write the layer's state into sections of a snapshot being checkpointed. Called on the update thread.
+        /// @param snapshot The snapshot to write into. Section keys are picked by the layers and must not collide.
+        virtual void onSaveState(StateSnapshot& snapshot);
+        /// @brief Roll the layer's state back to the sections it wrote into a snapshot. Called on the update thread.
+        /// @param snapshot The snapshot to read from.
+        virtual void onRestoreState(const StateSnapshot& snapshot);
+        /// @brief Handle a run of events of the same type at once. Only called on layers batching their events,
+        /// on the update thread before the layers update, with the events broadcast since the previous update
+        /// grouped by type and source window. Calls `onEvent` for each event still propagating by default.
+        /// @param span The events, in the order they were broadcast.
+        virtual void onEventBatch(const EventSpan& span);
+
+        /// @brief How often the engine updates the layer. Layers updated less than every frame receive the
+        /// time elapsed since their own previous update in their `EngineUpdateData`.
+        /// @return The const reference to `_updateCadence`.
+        inline const LayerUpdateCadence& updateCadence() const { return _updateCadence; }
+        /// @brief The windows whose events the layer receives. Empty receives the events of every window.
+        /// @return The const reference to `_vecSubscribedWindowIds`.
+        inline const ::std::vector<WindowID>& subscribedWindowIds() const { return _vecSubscribedWindowIds; }
+        /// @brief Whether the layer receives its events in batches through `onEventBatch` instead of `onEvent`.
+        /// @return `_isBatchingEvents` value.
+        inline bool isBatchingEvents() const { return _isBatchingEvents; }
+
+    // Protected member variables.
+    protected:
+        /// @brief How often the engine updates the layer. Read when the layer is added to the engine.
+        LayerUpdateCadence _updateCadence;
+        /// @brief The windows whose events the layer receives. Empty receives the events of every window.
+        /// Events not coming from a window reach every layer. Read when the layer is added to the engine.
+        ::std::vector<WindowID> _vecSubscribedWindowIds;
+        /// @brief Whether the layer receives its events in batches through `onEventBatch`, a frame late,
+        /// instead of one `onEvent` call per event as it is broadcast. Set it in the constructor.
+        bool _isBatchingEvents = false;
+
+    // Protected helper functions.
+    protected:
+        /// @brief Request an asset to be loaded in the background. Its `event::AssetLoaded` or `event::AssetLoadFailed`
+        /// completion event reaches the engine the layer was added to, whichever thread asks, such as the render
+        /// thread or a task on a job worker. Asked before the layer was added, it is broadcast to the process
+        /// default engine like `::celerique::loadAsset`.
+        /// @param filePath The path of the file to load the asset from.
+        /// @param priority The priority of the load request.
+        /// @param decoder The decoder run on a job worker. Defaults to storing the raw bytes as a `::std::vector<Byte>`.
+        /// @return The handle to the requested asset.
+        AssetHandle loadAsset(
+            const ::std::string& filePath, AssetPriority priority = CELERIQUE_ASSET_PRIORITY_NORMAL,
+            AssetDecoder&& decoder = nullptr
+        );
+
+    // Private member variables.
+    private:
+        /// @brief The engine the layer was added to, receiving the completion events of its loads.
+        internal::Engine* _ptrEngine = nullptr;
+
+        friend class internal::Engine;
+
     public:
         /// @brief Pure virtual destructor.
         virtual ~ApplicationLayerBase() = 0;
     };
+
+    /// @brief An application layer connecting the engine to another local process through shared memory event rings.
+    /// Events injected into the inbound ring are broadcast on the update thread like any other layer's events,
+    /// and the engine's events are sent to the outbound ring, dropped when it is full.
+    class CELERIQUE_SHARED_SYMBOL EventBridgeLayer final : public virtual ApplicationLayerBase {
+    public:
+        /// @brief Broadcast every event injected since the last update.
+        /// @param ptrUpdateData The shared pointer to the update data container.
+        void onUpdate(::std::shared_ptr<IUpdateData> ptrUpdateData = nullptr) override;
+        /// @brief Send an event to the outbound ring. Events injected through a bridge are not sent back.
+        /// @param ptrEvent The shared pointer to the event being dispatched.
+        void onEvent(::std::shared_ptr<EventBase> ptrEvent) override;
+        /// @brief The number of events not sent because the outbound ring was full.
+        /// @return The value of `_atomicNumDroppedEvents`.
+        inline uint64_t numDroppedEvents() const { return _atomicNumDroppedEvents.load(::std::memory_order_relaxed); }
+
+    // Private member variables.
+    private:
+        /// @brief The ring of events injected by another process, or null.
+        ::std::shared_ptr<SharedEventRing> _ptrInboundRing;
+        /// @brief The ring the engine's events are sent to, or null.
+        ::std::shared_ptr<SharedEventRing> _ptrOutboundRing;
+        /// @brief The categories of events sent out. None sends every category.
+        EventCategory _forwardedCategories;
+        /// @brief Serializes the producers of the outbound ring.
+        ::std::mutex _outboundMutex;
+        /// @brief The number of events not sent because the outbound ring was full.
+        ::std::atomic<uint64_t> _atomicNumDroppedEvents = 0;
+
+    public:
+        /// @brief Member init constructor.
+        /// @param ptrInboundRing The ring of events injected by another process, or null.
+        /// @param ptrOutboundRing The ring the engine's events are sent to, or null.
+        /// @param forwardedCategories The categories of events sent out. None sends every category.
+        EventBridgeLayer(
+            ::std::shared_ptr<SharedEventRing> ptrInboundRing, ::std::shared_ptr<SharedEventRing> ptrOutboundRing = nullptr,
+            EventCategory forwardedCategories = CELERIQUE_EVENT_CATEGORY_NONE
+        );
+    };
+
+    /// @brief An engine instance besides the process default one driven by the free functions, with its own
+    /// layers, windows, event routing, render thread, background work and suspended tasks. Every instance shares
+    /// the job workers and the asset loads. Asset completion events reach the instance whose layers, or whose
+    /// `loadAsset`, asked for the asset. The graphics API and its device stay process wide, so instances
+    /// rendering at the same time share them.
+    class CELERIQUE_SHARED_SYMBOL EngineContext final {
+    public:
+        /// @brief Updates the state of the engine instance.
+        /// @param ptrUpdateData The shared pointer to the update data container.
+        void onUpdate(::std::shared_ptr<EngineUpdateData> ptrUpdateData = nullptr);
+        /// @brief Add an application layer to be managed by the engine instance. Safe to call from any thread.
+        /// @param ptrAppLayer The unique pointer to the application layer instance.
+        void addAppLayer(::std::unique_ptr<ApplicationLayerBase>&& ptrAppLayer);
+        /// @brief Add a graphical user interface window to be managed by the engine instance. Safe to call from any thread.
+        /// @param ptrWindow The unique pointer to the window instance.
+        void addWindow(::std::unique_ptr<WindowBase>&& ptrWindow);
+        /// @brief Creates and run the engine instance's application run loop on the calling thread.
+        void run();
+        /// @brief Set the time each iteration of the instance's application run loop aims to take.
+        /// @param targetFrameTime The target frame time. Zero runs iterations back to back, with no background budget.
+        void setTargetFrameTime(::std::chrono::nanoseconds targetFrameTime);
+        /// @brief Set where and how the instance's application layers' render snapshots are rendered.
+        /// @param renderThreadMode The render thread mode.
+        void setRenderThreadMode(RenderThreadMode renderThreadMode);
+        /// @brief Submit background work to be run in slices in the instance's updates.
+        /// @param task The background work.
+        /// @param priority The priority of the work.
+        void submitBackgroundTask(
+            BackgroundTask&& task, BackgroundPriority priority = CELERIQUE_BACKGROUND_PRIORITY_NORMAL
+        );
+        /// @brief The statistics of the instance's background work scheduler.
+        /// @return A copy of the statistics.
+        BackgroundSchedulerStats backgroundSchedulerStats();
+        /// @brief Request an asset to be loaded in the background. Its `event::AssetLoaded` or
+        /// `event::AssetLoadFailed` completion event reaches the instance's layers on its next update.
+        /// @param filePath The path of the file to load the asset from.
+        /// @param priority The priority of the load request.
+        /// @param decoder The decoder run on a job worker. Defaults to storing the raw bytes as a `::std::vector<Byte>`.
+        /// @return The handle to the requested asset.
+        AssetHandle loadAsset(
+            const ::std::string& filePath, AssetPriority priority = CELERIQUE_ASSET_PRIORITY_NORMAL,
+            AssetDecoder&& decoder = nullptr
+        );
+#if defined(CELERIQUE_COROUTINES_ENABLED)
+        /// @brief Start a task on a job worker, its suspensions resumed by the instance's updates.
+        /// @param task The task to be started.
+        void spawnTask(Task<void>&& task);
+#endif
+        /// @brief Checkpoint the engine instance and every application layer into a state snapshot, replacing its
+        /// contents. Must be called on the instance's update thread.
+        /// @param snapshot The snapshot to write into.
+        void saveState(StateSnapshot& snapshot);
+        /// @brief Roll the engine instance and every application layer back to a state snapshot.
+        /// Must be called on the instance's update thread.
+        /// @param snapshot The snapshot to read from.
+        void restoreState(const StateSnapshot& snapshot);
+
+    // Private member variables.
+    private:
+        /// @brief The engine instance.
+        ::std::unique_ptr<internal::Engine> _ptrEngine;
+
+    public:
+        /// @brief Default constructor. Creates an engine instance.
+        EngineContext();
+        /// @brief Destructor. Destroys the engine instance with its layers and windows.
+        ~EngineContext();
+
+        /// @brief Prevent copying.
+        EngineContext(const EngineContext&) = delete;
+        /// @brief Prevent moving.
+        EngineContext(EngineContext&&) = delete;
+        /// @brief Prevent copy re-assignment.
+        EngineContext& operator=(const EngineContext&) = delete;
+        /// @brief Prevent move re-assignment.
+        EngineContext& operator=(EngineContext&&) = delete;
+    };
 }
 #endif
 // End C++ Only Region.
@@ -0,0 +1,210 @@
+/*
+
+File: ./include/celerique/animation.h
+Author: Aldhinn Espinas
+Description: This header file contains the skeletal animation interfaces.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#if !defined(CELERIQUE_ANIMATION_HEADER_FILE)
+#define CELERIQUE_ANIMATION_HEADER_FILE
+
+#include <celerique/defines.h>
+#include <celerique/types.h>
+#include <celerique/math.h>
+
+/// @brief The size of one joint of a skinning palette: the top 3 rows of its
+/// row-major skinning matrix, read by the skinning shaders as 3 `vec4`s.
+#define CELERIQUE_SKINNING_PALETTE_JOINT_SIZE                                               48
+/// @brief A null value for a joint's parent index, marking a root joint.
+#define CELERIQUE_JOINT_INDEX_NULL                                                          UINT32_MAX
+
+// Begin C++ Only Region.
+#if defined(__cplusplus)
+#include <vector>
+
+namespace celerique {
+    /// @brief The transform of a joint relative to its parent, padded to 4 floats per
+    /// component so every component is a single SIMD register.
+    struct JointPose {
+        /// @brief The translation. The last element is unused.
+        alignas(16) float translation[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+        /// @brief The rotation as a unit quaternion (x, y, z, w).
+        float rotation[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+        /// @brief The scale along each axis. The last element is unused.
+        float scale[4] = {1.0f, 1.0f, 1.0f, 0.0f};
+    };
+
+    /// @brief A hierarchy of joints, every parent before its children.
+    class CELERIQUE_SHARED_SYMBOL Skeleton final {
+    public:
+        /// @brief The number of joints.
+        /// @return The size of `_vecParentIndices`.
+        inline size_t numJoints() const { return _vecParentIndices.size(); }
+        /// @brief The parent of each joint, `CELERIQUE_JOINT_INDEX_NULL` for roots.
+        /// @return The const reference to `_vecParentIndices`.
+        inline const ::std::vector<uint32_t>& parentIndices() const { return _vecParentIndices; }
+        /// @brief The inverse of each joint's model matrix in the bind pose, 16 row-major floats each.
+        /// @return The const reference to `_vecInverseBindMatrices`.
+        inline const ::std::vector<float>& inverseBindMatrices() const { return _vecInverseBindMatrices; }
+
+    // Private member variables.
+    private:
+        /// @brief The parent of each joint, `CELERIQUE_JOINT_INDEX_NULL` for roots.
+        ::std::vector<uint32_t> _vecParentIndices;
+        /// @brief The inverse of each joint's model matrix in the bind pose, 16 row-major floats each.
+        ::std::vector<float> _vecInverseBindMatrices;
+
+    public:
+        /// @brief Member init constructor.
+        /// @param vecParentIndices The parent of each joint. Parents must come before their children.
+        /// @param vecInverseBindMatrices The inverse bind matrices, 16 row-major floats per joint.
+        /// Identity matrices are used if empty.
+        Skeleton(::std::vector<uint32_t>&& vecParentIndices, ::std::vector<float>&& vecInverseBindMatrices = {});
+    };
+
+    /// @brief A keyframe of a translation or scale channel.
+    struct RawVec3Key {
+        /// @brief The time of the keyframe in seconds.
+        float time;
+        /// @brief The value.
+        Vec3 value;
+    };
+    /// @brief A keyframe of a rotation channel.
+    struct RawRotationKey {
+        /// @brief The time of the keyframe in seconds.
+        float time;
+        /// @brief The value as a unit quaternion (x, y, z, w).
+        Vec4 value;
+    };
+    /// @brief The uncompressed keyframes of one joint, sorted by time. Empty channels keep the identity value.
+    struct RawJointTrack {
+        /// @brief The translation keyframes.
+        ::std::vector<RawVec3Key> vecTranslationKeys;
+        /// @brief The rotation keyframes.
+        ::std::vector<RawRotationKey> vecRotationKeys;
+        /// @brief The scale keyframes.
+        ::std::vector<RawVec3Key> vecScaleKeys;
+    };
+    /// @brief An uncompressed animation, as authored or imported.
+    struct RawAnimation {
+        /// @brief The length of the animation in seconds.
+        float duration = 0.0f;
+        /// @brief The keyframes of each joint.
+        ::std::vector<RawJointTrack> vecJointTracks;
+    };
+
+    /// @brief A compressed animation. Keyframes that linear interpolation reproduces within
+    /// a tolerance are removed, key times are stored as 16 bit fractions of the duration, and
+    /// rotations are quantized to 48 bits (the three smallest quaternion components).
+    class CELERIQUE_SHARED_SYMBOL AnimationClip final {
+    public:
+        /// @brief Sample the local pose of every joint.
+        /// @param time The time in seconds, clamped to the duration.
+        /// @param ptrPoses The destination receiving `numJoints()` poses.
+        void sample(float time, JointPose* ptrPoses) const;
+
+        /// @brief The number of joints animated.
+        /// @return The number of joints.
+        inline size_t numJoints() const { return _vecKeyRanges.size() / 6; }
+        /// @brief The length of the animation in seconds.
+        /// @return The value of `_duration`.
+        inline float duration() const { return _duration; }
+        /// @brief The number of keyframes kept across every channel.
+        /// @return The number of keyframes.
+        inline size_t numKeys() const {
+            return _vecTranslationTimes.size() + _vecRotationTimes.size() + _vecScaleTimes.size();
+        }
+        /// @brief The memory used by the keyframes.
+        /// @return The size in bytes.
+        size_t compressedSize() const;
+
+    // Private member variables.
+    private:
+        /// @brief The length of the animation in seconds.
+        float _duration;
+        /// @brief The first keyframe and number of keyframes of each joint's translation,
+        /// rotation and scale channels, 6 values per joint.
+        ::std::vector<uint32_t> _vecKeyRanges;
+        /// @brief The translation key times as fractions of the duration out of 65535.
+        ::std::vector<uint16_t> _vecTranslationTimes;
+        /// @brief The translation values, 3 floats per key, plus one float of padding.
+        ::std::vector<float> _vecTranslationValues;
+        /// @brief The rotation key times as fractions of the duration out of 65535.
+        ::std::vector<uint16_t> _vecRotationTimes;
+        /// @brief The quantized rotation values, 3 integers per key.
+        ::std::vector<uint16_t> _vecRotationValues;
+        /// @brief The scale key times as fractions of the duration out of 65535.
+        ::std::vector<uint16_t> _vecScaleTimes;
+        /// @brief The scale values, 3 floats per key, plus one float of padding.
+        ::std::vector<float> _vecScaleValues;
+
+    public:
+        /// @brief Compress a raw animation.
+        /// @param rawAnimation The uncompressed animation.
+        /// @param tolerance The largest distance from the raw keyframes a removed keyframe may
+        /// introduce, in the units of each channel (quaternion components for rotations).
+        AnimationClip(const RawAnimation& rawAnimation, float tolerance = 0.001f);
+    };
+
+    /// @brief Blend two poses, interpolating translations and scales and taking the shortest path between rotations.
+    /// @param ptrFrom The poses at weight 0.
+    /// @param ptrTo The poses at weight 1.
+    /// @param weight The blend weight.
+    /// @param numJoints The number of joints.
+    /// @param ptrOut The destination receiving the blended poses. May alias either input.
+    CELERIQUE_SHARED_SYMBOL void blendPoses(
+        const JointPose* ptrFrom, const JointPose* ptrTo, float weight, size_t numJoints, JointPose* ptrOut
+    );
+    /// @brief Compose local poses into model space matrices.
+    /// @param skeleton The skeleton of the poses.
+    /// @param ptrLocalPoses The pose of each joint relative to its parent.
+    /// @param ptrModelMatrices The destination receiving 16 row-major floats per joint.
+    CELERIQUE_SHARED_SYMBOL void buildModelMatrices(
+        const Skeleton& skeleton, const JointPose* ptrLocalPoses, float* ptrModelMatrices
+    );
+    /// @brief Write the skinning matrices (model matrix times inverse bind matrix) of every
+    /// joint, `CELERIQUE_SKINNING_PALETTE_JOINT_SIZE` bytes each, for the skinning shaders.
+    /// @param skeleton The skeleton of the matrices.
+    /// @param ptrModelMatrices The model matrices, 16 row-major floats per joint.
+    /// @param ptrDst The destination, such as a mapped storage buffer. Must be 4 byte aligned.
+    /// @param dstCapacity The size of the destination in bytes.
+    /// @return `false` if the destination is too small.
+    CELERIQUE_SHARED_SYMBOL bool writeSkinningPalette(
+        const Skeleton& skeleton, const float* ptrModelMatrices, void* ptrDst, size_t dstCapacity
+    );
+
+    /// @brief What a character plays.
+    struct CharacterAnimation {
+        /// @brief The clip played.
+        const AnimationClip* ptrClip = nullptr;
+        /// @brief The time within the clip in seconds.
+        float time = 0.0f;
+        /// @brief The clip blended in, or null for none.
+        const AnimationClip* ptrBlendClip = nullptr;
+        /// @brief The time within the blended clip in seconds.
+        float blendTime = 0.0f;
+        /// @brief The weight of the blended clip.
+        float blendWeight = 0.0f;
+    };
+    /// @brief Sample, blend, compose and write the skinning palettes of many characters
+    /// sharing a skeleton, in parallel on the job workers.
+    /// @param skeleton The skeleton of every character. Every clip must animate its joints.
+    /// @param ptrCharacters What each character plays.
+    /// @param numCharacters The number of characters.
+    /// @param ptrDst The destination receiving each character's palette one after the other.
+    /// @param dstCapacity The size of the destination in bytes.
+    /// @return `false` if the destination is too small or a clip does not match the skeleton.
+    CELERIQUE_SHARED_SYMBOL bool animateCharacters(
+        const Skeleton& skeleton, const CharacterAnimation* ptrCharacters, size_t numCharacters,
+        void* ptrDst, size_t dstCapacity
+    );
+}
+#endif
+// End C++ Only Region.
+
+#endif
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
@@ -0,0 +1,176 @@
+/*
+
+File: ./include/celerique/archive.h
+Author: Aldhinn Espinas
+Description: This header file contains interfaces to packed asset archives.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#if !defined(CELERIQUE_ARCHIVE_HEADER_FILE)
+#define CELERIQUE_ARCHIVE_HEADER_FILE
+
+#include <celerique/defines.h>
+#include <celerique/types.h>
+#include <celerique/pipeline.h>
+
+/// @brief The alignment in bytes of every entry (and the table of contents) in an archive.
+#define CELERIQUE_ARCHIVE_ALIGNMENT                                                         64
+/// @brief The default size of an uncompressed chunk of a compressed entry.
+#define CELERIQUE_ARCHIVE_DEFAULT_CHUNK_SIZE                                                65536
+
+/// @brief The compression applied to an archive entry.
+typedef uint32_t CeleriqueArchiveCompression;
+/// @brief The entry is stored as is and can be accessed without copying.
+#define CELERIQUE_ARCHIVE_COMPRESSION_NONE                                                  0x00
+/// @brief The entry is split into chunks that are each compressed as an LZ4 block.
+#define CELERIQUE_ARCHIVE_COMPRESSION_LZ4                                                   0x01
+
+// Begin C++ Only Region.
+#if defined(__cplusplus)
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace celerique {
+    /// @brief The compression applied to an archive entry.
+    typedef CeleriqueArchiveCompression ArchiveCompression;
+    /// @brief The type for a pointer value.
+    typedef CeleriquePointer Pointer;
+
+    namespace internal {
+        /// @brief The on-disk description of a single archive entry.
+        struct ArchiveTocEntry;
+    }
+
+    /// @brief Hash an entry name the way archives store it (64-bit FNV-1a).
+    /// @param name The name of the entry.
+    /// @return The hashed name.
+    CELERIQUE_SHARED_SYMBOL uint64_t hashArchiveEntryName(const ::std::string& name);
+
+    /// @brief A read only, memory mapped archive.
+    class CELERIQUE_SHARED_SYMBOL Archive final : public ::std::enable_shared_from_this<Archive> {
+    public:
+        /// @brief The number of entries in the archive.
+        /// @return The number of entries in the table of contents.
+        size_t numEntries() const;
+        /// @brief Determines whether the archive has an entry.
+        /// @param name The name of the entry.
+        /// @return `true` if the entry exists.
+        bool contains(const ::std::string& name) const;
+        /// @brief The uncompressed size of an entry.
+        /// @param name The name of the entry.
+        /// @return The size in bytes or 0 if the entry does not exist.
+        size_t entrySize(const ::std::string& name) const;
+        /// @brief Direct access to an uncompressed entry inside the mapping.
+        /// The pointer is aligned to `CELERIQUE_ARCHIVE_ALIGNMENT` and valid while the archive is alive.
+        /// @param name The name of the entry.
+        /// @return The pointer to the entry or `nullptr` if it does not exist or is compressed.
+        const Byte* entryData(const ::std::string& name) const;
+        /// @brief Copy or decompress an entry into a caller provided buffer.
+        /// Compressed chunks are decompressed in parallel on the job workers.
+        /// @param name The name of the entry.
+        /// @param ptrDst The destination buffer.
+        /// @param dstCapacity The size of the destination buffer.
+        /// @return `true` if the whole entry was written into the buffer.
+        bool read(const ::std::string& name, Byte* ptrDst, size_t dstCapacity) const;
+        /// @brief Copy or decompress an entry into a new buffer.
+        /// @param name The name of the entry.
+        /// @return The entry's contents or an empty buffer on failure.
+        ::std::vector<Byte> read(const ::std::string& name) const;
+        /// @brief Load a shader program from an entry. Uncompressed entries are
+        /// referenced in place and keep this archive alive.
+        /// @param name The name of the entry.
+        /// @return The shader program container (empty on failure).
+        ShaderProgram shaderProgram(const ::std::string& name);
+
+        /// @brief Member init constructor. Use `openArchive` instead.
+        /// @param ptrMapping The pointer to the start of the mapped archive.
+        /// @param mappingSize The size of the mapping.
+        /// @param ptrMappingHandle The platform specific handle kept alive for the mapping.
+        Archive(const Byte* ptrMapping, size_t mappingSize, Pointer ptrMappingHandle);
+
+    // Private helper functions.
+    private:
+        /// @brief Find the table of contents entry of a name.
+        /// @param name The name of the entry.
+        /// @return The pointer to the entry or `nullptr` if it does not exist.
+        const internal::ArchiveTocEntry* findEntry(const ::std::string& name) const;
+
+    // Private member variables.
+    private:
+        /// @brief The pointer to the start of the mapped archive.
+        const Byte* _ptrMapping;
+        /// @brief The size of the mapping.
+        size_t _mappingSize;
+        /// @brief The platform specific handle kept alive for the mapping.
+        Pointer _ptrMappingHandle;
+        /// @brief The sorted table of contents inside the mapping.
+        const internal::ArchiveTocEntry* _ptrTocEntries;
+        /// @brief The number of entries in the table of contents.
+        size_t _numTocEntries;
+
+    public:
+        /// @brief Destructor. Unmaps the archive.
+        ~Archive();
+
+        /// @brief Prevent copying.
+        Archive(const Archive&) = delete;
+        /// @brief Prevent moving.
+        Archive(Archive&&) = delete;
+        /// @brief Prevent copy re-assignment.
+        Archive& operator=(const Archive&) = delete;
+        /// @brief Prevent move re-assignment.
+        Archive& operator=(Archive&&) = delete;
+    };
+
+    /// @brief Collects entries and writes them out as an archive.
+    class CELERIQUE_SHARED_SYMBOL ArchiveWriter final {
+    public:
+        /// @brief Add an entry. Compression happens here, in parallel chunks on the job workers.
+        /// @param name The name of the entry. Names must hash uniquely within an archive.
+        /// @param ptrData The pointer to the entry's contents.
+        /// @param size The size of the entry's contents.
+        /// @param compression The compression applied to the entry.
+        /// @param chunkSize The uncompressed size of each compressed chunk.
+        void addEntry(
+            const ::std::string& name, const Byte* ptrData, size_t size,
+            ArchiveCompression compression = CELERIQUE_ARCHIVE_COMPRESSION_NONE,
+            uint32_t chunkSize = CELERIQUE_ARCHIVE_DEFAULT_CHUNK_SIZE
+        );
+        /// @brief Write every added entry to an archive file.
+        /// @param filePath The path of the archive to be written.
+        /// @return `true` if the archive was written successfully.
+        bool write(const ::std::string& filePath) const;
+
+    // Private member variables.
+    private:
+        /// @brief An entry waiting to be written.
+        struct PendingEntry {
+            /// @brief The hashed name of the entry.
+            uint64_t nameHash;
+            /// @brief The uncompressed size of the entry.
+            uint64_t size;
+            /// @brief The compression applied to the entry.
+            ArchiveCompression compression;
+            /// @brief The uncompressed size of each compressed chunk.
+            uint32_t chunkSize;
+            /// @brief The bytes as they are stored in the archive.
+            ::std::vector<Byte> storedBytes;
+        };
+        /// @brief The entries waiting to be written.
+        ::std::vector<PendingEntry> _vecPendingEntries;
+    };
+
+    /// @brief Memory map an archive file.
+    /// @param filePath The path of the archive.
+    /// @return The shared pointer to the archive or `nullptr` if it could not be opened.
+    CELERIQUE_SHARED_SYMBOL ::std::shared_ptr<Archive> openArchive(const ::std::string& filePath);
+}
+#endif
+// End C++ Only Region.
+
+#endif
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
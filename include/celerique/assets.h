@@ -0,0 +1,145 @@
+/*
+
+File: ./include/celerique/assets.h
+Author: Aldhinn Espinas
+Description: This header file contains interfaces to the asynchronous asset loading system.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#if !defined(CELERIQUE_ASSETS_HEADER_FILE)
+#define CELERIQUE_ASSETS_HEADER_FILE
+
+#include <celerique/defines.h>
+#include <celerique/types.h>
+
+/// @brief The unique identifier of a loaded or loading asset.
+typedef uintptr_t CeleriqueAssetID;
+/// @brief The null value for `CeleriqueAssetID`.
+#define CELERIQUE_ASSET_ID_NULL                                                             0x00
+
+/// @brief The priority of an asset load request. Higher values are serviced first.
+typedef uint8_t CeleriqueAssetPriority;
+/// @brief Load when nothing more important is waiting.
+#define CELERIQUE_ASSET_PRIORITY_LOW                                                        0x00
+/// @brief The default load priority.
+#define CELERIQUE_ASSET_PRIORITY_NORMAL                                                     0x01
+/// @brief Load ahead of every normal and low priority request.
+#define CELERIQUE_ASSET_PRIORITY_HIGH                                                       0x02
+
+/// @brief The loading state of an asset.
+typedef uint8_t CeleriqueAssetState;
+/// @brief The asset is unknown or was already released.
+#define CELERIQUE_ASSET_STATE_NULL                                                          0x00
+/// @brief The asset is waiting in the request queue.
+#define CELERIQUE_ASSET_STATE_QUEUED                                                        0x01
+/// @brief The asset is being read or decoded.
+#define CELERIQUE_ASSET_STATE_LOADING                                                       0x02
+/// @brief The asset finished loading and its data is available.
+#define CELERIQUE_ASSET_STATE_READY                                                         0x03
+/// @brief The asset failed to be read or decoded.
+#define CELERIQUE_ASSET_STATE_FAILED                                                        0x04
+
+// Begin C++ Only Region.
+#if defined(__cplusplus)
+#include <memory>
+#include <string>
+#include <vector>
+#include <functional>
+
+namespace celerique {
+    /// @brief The unique identifier of a loaded or loading asset.
+    typedef CeleriqueAssetID AssetID;
+    /// @brief The priority of an asset load request.
+    typedef CeleriqueAssetPriority AssetPriority;
+    /// @brief The loading state of an asset.
+    typedef CeleriqueAssetState AssetState;
+    /// @brief The type for a single unit of byte.
+    typedef CeleriqueByte Byte;
+
+    /// @brief The function that turns the raw file contents into the asset's in-memory representation.
+    /// It is run on a job worker thread. Throwing marks the asset as failed.
+    using AssetDecoder = ::std::function<::std::shared_ptr<void>(::std::vector<Byte>&&)>;
+
+    /// @brief A reference counted handle to an asset. The asset is released
+    /// once the last handle referring to it is destroyed.
+    class CELERIQUE_SHARED_SYMBOL AssetHandle final {
+    public:
+        /// @brief Default constructor. Refers to no asset.
+        AssetHandle() = default;
+        /// @brief Member init constructor. Takes over an already retained reference.
+        /// @param assetId The identifier of the asset being referred to.
+        explicit AssetHandle(AssetID assetId);
+
+        /// @brief The identifier of the asset being referred to.
+        /// @return `_assetId` value.
+        inline AssetID id() const { return _assetId; }
+        /// @brief The current loading state of the asset.
+        /// @return The asset state value.
+        AssetState state() const;
+        /// @brief Determines whether the asset finished loading.
+        /// @return `true` if the asset's data is available.
+        inline bool isReady() const { return state() == CELERIQUE_ASSET_STATE_READY; }
+
+        /// @brief Access the decoded asset data.
+        /// @tparam TData The type produced by the asset's decoder.
+        /// @return The shared pointer to the decoded data or `nullptr` if not yet ready.
+        template <typename TData>
+        inline ::std::shared_ptr<TData> data() const {
+            return ::std::static_pointer_cast<TData>(rawData());
+        }
+
+    // Private helper functions.
+    private:
+        /// @brief Access the type erased decoded asset data.
+        /// @return The shared pointer to the decoded data or `nullptr` if not yet ready.
+        ::std::shared_ptr<void> rawData() const;
+
+    // Private member variables.
+    private:
+        /// @brief The identifier of the asset being referred to.
+        AssetID _assetId = CELERIQUE_ASSET_ID_NULL;
+
+    // Copying and moving.
+    public:
+        /// @brief Copy constructor. Retains another reference to the asset.
+        /// @param other The other handle to be copied.
+        AssetHandle(const AssetHandle& other);
+        /// @brief Move constructor.
+        /// @param other The r-value reference to the handle where the reference is moving from.
+        AssetHandle(AssetHandle&& other) noexcept;
+        /// @brief Copy re-assignment operator.
+        /// @param other The other handle to be copied.
+        /// @return The reference to this instance.
+        AssetHandle& operator=(const AssetHandle& other);
+        /// @brief Move re-assignment operator.
+        /// @param other The r-value reference to the handle where the reference is moving from.
+        /// @return The reference to this instance.
+        AssetHandle& operator=(AssetHandle&& other) noexcept;
+
+        /// @brief Destructor. Releases the reference to the asset.
+        ~AssetHandle();
+    };
+
+    /// @brief Request an asset to be loaded in the background. Requesting an
+    /// already requested file path returns another handle to the same asset.
+    /// Completion is broadcast as either an `event::AssetLoaded` or an
+    /// `event::AssetLoadFailed` engine event to the process default engine,
+    /// even for an asset that already finished loading. Layers load through
+    /// `ApplicationLayerBase::loadAsset` to have it reach their own engine.
+    /// @param filePath The path of the file to load the asset from.
+    /// @param priority The priority of the load request.
+    /// @param decoder The decoder run on a job worker. Defaults to storing the raw bytes as a `::std::vector<Byte>`.
+    /// @return The handle to the requested asset.
+    CELERIQUE_SHARED_SYMBOL AssetHandle loadAsset(
+        const ::std::string& filePath, AssetPriority priority = CELERIQUE_ASSET_PRIORITY_NORMAL,
+        AssetDecoder&& decoder = nullptr
+    );
+}
+#endif
+// End C++ Only Region.
+
+#endif
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
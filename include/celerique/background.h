@@ -0,0 +1,78 @@
+/*
+
+File: ./include/celerique/background.h
+Author: Aldhinn Espinas
+Description: This header file contains the time budgeted background work scheduler, running
+    small slices of deferred work on the update thread with the time left in each frame.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#if !defined(CELERIQUE_BACKGROUND_HEADER_FILE)
+#define CELERIQUE_BACKGROUND_HEADER_FILE
+
+#include <celerique/defines.h>
+#include <celerique/types.h>
+
+/// @brief The priority of background work. Higher values run first.
+typedef uint8_t CeleriqueBackgroundPriority;
+/// @brief Run when nothing more important is waiting.
+#define CELERIQUE_BACKGROUND_PRIORITY_LOW                                                   0x00
+/// @brief The default background priority.
+#define CELERIQUE_BACKGROUND_PRIORITY_NORMAL                                                0x01
+/// @brief Run ahead of every normal and low priority background work.
+#define CELERIQUE_BACKGROUND_PRIORITY_HIGH                                                  0x02
+/// @brief The number of background priorities.
+#define CELERIQUE_NUM_BACKGROUND_PRIORITIES                                                 3
+
+// Begin C++ Only Region.
+#if defined(__cplusplus)
+#include <chrono>
+#include <functional>
+
+namespace celerique {
+    /// @brief The priority of background work.
+    typedef CeleriqueBackgroundPriority BackgroundPriority;
+    /// @brief One slice of background work, such as evicting a few cache entries.
+    /// Returns `true` once the work is finished, `false` to be called again in a later slice.
+    using BackgroundTask = ::std::function<bool()>;
+
+    /// @brief The statistics of the background work scheduler.
+    struct BackgroundSchedulerStats {
+        /// @brief The number of background tasks waiting, the deferred backlog.
+        size_t numPendingTasks = 0;
+        /// @brief The time the last update with background work had left for it.
+        ::std::chrono::nanoseconds lastBudget = ::std::chrono::nanoseconds::zero();
+        /// @brief The time the last update with background work spent on it.
+        ::std::chrono::nanoseconds lastUsed = ::std::chrono::nanoseconds::zero();
+        /// @brief The moving average of the time spent over the time budgeted, across updates with
+        /// background work. Above 1 when slices overrun the budget.
+        double averageUtilization = 0.0;
+        /// @brief The number of slices run so far.
+        uint64_t numSlicesRun = 0;
+        /// @brief The number of background tasks finished so far.
+        uint64_t numTasksCompleted = 0;
+        /// @brief The number of background tasks dropped after throwing so far.
+        uint64_t numTasksFailed = 0;
+    };
+
+    /// @brief Submit background work to the process default engine, to be run in slices on the update thread
+    /// after the layers and windows updated and the frame was rendered or handed to the render thread, until the
+    /// frame's remaining time is spent. At least one slice runs per update while work is
+    /// waiting, so work is never starved when the frame has no time left. Safe to call from any thread.
+    /// @param task The background work. A task throwing is logged as an error, counted as failed and dropped.
+    /// @param priority The priority of the work.
+    CELERIQUE_SHARED_SYMBOL void submitBackgroundTask(
+        BackgroundTask&& task, BackgroundPriority priority = CELERIQUE_BACKGROUND_PRIORITY_NORMAL
+    );
+    /// @brief The statistics of the process default engine's background work scheduler.
+    /// @return A copy of the statistics.
+    CELERIQUE_SHARED_SYMBOL BackgroundSchedulerStats backgroundSchedulerStats();
+}
+#endif
+// End C++ Only Region.
+
+#endif
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
@@ -0,0 +1,221 @@
+/*
+
+File: ./include/celerique/bridge.h
+Author: Aldhinn Espinas
+Description: This header file contains the shared memory event rings connecting an engine to other
+    local processes, such as test drivers and editor tools.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#if !defined(CELERIQUE_BRIDGE_HEADER_FILE)
+#define CELERIQUE_BRIDGE_HEADER_FILE
+
+#include <celerique/defines.h>
+#include <celerique/types.h>
+#include <celerique/events.h>
+
+/// @brief The size in bytes of an event record's payload, so a whole record fills a cache line.
+#define CELERIQUE_BRIDGE_EVENT_PAYLOAD_SIZE                                                 56
+
+/// @brief The identifier of an event type in event records, the same in every process.
+typedef uint16_t CeleriqueBridgeEventType;
+/// @brief A null value for `CeleriqueBridgeEventType`.
+#define CELERIQUE_BRIDGE_EVENT_TYPE_NULL                                                    0x0000
+/// @brief `event::KeyboardKeyPressed`.
+#define CELERIQUE_BRIDGE_EVENT_TYPE_KEYBOARD_KEY_PRESSED                                    0x0001
+/// @brief `event::KeyboardKeyReleased`.
+#define CELERIQUE_BRIDGE_EVENT_TYPE_KEYBOARD_KEY_RELEASED                                   0x0002
+/// @brief `event::MouseMoved`.
+#define CELERIQUE_BRIDGE_EVENT_TYPE_MOUSE_MOVED                                             0x0003
+/// @brief `event::MouseClicked`.
+#define CELERIQUE_BRIDGE_EVENT_TYPE_MOUSE_CLICKED                                           0x0004
+/// @brief `event::MouseReleased`.
+#define CELERIQUE_BRIDGE_EVENT_TYPE_MOUSE_RELEASED                                          0x0005
+/// @brief `event::MouseScrolled`.
+#define CELERIQUE_BRIDGE_EVENT_TYPE_MOUSE_SCROLLED                                          0x0006
+/// @brief `event::WindowResize`.
+#define CELERIQUE_BRIDGE_EVENT_TYPE_WINDOW_RESIZE                                           0x0007
+/// @brief `event::WindowMove`.
+#define CELERIQUE_BRIDGE_EVENT_TYPE_WINDOW_MOVE                                             0x0008
+/// @brief `event::WindowClose`.
+#define CELERIQUE_BRIDGE_EVENT_TYPE_WINDOW_CLOSE                                            0x0009
+/// @brief `event::WindowRequestClose`.
+#define CELERIQUE_BRIDGE_EVENT_TYPE_WINDOW_REQUEST_CLOSE                                    0x000A
+/// @brief `event::WindowMinimized`.
+#define CELERIQUE_BRIDGE_EVENT_TYPE_WINDOW_MINIMIZED                                        0x000B
+/// @brief `event::WindowFocused`.
+#define CELERIQUE_BRIDGE_EVENT_TYPE_WINDOW_FOCUSED                                          0x000C
+/// @brief `event::EngineShutdown`.
+#define CELERIQUE_BRIDGE_EVENT_TYPE_ENGINE_SHUTDOWN                                         0x000D
+/// @brief `event::AssetLoaded`.
+#define CELERIQUE_BRIDGE_EVENT_TYPE_ASSET_LOADED                                            0x000E
+/// @brief `event::AssetLoadFailed`.
+#define CELERIQUE_BRIDGE_EVENT_TYPE_ASSET_LOAD_FAILED                                       0x000F
+/// @brief The first identifier available to application defined event types.
+#define CELERIQUE_BRIDGE_EVENT_TYPE_CUSTOM                                                  0x0100
+
+// Begin C++ Only Region.
+#if defined(__cplusplus)
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <typeindex>
+#include <type_traits>
+
+namespace celerique {
+    /// @brief The identifier of an event type in event records, the same in every process.
+    typedef CeleriqueBridgeEventType BridgeEventType;
+    /// @brief Type for a byte character.
+    typedef CeleriqueByte Byte;
+
+    /// @brief An event serialized into a fixed size record, copied as is between processes.
+    struct BridgeEventRecord {
+        /// @brief The type of the event.
+        BridgeEventType type = CELERIQUE_BRIDGE_EVENT_TYPE_NULL;
+        /// @brief The number of payload bytes used.
+        uint16_t payloadSize = 0;
+        /// @brief The window the event came from in the engine's process, `CELERIQUE_WINDOW_ID_NULL` if none.
+        WindowID sourceWindowId = CELERIQUE_WINDOW_ID_NULL;
+        /// @brief The event's fields, one after the other.
+        Byte arrPayload[CELERIQUE_BRIDGE_EVENT_PAYLOAD_SIZE];
+
+        /// @brief Append a field to the payload.
+        /// @tparam T The trivially copyable type of the field.
+        /// @param value The value of the field.
+        /// @return `false` if the payload is full.
+        template<typename T>
+        inline bool write(const T& value) {
+            static_assert(::std::is_trivially_copyable<T>::value, "Only trivially copyable fields can be written.");
+            if (payloadSize + sizeof(T) > CELERIQUE_BRIDGE_EVENT_PAYLOAD_SIZE) return false;
+            ::std::memcpy(arrPayload + payloadSize, &value, sizeof(T));
+            payloadSize += static_cast<uint16_t>(sizeof(T));
+            return true;
+        }
+        /// @brief Read the next field of the payload.
+        /// @tparam T The trivially copyable type of the field.
+        /// @param offset The offset of the field, advanced past it.
+        /// @param value Receives the value of the field.
+        /// @return `false` if the payload holds no such field.
+        template<typename T>
+        inline bool read(size_t& offset, T& value) const {
+            static_assert(::std::is_trivially_copyable<T>::value, "Only trivially copyable fields can be read.");
+            if (offset + sizeof(T) > payloadSize) return false;
+            ::std::memcpy(&value, arrPayload + offset, sizeof(T));
+            offset += sizeof(T);
+            return true;
+        }
+    };
+
+    /// @brief Writes the fields of an event into a record's payload.
+    /// Returns `false` if the event cannot be serialized.
+    using BridgeEventSerializer = ::std::function<bool(const EventBase&, BridgeEventRecord&)>;
+    /// @brief Creates an event from a record's payload. Returns null for malformed payloads.
+    using BridgeEventDeserializer = ::std::function<::std::shared_ptr<EventBase>(const BridgeEventRecord&)>;
+
+    /// @brief Register how an application defined event type crosses processes. Every process
+    /// must register the same types under the same identifiers. The engine's own events are registered already.
+    /// @param type The identifier of the event type, from `CELERIQUE_BRIDGE_EVENT_TYPE_CUSTOM` on.
+    /// @param typeId The type of the event, as returned by its `typeID`.
+    /// @param serializer Writes the event's fields.
+    /// @param deserializer Creates the event from the fields.
+    CELERIQUE_SHARED_SYMBOL void registerBridgeEventType(
+        BridgeEventType type, ::std::type_index typeId,
+        BridgeEventSerializer&& serializer, BridgeEventDeserializer&& deserializer
+    );
+    /// @brief Serialize an event into a record.
+    /// @param event The event to be serialized.
+    /// @param record The record to be overwritten.
+    /// @return `false` if the event's type is not registered or its fields do not fit.
+    CELERIQUE_SHARED_SYMBOL bool serializeBridgeEvent(const EventBase& event, BridgeEventRecord& record);
+    /// @brief Create the event a record holds.
+    /// @param record The record.
+    /// @return The shared pointer to the event, or null if the type is not registered or the payload is malformed.
+    CELERIQUE_SHARED_SYMBOL ::std::shared_ptr<EventBase> deserializeBridgeEvent(const BridgeEventRecord& record);
+
+    /// @brief A single producer, single consumer ring of event records in named shared memory, so one process
+    /// writes and another reads without locking or copying through the kernel. A side waiting on an empty or
+    /// full ring sleeps on a futex in the shared memory and is woken by the other side (polling where futexes
+    /// are not available).
+    class CELERIQUE_SHARED_SYMBOL SharedEventRing final {
+    public:
+        /// @brief Append a record without waiting. Called by the producer only.
+        /// @param record The record.
+        /// @return `false` if the ring is full.
+        bool tryPush(const BridgeEventRecord& record);
+        /// @brief Append a record, waiting for space if the ring is full. Called by the producer only.
+        /// @param record The record.
+        /// @param timeout How long to wait at most.
+        /// @return `false` if the ring stayed full.
+        bool push(const BridgeEventRecord& record, ::std::chrono::nanoseconds timeout);
+        /// @brief Take the oldest record without waiting. Called by the consumer only.
+        /// @param record Receives the record.
+        /// @return `false` if the ring is empty.
+        bool tryPop(BridgeEventRecord& record);
+        /// @brief Take the oldest record, waiting for one if the ring is empty. Called by the consumer only.
+        /// @param record Receives the record.
+        /// @param timeout How long to wait at most.
+        /// @return `false` if the ring stayed empty.
+        bool pop(BridgeEventRecord& record, ::std::chrono::nanoseconds timeout);
+
+        /// @brief The number of records the ring holds at most.
+        /// @return The capacity, a power of 2.
+        uint32_t capacity() const;
+        /// @brief The number of records waiting. Only exact when called by the producer or the consumer.
+        /// @return The number of records.
+        uint32_t size() const;
+        /// @brief The name of the shared memory.
+        /// @return The const reference to `_name`.
+        inline const ::std::string& name() const { return _name; }
+
+        /// @brief Member init constructor. Use `createEventRing` or `openEventRing` instead.
+        /// @param ptrMapping The pointer to the start of the mapped shared memory.
+        /// @param mappingSize The size of the mapping.
+        /// @param name The name of the shared memory.
+        /// @param isOwner Whether the shared memory is removed with this instance.
+        SharedEventRing(Byte* ptrMapping, size_t mappingSize, const ::std::string& name, bool isOwner);
+
+    // Private member variables.
+    private:
+        /// @brief The pointer to the start of the mapped shared memory.
+        Byte* _ptrMapping;
+        /// @brief The size of the mapping.
+        size_t _mappingSize;
+        /// @brief The name of the shared memory.
+        ::std::string _name;
+        /// @brief Whether the shared memory is removed with this instance.
+        bool _isOwner;
+
+    public:
+        /// @brief Destructor. Unmaps the shared memory, removing its name if this instance created it.
+        ~SharedEventRing();
+
+        /// @brief Prevent copying.
+        SharedEventRing(const SharedEventRing&) = delete;
+        /// @brief Prevent moving.
+        SharedEventRing(SharedEventRing&&) = delete;
+        /// @brief Prevent copy re-assignment.
+        SharedEventRing& operator=(const SharedEventRing&) = delete;
+        /// @brief Prevent move re-assignment.
+        SharedEventRing& operator=(SharedEventRing&&) = delete;
+    };
+
+    /// @brief Create a named shared memory event ring. The name is removed once the returned ring is destroyed.
+    /// @param name The name of the shared memory, such as `/my-game-input`.
+    /// @param capacity The number of records the ring holds at most, rounded up to a power of 2.
+    /// @return The shared pointer to the ring, or `nullptr` if it could not be created.
+    CELERIQUE_SHARED_SYMBOL ::std::shared_ptr<SharedEventRing> createEventRing(const ::std::string& name, uint32_t capacity);
+    /// @brief Open a shared memory event ring created by another process.
+    /// @param name The name of the shared memory.
+    /// @return The shared pointer to the ring, or `nullptr` if it does not exist or is not an event ring.
+    CELERIQUE_SHARED_SYMBOL ::std::shared_ptr<SharedEventRing> openEventRing(const ::std::string& name);
+}
+#endif
+// End C++ Only Region.
+
+#endif
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
@@ -0,0 +1,164 @@
+/*
+
+File: ./include/celerique/broadphase.h
+Author: Aldhinn Espinas
+Description: This header file contains the collision broadphase interfaces.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#if !defined(CELERIQUE_BROADPHASE_HEADER_FILE)
+#define CELERIQUE_BROADPHASE_HEADER_FILE
+
+#include <celerique/defines.h>
+#include <celerique/types.h>
+#include <celerique/math.h>
+
+/// @brief The unique identifier of a body within a broadphase.
+typedef uint32_t CeleriqueBroadphaseBodyID;
+/// @brief A null value for `CeleriqueBroadphaseBodyID`.
+#define CELERIQUE_BROADPHASE_BODY_ID_NULL                                                   0
+
+/// @brief The algorithm a broadphase uses to find overlapping bodies.
+typedef uint8_t CeleriqueBroadphaseMethod;
+/// @brief A null value for `CeleriqueBroadphaseMethod`.
+#define CELERIQUE_BROADPHASE_METHOD_NULL                                                    0x00
+/// @brief Sweep and prune along the x axis, re-sorted incrementally every update.
+/// Best for bodies of widely varying sizes.
+#define CELERIQUE_BROADPHASE_METHOD_SWEEP_AND_PRUNE                                         0x01
+/// @brief A uniform grid of hashed cells. Best for many similarly sized bodies.
+#define CELERIQUE_BROADPHASE_METHOD_SPATIAL_HASH                                            0x02
+
+// Begin C++ Only Region.
+#if defined(__cplusplus)
+#include <vector>
+
+namespace celerique {
+    /// @brief The unique identifier of a body within a broadphase.
+    typedef CeleriqueBroadphaseBodyID BroadphaseBodyID;
+    /// @brief The algorithm a broadphase uses to find overlapping bodies.
+    typedef CeleriqueBroadphaseMethod BroadphaseMethod;
+
+    /// @brief Two bodies whose bounding boxes overlap. `bodyA` is always less than `bodyB`.
+    struct BroadphasePair {
+        /// @brief The body with the smaller unique identifier.
+        BroadphaseBodyID bodyA;
+        /// @brief The body with the larger unique identifier.
+        BroadphaseBodyID bodyB;
+
+        /// @brief Order pairs by `bodyA` then `bodyB`.
+        inline bool operator<(const BroadphasePair& other) const {
+            return bodyA < other.bodyA || (bodyA == other.bodyA && bodyB < other.bodyB);
+        }
+        /// @brief Compare two pairs for equality.
+        inline bool operator==(const BroadphasePair& other) const {
+            return bodyA == other.bodyA && bodyB == other.bodyB;
+        }
+    };
+
+    /// @brief Finds the pairs of bodies whose bounding boxes overlap, generating them in parallel
+    /// on the job workers, and keeps the pairs of the previous update to report what changed.
+    class CELERIQUE_SHARED_SYMBOL Broadphase final {
+    public:
+        /// @brief Add a body.
+        /// @param bounds The bounding box of the body.
+        /// @return The unique identifier of the body.
+        BroadphaseBodyID addBody(const Aabb3& bounds);
+        /// @brief Remove a body. Its pairs are reported as removed by the next `update`.
+        /// @param bodyId The unique identifier of the body.
+        void removeBody(BroadphaseBodyID bodyId);
+        /// @brief Move a body.
+        /// @param bodyId The unique identifier of the body.
+        /// @param bounds The new bounding box of the body.
+        void updateBody(BroadphaseBodyID bodyId, const Aabb3& bounds);
+        /// @brief Determines whether a body exists.
+        /// @param bodyId The unique identifier of the body.
+        /// @return `true` if the body exists.
+        bool contains(BroadphaseBodyID bodyId) const;
+        /// @brief The bounding box of a body.
+        /// @param bodyId The unique identifier of the body.
+        /// @return The bounding box.
+        Aabb3 bounds(BroadphaseBodyID bodyId) const;
+        /// @brief The number of bodies in the broadphase.
+        /// @return The number of bodies.
+        inline size_t numBodies() const { return _numBodies; }
+        /// @brief The algorithm used to find overlapping bodies.
+        /// @return The value of `_method`.
+        inline BroadphaseMethod method() const { return _method; }
+
+        /// @brief Find every overlapping pair and compare them with the pairs of the previous update.
+        /// @return The number of overlapping pairs.
+        size_t update();
+        /// @brief The overlapping pairs as of the last `update`, sorted.
+        /// @return The const reference to `_vecPairs`.
+        inline const ::std::vector<BroadphasePair>& pairs() const { return _vecPairs; }
+        /// @brief The pairs that started overlapping in the last `update`, sorted.
+        /// @return The const reference to `_vecAddedPairs`.
+        inline const ::std::vector<BroadphasePair>& addedPairs() const { return _vecAddedPairs; }
+        /// @brief The pairs that stopped overlapping (or lost a body) in the last `update`, sorted.
+        /// @return The const reference to `_vecRemovedPairs`.
+        inline const ::std::vector<BroadphasePair>& removedPairs() const { return _vecRemovedPairs; }
+
+    // Private helper functions.
+    private:
+        /// @brief The slot of a body in the body arrays.
+        /// @param bodyId The unique identifier of the body.
+        /// @return The slot, or `noSlot` if the body does not exist.
+        uint32_t slotOf(BroadphaseBodyID bodyId) const;
+        /// @brief Find the overlapping pairs by sweeping the bodies sorted along the x axis.
+        void sweepAndPrune();
+        /// @brief Find the overlapping pairs by sorting the bodies into grid cells.
+        void spatialHash();
+
+    // Private member variables.
+    private:
+        /// @brief The slot value meaning "none".
+        static constexpr uint32_t noSlot = UINT32_MAX;
+
+        /// @brief The algorithm used to find overlapping bodies.
+        BroadphaseMethod _method;
+        /// @brief The edge length of a grid cell.
+        float _cellSize;
+        /// @brief The number of bodies in the broadphase.
+        size_t _numBodies = 0;
+        /// @brief The bounding box of each slot, 6 floats each (min x, y, z then max x, y, z).
+        ::std::vector<float> _vecBounds;
+        /// @brief Whether each slot holds a body.
+        ::std::vector<uint8_t> _vecIsAlive;
+        /// @brief Free slots, to be reused.
+        ::std::vector<uint32_t> _vecFreeSlots;
+        /// @brief Slots of bodies removed since the last update. They are not reused until then
+        /// so their pairs are reported as removed rather than mistaken for a new body's.
+        ::std::vector<uint32_t> _vecPendingFreeSlots;
+        /// @brief The slots of the bodies sorted by the minimum x of their bounding boxes.
+        ::std::vector<uint32_t> _vecSortedSlots;
+        /// @brief The number of slots appended to `_vecSortedSlots` since the last update.
+        size_t _numUnsortedSlots = 0;
+        /// @brief The pairs found by each batch of bodies.
+        ::std::vector<::std::vector<BroadphasePair>> _vecBatchPairs;
+        /// @brief The overlapping pairs as of the last update.
+        ::std::vector<BroadphasePair> _vecPairs;
+        /// @brief The overlapping pairs as of the update before the last one.
+        ::std::vector<BroadphasePair> _vecPreviousPairs;
+        /// @brief The pairs that started overlapping in the last update.
+        ::std::vector<BroadphasePair> _vecAddedPairs;
+        /// @brief The pairs that stopped overlapping in the last update.
+        ::std::vector<BroadphasePair> _vecRemovedPairs;
+
+    public:
+        /// @brief Member init constructor.
+        /// @param method The algorithm used to find overlapping bodies.
+        /// @param cellSize The edge length of a grid cell, for the spatial hash method.
+        /// Best set to about the size of a typical body.
+        Broadphase(
+            BroadphaseMethod method = CELERIQUE_BROADPHASE_METHOD_SWEEP_AND_PRUNE, float cellSize = 1.0f
+        );
+    };
+}
+#endif
+// End C++ Only Region.
+
+#endif
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
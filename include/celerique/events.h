@@ -44,6 +44,12 @@ typedef uint8_t CeleriqueEventHandlingStrategy;
 /// @brief Spawn a separate thread to handle the event.
 #define CELERIQUE_EVENT_HANDLING_STRATEGY_ASYNC                                 0x02
 
+/// @brief The unique identifier of a graphical user interface window within the process.
+typedef uint32_t CeleriqueWindowID;
+
+/// @brief A null value for `CeleriqueWindowID`. Events not coming from a window carry it.
+#define CELERIQUE_WINDOW_ID_NULL                                                0
+
 // Begin C++ Only Region.
 #if defined(__cplusplus)
 #include <functional>
@@ -60,6 +66,9 @@ namespace celerique {
     /// @brief The way of handling events.
     typedef CeleriqueEventHandlingStrategy EventHandlingStrategy;
 
+    /// @brief The unique identifier of a graphical user interface window within the process.
+    typedef CeleriqueWindowID WindowID;
+
     /// @brief Base Event type.
     class EventBase {
     public:
@@ -78,10 +87,26 @@ namespace celerique {
         /// @return The type of the event.
         virtual ::std::type_index typeID() const = 0;
 
+        /// @brief The window this event came from.
+        /// @return `_sourceWindowId` value. `CELERIQUE_WINDOW_ID_NULL` if it did not come from a window.
+        inline WindowID sourceWindowId() const { return _sourceWindowId; }
+        /// @brief Set the window this event came from. Windows set it when broadcasting.
+        /// @param sourceWindowId The identifier of the window.
+        inline void setSourceWindowId(WindowID sourceWindowId) { _sourceWindowId = sourceWindowId; }
+        /// @brief Whether this event was injected by another process through an event bridge.
+        /// @return `_isBridged` value.
+        inline bool isBridged() const { return _isBridged; }
+        /// @brief Mark this event as injected through an event bridge. Bridges set it before broadcasting.
+        inline void markBridged() { _isBridged = true; }
+
     protected:
         /// @brief Atomic container for the state that determines
         /// whether or not this event should propagate.
         ::std::atomic<bool> _atomicShouldPropagate = true;
+        /// @brief The identifier of the window this event came from.
+        WindowID _sourceWindowId = CELERIQUE_WINDOW_ID_NULL;
+        /// @brief Whether this event was injected by another process through an event bridge.
+        bool _isBridged = false;
 
     public:
         /// @brief Pure virtual destructor.
@@ -91,6 +116,62 @@ namespace celerique {
     /// @brief The type of an event handler.
     using EventHandler = ::std::function<void(::std::shared_ptr<EventBase>)>;
 
+    /// @brief A contiguous run of events of the same type, in the order they were broadcast.
+    class EventSpan final {
+    public:
+        /// @brief The type of every event in the span.
+        /// @return `_typeId` value.
+        inline ::std::type_index typeID() const { return _typeId; }
+        /// @brief Whether the events are of a specific type.
+        /// @tparam TEvent The type of event to be checked.
+        /// @return `true` if every event in the span is a `TEvent`.
+        template<typename TEvent>
+        inline bool is() const { return ::std::type_index(typeid(TEvent)) == _typeId; }
+        /// @brief The number of events.
+        /// @return `_numEvents` value.
+        inline size_t size() const { return _numEvents; }
+        /// @brief The first event.
+        /// @return The pointer to the first event pointer.
+        inline const ::std::shared_ptr<EventBase>* begin() const { return _ptrEvents; }
+        /// @brief Past the last event.
+        /// @return The pointer past the last event pointer.
+        inline const ::std::shared_ptr<EventBase>* end() const { return _ptrEvents + _numEvents; }
+        /// @brief An event of the span.
+        /// @param index The index of the event.
+        /// @return The const reference to the shared pointer to the event.
+        inline const ::std::shared_ptr<EventBase>& operator[](size_t index) const { return _ptrEvents[index]; }
+        /// @brief An event of the span as its concrete type. Check the type with `is` first.
+        /// @tparam TEvent The type of every event in the span.
+        /// @param index The index of the event.
+        /// @return The reference to the event.
+        template<typename TEvent>
+        inline TEvent& get(size_t index) const {
+            static_assert(
+                ::std::is_base_of<::celerique::EventBase, TEvent>::value,
+                "TEvent must be derived from `::celerique::EventBase`"
+            );
+            // Events derive virtually from `EventBase`, which rules out a static cast.
+            return dynamic_cast<TEvent&>(*_ptrEvents[index]);
+        }
+
+    // Private member variables.
+    private:
+        /// @brief The type of every event in the span.
+        ::std::type_index _typeId;
+        /// @brief The pointer to the first event pointer.
+        const ::std::shared_ptr<EventBase>* _ptrEvents;
+        /// @brief The number of events.
+        size_t _numEvents;
+
+    public:
+        /// @brief Member init constructor.
+        /// @param typeId The type of every event in the span.
+        /// @param ptrEvents The pointer to the first event pointer.
+        /// @param numEvents The number of events.
+        inline EventSpan(::std::type_index typeId, const ::std::shared_ptr<EventBase>* ptrEvents, size_t numEvents) :
+        _typeId(typeId), _ptrEvents(ptrEvents), _numEvents(numEvents) {}
+    };
+
     /// @brief A template class for an event dispatcher.
     class EventDispatcher final {
     public:
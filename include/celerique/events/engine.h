@@ -13,6 +13,7 @@ License: Mozilla Public License 2.0. (See ./LICENSE).
 
 #include <celerique/defines.h>
 #include <celerique/events.h>
+#include <celerique/assets.h>
 
 // Begin C++ Only Region.
 #if defined(__cplusplus)
@@ -30,6 +31,44 @@ namespace celerique { namespace event {
     public:
         CELERIQUE_IMPL_EVENT(EngineShutdown, CELERIQUE_EVENT_CATEGORY_ENGINE);
     };
+
+    /// @brief An event type regarding an asset that finished loading.
+    class CELERIQUE_SHARED_SYMBOL AssetLoaded final : public virtual event::Engine,
+    public virtual EventBase {
+    public:
+        /// @brief Init constructor.
+        /// @param assetId The identifier of the asset that finished loading.
+        inline AssetLoaded(AssetID assetId) : _assetId(assetId) {}
+
+        /// @brief The identifier of the asset that finished loading.
+        /// @return `_assetId` value.
+        inline AssetID assetId() const { return _assetId; }
+
+        CELERIQUE_IMPL_EVENT(AssetLoaded, CELERIQUE_EVENT_CATEGORY_ENGINE);
+
+    private:
+        /// @brief The identifier of the asset that finished loading.
+        AssetID _assetId;
+    };
+
+    /// @brief An event type regarding an asset that could not be read or decoded.
+    class CELERIQUE_SHARED_SYMBOL AssetLoadFailed final : public virtual event::Engine,
+    public virtual EventBase {
+    public:
+        /// @brief Init constructor.
+        /// @param assetId The identifier of the asset that failed to load.
+        inline AssetLoadFailed(AssetID assetId) : _assetId(assetId) {}
+
+        /// @brief The identifier of the asset that failed to load.
+        /// @return `_assetId` value.
+        inline AssetID assetId() const { return _assetId; }
+
+        CELERIQUE_IMPL_EVENT(AssetLoadFailed, CELERIQUE_EVENT_CATEGORY_ENGINE);
+
+    private:
+        /// @brief The identifier of the asset that failed to load.
+        AssetID _assetId;
+    };
 }}
 #endif
 // End C++ Only Region.
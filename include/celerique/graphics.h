@@ -34,6 +34,7 @@ typedef uint8_t CeleriqueUiProtocol;
 #include <unordered_map>
 #include <memory>
 #include <string>
+#include <chrono>
 
 namespace celerique {
     /// @brief The interface to the specific graphics API.
@@ -52,8 +53,24 @@ namespace celerique {
         /// @param ptrGraphicsApi 
         virtual void useGraphicsApi(::std::shared_ptr<IGraphicsAPI> ptrGraphicsApi);
 
+        /// @brief The unique identifier of this window within the process.
+        /// @return `_windowId` value.
+        inline WindowID windowId() const { return _windowId; }
+
+    protected:
+        /// @brief Dispatch event to the listeners, marking this window as its source
+        /// unless the event already carries one.
+        /// @param ptrEvent The pointer to the event to be dispatched.
+        /// @param strategy The dispatch strategy (blocking by default.)
+        void broadcast(
+            const ::std::shared_ptr<EventBase>& ptrEvent,
+            EventHandlingStrategy strategy = CELERIQUE_EVENT_HANDLING_STRATEGY_BLOCKING
+        );
+
     // Protected member variables.
     protected:
+        /// @brief The unique identifier of this window within the process.
+        const WindowID _windowId;
         /// @brief The UI protocol used to create UI elements.
         UiProtocol _uiProtocol = CELERIQUE_UI_PROTOCOL_NULL;
         /// @brief The handle to the window according to UI protocol.
@@ -62,10 +79,30 @@ namespace celerique {
         ::std::weak_ptr<IGraphicsAPI> _weakPtrGraphicsApi;
 
     public:
+        /// @brief Default constructor. Assigns the next unique window identifier.
+        WindowBase();
         /// @brief Virtual destructor.
         virtual ~WindowBase();
     };
 
+    /// @brief The statistics of the command buffers cached for unchanged draws.
+    struct CommandBufferCacheStats {
+        /// @brief The number of frames whose commands were recorded.
+        uint64_t numFramesRecorded = 0;
+        /// @brief The number of frames that replayed commands recorded by an earlier frame.
+        uint64_t numFramesReplayed = 0;
+        /// @brief The average CPU time a frame spends recording its commands.
+        ::std::chrono::nanoseconds averageRecordTime = ::std::chrono::nanoseconds::zero();
+        /// @brief The average CPU time a recorded frame spends uploading its mesh.
+        ::std::chrono::nanoseconds averageMeshUploadTime = ::std::chrono::nanoseconds::zero();
+        /// @brief The average CPU time a replayed frame spends checking that nothing changed.
+        ::std::chrono::nanoseconds averageReplayTime = ::std::chrono::nanoseconds::zero();
+        /// @brief The CPU time saved by each replayed frame, the average record and mesh upload times less the average replay time.
+        ::std::chrono::nanoseconds savedTimePerFrame = ::std::chrono::nanoseconds::zero();
+        /// @brief The CPU time saved by every replayed frame so far.
+        ::std::chrono::nanoseconds totalSavedTime = ::std::chrono::nanoseconds::zero();
+    };
+
     /// @brief The interface to the specific graphics API.
     class IGraphicsAPI : public virtual IGpuResources {
     public:
@@ -96,9 +133,12 @@ namespace celerique {
         /// @param numVertexElements The number of individual vertices to draw.
         /// @param ptrVertexBuffer The pointer to the vertex buffer.
         /// @param ptrIndexBuffer The pointer to the index buffer.
+        /// @param drawVersion The version of the vertices and indices, changed by the caller whenever their contents
+        /// change. Cached commands are only reused for the same version. 0 when unversioned, never reused.
         virtual void draw(
             PipelineConfigID graphicsPipelineConfigId, size_t numVerticesToDraw, size_t vertexStride = 0,
-            size_t numVertexElements = 0, void* ptrVertexBuffer = nullptr, uint32_t* ptrIndexBuffer = nullptr
+            size_t numVertexElements = 0, void* ptrVertexBuffer = nullptr, uint32_t* ptrIndexBuffer = nullptr,
+            uint64_t drawVersion = 0
         ) = 0;
 
         /// @brief Add the window handle to the graphics API.
@@ -112,6 +152,20 @@ namespace celerique {
         /// @param windowHandle The handle to the window of which swapchain to re-create.
         virtual void reCreateSwapChain(Pointer windowHandle) = 0;
 
+        /// @brief Reuse the commands recorded for a draw while its pipeline, draw version and target image
+        /// stay the same, instead of recording them every frame. Data changing every
+        /// frame is expected to be passed through uniforms. Does nothing unless the graphics API supports it.
+        /// @param isEnabled Whether to cache recorded commands.
+        virtual void setCommandBufferCaching(bool isEnabled);
+        /// @brief The statistics of the command buffers cached for unchanged draws.
+        /// @return A copy of the statistics. All zero unless the graphics API supports caching.
+        virtual CommandBufferCacheStats commandBufferCacheStats();
+        /// @brief Render each draw once into an offscreen image, then scale it into every window sharing
+        /// a device, submitting and presenting all of them together. Windows keep the scene's aspect ratio.
+        /// Does nothing unless the graphics API supports it.
+        /// @param isEnabled Whether windows share one rendering of the scene.
+        virtual void setSharedSceneRendering(bool isEnabled);
+
     public:
         /// @brief Pure virtual destructor.
         virtual ~IGraphicsAPI() = 0;
@@ -0,0 +1,101 @@
+/*
+
+File: ./include/celerique/jobs.h
+Author: Aldhinn Espinas
+Description: This header file contains interfaces to the engine's job workers.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#if !defined(CELERIQUE_JOBS_HEADER_FILE)
+#define CELERIQUE_JOBS_HEADER_FILE
+
+#include <celerique/defines.h>
+#include <celerique/types.h>
+
+// Begin C++ Only Region.
+#if defined(__cplusplus)
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <deque>
+
+namespace celerique {
+    /// @brief The type of a unit of work to be executed by a worker thread.
+    using Job = ::std::function<void()>;
+    /// @brief The type of work done over the range of item indices `[begin, end)`.
+    using RangeJob = ::std::function<void(size_t begin, size_t end)>;
+
+    /// @brief A fixed size collection of worker threads consuming a first-in-first-out job queue.
+    class CELERIQUE_SHARED_SYMBOL ThreadPool final {
+    public:
+        /// @brief Member init constructor.
+        /// @param numWorkers The number of worker threads to be spawned.
+        /// Defaults to the number of hardware threads when set to 0.
+        ThreadPool(size_t numWorkers = 0);
+
+        /// @brief Submit a job to be executed by one of the worker threads.
+        /// @param job The job to be executed.
+        void submit(Job&& job);
+        /// @brief Block the calling thread until the job queue is empty and no job is executing.
+        void waitIdle();
+        /// @brief The number of worker threads.
+        /// @return The size of `_vecWorkerThreads`.
+        size_t numWorkers() const;
+
+    // Private helper functions.
+    private:
+        /// @brief The routine each worker thread runs until the pool is destroyed.
+        void workerLoop();
+
+    // Private member variables.
+    private:
+        /// @brief The worker threads.
+        ::std::vector<::std::thread> _vecWorkerThreads;
+        /// @brief The queue of jobs waiting to be executed.
+        ::std::deque<Job> _queueJobs;
+        /// @brief The mutex for `_queueJobs`, `_numRunningJobs` and `_shouldStop`.
+        ::std::mutex _jobsMutex;
+        /// @brief Notified when a job is submitted or when the pool is stopping.
+        ::std::condition_variable _condVarJobAvailable;
+        /// @brief Notified when the pool runs out of work.
+        ::std::condition_variable _condVarIdle;
+        /// @brief The number of jobs currently being executed.
+        size_t _numRunningJobs = 0;
+        /// @brief The state that indicates if the worker threads should exit.
+        bool _shouldStop = false;
+
+    public:
+        /// @brief Destructor. Finishes queued jobs before joining the worker threads.
+        ~ThreadPool();
+
+        /// @brief Prevent copying.
+        ThreadPool(const ThreadPool&) = delete;
+        /// @brief Prevent moving.
+        ThreadPool(ThreadPool&&) = delete;
+        /// @brief Prevent copy re-assignment.
+        ThreadPool& operator=(const ThreadPool&) = delete;
+        /// @brief Prevent move re-assignment.
+        ThreadPool& operator=(ThreadPool&&) = delete;
+    };
+
+    /// @brief Gets the engine-wide pool of job workers used for CPU bound work.
+    /// @return The reference to the job worker thread pool.
+    CELERIQUE_SHARED_SYMBOL ThreadPool& getJobWorkers();
+    /// @brief Split `numItems` into batches and run them across the job workers.
+    /// The calling thread works on batches too, so it is safe to call from a job worker.
+    /// Returns once every batch finished, re-throwing the first exception thrown by a batch.
+    /// @param numItems The number of items to be processed.
+    /// @param batchSize The maximum number of items per batch.
+    /// @param rangeJob The work done for each batch.
+    CELERIQUE_SHARED_SYMBOL void parallelFor(size_t numItems, size_t batchSize, const RangeJob& rangeJob);
+}
+#endif
+// End C++ Only Region.
+
+#endif
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
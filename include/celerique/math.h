@@ -15,6 +15,22 @@ License: Mozilla Public License 2.0. (See ./LICENSE).
 #include <celerique/logging.h>
 #include <celerique/types.h>
 
+/// @brief The type of the matrix storage order identifier.
+typedef uint8_t CeleriqueMatrixStorageOrder;
+/// @brief Row-major storage: the elements of each row are contiguous.
+#define CELERIQUE_MATRIX_STORAGE_ORDER_ROW_MAJOR                                            0x01
+/// @brief Column-major storage: the elements of each column are contiguous, as GLSL expects by default.
+#define CELERIQUE_MATRIX_STORAGE_ORDER_COLUMN_MAJOR                                         0x02
+
+/// @brief The type of the procedural noise type identifier.
+typedef uint8_t CeleriqueNoiseType;
+/// @brief Value noise: random values at the lattice points, smoothly interpolated.
+#define CELERIQUE_NOISE_TYPE_VALUE                                                          0x01
+/// @brief Perlin noise: random gradients at the lattice points, smoothly interpolated.
+#define CELERIQUE_NOISE_TYPE_PERLIN                                                         0x02
+/// @brief Simplex noise: random gradients at the corners of a simplex grid, summed with radial falloff.
+#define CELERIQUE_NOISE_TYPE_SIMPLEX                                                        0x03
+
 // Begin C++ Only Region.
 #if defined(__cplusplus)
 #include <utility>
@@ -27,12 +43,16 @@ License: Mozilla Public License 2.0. (See ./LICENSE).
 namespace celerique {
     /// @brief A value of this type describes the size of a stack allocated array.
     typedef CeleriqueArraySize ArraySize;
+    /// @brief The matrix storage order identifier.
+    typedef CeleriqueMatrixStorageOrder MatrixStorageOrder;
 
     /// @brief A template class for a static m by n matrix of `TData` data type.
     /// @tparam TData The type of each element in this matrix.
     /// @tparam numRows The number of row vectors.
     /// @tparam numCols The number of column vectors.
-    template<ArraySize numRows, ArraySize numCols, typename TData>
+    /// @tparam storageOrder The order of the elements in memory.
+    template<ArraySize numRows, ArraySize numCols, typename TData,
+    MatrixStorageOrder storageOrder = CELERIQUE_MATRIX_STORAGE_ORDER_ROW_MAJOR>
     class Matrix;
 
     /// @brief A template class for a static n-dimensional vector of `TData` data type.
@@ -148,12 +168,13 @@ namespace celerique {
         /// @tparam T The type of each element in this matrix.
         /// @tparam R The number of row vectors.
         /// @tparam C The number of column vectors.
+        /// @tparam S The storage order of the matrix.
         /// @param leftMat The left-hand side matrix.
         /// @param rightVec The right-hand side vector.
         /// @return The resulting dot product vector.
-        template<ArraySize R, ArraySize C, typename T>
+        template<ArraySize R, ArraySize C, typename T, MatrixStorageOrder S>
         friend ::celerique::Vec<R, T> operator*(
-            const ::celerique::Matrix<R, C, T>& leftMat,
+            const ::celerique::Matrix<R, C, T, S>& leftMat,
             const ::celerique::Vec<C, T>& rightVec
         );
     };
@@ -216,13 +237,16 @@ namespace celerique {
     /// @tparam TData The type of each element in this matrix.
     /// @tparam numRows The number of row vectors.
     /// @tparam numCols The number of column vectors.
-    template<ArraySize numRows, ArraySize numCols, typename TData>
+    /// @tparam storageOrder The order of the elements in memory. Column-major matrices can be
+    /// written into GPU buffers verbatim for GLSL, which reads matrices column by column.
+    template<ArraySize numRows, ArraySize numCols, typename TData, MatrixStorageOrder storageOrder>
     class Matrix final {
     public:
         /// @brief Initializer list constructor.
-        /// @param rowVectors The list of row vectors the data is going to be initialized with.
+        /// @param rowVectors The list of row vectors the data is going to be initialized with,
+        /// whatever the storage order.
         inline Matrix(const ::std::initializer_list<::std::initializer_list<TData>>& rowVectors = {}) {
-            if (rowVectors.size() > numCols) {
+            if (rowVectors.size() > numRows) {
                 ::std::string errorMessage = "Cannot initialize a " + ::std::to_string(numRows) +
                     "x" + ::std::to_string(numCols) + " matrix with more than " +
                     ::std::to_string(numRows) + " row vectors.";
@@ -240,15 +264,36 @@ namespace celerique {
                     celeriqueLogError(errorMessage);
                     throw ::std::out_of_range(errorMessage);
                 }
-                // Copy rowVec to _data.
-                auto endOfDataWithValuesIterator = ::std::copy(rowVec.begin(), rowVec.end(), _data[rowIndex]);
-                // Store zeros if the values provided are not sufficient to fill.
-                ::std::fill(endOfDataWithValuesIterator, ::std::end(_data[rowIndex]), static_cast<TData>(0));
+                if (!isColumnMajor) {
+                    // Copy rowVec to _data.
+                    auto endOfDataWithValuesIterator = ::std::copy(rowVec.begin(), rowVec.end(), _data[rowIndex]);
+                    // Store zeros if the values provided are not sufficient to fill.
+                    ::std::fill(endOfDataWithValuesIterator, ::std::end(_data[rowIndex]), static_cast<TData>(0));
+                } else {
+                    // Scatter rowVec across the columns, storing zeros past its end.
+                    ArraySize colIndex = 0;
+                    for (TData value : rowVec) _data[colIndex++][rowIndex] = value;
+                    for (; colIndex < numCols; colIndex++) _data[colIndex][rowIndex] = static_cast<TData>(0);
+                }
                 // Track row index being assigned.
                 rowIndex++;
             }
             // Store zeros if there aren't enough row vectors provided to fill the matrix.
-            ::std::fill(::std::begin(_data[rowIndex]), ::std::end(_data[numRows - 1]), static_cast<TData>(0));
+            for (; rowIndex < numRows; rowIndex++) {
+                for (ArraySize colIndex = 0; colIndex < numCols; colIndex++) element(rowIndex, colIndex) = static_cast<TData>(0);
+            }
+        }
+        /// @brief Storage order conversion constructor. This is where the transpose happens,
+        /// once, rather than on every upload.
+        /// @tparam otherStorageOrder The storage order of the other matrix.
+        /// @param other The matrix with the same elements in the other storage order.
+        template<MatrixStorageOrder otherStorageOrder>
+        inline explicit Matrix(const Matrix<numRows, numCols, TData, otherStorageOrder>& other) {
+            for (ArraySize rowIndex = 0; rowIndex < numRows; rowIndex++) {
+                for (ArraySize colIndex = 0; colIndex < numCols; colIndex++) {
+                    element(rowIndex, colIndex) = other(rowIndex, colIndex);
+                }
+            }
         }
 
         /// @brief The number of row vectors.
@@ -260,6 +305,18 @@ namespace celerique {
         /// @brief The number of elements this matrix has.
         /// @return The size value.
         inline static ArraySize size() { return numRows * numCols; }
+        /// @brief The order of the elements in memory.
+        /// @return `storageOrder` value.
+        inline static constexpr MatrixStorageOrder order() { return storageOrder; }
+        /// @brief Determines whether the memory of this matrix matches a GLSL matrix of the same
+        /// dimensions in a std140 (or std430) buffer: column-major, with 16 byte columns.
+        /// @return `true` if the matrix can be copied into the buffer verbatim.
+        inline static constexpr bool isStd140Layout() {
+            return isColumnMajor && ::std::is_same<TData, float>::value && numRows * sizeof(TData) == 16;
+        }
+        /// @brief The elements in storage order, for copying into GPU buffers.
+        /// @return The pointer to the `size()` elements.
+        inline const TData* data() const { return _data[0]; }
         /// @brief Reset the data with a specified value.
         /// @param value (default 0). The specified value to be set for all members.
         inline void reset(TData value = static_cast<TData>(0)) {
@@ -277,7 +334,7 @@ namespace celerique {
                 celeriqueLogError(errorMessage);
                 throw ::std::out_of_range(errorMessage);
             }
-            return _data[rowIndex][colIndex];
+            return element(rowIndex, colIndex);
         }
         /// @brief Get the reference to the element in the specified indices.
         /// @param rowIndex The row index to be accessed.
@@ -291,7 +348,7 @@ namespace celerique {
                 celeriqueLogError(errorMessage);
                 throw ::std::out_of_range(errorMessage);
             }
-            return _data[rowIndex][colIndex];
+            return element(rowIndex, colIndex);
         }
 
     // Copy constructors and assignment operators.
@@ -309,10 +366,30 @@ namespace celerique {
             return *this;
         }
 
+    // Private helper functions.
+    private:
+        /// @brief Get the reference to an element without bounds checking.
+        /// @param rowIndex The row index.
+        /// @param colIndex The column index.
+        /// @return The reference to the element.
+        inline TData& element(ArraySize rowIndex, ArraySize colIndex) {
+            return isColumnMajor ? _data[colIndex][rowIndex] : _data[rowIndex][colIndex];
+        }
+        /// @brief Get the reference to an element without bounds checking.
+        /// @param rowIndex The row index.
+        /// @param colIndex The column index.
+        /// @return The const reference to the element.
+        inline const TData& element(ArraySize rowIndex, ArraySize colIndex) const {
+            return isColumnMajor ? _data[colIndex][rowIndex] : _data[rowIndex][colIndex];
+        }
+
     // Private member variables.
     private:
-        /// @brief The stack allocated container for the data.
-        TData _data[numRows][numCols];
+        /// @brief Whether the elements of each column are contiguous.
+        static constexpr bool isColumnMajor = storageOrder == CELERIQUE_MATRIX_STORAGE_ORDER_COLUMN_MAJOR;
+        /// @brief The stack allocated container for the data, indexed by row then column,
+        /// or by column then row if column-major.
+        TData _data[isColumnMajor ? numCols : numRows][isColumnMajor ? numRows : numCols];
 
     public:
         // `TData` restrictions.
@@ -326,6 +403,12 @@ namespace celerique {
             (numRows >= 2 || numRows >= 2) && numRows > 0 && numCols > 0,
             "1x1 or 0x0 matrices are non-sense."
         );
+        // `storageOrder` restrictions.
+        static_assert(
+            storageOrder == CELERIQUE_MATRIX_STORAGE_ORDER_ROW_MAJOR ||
+            storageOrder == CELERIQUE_MATRIX_STORAGE_ORDER_COLUMN_MAJOR,
+            "Matrices are stored row-major or column-major."
+        );
 
     // Friend methods.
     public:
@@ -333,25 +416,27 @@ namespace celerique {
         /// @tparam T The type of each element in this matrix.
         /// @tparam R The number of row vectors.
         /// @tparam C The number of column vectors.
+        /// @tparam S The storage order of the matrix.
         /// @param leftMat The left-hand side matrix.
         /// @param rightVec The right-hand side vector.
         /// @return The resulting dot product vector.
-        template<ArraySize R, ArraySize C, typename T>
+        template<ArraySize R, ArraySize C, typename T, MatrixStorageOrder S>
         friend ::celerique::Vec<R, T> operator*(
-            const ::celerique::Matrix<R, C, T>& leftMat,
+            const ::celerique::Matrix<R, C, T, S>& leftMat,
             const ::celerique::Vec<C, T>& rightVec
         );
         /// @brief The equality operation.
         /// @tparam T The type of each element in this matrix.
         /// @tparam R The number of row vectors.
         /// @tparam C The number of column vectors.
+        /// @tparam S The storage order of the matrices.
         /// @param leftMat The left-hand side matrix.
         /// @param rightMat The right-hand side matrix.
         /// @return The equality value.
-        template<ArraySize R, ArraySize C, typename T>
+        template<ArraySize R, ArraySize C, typename T, MatrixStorageOrder S>
         friend bool operator==(
-            const ::celerique::Matrix<R, C, T>& leftMat,
-            const ::celerique::Matrix<R, C, T>& rightMat
+            const ::celerique::Matrix<R, C, T, S>& leftMat,
+            const ::celerique::Matrix<R, C, T, S>& rightMat
         );
         /// @brief The dot product operation between a matrix and another matrix.
         /// @tparam TData The type of each element in this matrix.
@@ -359,14 +444,15 @@ namespace celerique {
         /// @tparam numColsLeft The number of column vectors on the left-hand side matrix.
         /// @tparam numRowsRight The number of row vectors on the right-hand side matrix.
         /// @tparam numColsRight The number of column vectors on the right-hand side matrix.
+        /// @tparam S The storage order of the matrices.
         /// @param leftMat The left-hand side matrix.
         /// @param rightMat The right-hand side matrix.
         /// @return The resulting dot product matrix.
         template<ArraySize numRowsLeft, ArraySize numColsLeft,
-        ArraySize numRowsRight, ArraySize numColsRight, typename T>
-        friend ::celerique::Matrix<numRowsLeft, numColsRight, T> operator*(
-            const ::celerique::Matrix<numRowsLeft, numColsLeft, T>& leftMat,
-            const ::celerique::Matrix<numRowsRight, numColsRight, T>& rightMat
+        ArraySize numRowsRight, ArraySize numColsRight, typename T, MatrixStorageOrder S>
+        friend ::celerique::Matrix<numRowsLeft, numColsRight, T, S> operator*(
+            const ::celerique::Matrix<numRowsLeft, numColsLeft, T, S>& leftMat,
+            const ::celerique::Matrix<numRowsRight, numColsRight, T, S>& rightMat
         );
     };
 
@@ -376,21 +462,48 @@ namespace celerique {
     typedef Matrix<3, 3, float> Mat3x3;
     /// @brief A 4x4 float matrix.
     typedef Matrix<4, 4, float> Mat4x4;
+    /// @brief A 2x2 float matrix stored column-major.
+    typedef Matrix<2, 2, float, CELERIQUE_MATRIX_STORAGE_ORDER_COLUMN_MAJOR> ColumnMajorMat2x2;
+    /// @brief A 3x3 float matrix stored column-major.
+    typedef Matrix<3, 3, float, CELERIQUE_MATRIX_STORAGE_ORDER_COLUMN_MAJOR> ColumnMajorMat3x3;
+    /// @brief A 4x4 float matrix stored column-major, the memory layout of a GLSL `mat4` in any buffer.
+    typedef Matrix<4, 4, float, CELERIQUE_MATRIX_STORAGE_ORDER_COLUMN_MAJOR> ColumnMajorMat4x4;
+
+    // GLSL pads every column of a `mat2` or `mat3` to 16 bytes in std140 buffers,
+    // so only 4-row matrices can be written verbatim.
+    static_assert(
+        sizeof(ColumnMajorMat4x4) == 64 && ColumnMajorMat4x4::isStd140Layout(),
+        "A column-major 4x4 float matrix must match the std140 layout of a GLSL mat4."
+    );
+    static_assert(
+        !ColumnMajorMat3x3::isStd140Layout() && !Mat4x4::isStd140Layout(),
+        "Only column-major matrices with 16 byte columns match the std140 layout."
+    );
 
     /// @brief The dot product operation between a matrix and a vector.
     /// @tparam TData The type of each element in this matrix.
     /// @tparam numRows The number of row vectors.
     /// @tparam numCols The number of column vectors.
+    /// @tparam storageOrder The storage order of the matrix.
     /// @param leftMat The left-hand side matrix.
     /// @param rightVec The right-hand side vector.
     /// @return The resulting dot product vector.
-    template<ArraySize numRows, ArraySize numCols, typename TData>
+    template<ArraySize numRows, ArraySize numCols, typename TData, MatrixStorageOrder storageOrder>
     inline ::celerique::Vec<numRows, TData> operator*(
-        const ::celerique::Matrix<numRows, numCols, TData>& leftMat,
+        const ::celerique::Matrix<numRows, numCols, TData, storageOrder>& leftMat,
         const ::celerique::Vec<numCols, TData>& rightVec
     ) {
         // The container for the resulting dot product.
         ::celerique::Vec<numRows, TData> product;
+        if (storageOrder == CELERIQUE_MATRIX_STORAGE_ORDER_COLUMN_MAJOR) {
+            // Sum the column vectors scaled by the vector's components.
+            for (ArraySize colIndex = 0; colIndex < numCols; colIndex++) {
+                for (ArraySize rowIndex = 0; rowIndex < numRows; rowIndex++) {
+                    product._data[rowIndex] += leftMat._data[colIndex][rowIndex] * rightVec._data[colIndex];
+                }
+            }
+            return product;
+        }
         // Iterate over all the row vectors and get the dot product with the vector.
         for (ArraySize rowIndex = 0; rowIndex < numRows; rowIndex++) {
             // Iterate over the columns and dot product with the vector and sum their component products.
@@ -409,14 +522,15 @@ namespace celerique {
     /// @tparam numColsLeft The number of column vectors on the left-hand side matrix.
     /// @tparam numRowsRight The number of row vectors on the right-hand side matrix.
     /// @tparam numColsRight The number of column vectors on the right-hand side matrix.
+    /// @tparam storageOrder The storage order of the matrices.
     /// @param leftMat The left-hand side matrix.
     /// @param rightMat The right-hand side matrix.
     /// @return The resulting dot product matrix.
     template<ArraySize numRowsLeft, ArraySize numColsLeft,
-    ArraySize numRowsRight, ArraySize numColsRight, typename TData>
-    inline ::celerique::Matrix<numRowsLeft, numColsRight, TData> operator*(
-        const ::celerique::Matrix<numRowsLeft, numColsLeft, TData>& leftMat,
-        const ::celerique::Matrix<numRowsRight, numColsRight, TData>& rightMat
+    ArraySize numRowsRight, ArraySize numColsRight, typename TData, MatrixStorageOrder storageOrder>
+    inline ::celerique::Matrix<numRowsLeft, numColsRight, TData, storageOrder> operator*(
+        const ::celerique::Matrix<numRowsLeft, numColsLeft, TData, storageOrder>& leftMat,
+        const ::celerique::Matrix<numRowsRight, numColsRight, TData, storageOrder>& rightMat
     ) {
         static_assert(
             numColsLeft == numRowsRight,
@@ -425,7 +539,21 @@ namespace celerique {
         );
 
         // The container for the resulting dot product.
-        ::celerique::Matrix<numRowsLeft, numColsRight, TData> matrixProduct;
+        ::celerique::Matrix<numRowsLeft, numColsRight, TData, storageOrder> matrixProduct;
+        if (storageOrder == CELERIQUE_MATRIX_STORAGE_ORDER_COLUMN_MAJOR) {
+            // Each column of the product is a linear combination of the left-hand side columns.
+            matrixProduct.reset();
+            for (ArraySize colIndex = 0; colIndex < numColsRight; colIndex++) {
+                for (ArraySize i = 0; i < numRowsRight; i++) {
+                    /// @brief The weight of the left-hand side column.
+                    TData weight = rightMat._data[colIndex][i];
+                    for (ArraySize rowIndex = 0; rowIndex < numRowsLeft; rowIndex++) {
+                        matrixProduct._data[colIndex][rowIndex] += leftMat._data[i][rowIndex] * weight;
+                    }
+                }
+            }
+            return matrixProduct;
+        }
         // Iterate over the product indices.
         for (ArraySize rowIndex = 0; rowIndex < numRowsLeft; rowIndex++) {
             for (ArraySize colIndex = 0; colIndex < numColsRight; colIndex++) {
@@ -448,17 +576,18 @@ namespace celerique {
     /// @tparam TData The type of each element in this matrix.
     /// @tparam numRows The number of row vectors.
     /// @tparam numCols The number of column vectors.
+    /// @tparam storageOrder The storage order of the matrices.
     /// @param leftMat The left-hand side matrix.
     /// @param rightMat The right-hand side matrix.
     /// @return The equality value.
-    template<ArraySize numRows, ArraySize numCols, typename TData>
+    template<ArraySize numRows, ArraySize numCols, typename TData, MatrixStorageOrder storageOrder>
     inline bool operator==(
-        const ::celerique::Matrix<numRows, numCols, TData>& leftMat,
-        const ::celerique::Matrix<numRows, numCols, TData>& rightMat
+        const ::celerique::Matrix<numRows, numCols, TData, storageOrder>& leftMat,
+        const ::celerique::Matrix<numRows, numCols, TData, storageOrder>& rightMat
     ) {
         // Iterate over each others's component values and compare.
         return ::std::equal(
-            ::std::begin(leftMat._data[0]), ::std::end(leftMat._data[numRows-1]),
+            leftMat.data(), leftMat.data() + numRows * numCols,
             ::std::begin(rightMat._data[0])
         );
     }
@@ -467,16 +596,140 @@ namespace celerique {
     /// @tparam TData The type of each element in this matrix.
     /// @tparam numRows The number of row vectors.
     /// @tparam numCols The number of column vectors.
+    /// @tparam storageOrder The storage order of the matrices.
     /// @param leftMat The left-hand side matrix.
     /// @param rightMat The right-hand side matrix.
     /// @return The inequality value.
-    template<ArraySize numRows, ArraySize numCols, typename TData>
+    template<ArraySize numRows, ArraySize numCols, typename TData, MatrixStorageOrder storageOrder>
     inline bool operator!=(
-        const ::celerique::Matrix<numRows, numCols, TData>& leftMat,
-        const ::celerique::Matrix<numRows, numCols, TData>& rightMat
+        const ::celerique::Matrix<numRows, numCols, TData, storageOrder>& leftMat,
+        const ::celerique::Matrix<numRows, numCols, TData, storageOrder>& rightMat
     ) {
         return !(leftMat == rightMat);
     }
+
+    /// @brief An n-dimensional axis-aligned bounding box of `TData` data type.
+    /// @tparam numDimensions The number of dimensions.
+    /// @tparam TData The type of each coordinate.
+    template<ArraySize numDimensions, typename TData>
+    struct AxisAlignedBox final {
+        /// @brief The corner with the smallest coordinates.
+        Vec<numDimensions, TData> min;
+        /// @brief The corner with the largest coordinates.
+        Vec<numDimensions, TData> max;
+
+        /// @brief Determines whether this box overlaps another one. Touching boxes overlap.
+        /// @param other The other box.
+        /// @return `true` if the boxes overlap.
+        inline bool overlaps(const AxisAlignedBox& other) const {
+            for (ArraySize i = 0; i < numDimensions; i++) {
+                if (min[i] > other.max[i] || other.min[i] > max[i]) return false;
+            }
+            return true;
+        }
+        /// @brief Determines whether a point is inside this box. Points on the boundary are inside.
+        /// @param point The point.
+        /// @return `true` if the point is inside.
+        inline bool contains(const Vec<numDimensions, TData>& point) const {
+            for (ArraySize i = 0; i < numDimensions; i++) {
+                if (point[i] < min[i] || point[i] > max[i]) return false;
+            }
+            return true;
+        }
+    };
+
+    /// @brief A 2D axis-aligned bounding box of floats.
+    typedef AxisAlignedBox<2, float> Aabb2;
+    /// @brief A 3D axis-aligned bounding box of floats.
+    typedef AxisAlignedBox<3, float> Aabb3;
+
+    /// @brief A counter-based random number generator (Philox4x32-10). Every block of 4 values
+    /// is a pure function of the seed, the stream and the block's index, so generators can be
+    /// copied, skipped ahead or split into streams across threads and stay reproducible.
+    class CELERIQUE_SHARED_SYMBOL CounterRandom final {
+    public:
+        /// @brief Generate 4 random integers.
+        /// @param ptrOut The destination receiving 4 integers.
+        void nextUint4(uint32_t* ptrOut);
+        /// @brief Generate 4 random floats in [0, 1).
+        /// @param ptrOut The destination receiving 4 floats.
+        void nextFloat4(float* ptrOut);
+        /// @brief Generate many random integers, 4 blocks at a time. The values are the same
+        /// as calling `nextUint4` repeatedly.
+        /// @param ptrOut The destination.
+        /// @param count The number of integers. The generator advances by whole blocks.
+        void fillUint(uint32_t* ptrOut, size_t count);
+        /// @brief Generate many random floats in [0, 1), 4 blocks at a time. The values are the
+        /// same as calling `nextFloat4` repeatedly.
+        /// @param ptrOut The destination.
+        /// @param count The number of floats. The generator advances by whole blocks.
+        void fillFloat(float* ptrOut, size_t count);
+
+        /// @brief The index of the next block of 4 values.
+        /// @return The value of `_counter`.
+        inline uint64_t counter() const { return _counter; }
+        /// @brief Skip to a block of 4 values.
+        /// @param counter The index of the next block.
+        inline void seek(uint64_t counter) { _counter = counter; }
+
+        /// @brief Run the Philox4x32-10 bijection.
+        /// @param ptrCounter The 4 integers of the counter.
+        /// @param ptrKey The 2 integers of the key.
+        /// @param ptrOut The destination receiving 4 integers.
+        static void philox(const uint32_t* ptrCounter, const uint32_t* ptrKey, uint32_t* ptrOut);
+
+    // Private member variables.
+    private:
+        /// @brief The key, from the seed.
+        uint32_t _arrKey[2];
+        /// @brief The stream, the upper half of every counter.
+        uint64_t _stream;
+        /// @brief The index of the next block, the lower half of the counter.
+        uint64_t _counter = 0;
+
+    public:
+        /// @brief Member init constructor.
+        /// @param seed The seed.
+        /// @param stream The stream. Different streams of the same seed never overlap.
+        CounterRandom(uint64_t seed, uint64_t stream = 0);
+    };
+
+    /// @brief The procedural noise type identifier.
+    typedef CeleriqueNoiseType NoiseType;
+
+    /// @brief The layering of fractal Brownian motion (fBm): octaves of noise at rising
+    /// frequencies and falling amplitudes.
+    struct FbmConfig {
+        /// @brief The number of octaves.
+        uint32_t numOctaves = 5;
+        /// @brief The frequency multiplier between octaves.
+        float lacunarity = 2.0f;
+        /// @brief The amplitude multiplier between octaves.
+        float gain = 0.5f;
+    };
+
+    /// @brief Sample noise at 4 points at once.
+    /// @param type The noise type.
+    /// @param numDimensions The dimensions of the points: 2, 3 or 4.
+    /// @param ptrPoints The coordinates, one axis of the 4 points after the other
+    /// (x0 x1 x2 x3 y0 y1 y2 y3 ...), `4 * numDimensions` floats.
+    /// @param seed The seed. Different seeds give unrelated noise.
+    /// @param ptrOut The destination receiving 4 values in [-1, 1].
+    CELERIQUE_SHARED_SYMBOL void sampleNoise(
+        NoiseType type, ArraySize numDimensions, const float* ptrPoints, uint32_t seed, float* ptrOut
+    );
+    /// @brief Sample fractal Brownian motion at 4 points at once.
+    /// @param type The noise type of every octave.
+    /// @param numDimensions The dimensions of the points: 2, 3 or 4.
+    /// @param ptrPoints The coordinates, one axis of the 4 points after the other
+    /// (x0 x1 x2 x3 y0 y1 y2 y3 ...), `4 * numDimensions` floats.
+    /// @param seed The seed. Each octave uses a different seed derived from it.
+    /// @param config The layering of the octaves.
+    /// @param ptrOut The destination receiving 4 values in [-1, 1].
+    CELERIQUE_SHARED_SYMBOL void sampleFbm(
+        NoiseType type, ArraySize numDimensions, const float* ptrPoints, uint32_t seed,
+        const FbmConfig& config, float* ptrOut
+    );
 }
 
 /// @brief The dot product operation.
@@ -525,12 +778,13 @@ inline bool operator!=(
 /// @tparam TData The type of each element in this matrix.
 /// @tparam numRows The number of row vectors.
 /// @tparam numCols The number of column vectors.
+/// @tparam storageOrder The storage order of the matrix.
 /// @param leftMat The left-hand side matrix.
 /// @param rightVec The right-hand side vector.
 /// @return The resulting dot product vector.
-template<CeleriqueArraySize numRows, CeleriqueArraySize numCols, typename TData>
+template<CeleriqueArraySize numRows, CeleriqueArraySize numCols, typename TData, CeleriqueMatrixStorageOrder storageOrder>
 inline ::celerique::Vec<numRows, TData> operator*(
-    const ::celerique::Matrix<numRows, numCols, TData>& leftMat,
+    const ::celerique::Matrix<numRows, numCols, TData, storageOrder>& leftMat,
     const ::celerique::Vec<numCols, TData>& rightVec
 ) {
     return ::celerique::operator*(leftMat, rightVec);
@@ -542,14 +796,15 @@ inline ::celerique::Vec<numRows, TData> operator*(
 /// @tparam numColsLeft The number of column vectors on the left-hand side matrix.
 /// @tparam numRowsRight The number of row vectors on the right-hand side matrix.
 /// @tparam numColsRight The number of column vectors on the right-hand side matrix.
+/// @tparam storageOrder The storage order of the matrices.
 /// @param leftMat The left-hand side matrix.
 /// @param rightMat The right-hand side matrix.
 /// @return The resulting dot product matrix.
 template<CeleriqueArraySize numRowsLeft, CeleriqueArraySize numColsLeft,
-CeleriqueArraySize numRowsRight, CeleriqueArraySize numColsRight, typename TData>
-inline ::celerique::Matrix<numRowsLeft, numColsRight, TData> operator*(
-    const ::celerique::Matrix<numRowsLeft, numColsLeft, TData>& leftMat,
-    const ::celerique::Matrix<numRowsRight, numColsRight, TData>& rightMat
+CeleriqueArraySize numRowsRight, CeleriqueArraySize numColsRight, typename TData, CeleriqueMatrixStorageOrder storageOrder>
+inline ::celerique::Matrix<numRowsLeft, numColsRight, TData, storageOrder> operator*(
+    const ::celerique::Matrix<numRowsLeft, numColsLeft, TData, storageOrder>& leftMat,
+    const ::celerique::Matrix<numRowsRight, numColsRight, TData, storageOrder>& rightMat
 ) {
     return ::celerique::operator*(leftMat, rightMat);
 }
@@ -558,13 +813,14 @@ inline ::celerique::Matrix<numRowsLeft, numColsRight, TData> operator*(
 /// @tparam TData The type of each element in this matrix.
 /// @tparam numRows The number of row vectors.
 /// @tparam numCols The number of column vectors.
+/// @tparam storageOrder The storage order of the matrices.
 /// @param leftMat The left-hand side matrix.
 /// @param rightMat The right-hand side matrix.
 /// @return The equality value.
-template<CeleriqueArraySize numRows, CeleriqueArraySize numCols, typename TData>
+template<CeleriqueArraySize numRows, CeleriqueArraySize numCols, typename TData, CeleriqueMatrixStorageOrder storageOrder>
 inline bool operator==(
-    const ::celerique::Matrix<numRows, numCols, TData>& leftMat,
-    const ::celerique::Matrix<numRows, numCols, TData>& rightMat
+    const ::celerique::Matrix<numRows, numCols, TData, storageOrder>& leftMat,
+    const ::celerique::Matrix<numRows, numCols, TData, storageOrder>& rightMat
 ) {
     return ::celerique::operator==(leftMat, rightMat);
 }
@@ -573,13 +829,14 @@ inline bool operator==(
 /// @tparam TData The type of each element in this matrix.
 /// @tparam numRows The number of row vectors.
 /// @tparam numCols The number of column vectors.
+/// @tparam storageOrder The storage order of the matrices.
 /// @param leftMat The left-hand side matrix.
 /// @param rightMat The right-hand side matrix.
 /// @return The inequality value.
-template<CeleriqueArraySize numRows, CeleriqueArraySize numCols, typename TData>
+template<CeleriqueArraySize numRows, CeleriqueArraySize numCols, typename TData, CeleriqueMatrixStorageOrder storageOrder>
 inline bool operator!=(
-    const ::celerique::Matrix<numRows, numCols, TData>& leftMat,
-    const ::celerique::Matrix<numRows, numCols, TData>& rightMat
+    const ::celerique::Matrix<numRows, numCols, TData, storageOrder>& leftMat,
+    const ::celerique::Matrix<numRows, numCols, TData, storageOrder>& rightMat
 ) {
     return ::celerique::operator!=(leftMat, rightMat);
 }
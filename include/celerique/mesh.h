@@ -0,0 +1,185 @@
+/*
+
+File: ./include/celerique/mesh.h
+Author: Aldhinn Espinas
+Description: This header file contains interfaces to the mesh importer.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#if !defined(CELERIQUE_MESH_HEADER_FILE)
+#define CELERIQUE_MESH_HEADER_FILE
+
+#include <celerique/defines.h>
+#include <celerique/types.h>
+#include <celerique/pipeline.h>
+
+/// @brief The file formats a mesh can be imported from.
+typedef uint8_t CeleriqueMeshFormat;
+/// @brief A null value for `CeleriqueMeshFormat`.
+#define CELERIQUE_MESH_FORMAT_NULL                                                          0x00
+/// @brief Wavefront OBJ (text).
+#define CELERIQUE_MESH_FORMAT_OBJ                                                           0x01
+/// @brief Binary glTF 2.0 (.glb).
+#define CELERIQUE_MESH_FORMAT_GLB                                                           0x02
+
+/// @brief The vertex attributes a mesh can carry.
+typedef uint8_t CeleriqueMeshAttributes;
+/// @brief No vertex attributes.
+#define CELERIQUE_MESH_ATTRIBUTE_NONE                                                       0x00
+/// @brief Vertex positions. Matched by input layouts named `"position"`.
+#define CELERIQUE_MESH_ATTRIBUTE_POSITION                                                   CELERIQUE_LEFT_BIT_SHIFT_1(0)
+/// @brief Vertex normals. Matched by input layouts named `"normal"`.
+#define CELERIQUE_MESH_ATTRIBUTE_NORMAL                                                     CELERIQUE_LEFT_BIT_SHIFT_1(1)
+/// @brief Texture coordinates. Matched by input layouts named `"texCoord"`.
+#define CELERIQUE_MESH_ATTRIBUTE_TEX_COORD                                                  CELERIQUE_LEFT_BIT_SHIFT_1(2)
+/// @brief Vertex colors. Matched by input layouts named `"color"`.
+#define CELERIQUE_MESH_ATTRIBUTE_COLOR                                                      CELERIQUE_LEFT_BIT_SHIFT_1(3)
+
+// Begin C++ Only Region.
+#if defined(__cplusplus)
+#include <list>
+#include <string>
+#include <vector>
+
+namespace celerique {
+    /// @brief The file formats a mesh can be imported from.
+    typedef CeleriqueMeshFormat MeshFormat;
+    /// @brief The vertex attributes a mesh can carry.
+    typedef CeleriqueMeshAttributes MeshAttributes;
+
+    /// @brief Parse the mesh format from the file extension.
+    /// @param filePath The file path string value.
+    /// @return The mesh format.
+    CELERIQUE_SHARED_SYMBOL MeshFormat fileExtToMeshFormat(const ::std::string& filePath);
+    /// @brief Generate tightly packed vertex input layouts for a set of attributes, in the order
+    /// position (3 floats), normal (3 floats), texture coordinate (2 floats) and color (4 floats).
+    /// @param attributes The attributes to generate layouts for.
+    /// @param bindingPoint The binding point of the vertex buffer.
+    /// @return The collection of input layouts with consecutive locations starting at 0.
+    CELERIQUE_SHARED_SYMBOL ::std::list<InputLayout> genMeshInputLayouts(
+        MeshAttributes attributes, size_t bindingPoint = 0
+    );
+
+    /// @brief Imports a mesh from an in-memory file into caller provided vertex and index memory
+    /// (for example a mapped staging buffer) without an intermediate vertex copy.
+    /// Parsing makes a fixed number of allocations regardless of the mesh size.
+    /// The file contents must outlive the importer.
+    class CELERIQUE_SHARED_SYMBOL MeshImporter final {
+    public:
+        /// @brief Parse a mesh file. For glTF only the first primitive of the first mesh is imported
+        /// and it has to be a triangle list stored in the binary chunk. OBJ faces are triangulated
+        /// as fans and every face corner becomes its own vertex.
+        /// @param ptrData The pointer to the file contents.
+        /// @param size The size of the file contents.
+        /// @param format The format of the file.
+        /// @return `true` if the mesh was parsed successfully.
+        bool parse(const Byte* ptrData, size_t size, MeshFormat format);
+
+        /// @brief The attributes present in the parsed mesh.
+        /// @return `_attributes` value.
+        inline MeshAttributes attributes() const { return _attributes; }
+        /// @brief The number of vertices in the parsed mesh.
+        /// @return `_numVertices` value.
+        inline size_t numVertices() const { return _numVertices; }
+        /// @brief The number of indices in the parsed mesh.
+        /// @return `_numIndices` value.
+        inline size_t numIndices() const { return _numIndices; }
+        /// @brief Generate input layouts matching the parsed mesh's attributes.
+        /// @param bindingPoint The binding point of the vertex buffer.
+        /// @return The collection of input layouts.
+        inline ::std::list<InputLayout> inputLayouts(size_t bindingPoint = 0) const {
+            return genMeshInputLayouts(_attributes, bindingPoint);
+        }
+
+        /// @brief The number of bytes `writeVertices` needs for a set of input layouts.
+        /// @param listInputLayouts The input layouts the vertices are written in.
+        /// @return The vertex buffer size.
+        size_t vertexBufferSize(const ::std::list<InputLayout>& listInputLayouts) const;
+        /// @brief Convert the vertices straight into the target input layouts. Layouts are matched
+        /// to attributes by name; attributes missing from the mesh are written as zeroes.
+        /// @param listInputLayouts The input layouts the vertices are written in.
+        /// @param ptrDst The destination memory.
+        /// @param dstCapacity The size of the destination memory.
+        /// @return `true` if every vertex was written.
+        bool writeVertices(const ::std::list<InputLayout>& listInputLayouts, void* ptrDst, size_t dstCapacity) const;
+        /// @brief Write the triangle list indices as 32-bit unsigned integers.
+        /// @param ptrDst The destination memory.
+        /// @param dstCapacity The size of the destination memory in bytes.
+        /// @return `true` if every index was written.
+        bool writeIndices(uint32_t* ptrDst, size_t dstCapacity) const;
+
+    // Nested types.
+    public:
+        /// @brief Where the values of a single attribute are read from.
+        struct AttributeSource {
+            /// @brief The pointer to the first value.
+            const Byte* ptrBase = nullptr;
+            /// @brief The distance in bytes between consecutive values.
+            size_t stride = 0;
+            /// @brief The glTF component type of the values (5126 for float).
+            uint32_t componentType = 0;
+            /// @brief The number of components per value.
+            size_t numComponents = 0;
+            /// @brief Whether integer components are normalized to `[0, 1]` or `[-1, 1]`.
+            bool isNormalized = false;
+            /// @brief The number of values.
+            size_t count = 0;
+        };
+
+    // Private helper functions.
+    private:
+        /// @brief Parse a binary glTF file.
+        /// @param ptrData The pointer to the file contents.
+        /// @param size The size of the file contents.
+        /// @return `true` if the mesh was parsed successfully.
+        bool parseGlb(const Byte* ptrData, size_t size);
+        /// @brief Parse a Wavefront OBJ file.
+        /// @param ptrData The pointer to the file contents.
+        /// @param size The size of the file contents.
+        /// @return `true` if the mesh was parsed successfully.
+        bool parseObj(const Byte* ptrData, size_t size);
+
+    // Private member variables.
+    private:
+        /// @brief The format of the parsed file.
+        MeshFormat _format = CELERIQUE_MESH_FORMAT_NULL;
+        /// @brief The attributes present in the parsed mesh.
+        MeshAttributes _attributes = CELERIQUE_MESH_ATTRIBUTE_NONE;
+        /// @brief The number of vertices in the parsed mesh.
+        size_t _numVertices = 0;
+        /// @brief The number of indices in the parsed mesh.
+        size_t _numIndices = 0;
+        /// @brief The sources of the position, normal, texture coordinate and color values.
+        AttributeSource _attributeSources[4];
+        /// @brief The source of glTF indices. Empty for non-indexed glTF primitives.
+        AttributeSource _indexSource;
+        /// @brief OBJ vertex positions (3 floats each).
+        ::std::vector<float> _vecObjPositions;
+        /// @brief OBJ vertex colors (3 floats each), present when positions carry 6 values.
+        ::std::vector<float> _vecObjColors;
+        /// @brief OBJ vertex normals (3 floats each).
+        ::std::vector<float> _vecObjNormals;
+        /// @brief OBJ texture coordinates (2 floats each).
+        ::std::vector<float> _vecObjTexCoords;
+        /// @brief OBJ face corners as (position, texture coordinate, normal) value indices (-1 if absent).
+        ::std::vector<int32_t> _vecObjCorners;
+        /// @brief OBJ triangles as corner indices.
+        ::std::vector<uint32_t> _vecObjTriangles;
+
+    public:
+        /// @brief Default constructor.
+        MeshImporter() = default;
+        /// @brief Prevent copying, the attribute sources point into this instance.
+        MeshImporter(const MeshImporter&) = delete;
+        /// @brief Prevent copy re-assignment.
+        MeshImporter& operator=(const MeshImporter&) = delete;
+    };
+}
+#endif
+// End C++ Only Region.
+
+#endif
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
@@ -0,0 +1,141 @@
+/*
+
+File: ./include/celerique/particles.h
+Author: Aldhinn Espinas
+Description: This header file contains the particle system interfaces.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#if !defined(CELERIQUE_PARTICLES_HEADER_FILE)
+#define CELERIQUE_PARTICLES_HEADER_FILE
+
+#include <celerique/defines.h>
+#include <celerique/types.h>
+#include <celerique/math.h>
+#include <celerique/pipeline.h>
+
+/// @brief The size of the instance data written per particle. (position, size, color).
+#define CELERIQUE_PARTICLE_INSTANCE_SIZE                                                    32
+
+// Begin C++ Only Region.
+#if defined(__cplusplus)
+#include <list>
+#include <vector>
+
+namespace celerique {
+    /// @brief Generate the per-instance input layouts of the data written by `ParticleEmitter::writeInstances`,
+    /// in the order position (3 floats), size (1 float) and color (4 floats).
+    /// @param bindingPoint The binding point of the instance buffer.
+    /// @return The collection of input layouts with consecutive locations starting at 0.
+    CELERIQUE_SHARED_SYMBOL ::std::list<InputLayout> genParticleInstanceLayouts(size_t bindingPoint = 0);
+
+    /// @brief How an emitter spawns and animates its particles.
+    struct ParticleEmitterConfig {
+        /// @brief Where particles are spawned.
+        Vec3 position = {0.0f, 0.0f, 0.0f};
+        /// @brief The smallest initial velocity along each axis.
+        Vec3 minVelocity = {-1.0f, -1.0f, -1.0f};
+        /// @brief The largest initial velocity along each axis.
+        Vec3 maxVelocity = {1.0f, 1.0f, 1.0f};
+        /// @brief The acceleration applied to every particle, such as gravity.
+        Vec3 acceleration = {0.0f, 0.0f, 0.0f};
+        /// @brief The shortest lifetime of a particle in seconds.
+        float minLifetime = 1.0f;
+        /// @brief The longest lifetime of a particle in seconds.
+        float maxLifetime = 1.0f;
+        /// @brief The number of particles spawned per second by `update`.
+        float emissionRate = 0.0f;
+        /// @brief The size of a particle when spawned.
+        float startSize = 1.0f;
+        /// @brief The size of a particle when it dies.
+        float endSize = 1.0f;
+        /// @brief The color of a particle when spawned.
+        Vec4 startColor = {1.0f, 1.0f, 1.0f, 1.0f};
+        /// @brief The color of a particle when it dies.
+        Vec4 endColor = {1.0f, 1.0f, 1.0f, 0.0f};
+        /// @brief The maximum number of live particles.
+        size_t maxParticles = 1024;
+        /// @brief The seed of the random initial velocities and lifetimes.
+        uint32_t seed = 0;
+    };
+
+    /// @brief A source of particles stored as one array per component, so the simulation runs
+    /// 4 particles at a time on the job workers and no per-particle code is ever dispatched.
+    class CELERIQUE_SHARED_SYMBOL ParticleEmitter final {
+    public:
+        /// @brief Spawn particles immediately, up to the maximum number of live particles.
+        /// @param numParticles The number of particles to be spawned.
+        /// @return The number of particles spawned.
+        size_t emit(size_t numParticles);
+        /// @brief Age, move and kill the live particles, then spawn new ones at the emission rate.
+        /// @param deltaTime The elapsed time in seconds.
+        /// @return The number of live particles.
+        size_t update(float deltaTime);
+        /// @brief Write the instance data of every live particle, `CELERIQUE_PARTICLE_INSTANCE_SIZE`
+        /// bytes each as laid out by `genParticleInstanceLayouts`, for one instanced draw.
+        /// @param ptrDst The destination, such as a mapped per-frame instance buffer. Must be 4 byte aligned.
+        /// @param dstCapacity The size of the destination in bytes.
+        /// @return `false` if the destination is too small.
+        bool writeInstances(void* ptrDst, size_t dstCapacity) const;
+
+        /// @brief The number of live particles.
+        /// @return The value of `_numParticles`.
+        inline size_t numParticles() const { return _numParticles; }
+        /// @brief The size of the instance data of every live particle.
+        /// @return The number of bytes `writeInstances` writes.
+        inline size_t instanceDataSize() const { return _numParticles * CELERIQUE_PARTICLE_INSTANCE_SIZE; }
+        /// @brief How the emitter spawns and animates its particles.
+        /// @return The const reference to `_config`.
+        inline const ParticleEmitterConfig& config() const { return _config; }
+        /// @brief Move the emitter. Live particles keep their positions.
+        /// @param position Where new particles are spawned.
+        inline void setPosition(const Vec3& position) { _config.position = position; }
+
+    // Private helper functions.
+    private:
+        /// @brief The array of a component of every particle.
+        /// @param buffer The index of the set of component arrays, 0 or 1.
+        /// @param component The component.
+        /// @return The pointer to the first particle's component.
+        inline float* componentArray(size_t buffer, size_t component) {
+            return _arrVecComponents[buffer].data() + component * _capacity;
+        }
+        /// @brief The array of a component of every live particle.
+        /// @param component The component.
+        /// @return The const pointer to the first particle's component.
+        inline const float* componentArray(size_t component) const {
+            return _arrVecComponents[_currentBuffer].data() + component * _capacity;
+        }
+
+    // Private member variables.
+    private:
+        /// @brief How the emitter spawns and animates its particles.
+        ParticleEmitterConfig _config;
+        /// @brief The number of particles each component array holds, rounded up to a multiple of 4.
+        size_t _capacity;
+        /// @brief The number of live particles.
+        size_t _numParticles = 0;
+        /// @brief The number of particles ever spawned, which seeds each particle's random values.
+        uint32_t _numEmitted = 0;
+        /// @brief The fraction of a particle left over by the emission rate.
+        float _emissionRemainder = 0.0f;
+        /// @brief Two sets of component arrays, `_capacity` floats per component.
+        /// Survivors are compacted from the current set into the other one.
+        ::std::vector<float> _arrVecComponents[2];
+        /// @brief The index of the current set of component arrays.
+        size_t _currentBuffer = 0;
+
+    public:
+        /// @brief Member init constructor.
+        /// @param config How the emitter spawns and animates its particles.
+        ParticleEmitter(const ParticleEmitterConfig& config = ParticleEmitterConfig());
+    };
+}
+#endif
+// End C++ Only Region.
+
+#endif
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
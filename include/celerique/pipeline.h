@@ -71,6 +71,13 @@ typedef uint8_t CeleriqueGpuBufferUsage;
 #define CELERIQUE_GPU_BUFFER_USAGE_INDEX                                                    CELERIQUE_LEFT_BIT_SHIFT_1(1)
 /// @brief Using the GPU buffer as a uniform buffer.
 #define CELERIQUE_GPU_BUFFER_USAGE_UNIFORM                                                  CELERIQUE_LEFT_BIT_SHIFT_1(2)
+/// @brief Using the GPU buffer as a storage buffer, read by shaders as a runtime sized array.
+#define CELERIQUE_GPU_BUFFER_USAGE_STORAGE                                                  CELERIQUE_LEFT_BIT_SHIFT_1(3)
+/// @brief The GPU buffer is rewritten by the CPU every frame. It stays mapped for its whole life and holds
+/// one copy per frame in flight, so CPU writes land directly in memory the GPU reads with no copy command.
+#define CELERIQUE_GPU_BUFFER_USAGE_DYNAMIC                                                  CELERIQUE_LEFT_BIT_SHIFT_1(4)
+/// @brief The number of copies of a dynamic GPU buffer. Frame `n` writes copy `n` modulo this number.
+#define CELERIQUE_GPU_BUFFER_NUM_DYNAMIC_COPIES                                             3
 
 /// @brief The type of the pipeline configuration unique identifier.
 typedef uintptr_t CeleriquePipelineConfigID;
@@ -87,6 +94,8 @@ typedef uintptr_t CeleriqueGpuBufferID;
 #include <unordered_map>
 #include <string>
 #include <list>
+#include <memory>
+#include <vector>
 
 namespace celerique {
     /// @brief The type of the pipeline configuration unique identifier.
@@ -108,6 +117,8 @@ namespace celerique {
     class ShaderProgram;
     /// @brief A layout of a particular shader input variable.
     struct InputLayout;
+    /// @brief A range of a GPU buffer to be overwritten with data from the CPU.
+    struct GpuBufferRegion;
     /// @brief The interface to the GPU resources and functionalities.
     class IGpuResources;
 
@@ -127,6 +138,11 @@ namespace celerique {
         /// @param size The size of the buffer containing the shader program.
         /// @param ptrBuffer The pointer to the heap allocated buffer containing the shader program.
         ShaderProgram(size_t size = 0, Byte* ptrBuffer = nullptr);
+        /// @brief Borrowing constructor. The buffer is not freed by this container.
+        /// @param size The size of the buffer containing the shader program.
+        /// @param ptrBuffer The pointer to the buffer containing the shader program.
+        /// @param ptrOwner The shared pointer to whatever owns the buffer, kept alive by this container.
+        ShaderProgram(size_t size, Byte* ptrBuffer, ::std::shared_ptr<const void>&& ptrOwner);
 
         /// @brief The size of the buffer containing the shader program.
         /// @return `_size` value.
@@ -144,6 +160,8 @@ namespace celerique {
         size_t _size;
         /// @brief The pointer to the heap allocated buffer containing the shader program.
         Byte* _ptrBuffer;
+        /// @brief The owner of a borrowed `_ptrBuffer`. `nullptr` if this container owns the buffer.
+        ::std::shared_ptr<const void> _ptrOwner;
 
     // Copying and moving.
     public:
@@ -243,6 +261,18 @@ namespace celerique {
         ShaderStage shaderStage = CELERIQUE_SHADER_STAGE_UNSPECIFIED;
     };
 
+    /// @brief A range of a GPU buffer to be overwritten with data from the CPU.
+    struct GpuBufferRegion {
+        /// @brief The unique identifier of the GPU buffer.
+        GpuBufferID bufferId = CELERIQUE_GPU_BUFFER_ID_NULL;
+        /// @brief The byte offset of the range within the GPU buffer.
+        size_t offset = 0;
+        /// @brief The pointer to where the data to be copied to the GPU resides.
+        const void* ptrDataSrc = nullptr;
+        /// @brief The size of the data to be copied.
+        size_t dataSize = 0;
+    };
+
     /// @brief The interface to the GPU resources and functionalities.
     class IGpuResources {
     public:
@@ -261,6 +291,28 @@ namespace celerique {
         /// @param ptrDataSrc The pointer to where the data to be copied to the GPU resides.
         /// @param dataSize The size of the data to be copied.
         virtual void copyToBuffer(GpuBufferID bufferId, void* ptrDataSrc, size_t dataSize) = 0;
+        /// @brief Copy data from the CPU to a range of the GPU buffer, keeping the rest of its data.
+        /// @param bufferId The unique identifier of the GPU buffer.
+        /// @param offset The byte offset of the range within the GPU buffer.
+        /// @param ptrDataSrc The pointer to where the data to be copied to the GPU resides.
+        /// @param dataSize The size of the data to be copied.
+        virtual void copyToBufferRegion(GpuBufferID bufferId, size_t offset, const void* ptrDataSrc, size_t dataSize);
+        /// @brief Copy data from the CPU to many ranges of GPU buffers at once, such as single instances out
+        /// of a large instance buffer. The ranges of a dynamic GPU buffer are written to the copy of the current frame,
+        /// which keeps the rest of the buffer's latest contents.
+        /// @param vecRegions The ranges to be overwritten. Ranges of the same buffer must not overlap.
+        virtual void copyToBufferRegions(const ::std::vector<GpuBufferRegion>& vecRegions);
+        /// @brief Get the pointer to the copy of a dynamic GPU buffer for the current frame, the frame ending
+        /// with the next draw that submits to a window. Every call within a frame returns the same copy, which
+        /// starts with the buffer's latest contents. Blocks until the GPU finished the last frame that read the copy.
+        /// @param bufferId The unique identifier of a GPU buffer created with `CELERIQUE_GPU_BUFFER_USAGE_DYNAMIC`.
+        /// @return The persistently mapped pointer to the copy, or `nullptr` if dynamic buffers are not supported.
+        virtual void* mapDynamicBuffer(GpuBufferID bufferId);
+        /// @brief Get the offset of the copy of a dynamic GPU buffer last written, the dynamic offset its
+        /// descriptor is bound with.
+        /// @param bufferId The unique identifier of a GPU buffer created with `CELERIQUE_GPU_BUFFER_USAGE_DYNAMIC`.
+        /// @return The byte offset of the copy within the buffer, or 0 if dynamic buffers are not supported.
+        virtual size_t dynamicBufferOffset(GpuBufferID bufferId);
         /// @brief Free the specified GPU buffer.
         /// @param bufferId The unique identifier of the GPU buffer.
         virtual void freeBuffer(GpuBufferID bufferId) = 0;
@@ -0,0 +1,135 @@
+/*
+
+File: ./include/celerique/recorder.h
+Author: Aldhinn Espinas
+Description: This header file contains the crash flight recorder, keeping the most recent log
+    records, frame boundaries and events of every thread in memory to be dumped when the process dies.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#if !defined(CELERIQUE_RECORDER_HEADER_FILE)
+#define CELERIQUE_RECORDER_HEADER_FILE
+
+#include <celerique/defines.h>
+#include <celerique/types.h>
+
+/// @brief What a flight record is about.
+typedef uint8_t CeleriqueFlightRecordKind;
+
+/// @brief A null value for `CeleriqueFlightRecordKind`.
+#define CELERIQUE_FLIGHT_RECORD_KIND_NULL                                                   0x00
+/// @brief A log record. The detail is its severity, the value its source line and the text its message.
+#define CELERIQUE_FLIGHT_RECORD_KIND_LOG                                                    0x01
+/// @brief An engine update starting. The value is the number of updates before it.
+#define CELERIQUE_FLIGHT_RECORD_KIND_FRAME                                                  0x02
+/// @brief An event reaching an engine. The detail is its category, the value its source window
+/// and the text its type name.
+#define CELERIQUE_FLIGHT_RECORD_KIND_EVENT                                                  0x03
+/// @brief The first kind free for application records.
+#define CELERIQUE_FLIGHT_RECORD_KIND_CUSTOM                                                 0x80
+
+/// @brief Why a flight recorder dump was written.
+typedef uint32_t CeleriqueFlightDumpReason;
+
+/// @brief The dump was asked for with `dumpFlightRecorder`.
+#define CELERIQUE_FLIGHT_DUMP_REASON_REQUESTED                                              0x00
+/// @brief A fatal message was logged.
+#define CELERIQUE_FLIGHT_DUMP_REASON_FATAL_LOG                                              0x01
+/// @brief `::std::terminate` was called, such as for an uncaught exception.
+#define CELERIQUE_FLIGHT_DUMP_REASON_TERMINATE                                              0x02
+/// @brief A fatal signal was raised, such as a segmentation fault.
+#define CELERIQUE_FLIGHT_DUMP_REASON_SIGNAL                                                 0x03
+
+/// @brief The number of text bytes a flight record holds. Longer texts are truncated.
+#define CELERIQUE_FLIGHT_RECORD_TEXT_SIZE                                                   104
+/// @brief The number of records kept per thread, a power of 2.
+#define CELERIQUE_FLIGHT_RECORDER_CAPACITY                                                  1024
+/// @brief The number of threads recording at once. Threads beyond it are not recorded.
+#define CELERIQUE_FLIGHT_RECORDER_MAX_THREADS                                               256
+
+// Begin C++ Only Region.
+#if defined(__cplusplus)
+#include <string>
+#include <vector>
+
+namespace celerique {
+    /// @brief What a flight record is about.
+    typedef CeleriqueFlightRecordKind FlightRecordKind;
+    /// @brief Why a flight recorder dump was written.
+    typedef CeleriqueFlightDumpReason FlightDumpReason;
+
+    /// @brief One entry of a thread's flight recorder, written to dumps as is.
+    struct FlightRecord {
+        /// @brief When the record was written, in nanoseconds of the steady clock.
+        uint64_t timeNanoSecs;
+        /// @brief A value depending on the kind, such as the update index.
+        uint64_t value;
+        /// @brief What the record is about.
+        FlightRecordKind kind;
+        /// @brief A detail depending on the kind, such as the log severity.
+        uint8_t detail;
+        /// @brief The number of text bytes used.
+        uint16_t textSize;
+        /// @brief The index of the thread's recorder, shared by threads that ran one after the other.
+        uint32_t threadIndex;
+        /// @brief The text, not null terminated.
+        char arrText[CELERIQUE_FLIGHT_RECORD_TEXT_SIZE];
+
+        /// @brief The text as a string.
+        /// @return The text.
+        inline ::std::string text() const { return ::std::string(arrText, textSize); }
+    };
+
+    /// @brief The contents of a flight recorder dump.
+    struct FlightDump {
+        /// @brief Why the dump was written.
+        FlightDumpReason reason = CELERIQUE_FLIGHT_DUMP_REASON_REQUESTED;
+        /// @brief The signal that was raised, for `CELERIQUE_FLIGHT_DUMP_REASON_SIGNAL`.
+        int32_t signalNumber = 0;
+        /// @brief The records of every thread, each thread's oldest first.
+        ::std::vector<FlightRecord> vecRecords;
+    };
+
+    /// @brief Append a record to the calling thread's flight recorder, overwriting its oldest
+    /// record once full. Costs a clock read and a copy; never locks or allocates after the thread's first record.
+    /// @param kind What the record is about.
+    /// @param detail A detail depending on the kind.
+    /// @param value A value depending on the kind.
+    /// @param ptrText The text, or null.
+    /// @param textSize The number of text bytes, truncated to `CELERIQUE_FLIGHT_RECORD_TEXT_SIZE`.
+    CELERIQUE_SHARED_SYMBOL void flightRecord(
+        FlightRecordKind kind, uint8_t detail, uint64_t value, const char* ptrText = nullptr, size_t textSize = 0
+    );
+    /// @brief Write every thread's flight recorder to a file. Only uses async signal safe calls,
+    /// so it may run in a signal handler. The oldest slot of each thread and records written meanwhile
+    /// are left out, as they may be half overwritten.
+    /// @param path The path of the file, or null for the one passed to `installFlightRecorderDumps`.
+    /// @return `false` if there is no path or the file could not be written.
+    CELERIQUE_SHARED_SYMBOL bool dumpFlightRecorder(const char* path = nullptr);
+    /// @brief Dump the flight recorders to a file when a fatal message is logged, `::std::terminate` is
+    /// called or a fatal signal is raised. The previous terminate handler and the default signal action run after.
+    /// @param path The path of the file, replaced by every dump.
+    CELERIQUE_SHARED_SYMBOL void installFlightRecorderDumps(const ::std::string& path);
+    /// @brief Read a flight recorder dump.
+    /// @param path The path of the file.
+    /// @param dump The dump to be overwritten.
+    /// @return `false` if the file could not be read or is not a flight recorder dump.
+    CELERIQUE_SHARED_SYMBOL bool readFlightRecorderDump(const ::std::string& path, FlightDump& dump);
+
+    namespace internal {
+        /// @brief Write every thread's flight recorder to the file passed to `installFlightRecorderDumps`, if any.
+        /// Only uses async signal safe calls.
+        /// @param reason Why the dump is written.
+        /// @param signalNumber The signal that was raised, for `CELERIQUE_FLIGHT_DUMP_REASON_SIGNAL`.
+        /// @return `false` if there is no path or the file could not be written.
+        CELERIQUE_SHARED_SYMBOL bool dumpInstalledFlightRecorder(FlightDumpReason reason, int32_t signalNumber = 0);
+    }
+}
+#endif
+// End C++ Only Region.
+
+#endif
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
@@ -0,0 +1,207 @@
+/*
+
+File: ./include/celerique/render.h
+Author: Aldhinn Espinas
+Description: This header file contains the per-frame render snapshots handed from the
+    update thread to the render thread.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#if !defined(CELERIQUE_RENDER_HEADER_FILE)
+#define CELERIQUE_RENDER_HEADER_FILE
+
+#include <celerique/defines.h>
+#include <celerique/types.h>
+#include <celerique/graphics.h>
+
+/// @brief Where and how the engine renders the snapshots written by the application layers.
+typedef uint8_t CeleriqueRenderThreadMode;
+/// @brief Render on the update thread, right after the layers update.
+#define CELERIQUE_RENDER_THREAD_MODE_NONE                                                   0x00
+/// @brief Render on a dedicated thread, always the newest snapshot. The update thread never
+/// waits for the render thread and snapshots not yet rendered are replaced.
+#define CELERIQUE_RENDER_THREAD_MODE_LOW_LATENCY                                            0x01
+/// @brief Render on a dedicated thread, every snapshot. The update thread waits when the
+/// render thread is a whole frame behind, adding at most one frame of latency.
+#define CELERIQUE_RENDER_THREAD_MODE_THROUGHPUT                                             0x02
+
+// Begin C++ Only Region.
+#if defined(__cplusplus)
+#include <atomic>
+#include <vector>
+
+namespace celerique {
+    /// @brief Where and how the engine renders the snapshots written by the application layers.
+    typedef CeleriqueRenderThreadMode RenderThreadMode;
+
+    /// @brief A uniform update recorded in a render snapshot.
+    struct SnapshotUniformUpdate {
+        /// @brief The identifier of the graphics pipeline configuration.
+        PipelineConfigID graphicsPipelineConfigId;
+        /// @brief The binding point of the uniform.
+        size_t bindingPoint;
+        /// @brief The offset of the data in the snapshot's uniform bytes.
+        size_t offset;
+        /// @brief The size of the data.
+        size_t size;
+    };
+    /// @brief A draw call recorded in a render snapshot.
+    struct SnapshotDrawCall {
+        /// @brief The identifier of the graphics pipeline configuration used for drawing.
+        PipelineConfigID graphicsPipelineConfigId;
+        /// @brief The number of vertices to be drawn.
+        size_t numVerticesToDraw;
+        /// @brief The size of the individual vertex input.
+        size_t vertexStride;
+        /// @brief The number of individual vertices to draw.
+        size_t numVertexElements;
+        /// @brief The offset of the vertex data in the snapshot's vertex bytes.
+        size_t vertexOffset;
+        /// @brief The offset of the indices in the snapshot's indices.
+        size_t indexOffset;
+        /// @brief Whether a vertex buffer was passed.
+        bool hasVertexBuffer;
+        /// @brief Whether an index buffer was passed.
+        bool hasIndexBuffer;
+        /// @brief The version of the vertices and indices. 0 when unversioned.
+        uint64_t drawVersion;
+        /// @brief The number of uniform updates recorded before this draw call.
+        size_t numUniformUpdatesBefore;
+    };
+
+    /// @brief What an application layer renders in one frame: its uniform updates, transforms and
+    /// draw calls, with copies of all their data. Written on the update thread, then only read until
+    /// it is reused for a later frame, so its vectors keep their capacity and a steady frame does not allocate.
+    class CELERIQUE_SHARED_SYMBOL RenderSnapshot final {
+    public:
+        /// @brief Clear the recorded data for a new frame, keeping the allocated capacity.
+        /// @param frameIndex The index of the frame being recorded.
+        void reset(uint64_t frameIndex);
+        /// @brief Record a uniform update. The data is copied into the snapshot.
+        /// @param graphicsPipelineConfigId The unique identifier to the graphics pipeline configuration.
+        /// @param bindingPoint The binding point of the uniform.
+        /// @param ptrData The pointer to the buffer containing the new data.
+        /// @param sizeData The size of the new data to be passed.
+        void updateUniform(
+            PipelineConfigID graphicsPipelineConfigId, size_t bindingPoint, const void* ptrData, size_t sizeData
+        );
+        /// @brief Record a draw call. The vertex and index buffers are copied into the snapshot, so
+        /// the layer may change them as soon as this returns.
+        /// @param graphicsPipelineConfigId The identifier for the graphics pipeline configuration to be used for drawing.
+        /// @param numVerticesToDraw The number of vertices to be drawn.
+        /// @param vertexStride The size of the individual vertex input.
+        /// @param numVertexElements The number of individual vertices to draw.
+        /// @param ptrVertexBuffer The pointer to the vertex buffer.
+        /// @param ptrIndexBuffer The pointer to the index buffer, holding `numVerticesToDraw` indices.
+        /// @param drawVersion The version of the vertices and indices, changed whenever their contents change. 0 when unversioned.
+        void draw(
+            PipelineConfigID graphicsPipelineConfigId, size_t numVerticesToDraw, size_t vertexStride = 0,
+            size_t numVertexElements = 0, const void* ptrVertexBuffer = nullptr, const uint32_t* ptrIndexBuffer = nullptr,
+            uint64_t drawVersion = 0
+        );
+        /// @brief Record transforms, such as the world matrices exported from a scene, as a uniform update
+        /// of the specified binding point. The matrices are copied into the snapshot.
+        /// @param graphicsPipelineConfigId The unique identifier to the graphics pipeline configuration.
+        /// @param bindingPoint The binding point of the uniform holding the matrices.
+        /// @param ptrMatrices The matrices, 16 floats each.
+        /// @param numMatrices The number of matrices.
+        void addTransforms(
+            PipelineConfigID graphicsPipelineConfigId, size_t bindingPoint, const float* ptrMatrices, size_t numMatrices
+        );
+        /// @brief Replay the uniform updates and draw calls in the order they were recorded.
+        /// @param graphicsApi The graphics API to submit to.
+        void submit(IGraphicsAPI& graphicsApi) const;
+
+        /// @brief The index of the frame recorded.
+        /// @return The value of `_frameIndex`.
+        inline uint64_t frameIndex() const { return _frameIndex; }
+        /// @brief The uniform updates recorded.
+        /// @return The const reference to `_vecUniformUpdates`.
+        inline const ::std::vector<SnapshotUniformUpdate>& uniformUpdates() const { return _vecUniformUpdates; }
+        /// @brief The data of every uniform update, one after the other.
+        /// @return The const reference to `_vecUniformBytes`.
+        inline const ::std::vector<Byte>& uniformBytes() const { return _vecUniformBytes; }
+        /// @brief The draw calls recorded.
+        /// @return The const reference to `_vecDrawCalls`.
+        inline const ::std::vector<SnapshotDrawCall>& drawCalls() const { return _vecDrawCalls; }
+        /// @brief The vertex data of every draw call, one after the other.
+        /// @return The const reference to `_vecVertexBytes`.
+        inline const ::std::vector<Byte>& vertexBytes() const { return _vecVertexBytes; }
+        /// @brief The indices of every draw call, one after the other.
+        /// @return The const reference to `_vecIndices`.
+        inline const ::std::vector<uint32_t>& indices() const { return _vecIndices; }
+
+    // Private member variables.
+    private:
+        /// @brief The index of the frame recorded.
+        uint64_t _frameIndex = 0;
+        /// @brief The uniform updates recorded.
+        ::std::vector<SnapshotUniformUpdate> _vecUniformUpdates;
+        /// @brief The data of every uniform update, one after the other.
+        ::std::vector<Byte> _vecUniformBytes;
+        /// @brief The draw calls recorded.
+        ::std::vector<SnapshotDrawCall> _vecDrawCalls;
+        /// @brief The vertex data of every draw call, one after the other.
+        ::std::vector<Byte> _vecVertexBytes;
+        /// @brief The indices of every draw call, one after the other.
+        ::std::vector<uint32_t> _vecIndices;
+    };
+
+    /// @brief A single producer, single consumer mailbox of 3 slots. The producer fills the
+    /// write slot while the consumer reads the read slot, and the two swap through the ready
+    /// slot without locking, so neither ever waits for the other to finish with a slot.
+    /// @tparam T The type of the value in each slot.
+    template<typename T>
+    class TripleBufferMailbox final {
+    public:
+        /// @brief The slot only the producer may write.
+        /// @return The reference to the write slot.
+        inline T& writeSlot() { return _arrSlots[_writeIndex]; }
+        /// @brief Hand the write slot to the consumer, taking the ready slot as the next write slot.
+        /// Called by the producer only.
+        /// @return `true` if the ready slot held a value the consumer had not taken yet, which is now dropped.
+        inline bool publish() {
+            /// @brief The previous ready slot.
+            uint8_t prevReady = _atomicReady.exchange(
+                static_cast<uint8_t>(_writeIndex | _freshBit), ::std::memory_order_acq_rel
+            );
+            _writeIndex = prevReady & _indexMask;
+            return (prevReady & _freshBit) != 0;
+        }
+        /// @brief Whether a published value has not been taken by the consumer yet.
+        /// @return `true` if `consume` would return a value.
+        inline bool hasFresh() const { return (_atomicReady.load(::std::memory_order_acquire) & _freshBit) != 0; }
+        /// @brief Take the newest published value. Called by the consumer only.
+        /// @return The pointer to the read slot, valid until the next call, or null if nothing new was published.
+        inline const T* consume() {
+            if (!hasFresh()) return nullptr;
+            /// @brief The previous ready slot.
+            uint8_t prevReady = _atomicReady.exchange(_readIndex, ::std::memory_order_acq_rel);
+            _readIndex = prevReady & _indexMask;
+            return &_arrSlots[_readIndex];
+        }
+
+    // Private member variables.
+    private:
+        /// @brief The bit of the ready slot marking a value not taken by the consumer yet.
+        static constexpr uint8_t _freshBit = 0x04;
+        /// @brief The bits of the ready slot holding the slot index.
+        static constexpr uint8_t _indexMask = 0x03;
+        /// @brief The slots.
+        T _arrSlots[3];
+        /// @brief The index of the slot being written by the producer.
+        uint8_t _writeIndex = 0;
+        /// @brief The index of the slot being read by the consumer.
+        uint8_t _readIndex = 1;
+        /// @brief The index of the ready slot, with `_freshBit` set while it was not taken.
+        ::std::atomic<uint8_t> _atomicReady = 2;
+    };
+}
+#endif
+// End C++ Only Region.
+
+#endif
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
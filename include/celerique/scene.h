@@ -0,0 +1,160 @@
+/*
+
+File: ./include/celerique/scene.h
+Author: Aldhinn Espinas
+Description: This header file contains the scene graph interfaces.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#if !defined(CELERIQUE_SCENE_HEADER_FILE)
+#define CELERIQUE_SCENE_HEADER_FILE
+
+#include <celerique/defines.h>
+#include <celerique/types.h>
+#include <celerique/math.h>
+#include <celerique/state.h>
+
+/// @brief The unique identifier of a node within a scene.
+typedef uint32_t CeleriqueSceneNodeID;
+/// @brief A null value for `CeleriqueSceneNodeID`.
+#define CELERIQUE_SCENE_NODE_ID_NULL                                                        0
+
+// Begin C++ Only Region.
+#if defined(__cplusplus)
+#include <vector>
+
+namespace celerique {
+    /// @brief The unique identifier of a node within a scene.
+    typedef CeleriqueSceneNodeID SceneNodeID;
+
+    /// @brief A translation, rotation and scale, applied in the order scale, rotation, translation.
+    struct Transform {
+        /// @brief The translation.
+        Vec3 translation = {0.0f, 0.0f, 0.0f};
+        /// @brief The rotation as a unit quaternion (x, y, z, w).
+        Vec4 rotation = {0.0f, 0.0f, 0.0f, 1.0f};
+        /// @brief The scale along each axis.
+        Vec3 scale = {1.0f, 1.0f, 1.0f};
+    };
+
+    /// @brief A hierarchy of transforms stored as flat arrays sorted by depth, so every
+    /// parent comes before its children and each depth is a contiguous range.
+    /// World matrices are row-major and transform column vectors (`world = parentWorld * local`).
+    class CELERIQUE_SHARED_SYMBOL Scene final {
+    public:
+        /// @brief Create a node.
+        /// @param parentId The parent of the node, or null for a root node.
+        /// @param localTransform The transform relative to the parent.
+        /// @return The unique identifier of the node, or null if the parent does not exist.
+        SceneNodeID createNode(
+            SceneNodeID parentId = CELERIQUE_SCENE_NODE_ID_NULL, const Transform& localTransform = Transform()
+        );
+        /// @brief Destroy a node and every one of its descendants.
+        /// @param nodeId The node to be destroyed.
+        void destroyNode(SceneNodeID nodeId);
+        /// @brief Move a node (and its descendants) under another parent.
+        /// @param nodeId The node to be moved.
+        /// @param parentId The new parent, or null to make the node a root.
+        /// @return `false` if either node does not exist or the parent is a descendant of the node.
+        bool setParent(SceneNodeID nodeId, SceneNodeID parentId);
+        /// @brief Determines whether a node exists.
+        /// @param nodeId The unique identifier of the node.
+        /// @return `true` if the node exists.
+        bool contains(SceneNodeID nodeId) const;
+        /// @brief The parent of a node.
+        /// @param nodeId The unique identifier of the node.
+        /// @return The parent's unique identifier, or null for root nodes.
+        SceneNodeID parent(SceneNodeID nodeId) const;
+        /// @brief The number of nodes in the scene.
+        /// @return The size of the node arrays.
+        inline size_t numNodes() const { return _vecNodeIds.size(); }
+
+        /// @brief The transform of a node relative to its parent.
+        /// @param nodeId The unique identifier of the node.
+        /// @return The const reference to the local transform.
+        const Transform& localTransform(SceneNodeID nodeId) const;
+        /// @brief Replace the transform of a node relative to its parent and mark it dirty.
+        /// @param nodeId The unique identifier of the node.
+        /// @param localTransform The new local transform.
+        void setLocalTransform(SceneNodeID nodeId, const Transform& localTransform);
+
+        /// @brief Recompute the world matrices of dirty nodes and their descendants,
+        /// one depth at a time, in parallel on the job workers.
+        /// @return The number of world matrices recomputed.
+        size_t updateWorldTransforms();
+        /// @brief The world matrix of a node as of the last `updateWorldTransforms`.
+        /// @param nodeId The unique identifier of the node.
+        /// @return The world matrix.
+        Mat4x4 worldMatrix(SceneNodeID nodeId) const;
+        /// @brief The world matrices of every node (16 row-major floats each), in the order of `nodeIds`.
+        /// Valid until the next structural change or update.
+        /// @return The pointer to `numNodes() * 16` floats.
+        inline const float* worldMatrices() const { return _vecWorldMatrices.data(); }
+        /// @brief The unique identifiers of every node, in the order of `worldMatrices`.
+        /// @return The const reference to `_vecNodeIds`.
+        inline const ::std::vector<SceneNodeID>& nodeIds() const { return _vecNodeIds; }
+        /// @brief Copy the world matrices of a set of nodes into a contiguous array,
+        /// for example a mapped instance buffer.
+        /// @param ptrNodeIds The pointer to the unique identifiers of the nodes.
+        /// @param numNodeIds The number of nodes.
+        /// @param ptrDst The destination receiving 16 floats per node.
+        /// @param dstCapacity The size of the destination in bytes.
+        /// @param storageOrder The storage order written. Column-major matches GLSL `mat4` inputs.
+        /// @return `false` if a node does not exist or the destination is too small.
+        bool exportWorldMatrices(
+            const SceneNodeID* ptrNodeIds, size_t numNodeIds, float* ptrDst, size_t dstCapacity,
+            MatrixStorageOrder storageOrder = CELERIQUE_MATRIX_STORAGE_ORDER_ROW_MAJOR
+        ) const;
+
+        /// @brief Write every node array into a single state snapshot section, copied as is.
+        /// @param snapshot The snapshot to write into.
+        /// @param key The key of the section.
+        void saveState(StateSnapshot& snapshot, uint64_t key) const;
+        /// @brief Replace the scene with the one written into a state snapshot section.
+        /// @param snapshot The snapshot to read from.
+        /// @param key The key of the section.
+        /// @return `false` if the snapshot has no such section or it holds another layout, leaving the scene unchanged.
+        bool restoreState(const StateSnapshot& snapshot, uint64_t key);
+
+    // Private helper functions.
+    private:
+        /// @brief The index of a node in the node arrays.
+        /// @param nodeId The unique identifier of the node.
+        /// @return The index, or `noIndex` if the node does not exist.
+        uint32_t indexOf(SceneNodeID nodeId) const;
+        /// @brief Re-sort the node arrays by depth after structural changes.
+        void sortByDepth();
+
+    // Private member variables.
+    private:
+        /// @brief The index value meaning "none".
+        static constexpr uint32_t noIndex = UINT32_MAX;
+
+        /// @brief The unique identifier of each node.
+        ::std::vector<SceneNodeID> _vecNodeIds;
+        /// @brief The index of each node's parent, `noIndex` for root nodes.
+        ::std::vector<uint32_t> _vecParentIndices;
+        /// @brief The transform of each node relative to its parent.
+        ::std::vector<Transform> _vecLocalTransforms;
+        /// @brief The world matrix of each node, 16 row-major floats each.
+        ::std::vector<float> _vecWorldMatrices;
+        /// @brief Whether each node's world matrix has to be recomputed.
+        ::std::vector<uint8_t> _vecIsDirty;
+        /// @brief The first index of each depth, plus one past the last node.
+        ::std::vector<size_t> _vecLevelOffsets;
+        /// @brief The index of each node by its unique identifier minus one, `noIndex` if freed.
+        ::std::vector<uint32_t> _vecNodeIdToIndex;
+        /// @brief Unique identifiers of destroyed nodes, to be reused.
+        ::std::vector<SceneNodeID> _vecFreeNodeIds;
+        /// @brief Whether the node arrays have to be re-sorted by depth.
+        bool _isOrderDirty = false;
+    };
+}
+#endif
+// End C++ Only Region.
+
+#endif
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
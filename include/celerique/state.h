@@ -0,0 +1,132 @@
+/*
+
+File: ./include/celerique/state.h
+Author: Aldhinn Espinas
+Description: This header file contains the binary state snapshots of the engine and its application
+    layers, for rollback and quick restarts.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#if !defined(CELERIQUE_STATE_HEADER_FILE)
+#define CELERIQUE_STATE_HEADER_FILE
+
+#include <celerique/defines.h>
+#include <celerique/types.h>
+
+/// @brief The version of the state snapshot layout. Snapshots of another version are refused.
+#define CELERIQUE_STATE_SNAPSHOT_VERSION                                                    1
+/// @brief The alignment in bytes of every section (and its header) in a state snapshot.
+#define CELERIQUE_STATE_SNAPSHOT_ALIGNMENT                                                  16
+/// @brief The size in bytes of the blocks compared by state deltas.
+#define CELERIQUE_STATE_DELTA_BLOCK_SIZE                                                    64
+/// @brief The section key reserved for the engine's own state.
+#define CELERIQUE_STATE_KEY_ENGINE                                                          0
+
+// Begin C++ Only Region.
+#if defined(__cplusplus)
+#include <vector>
+
+namespace celerique {
+    /// @brief Type for a byte character.
+    typedef CeleriqueByte Byte;
+    /// @brief The changes from one state snapshot to the next, as the blocks that differ.
+    class StateDelta;
+
+    /// @brief A checkpoint of engine and layer state in one contiguous arena: a header followed by
+    /// keyed, versioned sections. Every offset is relative to the start of the arena, so its bytes can be
+    /// copied, sent or stored as is and restored with `assign`. Clearing keeps the arena's capacity, so
+    /// checkpointing every frame does not allocate once the state stopped growing.
+    class CELERIQUE_SHARED_SYMBOL StateSnapshot final {
+    public:
+        /// @brief Empty the snapshot, keeping the allocated capacity.
+        void clear();
+        /// @brief Reserve a section to be written in place.
+        /// @param key The key the section is looked up with. Unique within the snapshot.
+        /// @param size The size of the section's data.
+        /// @param version The version of the section's own layout, returned to the reader.
+        /// @return The pointer to the section's data, aligned to `CELERIQUE_STATE_SNAPSHOT_ALIGNMENT`
+        /// and valid until the next section is added.
+        Byte* appendSection(uint64_t key, size_t size, uint32_t version = 1);
+        /// @brief Copy data into a new section.
+        /// @param key The key the section is looked up with. Unique within the snapshot.
+        /// @param ptrData The pointer to the data.
+        /// @param size The size of the data.
+        /// @param version The version of the section's own layout, returned to the reader.
+        void writeSection(uint64_t key, const void* ptrData, size_t size, uint32_t version = 1);
+        /// @brief Find a section.
+        /// @param key The key of the section.
+        /// @param ptrSize Receives the size of the section's data, if not null.
+        /// @param ptrVersion Receives the version of the section's layout, if not null.
+        /// @return The pointer to the section's data, or null if the snapshot has no such section.
+        const Byte* section(uint64_t key, size_t* ptrSize = nullptr, uint32_t* ptrVersion = nullptr) const;
+        /// @brief Replace the snapshot with bytes copied from another snapshot's `data`.
+        /// @param ptrData The pointer to the bytes.
+        /// @param size The number of bytes.
+        /// @return `false` if the bytes are not a snapshot of this version, leaving the snapshot empty.
+        bool assign(const Byte* ptrData, size_t size);
+
+        /// @brief Record the blocks differing from a previous snapshot.
+        /// @param previous The previous snapshot, typically of the previous frame.
+        /// @param delta The delta to be overwritten, keeping its allocated capacity.
+        void diff(const StateSnapshot& previous, StateDelta& delta) const;
+        /// @brief Turn this snapshot into the one a delta was recorded from.
+        /// @param delta The delta recorded against this snapshot's contents.
+        /// @return `false` if the delta was recorded against a snapshot of another size or layout.
+        bool applyDelta(const StateDelta& delta);
+
+        /// @brief The arena.
+        /// @return The pointer to the first byte of the snapshot.
+        inline const Byte* data() const { return _vecArena.data(); }
+        /// @brief The size of the arena.
+        /// @return The number of bytes in the snapshot.
+        inline size_t size() const { return _vecArena.size(); }
+        /// @brief The number of sections written.
+        /// @return The number of sections.
+        size_t numSections() const;
+
+    // Private member variables.
+    private:
+        /// @brief The header followed by every section. Heap blocks are aligned for any fundamental type,
+        /// which covers `CELERIQUE_STATE_SNAPSHOT_ALIGNMENT`.
+        ::std::vector<Byte> _vecArena;
+
+    public:
+        /// @brief Default constructor. Creates an empty snapshot.
+        StateSnapshot();
+    };
+
+    /// @brief The changes from one state snapshot to the next, as the blocks that differ.
+    class CELERIQUE_SHARED_SYMBOL StateDelta final {
+    public:
+        /// @brief The number of blocks that differ.
+        /// @return The number of blocks recorded.
+        inline size_t numChangedBlocks() const { return _vecBlockIndices.size(); }
+        /// @brief The size of the data recorded, a measure of how much the state changed.
+        /// @return The number of bytes recorded.
+        inline size_t size() const { return _vecBlockBytes.size() + _vecBlockIndices.size() * sizeof(uint32_t); }
+
+    // Private member variables.
+    private:
+        /// @brief Records and applies deltas.
+        friend class StateSnapshot;
+
+        /// @brief The size of the snapshot the delta was recorded against.
+        size_t _baseSize = 0;
+        /// @brief The hash of the header and section headers of the snapshot the delta was recorded against.
+        uint64_t _baseLayoutHash = 0;
+        /// @brief The size of the snapshot the delta was recorded from.
+        size_t _targetSize = 0;
+        /// @brief The index of every block that differs.
+        ::std::vector<uint32_t> _vecBlockIndices;
+        /// @brief The new contents of every block that differs, `CELERIQUE_STATE_DELTA_BLOCK_SIZE` bytes each.
+        ::std::vector<Byte> _vecBlockBytes;
+    };
+}
+#endif
+// End C++ Only Region.
+
+#endif
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
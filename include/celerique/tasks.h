@@ -0,0 +1,297 @@
+/*
+
+File: ./include/celerique/tasks.h
+Author: Aldhinn Espinas
+Description: This header file contains the coroutine tasks scheduled on the engine's job workers.
+    Only available when building with C++ 20 (`CELERIQUE_ENABLE_CPP20`).
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#if !defined(CELERIQUE_TASKS_HEADER_FILE)
+#define CELERIQUE_TASKS_HEADER_FILE
+
+#include <celerique/defines.h>
+#include <celerique/types.h>
+#include <celerique/assets.h>
+
+// Begin C++ Only Region.
+#if defined(__cplusplus) && defined(CELERIQUE_COROUTINES_ENABLED)
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace celerique {
+    /// @brief A lazily started coroutine producing a value of type `T`. It runs when
+    /// awaited, or on a job worker once passed to `spawnTask`.
+    /// @tparam T The type of the value produced.
+    template<typename T>
+    class Task;
+
+    namespace internal {
+        /// @brief Keeps suspended coroutines until the conditions they wait on hold.
+        class TaskScheduler;
+
+        /// @brief The part of a coroutine promise naming the scheduler its suspensions are resumed by.
+        class ScheduledPromiseBase {
+        public:
+            /// @brief The scheduler of the engine the coroutine runs on, or `nullptr` for the process default engine's.
+            TaskScheduler* ptrScheduler = nullptr;
+        };
+
+        /// @brief The scheduler a coroutine's suspensions are resumed by.
+        /// @tparam TPromise The type of the coroutine's promise.
+        /// @param handle The handle to the coroutine.
+        /// @return The pointer to the scheduler, or `nullptr` for the process default engine's.
+        template<typename TPromise>
+        inline TaskScheduler* schedulerOf(::std::coroutine_handle<TPromise> handle) noexcept {
+            if constexpr (::std::is_base_of_v<ScheduledPromiseBase, TPromise>) return handle.promise().ptrScheduler;
+            else return nullptr;
+        }
+
+        /// @brief The promise state shared by every task type.
+        class TaskPromiseBase : public ScheduledPromiseBase {
+        public:
+            /// @brief Resumes the awaiting coroutine once the task finished.
+            struct FinalAwaiter {
+                /// @brief Always suspend so the awaiting coroutine is resumed by transfer.
+                /// @return `false`.
+                inline bool await_ready() const noexcept { return false; }
+                /// @brief Transfer to the awaiting coroutine, if any.
+                /// @tparam TPromise The type of the finished task's promise.
+                /// @param handle The handle to the finished task.
+                /// @return The handle to the coroutine to be resumed next.
+                template<typename TPromise>
+                inline ::std::coroutine_handle<> await_suspend(::std::coroutine_handle<TPromise> handle) noexcept {
+                    /// @brief The coroutine awaiting the finished task.
+                    ::std::coroutine_handle<> continuation = handle.promise().continuation;
+                    return continuation ? continuation : ::std::noop_coroutine();
+                }
+                /// @brief Never resumed.
+                inline void await_resume() const noexcept {}
+            };
+
+            /// @brief Tasks start when awaited.
+            /// @return An always suspending awaiter.
+            inline ::std::suspend_always initial_suspend() const noexcept { return {}; }
+            /// @brief Resume the awaiting coroutine when done.
+            /// @return The final awaiter.
+            inline FinalAwaiter final_suspend() const noexcept { return {}; }
+            /// @brief Keep the exception to be re-thrown to the awaiting coroutine.
+            inline void unhandled_exception() noexcept { ptrException = ::std::current_exception(); }
+
+            /// @brief The coroutine awaiting the task.
+            ::std::coroutine_handle<> continuation;
+            /// @brief The exception thrown by the task.
+            ::std::exception_ptr ptrException;
+        };
+
+        /// @brief The promise of a task producing a value.
+        /// @tparam T The type of the value produced.
+        template<typename T>
+        class TaskPromise final : public TaskPromiseBase {
+        public:
+            /// @brief Create the task referring to this promise.
+            /// @return The task.
+            Task<T> get_return_object() noexcept;
+            /// @brief Keep the value produced.
+            /// @tparam TValue The type of the value returned.
+            /// @param value The value returned.
+            template<typename TValue>
+            inline void return_value(TValue&& value) { optValue.emplace(::std::forward<TValue>(value)); }
+
+            /// @brief The value produced.
+            ::std::optional<T> optValue;
+        };
+        /// @brief The promise of a task producing no value.
+        template<>
+        class TaskPromise<void> final : public TaskPromiseBase {
+        public:
+            /// @brief Create the task referring to this promise.
+            /// @return The task.
+            Task<void> get_return_object() noexcept;
+            /// @brief Nothing to keep.
+            inline void return_void() const noexcept {}
+        };
+
+        /// @brief Resume a suspended coroutine on a job worker once the condition holds.
+        /// Conditions are checked at the start of every update of the scheduler's engine.
+        /// @param ptrScheduler The scheduler of the engine the coroutine runs on, or `nullptr` for the process default engine's.
+        /// @param isReady The condition. Null resumes on the next engine update.
+        /// @param handle The handle to the suspended coroutine.
+        CELERIQUE_SHARED_SYMBOL void resumeWhen(
+            TaskScheduler* ptrScheduler, ::std::function<bool()>&& isReady, ::std::coroutine_handle<> handle
+        );
+    }
+
+    /// @brief A lazily started coroutine producing a value of type `T`. It runs when
+    /// awaited, or on a job worker once passed to `spawnTask`.
+    /// @tparam T The type of the value produced.
+    template<typename T>
+    class Task final {
+    public:
+        /// @brief The promise type looked up by the compiler.
+        using promise_type = internal::TaskPromise<T>;
+
+        /// @brief Whether the task finished.
+        /// @return `true` if the task ran to completion.
+        inline bool isDone() const { return _handle && _handle.done(); }
+
+        /// @brief Whether the task already finished when awaited.
+        /// @return `true` if the awaiting coroutine may continue without suspending.
+        inline bool await_ready() const noexcept { return !_handle || _handle.done(); }
+        /// @brief Start the task on the awaiting coroutine's engine, resuming the awaiting coroutine when it finishes.
+        /// @tparam TPromise The type of the awaiting coroutine's promise.
+        /// @param awaitingHandle The handle to the awaiting coroutine.
+        /// @return The handle to the task, resumed next.
+        template<typename TPromise>
+        inline ::std::coroutine_handle<> await_suspend(::std::coroutine_handle<TPromise> awaitingHandle) noexcept {
+            _handle.promise().continuation = awaitingHandle;
+            _handle.promise().ptrScheduler = internal::schedulerOf(awaitingHandle);
+            return _handle;
+        }
+        /// @brief Take the value produced, re-throwing the exception the task threw.
+        /// @return The value produced.
+        inline T await_resume() {
+            if (_handle.promise().ptrException) ::std::rethrow_exception(_handle.promise().ptrException);
+            if constexpr (!::std::is_void_v<T>) return ::std::move(*_handle.promise().optValue);
+        }
+
+    // Private member variables.
+    private:
+        /// @brief The handle to the coroutine.
+        ::std::coroutine_handle<promise_type> _handle;
+
+    public:
+        /// @brief Member init constructor.
+        /// @param handle The handle to the coroutine.
+        explicit Task(::std::coroutine_handle<promise_type> handle) noexcept : _handle(handle) {}
+        /// @brief Move constructor.
+        /// @param other The r-value reference to the task being moved from.
+        Task(Task&& other) noexcept : _handle(::std::exchange(other._handle, nullptr)) {}
+        /// @brief Move re-assignment operator.
+        /// @param other The r-value reference to the task being moved from.
+        /// @return The reference to this instance.
+        Task& operator=(Task&& other) noexcept {
+            if (this != &other) {
+                if (_handle) _handle.destroy();
+                _handle = ::std::exchange(other._handle, nullptr);
+            }
+            return *this;
+        }
+        /// @brief Destructor. Destroys the coroutine.
+        ~Task() { if (_handle) _handle.destroy(); }
+
+        /// @brief Prevent copying.
+        Task(const Task&) = delete;
+        /// @brief Prevent copy re-assignment.
+        Task& operator=(const Task&) = delete;
+    };
+
+    /// @brief Create the task referring to this promise.
+    /// @return The task.
+    template<typename T>
+    inline Task<T> internal::TaskPromise<T>::get_return_object() noexcept {
+        return Task<T>(::std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+    }
+    /// @brief Create the task referring to this promise.
+    /// @return The task.
+    inline Task<void> internal::TaskPromise<void>::get_return_object() noexcept {
+        return Task<void>(::std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+    }
+
+    /// @brief Suspends the awaiting coroutine until a condition holds. No thread waits in the
+    /// meantime; the condition is checked once per update of the engine the coroutine runs on.
+    class CELERIQUE_SHARED_SYMBOL ConditionAwaiter {
+    public:
+        /// @brief Whether the condition already holds.
+        /// @return `true` if the awaiting coroutine may continue without suspending.
+        inline bool await_ready() const { return _isReady && _isReady(); }
+        /// @brief Hand the awaiting coroutine to its engine until the condition holds.
+        /// @tparam TPromise The type of the awaiting coroutine's promise.
+        /// @param awaitingHandle The handle to the awaiting coroutine.
+        template<typename TPromise>
+        inline void await_suspend(::std::coroutine_handle<TPromise> awaitingHandle) {
+            internal::resumeWhen(internal::schedulerOf(awaitingHandle), ::std::move(_isReady), awaitingHandle);
+        }
+        /// @brief Nothing to return.
+        inline void await_resume() const noexcept {}
+
+    // Private member variables.
+    private:
+        /// @brief The condition. Null holds on the next engine update.
+        ::std::function<bool()> _isReady;
+
+    public:
+        /// @brief Member init constructor.
+        /// @param isReady The condition. Null holds on the next engine update.
+        explicit ConditionAwaiter(::std::function<bool()>&& isReady) : _isReady(::std::move(isReady)) {}
+    };
+
+    /// @brief Suspends the awaiting coroutine until an asset finished loading or failed.
+    class CELERIQUE_SHARED_SYMBOL AssetLoadAwaiter {
+    public:
+        /// @brief Whether the asset already finished loading or failed.
+        /// @return `true` if the awaiting coroutine may continue without suspending.
+        bool await_ready() const;
+        /// @brief Hand the awaiting coroutine to its engine until the asset finished loading or failed.
+        /// @tparam TPromise The type of the awaiting coroutine's promise.
+        /// @param awaitingHandle The handle to the awaiting coroutine.
+        template<typename TPromise>
+        inline void await_suspend(::std::coroutine_handle<TPromise> awaitingHandle) {
+            internal::resumeWhen(
+                internal::schedulerOf(awaitingHandle), [awaiter = *this]() { return awaiter.await_ready(); }, awaitingHandle
+            );
+        }
+        /// @brief The state the asset ended up in.
+        /// @return Either `CELERIQUE_ASSET_STATE_READY` or `CELERIQUE_ASSET_STATE_FAILED`.
+        inline AssetState await_resume() const { return _assetHandle.state(); }
+
+    // Private member variables.
+    private:
+        /// @brief The handle to the asset being waited on.
+        AssetHandle _assetHandle;
+
+    public:
+        /// @brief Member init constructor.
+        /// @param assetHandle The handle to the asset being waited on.
+        explicit AssetLoadAwaiter(const AssetHandle& assetHandle) : _assetHandle(assetHandle) {}
+    };
+
+    /// @brief Start a task on a job worker, its suspensions resumed by the process default engine's updates.
+    /// The task is destroyed once it finished, and an exception it throws is logged as an error.
+    /// @param task The task to be started.
+    CELERIQUE_SHARED_SYMBOL void spawnTask(Task<void>&& task);
+    /// @brief Suspend the awaiting coroutine until the next update of its engine.
+    /// @return The awaiter to be awaited.
+    CELERIQUE_SHARED_SYMBOL ConditionAwaiter nextFrame();
+    /// @brief Suspend the awaiting coroutine for at least the specified duration, resuming on the
+    /// first update of its engine after it elapsed.
+    /// @param duration The duration to wait.
+    /// @return The awaiter to be awaited.
+    CELERIQUE_SHARED_SYMBOL ConditionAwaiter delay(::std::chrono::nanoseconds duration);
+    /// @brief Suspend the awaiting coroutine until an asset finished loading or failed.
+    /// @param assetHandle The handle to the asset being waited on.
+    /// @return The awaiter to be awaited, producing the asset state.
+    CELERIQUE_SHARED_SYMBOL AssetLoadAwaiter waitForAsset(const AssetHandle& assetHandle);
+    /// @brief Suspend the awaiting coroutine until a GPU timeline, such as a timeline semaphore,
+    /// reached a value.
+    /// @param completedValue Queries the value the timeline reached, such as `vkGetSemaphoreCounterValue`.
+    /// Called on the update thread of the awaiting coroutine's engine.
+    /// @param value The value to wait for.
+    /// @return The awaiter to be awaited.
+    CELERIQUE_SHARED_SYMBOL ConditionAwaiter waitForTimelineValue(
+        ::std::function<uint64_t()>&& completedValue, uint64_t value
+    );
+}
+#endif
+// End C++ Only Region.
+
+#endif
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
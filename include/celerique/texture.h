@@ -0,0 +1,166 @@
+/*
+
+File: ./include/celerique/texture.h
+Author: Aldhinn Espinas
+Description: This header file contains interfaces to block compressed textures.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#if !defined(CELERIQUE_TEXTURE_HEADER_FILE)
+#define CELERIQUE_TEXTURE_HEADER_FILE
+
+#include <celerique/defines.h>
+#include <celerique/types.h>
+#include <celerique/assets.h>
+
+/// @brief The pixel format of a texture as it is uploaded to the GPU.
+typedef uint8_t CeleriqueTextureFormat;
+/// @brief A null value for `CeleriqueTextureFormat`.
+#define CELERIQUE_TEXTURE_FORMAT_NULL                                                       0x00
+/// @brief Uncompressed 8-bit RGBA.
+#define CELERIQUE_TEXTURE_FORMAT_RGBA8_UNORM                                                0x01
+/// @brief Uncompressed 8-bit RGBA, sRGB encoded.
+#define CELERIQUE_TEXTURE_FORMAT_RGBA8_SRGB                                                 0x02
+/// @brief BC1 (DXT1), 8 bytes per 4x4 block.
+#define CELERIQUE_TEXTURE_FORMAT_BC1_UNORM                                                  0x03
+/// @brief BC1 (DXT1), sRGB encoded.
+#define CELERIQUE_TEXTURE_FORMAT_BC1_SRGB                                                   0x04
+/// @brief BC3 (DXT5), 16 bytes per 4x4 block.
+#define CELERIQUE_TEXTURE_FORMAT_BC3_UNORM                                                  0x05
+/// @brief BC3 (DXT5), sRGB encoded.
+#define CELERIQUE_TEXTURE_FORMAT_BC3_SRGB                                                   0x06
+/// @brief BC5 two channel (normal maps), 16 bytes per 4x4 block.
+#define CELERIQUE_TEXTURE_FORMAT_BC5_UNORM                                                  0x07
+/// @brief BC7, 16 bytes per 4x4 block.
+#define CELERIQUE_TEXTURE_FORMAT_BC7_UNORM                                                  0x08
+/// @brief BC7, sRGB encoded.
+#define CELERIQUE_TEXTURE_FORMAT_BC7_SRGB                                                   0x09
+/// @brief ETC2 RGBA (EAC alpha), 16 bytes per 4x4 block.
+#define CELERIQUE_TEXTURE_FORMAT_ETC2_RGBA8_UNORM                                           0x0A
+/// @brief ETC2 RGBA (EAC alpha), sRGB encoded.
+#define CELERIQUE_TEXTURE_FORMAT_ETC2_RGBA8_SRGB                                            0x0B
+/// @brief ASTC 4x4, 16 bytes per 4x4 block.
+#define CELERIQUE_TEXTURE_FORMAT_ASTC_4X4_UNORM                                             0x0C
+/// @brief ASTC 4x4, sRGB encoded.
+#define CELERIQUE_TEXTURE_FORMAT_ASTC_4X4_SRGB                                              0x0D
+
+/// @brief The block compressed format families a device can sample from.
+typedef uint8_t CeleriqueTextureFormatSupport;
+/// @brief No block compressed formats.
+#define CELERIQUE_TEXTURE_FORMAT_SUPPORT_NONE                                               0x00
+/// @brief BC1 formats.
+#define CELERIQUE_TEXTURE_FORMAT_SUPPORT_BC1                                                CELERIQUE_LEFT_BIT_SHIFT_1(0)
+/// @brief BC3 formats.
+#define CELERIQUE_TEXTURE_FORMAT_SUPPORT_BC3                                                CELERIQUE_LEFT_BIT_SHIFT_1(1)
+/// @brief BC5 formats.
+#define CELERIQUE_TEXTURE_FORMAT_SUPPORT_BC5                                                CELERIQUE_LEFT_BIT_SHIFT_1(2)
+/// @brief BC7 formats.
+#define CELERIQUE_TEXTURE_FORMAT_SUPPORT_BC7                                                CELERIQUE_LEFT_BIT_SHIFT_1(3)
+/// @brief ETC2 formats.
+#define CELERIQUE_TEXTURE_FORMAT_SUPPORT_ETC2                                               CELERIQUE_LEFT_BIT_SHIFT_1(4)
+/// @brief ASTC 4x4 formats.
+#define CELERIQUE_TEXTURE_FORMAT_SUPPORT_ASTC_4X4                                           CELERIQUE_LEFT_BIT_SHIFT_1(5)
+/// @brief Every BCn format (typical of desktop GPUs).
+#define CELERIQUE_TEXTURE_FORMAT_SUPPORT_BCN \
+    (CELERIQUE_TEXTURE_FORMAT_SUPPORT_BC1 | CELERIQUE_TEXTURE_FORMAT_SUPPORT_BC3 | \
+    CELERIQUE_TEXTURE_FORMAT_SUPPORT_BC5 | CELERIQUE_TEXTURE_FORMAT_SUPPORT_BC7)
+
+// Begin C++ Only Region.
+#if defined(__cplusplus)
+#include <memory>
+#include <vector>
+
+namespace celerique {
+    /// @brief The pixel format of a texture as it is uploaded to the GPU.
+    typedef CeleriqueTextureFormat TextureFormat;
+    /// @brief The block compressed format families a device can sample from.
+    typedef CeleriqueTextureFormatSupport TextureFormatSupport;
+
+    /// @brief Determines whether a texture format is stored in 4x4 blocks.
+    /// @param format The texture format.
+    /// @return `true` for block compressed formats.
+    CELERIQUE_SHARED_SYMBOL bool isBlockCompressed(TextureFormat format);
+    /// @brief The number of bytes a mip level of a texture format takes up.
+    /// @param format The texture format.
+    /// @param width The width of the mip level in pixels.
+    /// @param height The height of the mip level in pixels.
+    /// @return The size in bytes, 0 for unknown formats.
+    CELERIQUE_SHARED_SYMBOL size_t textureLevelSize(TextureFormat format, uint32_t width, uint32_t height);
+
+    /// @brief A single mip level ready to be uploaded.
+    struct TextureMipLevel {
+        /// @brief The width of the mip level in pixels.
+        uint32_t width = 0;
+        /// @brief The height of the mip level in pixels.
+        uint32_t height = 0;
+        /// @brief The pointer to the mip level's data.
+        const Byte* ptrData = nullptr;
+        /// @brief The size of the mip level's data.
+        size_t size = 0;
+    };
+
+    /// @brief An immutable texture whose mip levels are in the format they are uploaded in.
+    class CELERIQUE_SHARED_SYMBOL Texture final {
+    public:
+        /// @brief The format of the texture.
+        /// @return `_format` value.
+        inline TextureFormat format() const { return _format; }
+        /// @brief The width of the largest mip level.
+        /// @return The width in pixels.
+        inline uint32_t width() const { return _vecMipLevels.empty() ? 0 : _vecMipLevels.front().width; }
+        /// @brief The height of the largest mip level.
+        /// @return The height in pixels.
+        inline uint32_t height() const { return _vecMipLevels.empty() ? 0 : _vecMipLevels.front().height; }
+        /// @brief The mip levels, largest first.
+        /// @return The const reference to `_vecMipLevels`.
+        inline const ::std::vector<TextureMipLevel>& mipLevels() const { return _vecMipLevels; }
+        /// @brief The number of bytes uploaded for every mip level.
+        /// @return The size in bytes.
+        size_t size() const;
+        /// @brief The number of bytes the mip levels would take up as uncompressed RGBA8.
+        /// @return The size in bytes.
+        size_t uncompressedSize() const;
+
+        /// @brief Member init constructor.
+        /// @param format The format of the texture.
+        /// @param vecMipLevels The mip levels, largest first.
+        /// @param ptrOwner The shared pointer to whatever owns the mip level data.
+        Texture(TextureFormat format, ::std::vector<TextureMipLevel>&& vecMipLevels, ::std::shared_ptr<const void>&& ptrOwner);
+
+    // Private member variables.
+    private:
+        /// @brief The format of the texture.
+        TextureFormat _format;
+        /// @brief The mip levels, largest first.
+        ::std::vector<TextureMipLevel> _vecMipLevels;
+        /// @brief The shared pointer to whatever owns the mip level data.
+        ::std::shared_ptr<const void> _ptrOwner;
+    };
+
+    /// @brief Load a KTX2 texture for a device. Block compressed payloads the device supports
+    /// are referenced in place. Uncompressed RGBA8 payloads are compressed in parallel on the
+    /// job workers to BC1 (opaque) or BC3, if supported, and kept as RGBA8 otherwise.
+    /// @param ptrData The pointer to the file contents.
+    /// @param size The size of the file contents.
+    /// @param formatSupport The block compressed formats the device supports.
+    /// @param ptrOwner The shared pointer to whatever owns the file contents, kept alive by the texture.
+    /// May be `nullptr` if the caller keeps the contents alive for as long as the texture.
+    /// @return The shared pointer to the texture or `nullptr` if the file can not be used on the device.
+    CELERIQUE_SHARED_SYMBOL ::std::shared_ptr<Texture> loadKtx2Texture(
+        const Byte* ptrData, size_t size, TextureFormatSupport formatSupport,
+        ::std::shared_ptr<const void> ptrOwner = nullptr
+    );
+    /// @brief Create an asset decoder that loads KTX2 textures, for `loadAsset`.
+    /// The loaded asset's data is a `Texture`.
+    /// @param formatSupport The block compressed formats the device supports.
+    /// @return The asset decoder.
+    CELERIQUE_SHARED_SYMBOL AssetDecoder ktx2TextureDecoder(TextureFormatSupport formatSupport);
+}
+#endif
+// End C++ Only Region.
+
+#endif
+// End of file.
+// DO NOT WRITE BEYOND HERE.
\ No newline at end of file
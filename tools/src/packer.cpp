@@ -0,0 +1,118 @@
+/*
+
+File: ./tools/src/packer.cpp
+Author: Aldhinn Espinas
+Description: This source file contains the command line tool that packs files into an asset archive.
+
+    Usage: CeleriquePacker <output archive> [options] <file or directory>...
+
+    Options apply to every input that follows them:
+        --lz4               Compress entries in LZ4 chunks.
+        --store             Store entries uncompressed (default).
+        --chunk-size <n>    The uncompressed size of each compressed chunk.
+
+    Files are named by their path as given. Files found inside a directory
+    are named by their path relative to that directory.
+
+License: Mozilla Public License 2.0. (See ./LICENSE).
+
+*/
+
+#include <celerique/archive.h>
+#include <celerique/logging.h>
+
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace fs = ::std::filesystem;
+
+/// @brief Read the whole contents of a file.
+/// @param filePath The path of the file.
+/// @param fileContents The container receiving the contents.
+/// @return `true` if the file was read successfully.
+static bool readWholeFile(const fs::path& filePath, ::std::vector<::celerique::Byte>& fileContents) {
+    /// @brief The input stream of the file.
+    ::std::ifstream streamFile(filePath, ::std::ios::binary);
+    if (!streamFile.is_open()) return false;
+    fileContents.assign(::std::istreambuf_iterator<char>(streamFile), ::std::istreambuf_iterator<char>());
+    return !streamFile.bad();
+}
+
+/// @brief Add a single file to the archive.
+/// @param writer The archive being packed.
+/// @param filePath The path of the file.
+/// @param name The name of the entry.
+/// @param compression The compression applied to the entry.
+/// @param chunkSize The uncompressed size of each compressed chunk.
+/// @return `true` if the file was added.
+static bool packFile(
+    ::celerique::ArchiveWriter& writer, const fs::path& filePath, const ::std::string& name,
+    ::celerique::ArchiveCompression compression, uint32_t chunkSize
+) {
+    /// @brief The contents of the file.
+    ::std::vector<::celerique::Byte> fileContents;
+    if (!readWholeFile(filePath, fileContents)) {
+        ::std::cerr << "Failed to read " << filePath.string() << ::std::endl;
+        return false;
+    }
+    writer.addEntry(name, fileContents.data(), fileContents.size(), compression, chunkSize);
+    ::std::cout << name << " (" << fileContents.size() << " bytes)" << ::std::endl;
+    return true;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        ::std::cerr << "Usage: " << argv[0] <<
+            " <output archive> [--lz4 | --store] [--chunk-size <n>] <file or directory>..." << ::std::endl;
+        return 1;
+    }
+
+    ::celerique::ArchiveWriter writer;
+    /// @brief The compression applied to the inputs that follow.
+    ::celerique::ArchiveCompression compression = CELERIQUE_ARCHIVE_COMPRESSION_NONE;
+    /// @brief The chunk size applied to the inputs that follow.
+    uint32_t chunkSize = CELERIQUE_ARCHIVE_DEFAULT_CHUNK_SIZE;
+
+    try {
+        for (int i = 2; i < argc; i++) {
+            /// @brief The current argument.
+            ::std::string argument = argv[i];
+            if (argument == "--lz4") {
+                compression = CELERIQUE_ARCHIVE_COMPRESSION_LZ4;
+                continue;
+            }
+            if (argument == "--store") {
+                compression = CELERIQUE_ARCHIVE_COMPRESSION_NONE;
+                continue;
+            }
+            if (argument == "--chunk-size" && i + 1 < argc) {
+                chunkSize = static_cast<uint32_t>(::std::stoul(argv[++i]));
+                continue;
+            }
+
+            /// @brief The input path.
+            fs::path inputPath(argument);
+            if (!fs::is_directory(inputPath)) {
+                if (!packFile(writer, inputPath, inputPath.generic_string(), compression, chunkSize)) return 1;
+                continue;
+            }
+            for (const fs::directory_entry& entry : fs::recursive_directory_iterator(inputPath)) {
+                if (!entry.is_regular_file()) continue;
+                /// @brief The name of the entry relative to the input directory.
+                ::std::string name = fs::relative(entry.path(), inputPath).generic_string();
+                if (!packFile(writer, entry.path(), name, compression, chunkSize)) return 1;
+            }
+        }
+    } catch (const ::std::exception& exception) {
+        ::std::cerr << exception.what() << ::std::endl;
+        return 1;
+    }
+
+    if (!writer.write(argv[1])) return 1;
+    return 0;
+}
\ No newline at end of file
@@ -54,9 +54,11 @@ namespace celerique { namespace vulkan { namespace internal {
         /// @param numVertexElements The number of individual vertices to draw.
         /// @param ptrVertexBuffer The pointer to the vertex buffer.
         /// @param ptrIndexBuffer The pointer to the index buffer.
+        /// @param drawVersion The version of the vertices and indices, changed by the caller whenever their contents change.
         void draw(
             PipelineConfigID graphicsPipelineConfigId, size_t numVerticesToDraw, size_t vertexStride = 0,
-            size_t numVertexElements = 0, void* ptrVertexBuffer = nullptr, uint32_t* ptrIndexBuffer = nullptr
+            size_t numVertexElements = 0, void* ptrVertexBuffer = nullptr, uint32_t* ptrIndexBuffer = nullptr,
+            uint64_t drawVersion = 0
         ) override;
 
         /// @brief Add the window handle to the graphics API.
@@ -70,6 +72,18 @@ namespace celerique { namespace vulkan { namespace internal {
         /// @param windowHandle The handle to the window of which swapchain to re-create.
         void reCreateSwapChain(Pointer windowHandle) override;
 
+        /// @brief Reuse the command buffer recorded for a swapchain image while the draw's pipeline,
+        /// vertices and indices stay the same, instead of uploading the mesh and recording every frame.
+        /// @param isEnabled Whether to cache recorded command buffers.
+        void setCommandBufferCaching(bool isEnabled) override;
+        /// @brief The statistics of the command buffers cached for unchanged draws.
+        /// @return A copy of the statistics.
+        CommandBufferCacheStats commandBufferCacheStats() override;
+        /// @brief Render each draw once into an offscreen image, then blit it into every window sharing
+        /// a logical device with a single queue submission and a single present.
+        /// @param isEnabled Whether windows share one rendering of the scene.
+        void setSharedSceneRendering(bool isEnabled) override;
+
     private:
         /// @brief The shared pointer to the singleton instance.
         static ::std::shared_ptr<internal::GraphicsAPI> _ptrInst;
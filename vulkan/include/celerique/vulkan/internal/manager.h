@@ -22,6 +22,9 @@ License: Mozilla Public License 2.0. (See ./LICENSE).
 #include <vector>
 #include <unordered_map>
 #include <shared_mutex>
+#include <mutex>
+#include <memory>
+#include <chrono>
 
 namespace celerique { namespace vulkan { namespace internal {
     /// @brief The type of UI protocol used to create UI elements.
@@ -29,6 +32,59 @@ namespace celerique { namespace vulkan { namespace internal {
     /// @brief The type for a pointer container.
     typedef CeleriquePointer Pointer;
 
+    /// @brief The number of frames a shared scene target renders ahead.
+    constexpr size_t numSharedSceneFrames = 2;
+
+    /// @brief The offscreen image a scene is rendered to once, then blitted to every window of a logical device.
+    struct SharedSceneTarget final {
+        /// @brief The render pass compatible with the windows' one, leaving the image ready to be blitted from.
+        VkRenderPass renderPass = nullptr;
+        /// @brief The format of the image, the one of the windows' swapchain images.
+        VkFormat format = VK_FORMAT_UNDEFINED;
+        /// @brief The filter used when scaling the image to a window.
+        VkFilter blitFilter = VK_FILTER_NEAREST;
+        /// @brief The handle to the offscreen image.
+        VkImage image = nullptr;
+        /// @brief The handle to the memory of the offscreen image.
+        VkDeviceMemory imageMemory = nullptr;
+        /// @brief The handle to the view of the offscreen image.
+        VkImageView imageView = nullptr;
+        /// @brief The handle to the framebuffer attaching the offscreen image.
+        VkFramebuffer frameBuffer = nullptr;
+        /// @brief The extent of the offscreen image, covering every window.
+        VkExtent2D extent = {0, 0};
+        /// @brief The command buffers, one per frame.
+        ::std::vector<VkCommandBuffer> vecCommandBuffers;
+        /// @brief The in-flight fences, one per frame.
+        ::std::vector<VkFence> vecInFlightFences;
+        /// @brief The semaphores signaled when a frame finished rendering, waited on by its present.
+        ::std::vector<VkSemaphore> vecRenderFinishedSemaphores;
+        /// @brief The mesh buffer handles, one per frame.
+        ::std::vector<VkBuffer> vecMeshBuffers;
+        /// @brief The mesh buffer memory handles, one per frame.
+        ::std::vector<VkDeviceMemory> vecMeshBufferMemories;
+        /// @brief The map of a window to its image available semaphores, one per frame.
+        ::std::unordered_map<Pointer, ::std::vector<VkSemaphore>> mapWindowToVecImageAvailableSemaphores;
+        /// @brief The index of the frame being rendered.
+        size_t currentFrameIndex = 0;
+        /// @brief The mutex for the target's frames, which are drawn under the manager's shared lock.
+        ::std::unique_ptr<::std::mutex> ptrMutex;
+    };
+
+    /// @brief A GPU buffer rewritten by the CPU every frame, N-buffered and persistently mapped.
+    struct DynamicBuffer final {
+        /// @brief The pointer to the mapped memory of every copy.
+        Byte* ptrMapped = nullptr;
+        /// @brief The distance between copies, aligned for binding at any copy.
+        VkDeviceSize copyStride = 0;
+        /// @brief The index of the copy of the frame last written.
+        size_t currentCopyIndex = 0;
+        /// @brief The presented frame the current copy was handed out for. `UINT64_MAX` before the first.
+        uint64_t currentFrameIndex = UINT64_MAX;
+        /// @brief Whether the memory is device local, such as through a resizable BAR.
+        bool isDeviceLocal = false;
+    };
+
     /// @brief The description for the vulkan resource manager.
     /// There should only be a single instance to this class.
     class Manager final {
@@ -55,9 +111,11 @@ namespace celerique { namespace vulkan { namespace internal {
         /// @param numVertexElements The number of individual vertices to draw.
         /// @param ptrVertexBuffer The pointer to the vertex buffer.
         /// @param ptrIndexBuffer The pointer to the index buffer.
+        /// @param drawVersion The version of the vertices and indices, changed by the caller whenever their contents
+        /// change. 0 when unversioned.
         void draw(
             PipelineConfigID graphicsPipelineConfigId, size_t numVerticesToDraw, size_t vertexStride,
-            size_t numVertexElements, void* ptrVertexBuffer, uint32_t* ptrIndexBuffer
+            size_t numVertexElements, void* ptrVertexBuffer, uint32_t* ptrIndexBuffer, uint64_t drawVersion
         );
 
         /// @brief Add the window handle to the graphics API.
@@ -71,6 +129,17 @@ namespace celerique { namespace vulkan { namespace internal {
         /// @param windowHandle The handle to the window whose swapchain needs to be recreated.
         void reCreateSwapChain(Pointer windowHandle);
 
+        /// @brief Reuse the command buffer recorded for a swapchain image while the draw stays the same.
+        /// @param isEnabled Whether to cache recorded command buffers.
+        void setCommandBufferCaching(bool isEnabled);
+        /// @brief The statistics of the command buffers cached for unchanged draws.
+        /// @return A copy of the statistics.
+        CommandBufferCacheStats commandBufferCacheStats();
+        /// @brief Render each draw once into an offscreen image, then blit it into every window sharing
+        /// a logical device with a single queue submission and a single present.
+        /// @param isEnabled Whether windows share one rendering of the scene.
+        void setSharedSceneRendering(bool isEnabled);
+
         /// @brief Create a buffer of memory in the GPU.
         /// @param currentId The unique identifier of the GPU buffer.
         /// @param size The size of the memory to create & allocate.
@@ -81,11 +150,27 @@ namespace celerique { namespace vulkan { namespace internal {
             GpuBufferID currentId, size_t size, GpuBufferUsage usageFlagBits,
             ShaderStage shaderStage, size_t bindingPoint
         );
-        /// @brief Copy data from the CPU to the GPU buffer.
+        /// @brief Copy data from the CPU to the GPU buffer. Dynamic buffers are written directly
+        /// into the copy of the current frame.
         /// @param bufferId The unique identifier of the GPU buffer.
         /// @param ptrDataSrc The pointer to where the data to be copied to the GPU resides.
         /// @param dataSize The size of the data to be copied.
         void copyToBuffer(GpuBufferID bufferId, void* ptrDataSrc, size_t dataSize);
+        /// @brief Copy data from the CPU to many ranges of GPU buffers. The ranges of every logical device are
+        /// packed into one staging buffer and copied with one command per destination buffer in a single
+        /// submission. The ranges of a dynamic buffer are written directly to the copy of the current frame,
+        /// which keeps the rest of the buffer's latest contents.
+        /// @param vecRegions The ranges to be overwritten. Ranges of the same buffer must not overlap.
+        void copyToBufferRegions(const ::std::vector<GpuBufferRegion>& vecRegions);
+        /// @brief Get the pointer to the copy of a dynamic GPU buffer for the current frame.
+        /// @param bufferId The unique identifier of a GPU buffer created with `CELERIQUE_GPU_BUFFER_USAGE_DYNAMIC`.
+        /// @return The persistently mapped pointer to the copy.
+        void* mapDynamicBuffer(GpuBufferID bufferId);
+        /// @brief Get the offset of the copy of a dynamic GPU buffer last written, to be passed as the dynamic
+        /// offset of its descriptor.
+        /// @param bufferId The unique identifier of a GPU buffer created with `CELERIQUE_GPU_BUFFER_USAGE_DYNAMIC`.
+        /// @return The byte offset of the copy within the buffer.
+        size_t dynamicBufferOffset(GpuBufferID bufferId);
         /// @brief Free the specified GPU buffer.
         /// @param bufferId The unique identifier of the GPU buffer.
         void freeBuffer(GpuBufferID bufferId);
@@ -111,6 +196,21 @@ namespace celerique { namespace vulkan { namespace internal {
         void destroySyncObjects();
         /// @brief Destroy all memory buffer handlers.
         void destroyMemoryBufferHandlers();
+        /// @brief Destroy the mesh buffers read by the cached command buffers of a window.
+        /// The command buffers must not be pending execution.
+        /// @param windowHandle The handle to the window.
+        void destroyCachedMeshBuffers(Pointer windowHandle);
+        /// @brief Free the cached command buffers of a window and forget what they were recorded for.
+        /// They must not be pending execution.
+        /// @param windowHandle The handle to the window.
+        void destroyCachedCommandBuffers(Pointer windowHandle);
+        /// @brief Destroy the shared scene target of a logical device. The device must be idle.
+        /// @param graphicsLogicalDevice The handle to the graphics logical device.
+        void destroySharedSceneTarget(VkDevice graphicsLogicalDevice);
+        /// @brief Destroy the offscreen image of a shared scene target. It must not be in use.
+        /// @param graphicsLogicalDevice The handle to the graphics logical device that created it.
+        /// @param refTarget The reference to the shared scene target.
+        void destroySharedSceneImage(VkDevice graphicsLogicalDevice, SharedSceneTarget& refTarget);
         /// @brief Destroy all pipeline related objects.
         void destroyPipelines();
         /// @brief Destroy all swapchain frame buffers.
@@ -161,12 +261,30 @@ namespace celerique { namespace vulkan { namespace internal {
         /// @brief Create the command buffers for the window.
         /// @param windowHandle The UI protocol native pointer of the window to be registered.
         void createCommandBuffers(Pointer windowHandle);
+        /// @brief Create the command buffers cached for the window, one per swapchain image.
+        /// @param windowHandle The UI protocol native pointer of the window to be registered.
+        void createCachedCommandBuffers(Pointer windowHandle);
         /// @brief Create the containers for the mesh buffer handles.
         /// @param windowHandle The UI protocol native pointer of the window to be registered.
         void createContainersForMeshBufferHandles(Pointer windowHandle);
+        /// @brief Create the containers for the mesh buffer handles read by the cached command buffers.
+        /// @param windowHandle The UI protocol native pointer of the window to be registered.
+        void createContainersForCachedMeshBufferHandles(Pointer windowHandle);
         /// @brief Create synchronization objects.
         /// @param windowHandle The UI protocol native pointer of the window to be registered.
         void createSyncObjects(Pointer windowHandle);
+        /// @brief Join the window to the shared scene target of its logical device, creating the target if needed.
+        /// @param windowHandle The UI protocol native pointer of the window to be registered.
+        void joinSharedSceneTarget(Pointer windowHandle);
+        /// @brief Remove the window from the shared scene target of its logical device, destroying the target
+        /// once no window is left in it. The device must be idle.
+        /// @param windowHandle The UI protocol native pointer of the window.
+        void leaveSharedSceneTarget(Pointer windowHandle);
+        /// @brief Create the shared scene target of a logical device. Logs a warning and creates nothing
+        /// if the format cannot be blitted.
+        /// @param graphicsLogicalDevice The handle to the graphics logical device.
+        /// @param format The format of the windows' swapchain images.
+        void createSharedSceneTarget(VkDevice graphicsLogicalDevice, VkFormat format);
 
     // Swapchain helper functions.
     private:
@@ -199,9 +317,11 @@ namespace celerique { namespace vulkan { namespace internal {
         /// @param numVertexElements The number of individual vertices to draw.
         /// @param ptrVertexBuffer The pointer to the vertex buffer.
         /// @param ptrIndexBuffer The pointer to the index buffer.
+        /// @param drawVersion The version of the vertices and indices. 0 when unversioned.
         void drawOnWindow(
             Pointer windowHandle, PipelineConfigID graphicsPipelineConfigId, size_t numVerticesToDraw,
-            size_t vertexStride, size_t numVertexElements, void* ptrVertexBuffer, uint32_t* ptrIndexBuffer
+            size_t vertexStride, size_t numVertexElements, void* ptrVertexBuffer, uint32_t* ptrIndexBuffer,
+            uint64_t drawVersion
         );
         /// @brief Fill the mesh buffer with vertices and indices to be drawn.
         /// @param numVerticesToDraw The number of vertices to be drawn.
@@ -216,6 +336,59 @@ namespace celerique { namespace vulkan { namespace internal {
             size_t numVerticesToDraw, size_t vertexStride, size_t numVertexElements, void* ptrVertexBuffer, uint32_t* ptrIndexBuffer,
             VkDevice graphicsLogicalDevice, VkBuffer* ptrMeshBuffer, VkDeviceMemory* ptrMeshBufferMemory
         );
+        /// @brief Record the commands drawing to a swapchain image.
+        /// @param windowHandle The handle to the window to be drawn graphics on.
+        /// @param commandBuffer The handle to the reset command buffer to record to.
+        /// @param imageIndex The index of the swapchain image to be drawn to.
+        /// @param graphicsPipelineConfigId The identifier for the graphics pipeline configuration to be used for drawing.
+        /// @param numVerticesToDraw The number of vertices to be drawn.
+        /// @param vertexStride The size of the individual vertex input.
+        /// @param numVertexElements The number of individual vertices to draw.
+        /// @param hasVertexBuffer Whether a vertex buffer was specified.
+        /// @param hasIndexBuffer Whether an index buffer was specified.
+        /// @param meshBuffer The handle to the buffer containing vertex and index data.
+        void recordDrawCommands(
+            Pointer windowHandle, VkCommandBuffer commandBuffer, uint32_t imageIndex,
+            PipelineConfigID graphicsPipelineConfigId, size_t numVerticesToDraw, size_t vertexStride,
+            size_t numVertexElements, bool hasVertexBuffer, bool hasIndexBuffer, VkBuffer meshBuffer
+        );
+        /// @brief Record a render pass drawing to a framebuffer.
+        /// @param commandBuffer The handle to the command buffer being recorded.
+        /// @param renderPass The handle to the render pass compatible with the pipeline.
+        /// @param frameBuffer The handle to the framebuffer to be drawn to.
+        /// @param extent The extent of the framebuffer.
+        /// @param graphicsPipelineConfigId The identifier for the graphics pipeline configuration to be used for drawing.
+        /// @param numVerticesToDraw The number of vertices to be drawn.
+        /// @param vertexStride The size of the individual vertex input.
+        /// @param numVertexElements The number of individual vertices to draw.
+        /// @param hasVertexBuffer Whether a vertex buffer was specified.
+        /// @param hasIndexBuffer Whether an index buffer was specified.
+        /// @param meshBuffer The handle to the buffer containing vertex and index data.
+        void recordDrawPass(
+            VkCommandBuffer commandBuffer, VkRenderPass renderPass, VkFramebuffer frameBuffer, const VkExtent2D& extent,
+            PipelineConfigID graphicsPipelineConfigId, size_t numVerticesToDraw, size_t vertexStride,
+            size_t numVertexElements, bool hasVertexBuffer, bool hasIndexBuffer, VkBuffer meshBuffer
+        );
+        /// @brief Draw graphics once to the shared scene target of a logical device, then blit it to every window,
+        /// submitting and presenting them together.
+        /// @param graphicsLogicalDevice The handle to the graphics logical device.
+        /// @param vecWindowHandles The handles to the windows to be drawn graphics on.
+        /// @param graphicsPipelineConfigId The identifier for the graphics pipeline configuration to be used for drawing.
+        /// @param numVerticesToDraw The number of vertices to be drawn.
+        /// @param vertexStride The size of the individual vertex input.
+        /// @param numVertexElements The number of individual vertices to draw.
+        /// @param ptrVertexBuffer The pointer to the vertex buffer.
+        /// @param ptrIndexBuffer The pointer to the index buffer.
+        void drawSharedScene(
+            VkDevice graphicsLogicalDevice, const ::std::vector<Pointer>& vecWindowHandles,
+            PipelineConfigID graphicsPipelineConfigId, size_t numVerticesToDraw, size_t vertexStride,
+            size_t numVertexElements, void* ptrVertexBuffer, uint32_t* ptrIndexBuffer
+        );
+        /// @brief (Re-)create the offscreen image of a shared scene target. Waits for its frames to finish.
+        /// @param graphicsLogicalDevice The handle to the graphics logical device.
+        /// @param refTarget The reference to the shared scene target.
+        /// @param extent The extent of the image.
+        void createSharedSceneImage(VkDevice graphicsLogicalDevice, SharedSceneTarget& refTarget, const VkExtent2D& extent);
 
     // Pipeline helper functions.
     private:
@@ -256,6 +429,44 @@ namespace celerique { namespace vulkan { namespace internal {
             VkBuffer* ptrBuffer,
             VkDeviceMemory* ptrBufferMemory
         );
+        /// @brief Get the copy of a dynamic buffer for the current frame, waiting until the frame
+        /// that last used it finished on the GPU. A frame handing out a copy first fills it with the
+        /// buffer's latest contents, so writes to part of it keep the rest.
+        /// @param bufferId The unique identifier of the dynamic GPU buffer.
+        /// @param refDynamicBuffer The reference to the copies of the dynamic buffer.
+        /// @param isFullyOverwritten Whether the caller overwrites the whole buffer, so nothing is carried over.
+        /// @return The pointer to the mapped memory of the copy.
+        Byte* currentDynamicBufferCopy(GpuBufferID bufferId, DynamicBuffer& refDynamicBuffer, bool isFullyOverwritten);
+        /// @brief Keep the fence of a submission of the current frame, so the frame's dynamic buffer copies
+        /// are handed out again only once it signaled.
+        /// @param logicalDevice The logical device submitted to.
+        /// @param submitFence The fence signaled when the submission finished.
+        void addDynamicBufferFrameFence(VkDevice logicalDevice, VkFence submitFence);
+        /// @brief Advance to the next frame if the draw that just ended submitted to any window.
+        void endDynamicBufferFrame();
+        /// @brief Wait until the GPU finished the last frame that read a copy of the dynamic buffers of a logical device.
+        /// @param logicalDevice The logical device of the dynamic buffers.
+        /// @param copyIndex The index of the copy.
+        void waitForDynamicBufferFrame(VkDevice logicalDevice, size_t copyIndex);
+        /// @brief Forget the submission fences kept for the frames of an idle logical device.
+        /// @param logicalDevice The logical device.
+        void forgetDynamicBufferFrameFences(VkDevice logicalDevice);
+        /// @brief Create a persistently mapped buffer object, preferring device local host visible memory
+        /// and falling back to host memory.
+        /// @param logicalDevice The logical device used to create the resources.
+        /// @param deviceSize The size of the memory to be allocated.
+        /// @param usageFlags The buffer's usage.
+        /// @param ptrBuffer The pointer to the buffer handle.
+        /// @param ptrBufferMemory The pointer to the buffer memory handle.
+        /// @param ptrDynamicBuffer The pointer to the dynamic buffer to be given the mapped memory.
+        void createDynamicBufferAndAllocateMemory(
+            VkDevice logicalDevice,
+            VkDeviceSize deviceSize,
+            VkBufferUsageFlags usageFlags,
+            VkBuffer* ptrBuffer,
+            VkDeviceMemory* ptrBufferMemory,
+            DynamicBuffer* ptrDynamicBuffer
+        );
         /// @brief Find the memory type index of a given physical device.
         /// @param physicalDevice The physical device specified.
         /// @param typeFilter The bit field types that are suitable.
@@ -281,6 +492,36 @@ namespace celerique { namespace vulkan { namespace internal {
         /// @param leftVecIndices The vector of indices on the left hand side.
         /// @param rightVecIndices The vector of indices on the right hand side.
         static ::std::vector<uint32_t> getUniqueIndices(const ::std::vector<uint32_t>& leftVecIndices, const ::std::vector<uint32_t>& rightVecIndices);
+        /// @brief Hash everything the commands drawing to a swapchain image are recorded from with 64-bit FNV-1a.
+        /// The vertices and indices are represented by the caller's draw version, so hashing never reads them.
+        /// @param graphicsPipelineConfigId The identifier for the graphics pipeline configuration to be used for drawing.
+        /// @param numVerticesToDraw The number of vertices to be drawn.
+        /// @param vertexStride The size of the individual vertex input.
+        /// @param numVertexElements The number of individual vertices to draw.
+        /// @param swapChainExtent The extent of the swapchain image drawn to.
+        /// @param hasVertexBuffer Whether a vertex buffer is drawn.
+        /// @param hasIndexBuffer Whether an index buffer is drawn.
+        /// @param drawVersion The version of the vertices and indices.
+        /// @return The hash of the draw. 0 for unversioned draws, which are never replayed.
+        static uint64_t hashDraw(
+            PipelineConfigID graphicsPipelineConfigId, size_t numVerticesToDraw, size_t vertexStride,
+            size_t numVertexElements, const VkExtent2D& swapChainExtent, bool hasVertexBuffer,
+            bool hasIndexBuffer, uint64_t drawVersion
+        );
+        /// @brief Whether any two non-empty ranges of the same GPU buffer overlap.
+        /// @param vecRegions The ranges to be checked.
+        /// @return `true` if a byte of a buffer is written by more than one range.
+        static bool hasOverlappingRegions(const ::std::vector<GpuBufferRegion>& vecRegions);
+        /// @brief Whether a window is drawn through its device's shared scene rather than on its own.
+        /// @param isSharingSceneRendering Whether shared scene rendering is enabled.
+        /// @param ptrTarget The pointer to the shared scene target of the window's device, or null if it has none.
+        /// @param windowHandle The handle to the window.
+        /// @param swapChainImageUsage The usage the window's swapchain images were created with.
+        /// @return `true` if the window joined the target and its swapchain images can be blitted to.
+        static bool isDrawnWithSharedScene(
+            bool isSharingSceneRendering, const SharedSceneTarget* ptrTarget,
+            Pointer windowHandle, VkImageUsageFlags swapChainImageUsage
+        );
 
     // Helper functions.
     private:
@@ -410,6 +651,8 @@ namespace celerique { namespace vulkan { namespace internal {
         ::std::unordered_map<Pointer, VkDevice> _mapWindowToGraphicsLogicDev;
         /// @brief The map of a window to its swapchain image format.
         ::std::unordered_map<Pointer, VkFormat> _mapWindowToSwapChainImageFormat;
+        /// @brief The map of a window to the usage of its swapchain images.
+        ::std::unordered_map<Pointer, VkImageUsageFlags> _mapWindowToSwapChainImageUsage;
         /// @brief The map of a window to the extent description of its swapchain.
         ::std::unordered_map<Pointer, VkExtent2D> _mapWindowToSwapChainExtent;
         /// @brief The map of window to its swapchain.
@@ -436,6 +679,17 @@ namespace celerique { namespace vulkan { namespace internal {
         ::std::unordered_map<Pointer, ::std::vector<VkSemaphore>> _mapWindowToVecRenderFinishedSemaphores;
         /// @brief The map of a window to its in-flight fences.
         ::std::unordered_map<Pointer, ::std::vector<VkFence>> _mapWindowToVecInFlightFences;
+        /// @brief The map of a window to the in-flight fence of the last submission drawing to each swapchain image.
+        ::std::unordered_map<Pointer, ::std::vector<VkFence>> _mapWindowToVecImageInFlightFences;
+        /// @brief The map of a window to its cached command buffers, one per swapchain image.
+        ::std::unordered_map<Pointer, ::std::vector<VkCommandBuffer>> _mapWindowToVecCachedCommandBuffers;
+        /// @brief The map of a window to the hash of the draw each cached command buffer was recorded for.
+        /// 0 when not recorded.
+        ::std::unordered_map<Pointer, ::std::vector<uint64_t>> _mapWindowToVecCachedDrawHashes;
+        /// @brief The map of a window to the mesh buffer handles read by its cached command buffers.
+        ::std::unordered_map<Pointer, ::std::vector<VkBuffer>> _mapWindowToVecCachedMeshBuffers;
+        /// @brief The map of a window to the mesh buffer memory handles read by its cached command buffers.
+        ::std::unordered_map<Pointer, ::std::vector<VkDeviceMemory>> _mapWindowToVecCachedMeshBufferMemories;
 
     // Pipeline resources.
     private:
@@ -464,6 +718,43 @@ namespace celerique { namespace vulkan { namespace internal {
         ::std::unordered_map<GpuBufferID, size_t> _mapGpuBufferIdToSize;
         /// @brief The map of a GPU buffer ID to its descriptor set layouts.
         ::std::unordered_map<GpuBufferID, VkDescriptorSetLayout> _mapGpuBufferIdToDescSetLayouts;
+        /// @brief The map of a dynamic GPU buffer ID to its copies.
+        ::std::unordered_map<GpuBufferID, DynamicBuffer> _mapGpuBufferIdToDynamicBuffer;
+        /// @brief The map of a logical device to the fences of the submissions of the last frame that read
+        /// each dynamic buffer copy. The fences belong to the windows and shared scene targets.
+        ::std::unordered_map<VkDevice, ::std::vector<::std::vector<VkFence>>> _mapLogicDevToVecFrameSubmitFences;
+        /// @brief The number of frames presented, selecting the copy of every dynamic buffer written.
+        uint64_t _dynamicBufferFrameIndex = 0;
+        /// @brief Whether the draw of the current frame submitted to any window.
+        bool _isDynamicBufferFrameSubmitted = false;
+        /// @brief The mutex object serializing the submissions of concurrent draw threads.
+        ::std::mutex _dynamicBufferFrameMutex;
+
+    // Command buffer caching.
+    private:
+        /// @brief Whether the command buffers recorded for unchanged draws are replayed.
+        bool _isCachingCommandBuffers = false;
+        /// @brief The mutex object guarding the command buffer cache timings, updated by every window's draw thread.
+        ::std::mutex _cacheStatsMutex;
+        /// @brief The number of frames whose commands were recorded into a cached command buffer.
+        uint64_t _numCachedFramesRecorded = 0;
+        /// @brief The number of frames that replayed a cached command buffer.
+        uint64_t _numCachedFramesReplayed = 0;
+        /// @brief The number of mesh uploads for cached command buffers.
+        uint64_t _numCachedMeshFills = 0;
+        /// @brief The CPU time spent recording cached command buffers, mesh uploads excluded.
+        ::std::chrono::nanoseconds _cachedRecordTime = ::std::chrono::nanoseconds::zero();
+        /// @brief The CPU time spent uploading the meshes of cached command buffers.
+        ::std::chrono::nanoseconds _cachedMeshFillTime = ::std::chrono::nanoseconds::zero();
+        /// @brief The CPU time replayed frames spent checking that nothing changed.
+        ::std::chrono::nanoseconds _cachedReplayTime = ::std::chrono::nanoseconds::zero();
+
+    // Shared scene rendering.
+    private:
+        /// @brief Whether windows sharing a logical device share one rendering of the scene.
+        bool _isSharingSceneRendering = false;
+        /// @brief The map of a graphics logical device to its shared scene target.
+        ::std::unordered_map<VkDevice, SharedSceneTarget> _mapLogicDevToSharedSceneTarget;
 
     // Validation layer objects.
 #if defined(CELERIQUE_DEBUG_MODE)
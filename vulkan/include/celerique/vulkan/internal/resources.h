@@ -35,6 +35,23 @@ namespace celerique { namespace vulkan { namespace internal {
         /// @param ptrDataSrc The pointer to where the data to be copied to the GPU resides.
         /// @param dataSize The size of the data to be copied.
         void copyToBuffer(GpuBufferID bufferId, void* ptrDataSrc, size_t dataSize) override;
+        /// @brief Copy data from the CPU to a range of the GPU buffer, keeping the rest of its data.
+        /// @param bufferId The unique identifier of the GPU buffer.
+        /// @param offset The byte offset of the range within the GPU buffer.
+        /// @param ptrDataSrc The pointer to where the data to be copied to the GPU resides.
+        /// @param dataSize The size of the data to be copied.
+        void copyToBufferRegion(GpuBufferID bufferId, size_t offset, const void* ptrDataSrc, size_t dataSize) override;
+        /// @brief Copy data from the CPU to many ranges of GPU buffers through one staging buffer and one submission.
+        /// @param vecRegions The ranges to be overwritten. Ranges of the same buffer must not overlap.
+        void copyToBufferRegions(const ::std::vector<GpuBufferRegion>& vecRegions) override;
+        /// @brief Get the pointer to the copy of a dynamic GPU buffer for the current frame.
+        /// @param bufferId The unique identifier of a GPU buffer created with `CELERIQUE_GPU_BUFFER_USAGE_DYNAMIC`.
+        /// @return The persistently mapped pointer to the copy.
+        void* mapDynamicBuffer(GpuBufferID bufferId) override;
+        /// @brief Get the offset of the copy of a dynamic GPU buffer last written, to be bound as its dynamic offset.
+        /// @param bufferId The unique identifier of a GPU buffer created with `CELERIQUE_GPU_BUFFER_USAGE_DYNAMIC`.
+        /// @return The byte offset of the copy within the buffer.
+        size_t dynamicBufferOffset(GpuBufferID bufferId) override;
         /// @brief Free the specified GPU buffer.
         /// @param bufferId The unique identifier of the GPU buffer.
         void freeBuffer(GpuBufferID bufferId) override;
@@ -78,11 +78,14 @@ void celerique::vulkan::internal::GraphicsAPI::updateUniform(
 /// @param numVertexElements The number of individual vertices to draw.
 /// @param ptrVertexBuffer The pointer to the vertex buffer.
 /// @param ptrIndexBuffer The pointer to the index buffer.
+/// @param drawVersion The version of the vertices and indices, changed by the caller whenever their contents change.
 void ::celerique::vulkan::internal::GraphicsAPI::draw(
     PipelineConfigID graphicsPipelineConfigId, size_t numVerticesToDraw, size_t vertexStride,
-    size_t numVertexElements, void* ptrVertexBuffer, uint32_t* ptrIndexBuffer
+    size_t numVertexElements, void* ptrVertexBuffer, uint32_t* ptrIndexBuffer, uint64_t drawVersion
 ) {
-    refManager.draw(graphicsPipelineConfigId, numVerticesToDraw, vertexStride, numVertexElements, ptrVertexBuffer, ptrIndexBuffer);
+    refManager.draw(
+        graphicsPipelineConfigId, numVerticesToDraw, vertexStride, numVertexElements, ptrVertexBuffer, ptrIndexBuffer, drawVersion
+    );
 }
 
 /// @brief Add the window handle to the graphics API.
@@ -104,6 +107,26 @@ void ::celerique::vulkan::internal::GraphicsAPI::reCreateSwapChain(Pointer windo
     refManager.reCreateSwapChain(windowHandle);
 }
 
+/// @brief Reuse the command buffer recorded for a swapchain image while the draw's pipeline,
+/// vertices and indices stay the same, instead of uploading the mesh and recording every frame.
+/// @param isEnabled Whether to cache recorded command buffers.
+void ::celerique::vulkan::internal::GraphicsAPI::setCommandBufferCaching(bool isEnabled) {
+    refManager.setCommandBufferCaching(isEnabled);
+}
+
+/// @brief The statistics of the command buffers cached for unchanged draws.
+/// @return A copy of the statistics.
+::celerique::CommandBufferCacheStats celerique::vulkan::internal::GraphicsAPI::commandBufferCacheStats() {
+    return refManager.commandBufferCacheStats();
+}
+
+/// @brief Render each draw once into an offscreen image, then blit it into every window sharing
+/// a logical device with a single queue submission and a single present.
+/// @param isEnabled Whether windows share one rendering of the scene.
+void ::celerique::vulkan::internal::GraphicsAPI::setSharedSceneRendering(bool isEnabled) {
+    refManager.setSharedSceneRendering(isEnabled);
+}
+
 /// @brief The shared pointer to the singleton instance.
 ::std::shared_ptr<::celerique::vulkan::internal::GraphicsAPI> celerique::vulkan::internal::GraphicsAPI::_ptrInst = nullptr;
 
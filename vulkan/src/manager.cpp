@@ -17,6 +17,7 @@ License: Mozilla Public License 2.0. (See ./LICENSE).
 #include <mutex>
 #include <algorithm>
 #include <thread>
+#include <chrono>
 
 // Target platform defines for vulkan.
 #if (defined(CELERIQUE_FOR_LINUX_SYSTEMS) || defined(CELERIQUE_FOR_BSD_SYSTEMS)) && !defined(CELERIQUE_FOR_ANDROID)
@@ -267,6 +268,11 @@ void ::celerique::vulkan::internal::Manager::removeGraphicsPipeline(PipelineConf
     }
     // Erase.
     _mapGraphicsPipelineIdToListShaderModules.erase(graphicsPipelineConfigId);
+
+    // Re-record every cached command buffer, as a new pipeline may reuse the handle.
+    for (auto& pairWindowToVecCachedDrawHashes : _mapWindowToVecCachedDrawHashes) {
+        ::std::fill(pairWindowToVecCachedDrawHashes.second.begin(), pairWindowToVecCachedDrawHashes.second.end(), 0);
+    }
 }
 
 /// @brief Clear the collection of graphics pipelines.
@@ -307,6 +313,11 @@ void ::celerique::vulkan::internal::Manager::clearGraphicsPipelines() {
         // Erase.
         _mapGraphicsPipelineIdToListShaderModules.erase(graphicsPipelineConfigId);
     }
+
+    // Re-record every cached command buffer, as a new pipeline may reuse a handle.
+    for (auto& pairWindowToVecCachedDrawHashes : _mapWindowToVecCachedDrawHashes) {
+        ::std::fill(pairWindowToVecCachedDrawHashes.second.begin(), pairWindowToVecCachedDrawHashes.second.end(), 0);
+    }
 }
 
 /// @brief Graphics draw call.
@@ -316,21 +327,49 @@ void ::celerique::vulkan::internal::Manager::clearGraphicsPipelines() {
 /// @param numVertexElements The number of individual vertices to draw.
 /// @param ptrVertexBuffer The pointer to the vertex buffer.
 /// @param ptrIndexBuffer The pointer to the index buffer.
+/// @param drawVersion The version of the vertices and indices, changed by the caller whenever their contents
+/// change. 0 when unversioned.
 void ::celerique::vulkan::internal::Manager::draw(
     PipelineConfigID graphicsPipelineConfigId, size_t numVerticesToDraw, size_t vertexStride,
-    size_t numVertexElements, void* ptrVertexBuffer, uint32_t* ptrIndexBuffer
+    size_t numVertexElements, void* ptrVertexBuffer, uint32_t* ptrIndexBuffer, uint64_t drawVersion
 ) {
     ::std::shared_lock<::std::shared_mutex> readLock(_sharedMutex);
 
     /// @brief The container for the thread handles that executes the draw calls for each window.
     ::std::list<::std::thread> listDrawCallThreads;
+    /// @brief The map of a graphics logical device to the windows sharing its rendering of the scene.
+    ::std::unordered_map<VkDevice, ::std::vector<Pointer>> mapLogicDevToVecSharingWindows;
     // Iterate over all windows to be drawn.
     for (const auto& pairWindowToSurface : _mapWindowToSurface) {
         /// @brief The window handle.
         Pointer windowHandle = pairWindowToSurface.first;
+        /// @brief The graphics logical device assigned to the window.
+        VkDevice graphicsLogicalDevice = _mapWindowToGraphicsLogicDev[windowHandle];
+        /// @brief The iterator to the shared scene target of the window's logical device.
+        auto sharedSceneTargetIterator = _mapLogicDevToSharedSceneTarget.find(graphicsLogicalDevice);
+        // Windows that joined their device's shared scene share its rendering.
+        if (isDrawnWithSharedScene(
+            _isSharingSceneRendering,
+            sharedSceneTargetIterator != _mapLogicDevToSharedSceneTarget.end() ? &sharedSceneTargetIterator->second : nullptr,
+            windowHandle, _mapWindowToSwapChainImageUsage[windowHandle]
+        )) {
+            mapLogicDevToVecSharingWindows[graphicsLogicalDevice].push_back(windowHandle);
+            continue;
+        }
         // Execute drawing on a different thread.
         ::std::thread drawCallThread(::std::bind(
             &Manager::drawOnWindow, this, windowHandle, graphicsPipelineConfigId, numVerticesToDraw,
+            vertexStride, numVertexElements, ptrVertexBuffer, ptrIndexBuffer, drawVersion
+        ));
+        // Collect thread handle.
+        listDrawCallThreads.emplace_back(::std::move(drawCallThread));
+    }
+    // Render once per logical device for the windows sharing it.
+    for (const auto& pairLogicDevToVecSharingWindows : mapLogicDevToVecSharingWindows) {
+        // Execute drawing on a different thread.
+        ::std::thread drawCallThread(::std::bind(
+            &Manager::drawSharedScene, this, pairLogicDevToVecSharingWindows.first,
+            ::std::cref(pairLogicDevToVecSharingWindows.second), graphicsPipelineConfigId, numVerticesToDraw,
             vertexStride, numVertexElements, ptrVertexBuffer, ptrIndexBuffer
         ));
         // Collect thread handle.
@@ -340,6 +379,7 @@ void ::celerique::vulkan::internal::Manager::draw(
     for (::std::thread& refDrawCallThread : listDrawCallThreads) {
         refDrawCallThread.join();
     }
+    endDynamicBufferFrame();
 }
 
 /// @brief Add the window handle to the graphics API.
@@ -388,7 +428,9 @@ void celerique::vulkan::internal::Manager::addWindow(UiProtocol uiProtocol, Poin
     createSwapChainFrameBuffers(windowHandle);
     createCommandBuffers(windowHandle);
     createContainersForMeshBufferHandles(windowHandle);
+    createContainersForCachedMeshBufferHandles(windowHandle);
     createSyncObjects(windowHandle);
+    if (_isSharingSceneRendering) joinSharedSceneTarget(windowHandle);
 
     celeriqueLogDebug("Registered window.");
 }
@@ -413,6 +455,10 @@ void celerique::vulkan::internal::Manager::removeWindow(Pointer windowHandle) {
     VkDevice graphicsLogicalDevice = _mapWindowToGraphicsLogicDev[windowHandle];
     // Wait for resources to clear out.
     vkDeviceWaitIdle(graphicsLogicalDevice);
+    // The window's fences are about to be destroyed.
+    forgetDynamicBufferFrameFences(graphicsLogicalDevice);
+
+    leaveSharedSceneTarget(windowHandle);
 
     /// @brief The collection of in-flight fences to be destroyed.
     const ::std::vector<VkFence>& vecInFlightFences = _mapWindowToVecInFlightFences[windowHandle];
@@ -421,6 +467,7 @@ void celerique::vulkan::internal::Manager::removeWindow(Pointer windowHandle) {
         vkDestroyFence(graphicsLogicalDevice, inFlightFences, nullptr);
     }
     _mapWindowToVecInFlightFences.erase(windowHandle);
+    _mapWindowToVecImageInFlightFences.erase(windowHandle);
     celeriqueLogTrace("Destroyed window in-flight fences.");
 
     /// @brief The collection of render-finished semaphores.
@@ -442,8 +489,14 @@ void celerique::vulkan::internal::Manager::removeWindow(Pointer windowHandle) {
     celeriqueLogTrace("Destroyed window image available semaphores.");
 
     _mapWindowToVecCommandBuffers.erase(windowHandle);
+    _mapWindowToVecCachedCommandBuffers.erase(windowHandle);
+    _mapWindowToVecCachedDrawHashes.erase(windowHandle);
     celeriqueLogTrace("Removed command buffer references for the window.");
 
+    destroyCachedMeshBuffers(windowHandle);
+    _mapWindowToVecCachedMeshBufferMemories.erase(windowHandle);
+    _mapWindowToVecCachedMeshBuffers.erase(windowHandle);
+
     /// @brief The mesh buffer memory handles to be freed.
     const ::std::vector<VkDeviceMemory>& vecMeshBufferMemories = _mapWindowToVecMeshBufferMemories[windowHandle];
     // Iterate over memories and free.
@@ -493,6 +546,7 @@ void celerique::vulkan::internal::Manager::removeWindow(Pointer windowHandle) {
 
     // Delete swapchain extent.
     _mapWindowToSwapChainExtent.erase(windowHandle);
+    _mapWindowToSwapChainImageUsage.erase(windowHandle);
     celeriqueLogTrace("Erased window swapchain extent.");
 
     _mapWindowToGraphicsCommandPool.erase(windowHandle);
@@ -538,6 +592,9 @@ void celerique::vulkan::internal::Manager::reCreateSwapChain(Pointer windowHandl
 
     // Free existing command buffers.
     vkFreeCommandBuffers(graphicsLogicalDevice, graphicsCommandPool, static_cast<uint32_t>(refVecCommandBuffers.size()), refVecCommandBuffers.data());
+    // The cached command buffers drew to the old swapchain images.
+    destroyCachedCommandBuffers(windowHandle);
+    destroyCachedMeshBuffers(windowHandle);
     // Destroy current framebuffers.
     for (VkFramebuffer frameBuffer : refVecFrameBuffers) {
         vkDestroyFramebuffer(graphicsLogicalDevice, frameBuffer, nullptr);
@@ -553,6 +610,94 @@ void celerique::vulkan::internal::Manager::reCreateSwapChain(Pointer windowHandl
     createSwapChainImageViews(windowHandle);
     createSwapChainFrameBuffers(windowHandle);
     createCommandBuffers(windowHandle);
+    createContainersForCachedMeshBufferHandles(windowHandle);
+    // No submission is pending on the new swapchain images.
+    _mapWindowToVecImageInFlightFences[windowHandle] = ::std::vector<VkFence>(
+        _mapWindowToVecSwapChainFrameBuffers[windowHandle].size(), nullptr
+    );
+    // The new swapchain may have another format, so the window joins the shared scene again.
+    if (_isSharingSceneRendering) {
+        leaveSharedSceneTarget(windowHandle);
+        joinSharedSceneTarget(windowHandle);
+    }
+}
+
+/// @brief Reuse the command buffer recorded for a swapchain image while the draw stays the same.
+/// @param isEnabled Whether to cache recorded command buffers.
+void celerique::vulkan::internal::Manager::setCommandBufferCaching(bool isEnabled) {
+    ::std::unique_lock<::std::shared_mutex> writeLock(_sharedMutex);
+
+    if (_isCachingCommandBuffers == isEnabled) return;
+    _isCachingCommandBuffers = isEnabled;
+    if (isEnabled) {
+        for (const auto& pairWindowToSurface : _mapWindowToSurface) {
+            createCachedCommandBuffers(pairWindowToSurface.first);
+        }
+        celeriqueLogDebug("Enabled command buffer caching.");
+        return;
+    }
+
+    // Release the cached command buffers and what they read from.
+    for (const auto& pairWindowToSurface : _mapWindowToSurface) {
+        /// @brief The handle to the window.
+        Pointer windowHandle = pairWindowToSurface.first;
+        // Wait for the cached command buffers to finish executing.
+        vkDeviceWaitIdle(_mapWindowToGraphicsLogicDev[windowHandle]);
+        destroyCachedMeshBuffers(windowHandle);
+        destroyCachedCommandBuffers(windowHandle);
+    }
+    celeriqueLogDebug("Disabled command buffer caching.");
+}
+
+/// @brief The statistics of the command buffers cached for unchanged draws.
+/// @return A copy of the statistics.
+::celerique::CommandBufferCacheStats celerique::vulkan::internal::Manager::commandBufferCacheStats() {
+    ::std::lock_guard<::std::mutex> lock(_cacheStatsMutex);
+
+    /// @brief The statistics to be returned.
+    CommandBufferCacheStats stats;
+    stats.numFramesRecorded = _numCachedFramesRecorded;
+    stats.numFramesReplayed = _numCachedFramesReplayed;
+    if (_numCachedFramesRecorded > 0) {
+        stats.averageRecordTime = _cachedRecordTime / _numCachedFramesRecorded;
+    }
+    if (_numCachedMeshFills > 0) {
+        stats.averageMeshUploadTime = _cachedMeshFillTime / _numCachedMeshFills;
+    }
+    if (_numCachedFramesReplayed > 0) {
+        stats.averageReplayTime = _cachedReplayTime / _numCachedFramesReplayed;
+    }
+    // Without caching, every frame uploads its mesh and records its commands.
+    if (stats.averageRecordTime + stats.averageMeshUploadTime > stats.averageReplayTime) {
+        stats.savedTimePerFrame = stats.averageRecordTime + stats.averageMeshUploadTime - stats.averageReplayTime;
+    }
+    stats.totalSavedTime = stats.savedTimePerFrame * _numCachedFramesReplayed;
+    return stats;
+}
+
+/// @brief Render each draw once into an offscreen image, then blit it into every window sharing
+/// a logical device with a single queue submission and a single present.
+/// @param isEnabled Whether windows share one rendering of the scene.
+void celerique::vulkan::internal::Manager::setSharedSceneRendering(bool isEnabled) {
+    ::std::unique_lock<::std::shared_mutex> writeLock(_sharedMutex);
+
+    if (_isSharingSceneRendering == isEnabled) return;
+    _isSharingSceneRendering = isEnabled;
+    if (isEnabled) {
+        for (const auto& pairWindowToSurface : _mapWindowToSurface) {
+            joinSharedSceneTarget(pairWindowToSurface.first);
+        }
+        celeriqueLogDebug("Enabled shared scene rendering.");
+        return;
+    }
+
+    for (auto& pairLogicDevToSharedSceneTarget : _mapLogicDevToSharedSceneTarget) {
+        // Wait for the shared scene to finish rendering.
+        vkDeviceWaitIdle(pairLogicDevToSharedSceneTarget.first);
+        destroySharedSceneTarget(pairLogicDevToSharedSceneTarget.first);
+    }
+    _mapLogicDevToSharedSceneTarget.clear();
+    celeriqueLogDebug("Disabled shared scene rendering.");
 }
 
 /// @brief Create a buffer of memory in the GPU.
@@ -591,13 +736,8 @@ void celerique::vulkan::internal::Manager::createBuffer(
     if ((usageFlagBits & CELERIQUE_GPU_BUFFER_USAGE_UNIFORM) != 0) {
         vulkanUsageFlags |= VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT;
     }
-
-    /// @brief The memory property flags to be turned on.
-    VkMemoryPropertyFlags memoryPropertyFlags = 0;
-    if ((usageFlagBits & (CELERIQUE_GPU_BUFFER_USAGE_VERTEX |
-    CELERIQUE_GPU_BUFFER_USAGE_INDEX | CELERIQUE_GPU_BUFFER_USAGE_UNIFORM)) != 0) {
-        vulkanUsageFlags |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
-        memoryPropertyFlags |= VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    if ((usageFlagBits & CELERIQUE_GPU_BUFFER_USAGE_STORAGE) != 0) {
+        vulkanUsageFlags |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
     }
 
     /// @brief The vulkan buffer handle.
@@ -605,21 +745,56 @@ void celerique::vulkan::internal::Manager::createBuffer(
     /// @brief The vulkan device memory handle.
     VkDeviceMemory deviceMemory = nullptr;
 
-    createBufferAndAllocateMemory(
-        logicalDevice, static_cast<VkDeviceSize>(size), vulkanUsageFlags,
-        memoryPropertyFlags, &vkBuffer, &deviceMemory
-    );
+    if ((usageFlagBits & CELERIQUE_GPU_BUFFER_USAGE_DYNAMIC) != 0) {
+        /// @brief The limits of the physical device the buffer is created on.
+        VkPhysicalDeviceProperties physicalDeviceProperties = {};
+        vkGetPhysicalDeviceProperties(_mapLogicDevToPhysDev[logicalDevice], &physicalDeviceProperties);
+        /// @brief The alignment letting each copy be bound as a uniform or storage buffer.
+        VkDeviceSize copyAlignment = ::std::max<VkDeviceSize>({
+            1, physicalDeviceProperties.limits.minUniformBufferOffsetAlignment,
+            physicalDeviceProperties.limits.minStorageBufferOffsetAlignment
+        });
+
+        /// @brief The copies of the buffer, one per frame in flight.
+        DynamicBuffer dynamicBuffer;
+        dynamicBuffer.copyStride = (static_cast<VkDeviceSize>(size) + copyAlignment - 1) / copyAlignment * copyAlignment;
+        createDynamicBufferAndAllocateMemory(
+            logicalDevice, dynamicBuffer.copyStride * CELERIQUE_GPU_BUFFER_NUM_DYNAMIC_COPIES, vulkanUsageFlags,
+            &vkBuffer, &deviceMemory, &dynamicBuffer
+        );
+        _mapGpuBufferIdToDynamicBuffer[currentId] = dynamicBuffer;
+    } else {
+        /// @brief The memory property flags to be turned on.
+        VkMemoryPropertyFlags memoryPropertyFlags = 0;
+        if ((usageFlagBits & (CELERIQUE_GPU_BUFFER_USAGE_VERTEX |
+        CELERIQUE_GPU_BUFFER_USAGE_INDEX | CELERIQUE_GPU_BUFFER_USAGE_UNIFORM |
+        CELERIQUE_GPU_BUFFER_USAGE_STORAGE)) != 0) {
+            vulkanUsageFlags |= VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+            memoryPropertyFlags |= VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+        }
+
+        createBufferAndAllocateMemory(
+            logicalDevice, static_cast<VkDeviceSize>(size), vulkanUsageFlags,
+            memoryPropertyFlags, &vkBuffer, &deviceMemory
+        );
+    }
 
     // Map identifier to resources.
     _mapGpuBufferIdToLogicDev[currentId] = logicalDevice;
     _mapGpuBufferIdToVkBuffer[currentId] = vkBuffer;
     _mapGpuBufferIdToDevMemory[currentId] = deviceMemory;
     _mapGpuBufferIdToSize[currentId] = size;
-    if ((usageFlagBits & CELERIQUE_GPU_BUFFER_USAGE_UNIFORM) != 0) {
+    if ((usageFlagBits & (CELERIQUE_GPU_BUFFER_USAGE_UNIFORM | CELERIQUE_GPU_BUFFER_USAGE_STORAGE)) != 0) {
         /// @brief The description of the uniform layout binding.
         VkDescriptorSetLayoutBinding uniformLayoutBinding = {};
         uniformLayoutBinding.binding = bindingPoint;
-        uniformLayoutBinding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        uniformLayoutBinding.descriptorType = (usageFlagBits & CELERIQUE_GPU_BUFFER_USAGE_UNIFORM) != 0 ?
+            VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        // Dynamic buffers are bound once, selecting the copy of the frame by `dynamicBufferOffset`.
+        if ((usageFlagBits & CELERIQUE_GPU_BUFFER_USAGE_DYNAMIC) != 0) {
+            uniformLayoutBinding.descriptorType = (usageFlagBits & CELERIQUE_GPU_BUFFER_USAGE_UNIFORM) != 0 ?
+                VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC : VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC;
+        }
         uniformLayoutBinding.descriptorCount = 1;
         if ((shaderStage & CELERIQUE_SHADER_STAGE_VERTEX) != 0) {
             uniformLayoutBinding.stageFlags |= VK_SHADER_STAGE_VERTEX_BIT;
@@ -660,7 +835,8 @@ void celerique::vulkan::internal::Manager::createBuffer(
     celeriqueLogDebug("Created buffer ID " + ::std::to_string(currentId) + " of size " + ::std::to_string(size) + ".");
 }
 
-/// @brief Copy data from the CPU to the GPU buffer.
+/// @brief Copy data from the CPU to the GPU buffer. Dynamic buffers are written directly
+/// into the copy of the current frame.
 /// @param bufferId The unique identifier of the GPU buffer.
 /// @param ptrDataSrc The pointer to where the data to be copied to the GPU resides.
 /// @param dataSize The size of the data to be copied.
@@ -678,12 +854,22 @@ void celerique::vulkan::internal::Manager::copyToBuffer(
         throw ::std::runtime_error(errorMessage);
     }
 
+    /// @brief The iterator to the copies of a dynamic buffer.
+    auto dynamicBufferIterator = _mapGpuBufferIdToDynamicBuffer.find(bufferId);
+    if (dynamicBufferIterator != _mapGpuBufferIdToDynamicBuffer.end()) {
+        // The memory is host coherent. The write is visible to the next submission.
+        memcpy(
+            currentDynamicBufferCopy(bufferId, dynamicBufferIterator->second, dataSize == bufferSize),
+            ptrDataSrc, dataSize
+        );
+        return;
+    }
+
     /// @brief The variable that stores the result of any vulkan function called.
     VkResult result;
-    // TODO: Properly select logical device.
 
-    /// @brief The logical device to be used for memory allocations.
-    VkDevice logicalDevice = _vecGraphicsLogicDev[0];
+    /// @brief The logical device that created the buffer, used for memory allocations.
+    VkDevice logicalDevice = _mapGpuBufferIdToLogicDev[bufferId];
     /// @brief The handle to the destination Vulkan buffer.
     VkBuffer vulkanBuffer = _mapGpuBufferIdToVkBuffer[bufferId];
 
@@ -723,6 +909,179 @@ void celerique::vulkan::internal::Manager::copyToBuffer(
     vkDestroyBuffer(logicalDevice, stagingObjectsBuffer, nullptr);
 }
 
+/// @brief Copy data from the CPU to many ranges of GPU buffers. Every range is packed into one staging
+/// buffer and copied with one command per destination buffer in a single submission. The ranges of a
+/// dynamic buffer are written directly to the copy of the current frame, which keeps the rest of the
+/// buffer's latest contents.
+/// @param vecRegions The ranges to be overwritten. Ranges of the same buffer must not overlap.
+void celerique::vulkan::internal::Manager::copyToBufferRegions(const ::std::vector<GpuBufferRegion>& vecRegions) {
+    ::std::unique_lock<::std::shared_mutex> writeLock(_sharedMutex);
+
+    /// @brief The map of a logical device to the size of the staging buffer holding its ranges.
+    ::std::unordered_map<VkDevice, VkDeviceSize> mapLogicDevToStagingSize;
+    /// @brief The logical devices with ranges to be staged, in the order they were first written.
+    ::std::vector<VkDevice> vecStagingLogicDevs;
+    /// @brief The map of a dynamic buffer ID to the number of its bytes overwritten.
+    ::std::unordered_map<GpuBufferID, size_t> mapDynamicBufferIdToWrittenSize;
+    // Check every range before copying any.
+    for (const GpuBufferRegion& region : vecRegions) {
+        /// @brief The iterator to the size of the destination buffer.
+        auto bufferSizeIterator = _mapGpuBufferIdToSize.find(region.bufferId);
+        if (bufferSizeIterator == _mapGpuBufferIdToSize.end()) {
+            ::std::string errorMessage = "Buffer ID " + ::std::to_string(region.bufferId) + " does not exist.";
+            celeriqueLogError(errorMessage);
+            throw ::std::runtime_error(errorMessage);
+        }
+        /// @brief The size of the destination buffer.
+        size_t bufferSize = bufferSizeIterator->second;
+        if (region.offset > bufferSize || region.dataSize > bufferSize - region.offset) {
+            ::std::string errorMessage = "Buffer size is only " + ::std::to_string(bufferSize) +
+                " bytes while the data ends at byte " + ::std::to_string(region.offset + region.dataSize) + ".";
+            celeriqueLogError(errorMessage);
+            throw ::std::runtime_error(errorMessage);
+        }
+        if (region.dataSize == 0) continue;
+        if (_mapGpuBufferIdToDynamicBuffer.find(region.bufferId) != _mapGpuBufferIdToDynamicBuffer.end()) {
+            mapDynamicBufferIdToWrittenSize[region.bufferId] += region.dataSize;
+        } else {
+            /// @brief The logical device the destination buffer was created on.
+            VkDevice logicalDevice = _mapGpuBufferIdToLogicDev[region.bufferId];
+            if (mapLogicDevToStagingSize.find(logicalDevice) == mapLogicDevToStagingSize.end()) {
+                vecStagingLogicDevs.push_back(logicalDevice);
+            }
+            mapLogicDevToStagingSize[logicalDevice] += static_cast<VkDeviceSize>(region.dataSize);
+        }
+    }
+    // The ranges of one buffer are copied by a single command, where overlapping ranges are undefined.
+    if (hasOverlappingRegions(vecRegions)) {
+        ::std::string errorMessage = "Ranges copied to the same buffer must not overlap.";
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
+    }
+
+    // Ranges of dynamic buffers are written directly to the copy of the current frame.
+    for (const GpuBufferRegion& region : vecRegions) {
+        if (region.dataSize == 0) continue;
+        /// @brief The iterator to the copies of a dynamic buffer.
+        auto dynamicBufferIterator = _mapGpuBufferIdToDynamicBuffer.find(region.bufferId);
+        if (dynamicBufferIterator == _mapGpuBufferIdToDynamicBuffer.end()) continue;
+        // Ranges of one buffer do not overlap, so they cover all of it when their sizes add up to its size.
+        memcpy(
+            currentDynamicBufferCopy(
+                region.bufferId, dynamicBufferIterator->second,
+                mapDynamicBufferIdToWrittenSize[region.bufferId] == _mapGpuBufferIdToSize[region.bufferId]
+            ) + region.offset,
+            region.ptrDataSrc, region.dataSize
+        );
+    }
+
+    /// @brief The variable that stores the result of any vulkan function called.
+    VkResult result;
+    // Every logical device stages and copies the ranges of its own buffers.
+    for (VkDevice logicalDevice : vecStagingLogicDevs) {
+        /// @brief The size of the staging buffer holding every range of the logical device.
+        VkDeviceSize stagingSize = mapLogicDevToStagingSize[logicalDevice];
+        /// @brief The CPU accessible buffer holding every range.
+        VkBuffer stagingObjectsBuffer = nullptr;
+        /// @brief The CPU accessible buffer memory.
+        VkDeviceMemory stagingObjectsBufferMemory = nullptr;
+        /// @brief The pointer to the CPU accessible buffer of `stagingObjectsBuffer`.
+        void* ptrStagingDataSrc = nullptr;
+        // Create resources for staging buffer and memory.
+        createBufferAndAllocateMemory(
+            logicalDevice, stagingSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+            &stagingObjectsBuffer, &stagingObjectsBufferMemory
+        );
+        result = vkMapMemory(logicalDevice, stagingObjectsBufferMemory, 0, stagingSize, 0, &ptrStagingDataSrc);
+        if (result != VK_SUCCESS) {
+            ::std::string errorMessage = "Failed to map memory with result " + ::std::to_string(result);
+            celeriqueLogError(errorMessage);
+            throw ::std::runtime_error(errorMessage);
+        }
+
+        /// @brief The map of a destination buffer ID to the ranges copied to it.
+        ::std::unordered_map<GpuBufferID, ::std::vector<VkBufferCopy>> mapGpuBufferIdToVecCopyRegions;
+        /// @brief The destination buffer IDs, in the order they were first written.
+        ::std::vector<GpuBufferID> vecDstBufferIds;
+        /// @brief The offset of the next range within the staging buffer.
+        VkDeviceSize stagingOffset = 0;
+        for (const GpuBufferRegion& region : vecRegions) {
+            if (region.dataSize == 0) continue;
+            if (_mapGpuBufferIdToDynamicBuffer.find(region.bufferId) != _mapGpuBufferIdToDynamicBuffer.end()) continue;
+            if (_mapGpuBufferIdToLogicDev[region.bufferId] != logicalDevice) continue;
+
+            // Pack the range into the staging buffer.
+            memcpy(reinterpret_cast<Byte*>(ptrStagingDataSrc) + stagingOffset, region.ptrDataSrc, region.dataSize);
+            /// @brief Information about how the range is copied.
+            VkBufferCopy copyRegion = {};
+            copyRegion.srcOffset = stagingOffset;
+            copyRegion.dstOffset = static_cast<VkDeviceSize>(region.offset);
+            copyRegion.size = static_cast<VkDeviceSize>(region.dataSize);
+            /// @brief The reference to the ranges copied to the destination buffer.
+            ::std::vector<VkBufferCopy>& refVecCopyRegions = mapGpuBufferIdToVecCopyRegions[region.bufferId];
+            if (refVecCopyRegions.empty()) vecDstBufferIds.push_back(region.bufferId);
+            refVecCopyRegions.push_back(copyRegion);
+            stagingOffset += copyRegion.size;
+        }
+        // Unmap `ptrStagingDataSrc` as it is no longer needed.
+        vkUnmapMemory(logicalDevice, stagingObjectsBufferMemory);
+
+        /// @brief The command buffer for copying.
+        VkCommandBuffer copyCommandBuffer = beginSingleTimeCommand(logicalDevice);
+        for (GpuBufferID dstBufferId : vecDstBufferIds) {
+            /// @brief The reference to the ranges copied to the destination buffer.
+            const ::std::vector<VkBufferCopy>& refVecCopyRegions = mapGpuBufferIdToVecCopyRegions[dstBufferId];
+            vkCmdCopyBuffer(
+                copyCommandBuffer, stagingObjectsBuffer, _mapGpuBufferIdToVkBuffer[dstBufferId],
+                static_cast<uint32_t>(refVecCopyRegions.size()), refVecCopyRegions.data()
+            );
+        }
+        // The graphics queue is used for copy submission.
+        endSingleTimeCommand(logicalDevice, copyCommandBuffer, selectGraphicsQueue(logicalDevice));
+
+        // Destroy staging resources.
+        vkFreeMemory(logicalDevice, stagingObjectsBufferMemory, nullptr);
+        vkDestroyBuffer(logicalDevice, stagingObjectsBuffer, nullptr);
+    }
+}
+
+/// @brief Get the pointer to the copy of a dynamic GPU buffer for the current frame.
+/// @param bufferId The unique identifier of a GPU buffer created with `CELERIQUE_GPU_BUFFER_USAGE_DYNAMIC`.
+/// @return The persistently mapped pointer to the copy.
+void* celerique::vulkan::internal::Manager::mapDynamicBuffer(GpuBufferID bufferId) {
+    ::std::unique_lock<::std::shared_mutex> writeLock(_sharedMutex);
+
+    /// @brief The iterator to the copies of the dynamic buffer.
+    auto dynamicBufferIterator = _mapGpuBufferIdToDynamicBuffer.find(bufferId);
+    if (dynamicBufferIterator == _mapGpuBufferIdToDynamicBuffer.end()) {
+        ::std::string errorMessage = "Buffer ID " + ::std::to_string(bufferId) + " is not a dynamic buffer.";
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
+    }
+    // The caller may write only part of the copy.
+    return currentDynamicBufferCopy(bufferId, dynamicBufferIterator->second, false);
+}
+
+/// @brief Get the offset of the copy of a dynamic GPU buffer last written, to be passed as the dynamic
+/// offset of its descriptor.
+/// @param bufferId The unique identifier of a GPU buffer created with `CELERIQUE_GPU_BUFFER_USAGE_DYNAMIC`.
+/// @return The byte offset of the copy within the buffer.
+size_t celerique::vulkan::internal::Manager::dynamicBufferOffset(GpuBufferID bufferId) {
+    ::std::shared_lock<::std::shared_mutex> readLock(_sharedMutex);
+
+    /// @brief The iterator to the copies of the dynamic buffer.
+    auto dynamicBufferIterator = _mapGpuBufferIdToDynamicBuffer.find(bufferId);
+    if (dynamicBufferIterator == _mapGpuBufferIdToDynamicBuffer.end()) {
+        ::std::string errorMessage = "Buffer ID " + ::std::to_string(bufferId) + " is not a dynamic buffer.";
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
+    }
+    /// @brief The reference to the copies of the dynamic buffer.
+    const DynamicBuffer& refDynamicBuffer = dynamicBufferIterator->second;
+    return static_cast<size_t>(refDynamicBuffer.currentCopyIndex * refDynamicBuffer.copyStride);
+}
+
 /// @brief Free the specified GPU buffer.
 /// @param bufferId The unique identifier of the GPU buffer.
 void celerique::vulkan::internal::Manager::freeBuffer(GpuBufferID bufferId) {
@@ -735,6 +1094,13 @@ void celerique::vulkan::internal::Manager::freeBuffer(GpuBufferID bufferId) {
     /// @brief The vulkan device memory handle.
     VkDeviceMemory deviceMemory = _mapGpuBufferIdToDevMemory[bufferId];
 
+    if (_mapGpuBufferIdToDynamicBuffer.find(bufferId) != _mapGpuBufferIdToDynamicBuffer.end()) {
+        // Frames still in flight may read any of the copies.
+        for (size_t copyIndex = 0; copyIndex < CELERIQUE_GPU_BUFFER_NUM_DYNAMIC_COPIES; copyIndex++) {
+            waitForDynamicBufferFrame(logicalDevice, copyIndex);
+        }
+        vkUnmapMemory(logicalDevice, deviceMemory);
+    }
     vkFreeMemory(logicalDevice, deviceMemory, nullptr);
     vkDestroyBuffer(logicalDevice, vkBuffer, nullptr);
 
@@ -742,6 +1108,7 @@ void celerique::vulkan::internal::Manager::freeBuffer(GpuBufferID bufferId) {
     _mapGpuBufferIdToVkBuffer.erase(bufferId);
     _mapGpuBufferIdToDevMemory.erase(bufferId);
     _mapGpuBufferIdToSize.erase(bufferId);
+    _mapGpuBufferIdToDynamicBuffer.erase(bufferId);
 
     celeriqueLogDebug("Freed buffer ID " + ::std::to_string(bufferId));
 }
@@ -761,6 +1128,9 @@ void celerique::vulkan::internal::Manager::clearBuffers() {
         /// @brief The descriptor set layout mapped to the GPU buffer identifier.
         VkDescriptorSetLayout descriptorSetLayout = _mapGpuBufferIdToDescSetLayouts[bufferId];
 
+        if (_mapGpuBufferIdToDynamicBuffer.find(bufferId) != _mapGpuBufferIdToDynamicBuffer.end()) {
+            vkUnmapMemory(logicalDevice, deviceMemory);
+        }
         vkFreeMemory(logicalDevice, deviceMemory, nullptr);
         vkDestroyBuffer(logicalDevice, vkBuffer, nullptr);
         if (descriptorSetLayout != nullptr) {
@@ -772,6 +1142,7 @@ void celerique::vulkan::internal::Manager::clearBuffers() {
     _mapGpuBufferIdToDevMemory.clear();
     _mapGpuBufferIdToSize.clear();
     _mapGpuBufferIdToDescSetLayouts.clear();
+    _mapGpuBufferIdToDynamicBuffer.clear();
     celeriqueLogTrace("Cleared all memory buffer handlers.");
 }
 
@@ -799,7 +1170,12 @@ celerique::vulkan::internal::Manager::~Manager() {
         vkDeviceWaitIdle(graphicsLogicalDevice);
     }
 
+    for (auto& pairLogicDevToSharedSceneTarget : _mapLogicDevToSharedSceneTarget) {
+        destroySharedSceneTarget(pairLogicDevToSharedSceneTarget.first);
+    }
+    _mapLogicDevToSharedSceneTarget.clear();
     destroySyncObjects();
+    _mapLogicDevToVecFrameSubmitFences.clear();
     destroyMemoryBufferHandlers();
     destroyPipelines();
     destroySwapChainFrameBuffers();
@@ -1003,6 +1379,7 @@ void celerique::vulkan::internal::Manager::destroySyncObjects() {
         }
     }
     _mapWindowToVecInFlightFences.clear();
+    _mapWindowToVecImageInFlightFences.clear();
 
     celeriqueLogTrace("Destroyed all sync objects.");
 }
@@ -1043,12 +1420,141 @@ void celerique::vulkan::internal::Manager::destroyMemoryBufferHandlers() {
         }
     }
     _mapWindowToVecMeshBuffers.clear();
+    // Iterate over the cached mesh buffers and destroy.
+    for (const auto& pairWindowToVecCachedMeshBuffers : _mapWindowToVecCachedMeshBuffers) {
+        destroyCachedMeshBuffers(pairWindowToVecCachedMeshBuffers.first);
+    }
+    _mapWindowToVecCachedMeshBufferMemories.clear();
+    _mapWindowToVecCachedMeshBuffers.clear();
 
     celeriqueLogTrace("Destroyed all mesh buffer handlers.");
 
     clearBuffers();
 }
 
+/// @brief Destroy the mesh buffers read by the cached command buffers of a window.
+/// The command buffers must not be pending execution.
+/// @param windowHandle The handle to the window.
+void celerique::vulkan::internal::Manager::destroyCachedMeshBuffers(Pointer windowHandle) {
+    /// @brief The handle to the graphics logical device assigned to the window.
+    VkDevice graphicsLogicalDevice = _mapWindowToGraphicsLogicDev[windowHandle];
+    // Iterate over memories and free.
+    for (VkDeviceMemory& refMeshBufferMemory : _mapWindowToVecCachedMeshBufferMemories[windowHandle]) {
+        // Free if not null.
+        if (refMeshBufferMemory != nullptr) {
+            vkFreeMemory(graphicsLogicalDevice, refMeshBufferMemory, nullptr);
+            refMeshBufferMemory = nullptr;
+        }
+    }
+    // Iterate over buffers and destroy.
+    for (VkBuffer& refMeshBuffer : _mapWindowToVecCachedMeshBuffers[windowHandle]) {
+        // Destroy if not null.
+        if (refMeshBuffer != nullptr) {
+            vkDestroyBuffer(graphicsLogicalDevice, refMeshBuffer, nullptr);
+            refMeshBuffer = nullptr;
+        }
+    }
+}
+
+/// @brief Free the cached command buffers of a window and forget what they were recorded for.
+/// They must not be pending execution.
+/// @param windowHandle The handle to the window.
+void celerique::vulkan::internal::Manager::destroyCachedCommandBuffers(Pointer windowHandle) {
+    /// @brief The iterator to the window's cached command buffers.
+    auto cachedCommandBuffersIterator = _mapWindowToVecCachedCommandBuffers.find(windowHandle);
+    if (cachedCommandBuffersIterator == _mapWindowToVecCachedCommandBuffers.end()) return;
+
+    /// @brief The reference to the window's collection of cached command buffers.
+    ::std::vector<VkCommandBuffer>& refVecCachedCommandBuffers = cachedCommandBuffersIterator->second;
+    if (!refVecCachedCommandBuffers.empty()) {
+        vkFreeCommandBuffers(
+            _mapWindowToGraphicsLogicDev[windowHandle], _mapWindowToGraphicsCommandPool[windowHandle],
+            static_cast<uint32_t>(refVecCachedCommandBuffers.size()), refVecCachedCommandBuffers.data()
+        );
+    }
+    _mapWindowToVecCachedCommandBuffers.erase(cachedCommandBuffersIterator);
+    _mapWindowToVecCachedDrawHashes.erase(windowHandle);
+}
+
+/// @brief Destroy the shared scene target of a logical device. The device must be idle.
+/// @param graphicsLogicalDevice The handle to the graphics logical device.
+void celerique::vulkan::internal::Manager::destroySharedSceneTarget(VkDevice graphicsLogicalDevice) {
+    /// @brief The reference to the shared scene target to be destroyed.
+    SharedSceneTarget& refTarget = _mapLogicDevToSharedSceneTarget[graphicsLogicalDevice];
+    // The target's fences are about to be destroyed.
+    forgetDynamicBufferFrameFences(graphicsLogicalDevice);
+
+    for (auto& pairWindowToVecImageAvailableSemaphores : refTarget.mapWindowToVecImageAvailableSemaphores) {
+        for (VkSemaphore imageAvailableSemaphore : pairWindowToVecImageAvailableSemaphores.second) {
+            vkDestroySemaphore(graphicsLogicalDevice, imageAvailableSemaphore, nullptr);
+        }
+        /// @brief The iterator to the in-flight fences of the window's last submission per swapchain image.
+        auto imageInFlightFencesIterator = _mapWindowToVecImageInFlightFences.find(pairWindowToVecImageAvailableSemaphores.first);
+        // Forget the fences about to be destroyed.
+        if (imageInFlightFencesIterator != _mapWindowToVecImageInFlightFences.end()) {
+            ::std::fill(imageInFlightFencesIterator->second.begin(), imageInFlightFencesIterator->second.end(), nullptr);
+        }
+    }
+    refTarget.mapWindowToVecImageAvailableSemaphores.clear();
+    for (VkSemaphore renderFinishedSemaphore : refTarget.vecRenderFinishedSemaphores) {
+        vkDestroySemaphore(graphicsLogicalDevice, renderFinishedSemaphore, nullptr);
+    }
+    refTarget.vecRenderFinishedSemaphores.clear();
+    for (VkFence inFlightFence : refTarget.vecInFlightFences) {
+        vkDestroyFence(graphicsLogicalDevice, inFlightFence, nullptr);
+    }
+    refTarget.vecInFlightFences.clear();
+
+    for (size_t i = 0; i < refTarget.vecMeshBuffers.size(); i++) {
+        // Free if not null.
+        if (refTarget.vecMeshBufferMemories[i] != nullptr) {
+            vkFreeMemory(graphicsLogicalDevice, refTarget.vecMeshBufferMemories[i], nullptr);
+        }
+        // Destroy if not null.
+        if (refTarget.vecMeshBuffers[i] != nullptr) {
+            vkDestroyBuffer(graphicsLogicalDevice, refTarget.vecMeshBuffers[i], nullptr);
+        }
+    }
+    refTarget.vecMeshBufferMemories.clear();
+    refTarget.vecMeshBuffers.clear();
+
+    // Free the command buffers back to the pool they were allocated from.
+    vkFreeCommandBuffers(
+        graphicsLogicalDevice, _mapLogicDevToVecCommandPools[graphicsLogicalDevice][0],
+        static_cast<uint32_t>(refTarget.vecCommandBuffers.size()), refTarget.vecCommandBuffers.data()
+    );
+    refTarget.vecCommandBuffers.clear();
+
+    destroySharedSceneImage(graphicsLogicalDevice, refTarget);
+    vkDestroyRenderPass(graphicsLogicalDevice, refTarget.renderPass, nullptr);
+    refTarget.renderPass = nullptr;
+
+    celeriqueLogTrace("Destroyed shared scene target.");
+}
+
+/// @brief Destroy the offscreen image of a shared scene target. It must not be in use.
+/// @param graphicsLogicalDevice The handle to the graphics logical device that created it.
+/// @param refTarget The reference to the shared scene target.
+void celerique::vulkan::internal::Manager::destroySharedSceneImage(VkDevice graphicsLogicalDevice, SharedSceneTarget& refTarget) {
+    if (refTarget.frameBuffer != nullptr) {
+        vkDestroyFramebuffer(graphicsLogicalDevice, refTarget.frameBuffer, nullptr);
+        refTarget.frameBuffer = nullptr;
+    }
+    if (refTarget.imageView != nullptr) {
+        vkDestroyImageView(graphicsLogicalDevice, refTarget.imageView, nullptr);
+        refTarget.imageView = nullptr;
+    }
+    if (refTarget.image != nullptr) {
+        vkDestroyImage(graphicsLogicalDevice, refTarget.image, nullptr);
+        refTarget.image = nullptr;
+    }
+    if (refTarget.imageMemory != nullptr) {
+        vkFreeMemory(graphicsLogicalDevice, refTarget.imageMemory, nullptr);
+        refTarget.imageMemory = nullptr;
+    }
+    refTarget.extent = {0, 0};
+}
+
 /// @brief Destroy all pipeline related objects.
 void celerique::vulkan::internal::Manager::destroyPipelines() {
     // Iterate over pipeline instances.
@@ -1526,6 +2032,8 @@ void celerique::vulkan::internal::Manager::createSwapChain(Pointer windowHandle,
     swapChainInfo.imageExtent = _mapWindowToSwapChainExtent[windowHandle];
     swapChainInfo.imageArrayLayers = 1;
     swapChainInfo.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    // Allow a shared scene to be blitted to the swapchain images.
+    swapChainInfo.imageUsage |= surfaceCapabilities.supportedUsageFlags & VK_IMAGE_USAGE_TRANSFER_DST_BIT;
     swapChainInfo.preTransform = surfaceCapabilities.currentTransform;
     // TODO: Used for blending with other windows in the windows system. Perhaps, to create
     // some translucency effect on the window. We'll set it to opaque for now.
@@ -1541,6 +2049,7 @@ void celerique::vulkan::internal::Manager::createSwapChain(Pointer windowHandle,
         throw ::std::runtime_error(errorMessage);
     }
     _mapWindowToSwapChain[windowHandle] = swapChain;
+    _mapWindowToSwapChainImageUsage[windowHandle] = swapChainInfo.imageUsage;
     celeriqueLogTrace("Created swapchain.");
 }
 
@@ -1768,6 +2277,39 @@ void celerique::vulkan::internal::Manager::createCommandBuffers(Pointer windowHa
     _mapWindowToGraphicsCommandPool[windowHandle] = graphicsCommandPool;
     _mapWindowToVecCommandBuffers[windowHandle] = ::std::move(vecCommandBuffers);
     celeriqueLogTrace("Created command buffers.");
+
+    if (_isCachingCommandBuffers) createCachedCommandBuffers(windowHandle);
+}
+
+/// @brief Create the command buffers cached for the window, one per swapchain image.
+/// @param windowHandle The UI protocol native pointer of the window to be registered.
+void celerique::vulkan::internal::Manager::createCachedCommandBuffers(Pointer windowHandle) {
+    /// @brief The number of swapchain images to be drawn to.
+    size_t numImages = _mapWindowToVecSwapChainFrameBuffers[windowHandle].size();
+    /// @brief The vector of command buffers recorded once per swapchain image and replayed while the draw stays the same.
+    ::std::vector<VkCommandBuffer> vecCachedCommandBuffers(numImages, nullptr);
+
+    /// @brief The information regarding how the command buffers are allocated.
+    VkCommandBufferAllocateInfo commandBufferInfo = {};
+    commandBufferInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    commandBufferInfo.commandPool = _mapWindowToGraphicsCommandPool[windowHandle];
+    commandBufferInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    commandBufferInfo.commandBufferCount = static_cast<uint32_t>(numImages);
+
+    /// @brief The container for the result code from the vulkan api.
+    VkResult result = vkAllocateCommandBuffers(
+        _mapWindowToGraphicsLogicDev[windowHandle], &commandBufferInfo, vecCachedCommandBuffers.data()
+    );
+    if (result != VK_SUCCESS) {
+        ::std::string errorMessage = "Failed to create cached command buffers "
+        "with result code: " + ::std::to_string(result);
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
+    }
+
+    _mapWindowToVecCachedCommandBuffers[windowHandle] = ::std::move(vecCachedCommandBuffers);
+    _mapWindowToVecCachedDrawHashes[windowHandle] = ::std::vector<uint64_t>(numImages, 0);
+    celeriqueLogTrace("Created cached command buffers.");
 }
 
 /// @brief Create the containers for the mesh buffer handles.
@@ -1781,6 +2323,17 @@ void celerique::vulkan::internal::Manager::createContainersForMeshBufferHandles(
     celeriqueLogTrace("Created mesh buffer handles.");
 }
 
+/// @brief Create the containers for the mesh buffer handles read by the cached command buffers.
+/// @param windowHandle The UI protocol native pointer of the window to be registered.
+void celerique::vulkan::internal::Manager::createContainersForCachedMeshBufferHandles(Pointer windowHandle) {
+    /// @brief The number of swapchain images to be drawn to.
+    size_t numImages = _mapWindowToVecSwapChainFrameBuffers[windowHandle].size();
+    _mapWindowToVecCachedMeshBufferMemories[windowHandle] = ::std::vector<VkDeviceMemory>(numImages, nullptr);
+    _mapWindowToVecCachedMeshBuffers[windowHandle] = ::std::vector<VkBuffer>(numImages, nullptr);
+
+    celeriqueLogTrace("Created cached mesh buffer handles.");
+}
+
 /// @brief Create synchronization objects.
 /// @param windowHandle The UI protocol native pointer of the window to be registered.
 void celerique::vulkan::internal::Manager::createSyncObjects(Pointer windowHandle) {
@@ -1854,81 +2407,288 @@ void celerique::vulkan::internal::Manager::createSyncObjects(Pointer windowHandl
     _mapWindowToVecImageAvailableSemaphores[windowHandle] = ::std::move(vecImageAvailableSemaphores);
     _mapWindowToVecRenderFinishedSemaphores[windowHandle] = ::std::move(vecRenderFinishedSemaphores);
     _mapWindowToVecInFlightFences[windowHandle] = ::std::move(vecInFlightFences);
+    _mapWindowToVecImageInFlightFences[windowHandle] = ::std::vector<VkFence>(numOfSyncObjects, nullptr);
 
     celeriqueLogTrace("Created sync objects.");
 }
 
-/// @brief Choose the swapchain best image format out of the specified surface format.
-/// @param vecSurfaceFormats The specified list of surface formats choices.
-/// @return The best image format.
-VkFormat celerique::vulkan::internal::Manager::chooseSwapChainImageFormat(const ::std::vector<VkSurfaceFormatKHR>& vecSurfaceFormats) {
-    for (const VkSurfaceFormatKHR& surfaceFormat : vecSurfaceFormats) {
-        if (surfaceFormat.format == VK_FORMAT_B8G8R8A8_SRGB &&
-        surfaceFormat.colorSpace == VK_COLOR_SPACE_SRGB_NONLINEAR_KHR) {
-            celeriqueLogTrace("Image format: VK_FORMAT_B8G8R8A8_SRGB");
-            return surfaceFormat.format;
+/// @brief Join the window to the shared scene target of its logical device, creating the target if needed.
+/// @param windowHandle The UI protocol native pointer of the window to be registered.
+void celerique::vulkan::internal::Manager::joinSharedSceneTarget(Pointer windowHandle) {
+    /// @brief The handle to the graphics logical device assigned for the window.
+    VkDevice graphicsLogicalDevice = _mapWindowToGraphicsLogicDev[windowHandle];
+    if (_mapLogicDevToSharedSceneTarget.find(graphicsLogicalDevice) == _mapLogicDevToSharedSceneTarget.end()) {
+        createSharedSceneTarget(graphicsLogicalDevice, _mapWindowToSwapChainImageFormat[windowHandle]);
+    }
+    /// @brief The iterator to the shared scene target of the window's logical device.
+    auto sharedSceneTargetIterator = _mapLogicDevToSharedSceneTarget.find(graphicsLogicalDevice);
+    // The format cannot be blitted. The window keeps rendering on its own.
+    if (sharedSceneTargetIterator == _mapLogicDevToSharedSceneTarget.end()) return;
+    if (sharedSceneTargetIterator->second.format != _mapWindowToSwapChainImageFormat[windowHandle]) {
+        celeriqueLogWarning("Window swapchain format differs from the shared scene. The window keeps rendering on its own.");
+        return;
+    }
+
+    /// @brief The image available semaphores of the window, one per shared scene frame.
+    ::std::vector<VkSemaphore> vecImageAvailableSemaphores;
+    vecImageAvailableSemaphores.reserve(numSharedSceneFrames);
+    for (size_t i = 0; i < numSharedSceneFrames; i++) {
+        /// @brief Information about the image available semaphore.
+        VkSemaphoreCreateInfo imageAvailableSemaphoreInfo = {};
+        imageAvailableSemaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        /// @brief The handle to the image available semaphore.
+        VkSemaphore imageAvailableSemaphore = nullptr;
+        // Create the image available semaphore.
+        VkResult result = vkCreateSemaphore(graphicsLogicalDevice, &imageAvailableSemaphoreInfo, nullptr, &imageAvailableSemaphore);
+        if (result != VK_SUCCESS) {
+            ::std::string errorMessage = "Failed to create shared scene image available semaphore with result " + ::std::to_string(result);
+            celeriqueLogError(errorMessage);
+            throw ::std::runtime_error(errorMessage);
         }
+        vecImageAvailableSemaphores.push_back(imageAvailableSemaphore);
     }
+    sharedSceneTargetIterator->second.mapWindowToVecImageAvailableSemaphores[windowHandle] = ::std::move(vecImageAvailableSemaphores);
 
-    // Just settle on the first one if the formats aren't perfect.
-    celeriqueLogTrace("Image format: " + ::std::to_string(vecSurfaceFormats[0].format));
-    return vecSurfaceFormats[0].format;
+    celeriqueLogTrace("Joined window to the shared scene target.");
 }
 
-/// @brief Choose the best swapchain present mode out of the specified present modes.
-/// @param vecPresentModes The specified list of present mode choices.
-/// @return The best present mode.
-VkPresentModeKHR celerique::vulkan::internal::Manager::chooseSwapChainPresentMode(const ::std::vector<VkPresentModeKHR>& vecPresentModes) {
-    /// @brief The chosen present mode.
-    VkPresentModeKHR chosenPresentMode = VK_PRESENT_MODE_MAX_ENUM_KHR;
-
-    // Iterate over present modes.
-    for (VkPresentModeKHR presentMode : vecPresentModes) {
-        if (presentMode == VK_PRESENT_MODE_MAILBOX_KHR) {
-            celeriqueLogTrace("Present mailbox mode.");
-            // Priority choice of present mode.
-            // Will halt from here on.
-            return VK_PRESENT_MODE_MAILBOX_KHR;
-        } else if (presentMode == VK_PRESENT_MODE_FIFO_KHR) {
-            celeriqueLogTrace("Present fifo mode chosen but will keep looking.");
-            // Will settle on this but will keep looking.
-            chosenPresentMode = VK_PRESENT_MODE_FIFO_KHR;
+/// @brief Remove the window from the shared scene target of its logical device, destroying the target
+/// once no window is left in it. The device must be idle.
+/// @param windowHandle The UI protocol native pointer of the window.
+void celerique::vulkan::internal::Manager::leaveSharedSceneTarget(Pointer windowHandle) {
+    /// @brief The handle to the graphics logical device assigned for the window.
+    VkDevice graphicsLogicalDevice = _mapWindowToGraphicsLogicDev[windowHandle];
+    /// @brief The iterator to the shared scene target of the window's logical device.
+    auto sharedSceneTargetIterator = _mapLogicDevToSharedSceneTarget.find(graphicsLogicalDevice);
+    if (sharedSceneTargetIterator == _mapLogicDevToSharedSceneTarget.end()) return;
+
+    /// @brief The reference to the image available semaphores of the target's windows.
+    auto& refMapWindowToVecImageAvailableSemaphores = sharedSceneTargetIterator->second.mapWindowToVecImageAvailableSemaphores;
+    /// @brief The iterator to the window's image available semaphores.
+    auto imageAvailableSemaphoresIterator = refMapWindowToVecImageAvailableSemaphores.find(windowHandle);
+    if (imageAvailableSemaphoresIterator != refMapWindowToVecImageAvailableSemaphores.end()) {
+        for (VkSemaphore imageAvailableSemaphore : imageAvailableSemaphoresIterator->second) {
+            vkDestroySemaphore(graphicsLogicalDevice, imageAvailableSemaphore, nullptr);
         }
+        refMapWindowToVecImageAvailableSemaphores.erase(imageAvailableSemaphoresIterator);
+        /// @brief The iterator to the in-flight fences of the window's last submission per swapchain image.
+        auto imageInFlightFencesIterator = _mapWindowToVecImageInFlightFences.find(windowHandle);
+        // Forget the target's fences, which may be destroyed below.
+        if (imageInFlightFencesIterator != _mapWindowToVecImageInFlightFences.end()) {
+            ::std::fill(imageInFlightFencesIterator->second.begin(), imageInFlightFencesIterator->second.end(), nullptr);
+        }
+        celeriqueLogTrace("Removed window from the shared scene target.");
     }
+    if (!refMapWindowToVecImageAvailableSemaphores.empty()) return;
 
-    return chosenPresentMode;
+    destroySharedSceneTarget(graphicsLogicalDevice);
+    _mapLogicDevToSharedSceneTarget.erase(graphicsLogicalDevice);
 }
 
-/// @brief Determine the swapchain extent which calculates the resolution of the swapchain images.
-/// @param surfaceCapabilities The surface capabilities structure.
-/// @param windowHandle The UI protocol native pointer of the window to be registered.
-/// @param uiProtocol The UI protocol used to create UI elements.
-/// @return The swapchain extent.
-VkExtent2D celerique::vulkan::internal::Manager::determineSwapChainExtent(const VkSurfaceCapabilitiesKHR& surfaceCapabilities, Pointer windowHandle, UiProtocol uiProtocol) {
-    if (surfaceCapabilities.currentExtent.width != UINT32_MAX)
-        return surfaceCapabilities.currentExtent;
-
+/// @brief Create the shared scene target of a logical device. Logs a warning and creates nothing
+/// if the format cannot be blitted.
+/// @param graphicsLogicalDevice The handle to the graphics logical device.
+/// @param format The format of the windows' swapchain images.
+void celerique::vulkan::internal::Manager::createSharedSceneTarget(VkDevice graphicsLogicalDevice, VkFormat format) {
     /// @brief The container for the result code from the vulkan api.
     VkResult result;
-    /// @brief The number of pixel units in the screen.
-    typedef CeleriquePixelUnits PixelUnits;
 
-    /// @brief The width of the viewport.
-    PixelUnits viewportWidth;
-    /// @brief The height of the viewport.
-    PixelUnits viewportHeight;
+    /// @brief The features of the format on the physical device.
+    VkFormatProperties formatProperties = {};
+    vkGetPhysicalDeviceFormatProperties(_mapLogicDevToPhysDev[graphicsLogicalDevice], format, &formatProperties);
+    /// @brief The features the offscreen image and the swapchain images need for scaled copies.
+    VkFormatFeatureFlags requiredFeatures = VK_FORMAT_FEATURE_BLIT_SRC_BIT | VK_FORMAT_FEATURE_BLIT_DST_BIT;
+    if ((formatProperties.optimalTilingFeatures & requiredFeatures) != requiredFeatures) {
+        celeriqueLogWarning("Swapchain format cannot be blitted. Windows keep rendering on their own.");
+        return;
+    }
 
-    switch(uiProtocol) {
-#if (defined(CELERIQUE_FOR_LINUX_SYSTEMS) || defined(CELERIQUE_FOR_BSD_SYSTEMS)) && !defined(CELERIQUE_FOR_ANDROID)
-    case CELERIQUE_UI_PROTOCOL_X11: {
-        // Open a connection to the X server
-        Display* ptrDisplay = XOpenDisplay(NULL);
-        if (ptrDisplay == nullptr) {
-            const char* errorMessage = "Failed to open x11 display.";
-            celeriqueLogError(errorMessage);
-            throw ::std::runtime_error(errorMessage);
-        }
-        /// @brief The x11 ID.
+    /// @brief The shared scene target to be created.
+    SharedSceneTarget target;
+    target.ptrMutex = ::std::make_unique<::std::mutex>();
+    target.format = format;
+    target.blitFilter = (formatProperties.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT) != 0 ?
+        VK_FILTER_LINEAR : VK_FILTER_NEAREST;
+
+    /// @brief Contains information about the colour attachment, matching the windows' render pass.
+    VkAttachmentDescription colourAttachment = {};
+    colourAttachment.format = format;
+    colourAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
+    colourAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR;
+    colourAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    colourAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    colourAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+    colourAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    colourAttachment.finalLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+
+    VkAttachmentReference refColourAttachment = {};
+    refColourAttachment.attachment = 0;
+    refColourAttachment.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+
+    VkSubpassDescription subpass = {};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = 1;
+    subpass.pColorAttachments = &refColourAttachment;
+
+    /// @brief The dependencies on the blits of the previous frame and of the blits on this frame.
+    VkSubpassDependency arrDependencies[2] = {};
+    arrDependencies[0].srcSubpass = VK_SUBPASS_EXTERNAL;
+    arrDependencies[0].dstSubpass = 0;
+    arrDependencies[0].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT;
+    arrDependencies[0].srcAccessMask = 0;
+    arrDependencies[0].dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    arrDependencies[0].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    arrDependencies[1].srcSubpass = 0;
+    arrDependencies[1].dstSubpass = VK_SUBPASS_EXTERNAL;
+    arrDependencies[1].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    arrDependencies[1].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    arrDependencies[1].dstStageMask = VK_PIPELINE_STAGE_TRANSFER_BIT;
+    arrDependencies[1].dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+
+    // Render pass info.
+    VkRenderPassCreateInfo renderPassInfo{};
+    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
+    renderPassInfo.attachmentCount = 1;
+    renderPassInfo.pAttachments = &colourAttachment;
+    renderPassInfo.subpassCount = 1;
+    renderPassInfo.pSubpasses = &subpass;
+    renderPassInfo.dependencyCount = 2;
+    renderPassInfo.pDependencies = arrDependencies;
+
+    // Create render pass.
+    result = vkCreateRenderPass(graphicsLogicalDevice, &renderPassInfo, nullptr, &target.renderPass);
+    if (result != VK_SUCCESS) {
+        ::std::string errorMessage = "Failed to create shared scene render pass "
+        "with result code: " + ::std::to_string(result);
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
+    }
+
+    /// @brief The information regarding how the command buffers are allocated.
+    VkCommandBufferAllocateInfo commandBufferInfo = {};
+    commandBufferInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    commandBufferInfo.commandPool = _mapLogicDevToVecCommandPools[graphicsLogicalDevice][0];
+    commandBufferInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    commandBufferInfo.commandBufferCount = static_cast<uint32_t>(numSharedSceneFrames);
+    target.vecCommandBuffers.resize(numSharedSceneFrames, nullptr);
+    // Allocate command buffers.
+    result = vkAllocateCommandBuffers(graphicsLogicalDevice, &commandBufferInfo, target.vecCommandBuffers.data());
+    if (result != VK_SUCCESS) {
+        ::std::string errorMessage = "Failed to create shared scene command buffers "
+        "with result code: " + ::std::to_string(result);
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
+    }
+
+    for (size_t i = 0; i < numSharedSceneFrames; i++) {
+        /// @brief Information about the render finished semaphore.
+        VkSemaphoreCreateInfo renderFinishedSemaphoreInfo = {};
+        renderFinishedSemaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        /// @brief The handle to the render finished semaphore.
+        VkSemaphore renderFinishedSemaphore = nullptr;
+        // Create the render finished semaphore.
+        result = vkCreateSemaphore(graphicsLogicalDevice, &renderFinishedSemaphoreInfo, nullptr, &renderFinishedSemaphore);
+        if (result != VK_SUCCESS) {
+            ::std::string errorMessage = "Failed to create shared scene render finished semaphore with result " + ::std::to_string(result);
+            celeriqueLogError(errorMessage);
+            throw ::std::runtime_error(errorMessage);
+        }
+        target.vecRenderFinishedSemaphores.push_back(renderFinishedSemaphore);
+
+        /// @brief The information about the in-flight fence.
+        VkFenceCreateInfo inFlightFenceInfo{};
+        inFlightFenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+        inFlightFenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+        /// @brief The handle to the in-flight fence.
+        VkFence inFlightFence;
+        // Create the in-flight fence.
+        result = vkCreateFence(graphicsLogicalDevice, &inFlightFenceInfo, nullptr, &inFlightFence);
+        if (result != VK_SUCCESS) {
+            ::std::string errorMessage = "Failed to create shared scene in-flight fence with result " + ::std::to_string(result);
+            celeriqueLogError(errorMessage);
+            throw ::std::runtime_error(errorMessage);
+        }
+        target.vecInFlightFences.push_back(inFlightFence);
+    }
+    target.vecMeshBuffers = ::std::vector<VkBuffer>(numSharedSceneFrames, nullptr);
+    target.vecMeshBufferMemories = ::std::vector<VkDeviceMemory>(numSharedSceneFrames, nullptr);
+
+    // The offscreen image is created on the first draw, once the windows' extents are known.
+    _mapLogicDevToSharedSceneTarget[graphicsLogicalDevice] = ::std::move(target);
+    celeriqueLogTrace("Created shared scene target.");
+}
+
+/// @brief Choose the swapchain best image format out of the specified surface format.
+/// @param vecSurfaceFormats The specified list of surface formats choices.
+/// @return The best image format.
+VkFormat celerique::vulkan::internal::Manager::chooseSwapChainImageFormat(const ::std::vector<VkSurfaceFormatKHR>& vecSurfaceFormats) {
+    for (const VkSurfaceFormatKHR& surfaceFormat : vecSurfaceFormats) {
+        if (surfaceFormat.format == VK_FORMAT_B8G8R8A8_SRGB &&
+        surfaceFormat.colorSpace == VK_COLOR_SPACE_SRGB_NONLINEAR_KHR) {
+            celeriqueLogTrace("Image format: VK_FORMAT_B8G8R8A8_SRGB");
+            return surfaceFormat.format;
+        }
+    }
+
+    // Just settle on the first one if the formats aren't perfect.
+    celeriqueLogTrace("Image format: " + ::std::to_string(vecSurfaceFormats[0].format));
+    return vecSurfaceFormats[0].format;
+}
+
+/// @brief Choose the best swapchain present mode out of the specified present modes.
+/// @param vecPresentModes The specified list of present mode choices.
+/// @return The best present mode.
+VkPresentModeKHR celerique::vulkan::internal::Manager::chooseSwapChainPresentMode(const ::std::vector<VkPresentModeKHR>& vecPresentModes) {
+    /// @brief The chosen present mode.
+    VkPresentModeKHR chosenPresentMode = VK_PRESENT_MODE_MAX_ENUM_KHR;
+
+    // Iterate over present modes.
+    for (VkPresentModeKHR presentMode : vecPresentModes) {
+        if (presentMode == VK_PRESENT_MODE_MAILBOX_KHR) {
+            celeriqueLogTrace("Present mailbox mode.");
+            // Priority choice of present mode.
+            // Will halt from here on.
+            return VK_PRESENT_MODE_MAILBOX_KHR;
+        } else if (presentMode == VK_PRESENT_MODE_FIFO_KHR) {
+            celeriqueLogTrace("Present fifo mode chosen but will keep looking.");
+            // Will settle on this but will keep looking.
+            chosenPresentMode = VK_PRESENT_MODE_FIFO_KHR;
+        }
+    }
+
+    return chosenPresentMode;
+}
+
+/// @brief Determine the swapchain extent which calculates the resolution of the swapchain images.
+/// @param surfaceCapabilities The surface capabilities structure.
+/// @param windowHandle The UI protocol native pointer of the window to be registered.
+/// @param uiProtocol The UI protocol used to create UI elements.
+/// @return The swapchain extent.
+VkExtent2D celerique::vulkan::internal::Manager::determineSwapChainExtent(const VkSurfaceCapabilitiesKHR& surfaceCapabilities, Pointer windowHandle, UiProtocol uiProtocol) {
+    if (surfaceCapabilities.currentExtent.width != UINT32_MAX)
+        return surfaceCapabilities.currentExtent;
+
+    /// @brief The container for the result code from the vulkan api.
+    VkResult result;
+    /// @brief The number of pixel units in the screen.
+    typedef CeleriquePixelUnits PixelUnits;
+
+    /// @brief The width of the viewport.
+    PixelUnits viewportWidth;
+    /// @brief The height of the viewport.
+    PixelUnits viewportHeight;
+
+    switch(uiProtocol) {
+#if (defined(CELERIQUE_FOR_LINUX_SYSTEMS) || defined(CELERIQUE_FOR_BSD_SYSTEMS)) && !defined(CELERIQUE_FOR_ANDROID)
+    case CELERIQUE_UI_PROTOCOL_X11: {
+        // Open a connection to the X server
+        Display* ptrDisplay = XOpenDisplay(NULL);
+        if (ptrDisplay == nullptr) {
+            const char* errorMessage = "Failed to open x11 display.";
+            celeriqueLogError(errorMessage);
+            throw ::std::runtime_error(errorMessage);
+        }
+        /// @brief The x11 ID.
         XID x11Id = reinterpret_cast<XID>(windowHandle);
         /// @brief Contains the x11 attributes.
         XWindowAttributes x11Attributes;
@@ -2006,9 +2766,11 @@ uint32_t celerique::vulkan::internal::Manager::determineMinImageCount(const VkSu
 /// @param numVertexElements The number of individual vertices to draw.
 /// @param ptrVertexBuffer The pointer to the vertex buffer.
 /// @param ptrIndexBuffer The pointer to the index buffer.
+/// @param drawVersion The version of the vertices and indices. 0 when unversioned.
 void celerique::vulkan::internal::Manager::drawOnWindow(
     Pointer windowHandle, PipelineConfigID graphicsPipelineConfigId, size_t numVerticesToDraw,
-    size_t vertexStride, size_t numVertexElements, void* ptrVertexBuffer, uint32_t* ptrIndexBuffer
+    size_t vertexStride, size_t numVertexElements, void* ptrVertexBuffer, uint32_t* ptrIndexBuffer,
+    uint64_t drawVersion
 ) {
     ::std::shared_lock<::std::shared_mutex> readLock(_sharedMutex);
 
@@ -2051,6 +2813,19 @@ void celerique::vulkan::internal::Manager::drawOnWindow(
         throw ::std::runtime_error(errorMessage);
     }
 
+    /// @brief The reference to the in-flight fence of the last submission drawing to the image.
+    VkFence& refImageInFlightFence = _mapWindowToVecImageInFlightFences[windowHandle][imageIndex];
+    // Wait until the last submission drawing to the image finished, so its cached command buffer may be reused.
+    if (refImageInFlightFence != nullptr && refImageInFlightFence != vecInFlightFences[currentFrameIndex]) {
+        result = vkWaitForFences(graphicsLogicalDevice, 1, &refImageInFlightFence, VK_TRUE, UINT32_MAX);
+        if (result != VK_SUCCESS) {
+            ::std::string errorMessage = "Failed to wait for image in-flight fence with result " + ::std::to_string(result);
+            celeriqueLogError(errorMessage);
+            throw ::std::runtime_error(errorMessage);
+        }
+    }
+    refImageInFlightFence = vecInFlightFences[currentFrameIndex];
+
     // Reset the fence for drawing in the GPU.
     result = vkResetFences(graphicsLogicalDevice, 1, &vecInFlightFences[currentFrameIndex]);
     if (result != VK_SUCCESS) {
@@ -2059,263 +2834,795 @@ void celerique::vulkan::internal::Manager::drawOnWindow(
         throw ::std::runtime_error(errorMessage);
     }
 
-    /// @brief The collection of the window's command buffer.
-    const ::std::vector<VkCommandBuffer>& vecCommandBuffers = _mapWindowToVecCommandBuffers[windowHandle];
-    // Reset the command buffer.
-    result = vkResetCommandBuffer(vecCommandBuffers[currentFrameIndex], 0);
+    /// @brief The command buffer to be submitted.
+    VkCommandBuffer commandBuffer = nullptr;
+    // Replay the command buffer recorded for this image if the draw did not change.
+    if (_isCachingCommandBuffers) {
+        /// @brief When checking the draw started.
+        ::std::chrono::steady_clock::time_point checkStart = ::std::chrono::steady_clock::now();
+        /// @brief The hash of the draw.
+        uint64_t drawHash = hashDraw(
+            graphicsPipelineConfigId, numVerticesToDraw, vertexStride, numVertexElements,
+            _mapWindowToSwapChainExtent[windowHandle], ptrVertexBuffer != nullptr, ptrIndexBuffer != nullptr, drawVersion
+        );
+        /// @brief The reference to the hash of the draw the image's cached command buffer was recorded for.
+        uint64_t& refCachedDrawHash = _mapWindowToVecCachedDrawHashes[windowHandle][imageIndex];
+        commandBuffer = _mapWindowToVecCachedCommandBuffers[windowHandle][imageIndex];
+
+        // Unversioned draws hash to 0, which never matches a recorded command buffer.
+        if (drawHash != 0 && drawHash == refCachedDrawHash) {
+            ::std::lock_guard<::std::mutex> lock(_cacheStatsMutex);
+            _numCachedFramesReplayed++;
+            _cachedReplayTime += ::std::chrono::steady_clock::now() - checkStart;
+        } else {
+            /// @brief The reference to the handle to the buffer containing vertex and index data.
+            VkBuffer& refMeshBuffer = _mapWindowToVecCachedMeshBuffers[windowHandle][imageIndex];
+            /// @brief The reference to the handle to the memory of the mesh buffer in the GPU.
+            VkDeviceMemory& refMeshBufferMemory = _mapWindowToVecCachedMeshBufferMemories[windowHandle][imageIndex];
+
+            /// @brief When uploading the mesh started.
+            ::std::chrono::steady_clock::time_point fillStart = ::std::chrono::steady_clock::now();
+            fillMeshBuffer(
+                numVerticesToDraw, vertexStride, numVertexElements, ptrVertexBuffer, ptrIndexBuffer,
+                graphicsLogicalDevice, &refMeshBuffer, &refMeshBufferMemory
+            );
+            /// @brief When recording the commands started.
+            ::std::chrono::steady_clock::time_point recordStart = ::std::chrono::steady_clock::now();
+            // Reset the command buffer.
+            result = vkResetCommandBuffer(commandBuffer, 0);
+            if (result != VK_SUCCESS) {
+                ::std::string errorMessage = "Failed to reset cached command buffer with result " + ::std::to_string(result);
+                celeriqueLogError(errorMessage);
+                throw ::std::runtime_error(errorMessage);
+            }
+            recordDrawCommands(
+                windowHandle, commandBuffer, imageIndex, graphicsPipelineConfigId, numVerticesToDraw, vertexStride,
+                numVertexElements, ptrVertexBuffer != nullptr, ptrIndexBuffer != nullptr, refMeshBuffer
+            );
+            refCachedDrawHash = drawHash;
+
+            ::std::lock_guard<::std::mutex> lock(_cacheStatsMutex);
+            _numCachedMeshFills++;
+            _cachedMeshFillTime += recordStart - fillStart;
+            _numCachedFramesRecorded++;
+            _cachedRecordTime += ::std::chrono::steady_clock::now() - recordStart;
+        }
+    }
+    // Record the frame's command buffer.
+    else {
+        commandBuffer = _mapWindowToVecCommandBuffers[windowHandle][currentFrameIndex];
+        // Reset the command buffer.
+        result = vkResetCommandBuffer(commandBuffer, 0);
+        if (result != VK_SUCCESS) {
+            ::std::string errorMessage = "Failed to reset command buffer with result " + ::std::to_string(result);
+            celeriqueLogError(errorMessage);
+            throw ::std::runtime_error(errorMessage);
+        }
+
+        /// @brief The reference to the handle to the buffer containing vertex and index data.
+        VkBuffer& refMeshBuffer = _mapWindowToVecMeshBuffers[windowHandle][currentFrameIndex];
+        /// @brief The reference to the handle to the memory of the mesh buffer in the GPU.
+        VkDeviceMemory& refMeshBufferMemory = _mapWindowToVecMeshBufferMemories[windowHandle][currentFrameIndex];
+
+        fillMeshBuffer(
+            numVerticesToDraw, vertexStride, numVertexElements, ptrVertexBuffer, ptrIndexBuffer,
+            graphicsLogicalDevice, &refMeshBuffer, &refMeshBufferMemory
+        );
+        recordDrawCommands(
+            windowHandle, commandBuffer, imageIndex, graphicsPipelineConfigId, numVerticesToDraw, vertexStride,
+            numVertexElements, ptrVertexBuffer != nullptr, ptrIndexBuffer != nullptr, refMeshBuffer
+        );
+    }
+
+    /// @brief Collection of wait stages.
+    VkPipelineStageFlags waitStages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
+    /// @brief The collection of render finished semaphores.
+    const ::std::vector<VkSemaphore>& vecRenderFinishedSemaphores = _mapWindowToVecRenderFinishedSemaphores[windowHandle];
+
+    /// @brief Information to be submitted to the graphics queue.
+    VkSubmitInfo graphicsQueueSubmitInfo = {};
+    graphicsQueueSubmitInfo.sType = VkStructureType::VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    graphicsQueueSubmitInfo.commandBufferCount = 1;
+    graphicsQueueSubmitInfo.pCommandBuffers = &commandBuffer;
+    graphicsQueueSubmitInfo.waitSemaphoreCount = 1;
+    graphicsQueueSubmitInfo.pWaitSemaphores = &vecImageAvailableSemaphores[currentFrameIndex];
+    graphicsQueueSubmitInfo.pWaitDstStageMask = waitStages;
+    graphicsQueueSubmitInfo.signalSemaphoreCount = 1;
+    graphicsQueueSubmitInfo.pSignalSemaphores = &vecRenderFinishedSemaphores[currentFrameIndex];
+
+    // Submit to the graphics queue. Signals the in-flight fence when graphics rendering is done.
+    result = vkQueueSubmit(selectGraphicsQueue(graphicsLogicalDevice), 1, &graphicsQueueSubmitInfo, vecInFlightFences[currentFrameIndex]);
     if (result != VK_SUCCESS) {
-        ::std::string errorMessage = "Failed to reset command buffer with result " + ::std::to_string(result);
+        ::std::string errorMessage = "Failed to submit to graphics queue with result " + ::std::to_string(result);
         celeriqueLogError(errorMessage);
         throw ::std::runtime_error(errorMessage);
     }
+    addDynamicBufferFrameFence(graphicsLogicalDevice, vecInFlightFences[currentFrameIndex]);
 
-    /// @brief The reference to the handle to the buffer containing vertex and index data.
-    VkBuffer& refMeshBuffer = _mapWindowToVecMeshBuffers[windowHandle][currentFrameIndex];
-    /// @brief The reference to the handle to the memory of the mesh buffer in the GPU.
-    VkDeviceMemory& refMeshBufferMemory = _mapWindowToVecMeshBufferMemories[windowHandle][currentFrameIndex];
+    /// @brief Presentation information.
+    VkPresentInfoKHR presentInfo = {};
+    presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
+    presentInfo.waitSemaphoreCount = 1;
+    presentInfo.pWaitSemaphores = &vecRenderFinishedSemaphores[currentFrameIndex];
+    presentInfo.swapchainCount = 1;
+    presentInfo.pSwapchains = &swapChain;
+    presentInfo.pImageIndices = &imageIndex;
 
-    fillMeshBuffer(
-        numVerticesToDraw, vertexStride, numVertexElements, ptrVertexBuffer, ptrIndexBuffer,
-        graphicsLogicalDevice, &refMeshBuffer, &refMeshBufferMemory
+    // Waits for the graphics rendering before
+    // presenting the image back to the swapchain.
+    result = vkQueuePresentKHR(selectPresentQueue(graphicsLogicalDevice), &presentInfo);
+    if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR) {
+        // Simply return. The engine will eventually re-create the swapchain triggered by certain events.
+        return;
+    } else if (result != VK_SUCCESS) {
+        ::std::string errorMessage = "Failed to submit to present with result " + ::std::to_string(result);
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
+    }
+
+    // Update the current frame index.
+    _mapWindowToCurrentFrameIndex[windowHandle] = (currentFrameIndex + 1) % _mapWindowToVecSwapChainFrameBuffers[windowHandle].size();
+}
+
+/// @brief Fill the mesh buffer with vertices and indices to be drawn.
+/// @param numVerticesToDraw The number of vertices to be drawn.
+/// @param vertexStride The size of the individual vertex input.
+/// @param numVertexElements The number of individual vertices to draw.
+/// @param ptrVertexBuffer The pointer to the vertex buffer.
+/// @param ptrIndexBuffer The pointer to the index buffer.
+/// @param graphicsLogicalDevice The graphics logical device used to draw the window.
+/// @param ptrMeshBuffer The pointer to the handle to the buffer containing vertex and index data.
+/// @param ptrMeshBufferMemory The pointer to the handle to the memory of the mesh buffer in the GPU.
+void celerique::vulkan::internal::Manager::fillMeshBuffer(
+    size_t numVerticesToDraw, size_t vertexStride, size_t numVertexElements, void* ptrVertexBuffer, uint32_t* ptrIndexBuffer,
+    VkDevice graphicsLogicalDevice, VkBuffer* ptrMeshBuffer, VkDeviceMemory* ptrMeshBufferMemory
+) {
+    // Destroy the old data if they exist.
+    if (*ptrMeshBufferMemory != nullptr) {
+        vkFreeMemory(graphicsLogicalDevice, *ptrMeshBufferMemory, nullptr);
+        *ptrMeshBufferMemory = nullptr;
+    }
+    if (*ptrMeshBuffer != nullptr) {
+        vkDestroyBuffer(graphicsLogicalDevice, *ptrMeshBuffer, nullptr);
+        *ptrMeshBuffer = nullptr;
+    }
+
+    // Return immediately as there is nothing to fill.
+    if (numVerticesToDraw == 0 || vertexStride == 0 || numVertexElements == 0 || ptrVertexBuffer == nullptr) return;
+
+    /// @brief The variable that stores the result of any vulkan function called.
+    VkResult result;
+
+    /// @brief The size of the buffer to be allocated.
+    VkDeviceSize bufferSize;
+    // Without index buffer.
+    if (ptrIndexBuffer == nullptr) {
+        bufferSize = static_cast<VkDeviceSize>(vertexStride * numVertexElements);
+    }
+    // With index buffer.
+    else {
+        bufferSize = static_cast<VkDeviceSize>(
+            vertexStride * numVertexElements + sizeof(uint32_t) * numVerticesToDraw
+        );
+    }
+
+    /// @brief The CPU accessible objects buffer.
+    VkBuffer stagingObjectsBuffer = nullptr;
+    /// @brief The CPU accessible objects buffer memory.
+    VkDeviceMemory stagingObjectsBufferMemory = nullptr;
+    // Create resources for staging buffer and memory.
+    createBufferAndAllocateMemory(
+        graphicsLogicalDevice, bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+        &stagingObjectsBuffer, &stagingObjectsBufferMemory
     );
 
+    /// @brief The pointer to the CPU accessible buffer of `stagingObjectsBuffer`.
+    void* ptrStagingDataSrc = nullptr;
+    result = vkMapMemory(graphicsLogicalDevice, stagingObjectsBufferMemory, 0, bufferSize, 0, &ptrStagingDataSrc);
+    if (result != VK_SUCCESS) {
+        ::std::string errorMessage = "Failed to map memory with result " + ::std::to_string(result);
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
+    }
+    // Fill in with the vertices data.
+    memcpy(ptrStagingDataSrc, ptrVertexBuffer, vertexStride * numVertexElements);
+    // If index buffer specified,
+    if (ptrIndexBuffer != nullptr) {
+        // Append the data buffer with the indices data.
+        memcpy(
+            reinterpret_cast<void*>(
+                reinterpret_cast<Pointer>(ptrStagingDataSrc) +
+                static_cast<Pointer>(vertexStride * numVertexElements)
+            ),
+            ptrIndexBuffer, numVerticesToDraw * sizeof(uint32_t)
+        );
+    }
+    vkUnmapMemory(graphicsLogicalDevice, stagingObjectsBufferMemory);
+
+    if (ptrIndexBuffer != nullptr) {
+        createBufferAndAllocateMemory(
+            graphicsLogicalDevice, bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT |
+            VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+            ptrMeshBuffer, ptrMeshBufferMemory
+        );
+    } else {
+        createBufferAndAllocateMemory(
+            graphicsLogicalDevice, bufferSize,
+            VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
+            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
+            ptrMeshBuffer, ptrMeshBufferMemory
+        );
+    }
+
+    /// @brief The handle to the physical device that the logical device represents.
+    VkPhysicalDevice physicalDevice = _mapLogicDevToPhysDev[graphicsLogicalDevice];
+    /// @brief The command queue used for copy submission. (will be using the graphics queue).
+    VkQueue copyCommandQueue = selectGraphicsQueue(graphicsLogicalDevice);
+
+    copyVulkanBufferData(graphicsLogicalDevice, copyCommandQueue, stagingObjectsBuffer, *ptrMeshBuffer, bufferSize);
+
+    // Destroy staging resources.
+    vkFreeMemory(graphicsLogicalDevice, stagingObjectsBufferMemory, nullptr);
+    vkDestroyBuffer(graphicsLogicalDevice, stagingObjectsBuffer, nullptr);
+}
+
+/// @brief Record the commands drawing to a swapchain image.
+/// @param windowHandle The handle to the window to be drawn graphics on.
+/// @param commandBuffer The handle to the reset command buffer to record to.
+/// @param imageIndex The index of the swapchain image to be drawn to.
+/// @param graphicsPipelineConfigId The identifier for the graphics pipeline configuration to be used for drawing.
+/// @param numVerticesToDraw The number of vertices to be drawn.
+/// @param vertexStride The size of the individual vertex input.
+/// @param numVertexElements The number of individual vertices to draw.
+/// @param hasVertexBuffer Whether a vertex buffer was specified.
+/// @param hasIndexBuffer Whether an index buffer was specified.
+/// @param meshBuffer The handle to the buffer containing vertex and index data.
+void celerique::vulkan::internal::Manager::recordDrawCommands(
+    Pointer windowHandle, VkCommandBuffer commandBuffer, uint32_t imageIndex,
+    PipelineConfigID graphicsPipelineConfigId, size_t numVerticesToDraw, size_t vertexStride,
+    size_t numVertexElements, bool hasVertexBuffer, bool hasIndexBuffer, VkBuffer meshBuffer
+) {
+    /// @brief The container for the result code from the vulkan api.
+    VkResult result;
+
     /// @brief Information about how the command buffer begins recording.
     VkCommandBufferBeginInfo commandBufferBeginInfo = {};
     commandBufferBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-    result = vkBeginCommandBuffer(vecCommandBuffers[currentFrameIndex], &commandBufferBeginInfo);
+    result = vkBeginCommandBuffer(commandBuffer, &commandBufferBeginInfo);
     if (result != VK_SUCCESS) {
         ::std::string errorMessage = "Failed to begin command buffer with result " + ::std::to_string(result);
         celeriqueLogError(errorMessage);
         throw ::std::runtime_error(errorMessage);
     }
 
-    /// @brief The window's swapchain extent.
-    const VkExtent2D& swapChainExtent = _mapWindowToSwapChainExtent[windowHandle];
+    recordDrawPass(
+        commandBuffer, _pairRenderPassToLogicDev.first, _mapWindowToVecSwapChainFrameBuffers[windowHandle][imageIndex],
+        _mapWindowToSwapChainExtent[windowHandle], graphicsPipelineConfigId, numVerticesToDraw, vertexStride,
+        numVertexElements, hasVertexBuffer, hasIndexBuffer, meshBuffer
+    );
+
+    // End command buffer recording.
+    result = vkEndCommandBuffer(commandBuffer);
+    if (result != VK_SUCCESS) {
+        ::std::string errorMessage = "Failed to record command with result " + ::std::to_string(result);
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
+    }
+}
 
+/// @brief Record a render pass drawing to a framebuffer.
+/// @param commandBuffer The handle to the command buffer being recorded.
+/// @param renderPass The handle to the render pass compatible with the pipeline.
+/// @param frameBuffer The handle to the framebuffer to be drawn to.
+/// @param extent The extent of the framebuffer.
+/// @param graphicsPipelineConfigId The identifier for the graphics pipeline configuration to be used for drawing.
+/// @param numVerticesToDraw The number of vertices to be drawn.
+/// @param vertexStride The size of the individual vertex input.
+/// @param numVertexElements The number of individual vertices to draw.
+/// @param hasVertexBuffer Whether a vertex buffer was specified.
+/// @param hasIndexBuffer Whether an index buffer was specified.
+/// @param meshBuffer The handle to the buffer containing vertex and index data.
+void celerique::vulkan::internal::Manager::recordDrawPass(
+    VkCommandBuffer commandBuffer, VkRenderPass renderPass, VkFramebuffer frameBuffer, const VkExtent2D& extent,
+    PipelineConfigID graphicsPipelineConfigId, size_t numVerticesToDraw, size_t vertexStride,
+    size_t numVertexElements, bool hasVertexBuffer, bool hasIndexBuffer, VkBuffer meshBuffer
+) {
     /// @brief The viewport description.
     VkViewport viewport = {};
     viewport.x = 0.0f;
     viewport.y = 0.0f;
-    viewport.width = static_cast<float>(swapChainExtent.width);
-    viewport.height = static_cast<float>(swapChainExtent.height);
+    viewport.width = static_cast<float>(extent.width);
+    viewport.height = static_cast<float>(extent.height);
     viewport.minDepth = 0.0f;
     viewport.maxDepth = 1.0f;
     // Set the viewport
-    vkCmdSetViewport(vecCommandBuffers[currentFrameIndex], 0, 1, &viewport);
+    vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
 
     /// @brief The scissor rectangle description.
     VkRect2D scissor = {};
     scissor.offset = {0, 0};
-    scissor.extent = swapChainExtent;
+    scissor.extent = extent;
 
     // Set the scissor
-    vkCmdSetScissor(vecCommandBuffers[currentFrameIndex], 0, 1, &scissor);
+    vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
 
     /// @brief The clear value.
     VkClearValue clearValue;
     clearValue.color = {0.0f, 0.0f, 0.0f, 0.01}; // Setting the screen to black.
-    /// @brief The window's collection of frame buffers.
-    const ::std::vector<VkFramebuffer>& vecSwapChainFrameBuffers = _mapWindowToVecSwapChainFrameBuffers[windowHandle];
 
     /// @brief Information about beginning render pass.
     VkRenderPassBeginInfo renderPassBeginInfo = {};
     renderPassBeginInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-    renderPassBeginInfo.renderPass = _pairRenderPassToLogicDev.first;
-    renderPassBeginInfo.framebuffer = vecSwapChainFrameBuffers[imageIndex];
+    renderPassBeginInfo.renderPass = renderPass;
+    renderPassBeginInfo.framebuffer = frameBuffer;
     renderPassBeginInfo.renderArea.offset = {0, 0};
-    renderPassBeginInfo.renderArea.extent = _mapWindowToSwapChainExtent[windowHandle];
+    renderPassBeginInfo.renderArea.extent = extent;
     renderPassBeginInfo.clearValueCount = 1;
     renderPassBeginInfo.pClearValues = &clearValue;
     // Begin render pass.
-    vkCmdBeginRenderPass(vecCommandBuffers[currentFrameIndex], &renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
+    vkCmdBeginRenderPass(commandBuffer, &renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
 
     /// @brief The handle to the graphics pipeline to be used for rendering.
     VkPipeline graphicsPipeline = _mapGraphicsPipelineIdToPipeline[graphicsPipelineConfigId];
     // Bind the command buffer to the graphics pipeline.
-    vkCmdBindPipeline(vecCommandBuffers[currentFrameIndex], VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline);
+    vkCmdBindPipeline(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, graphicsPipeline);
 
     /// @brief The collection of offset values for the mesh buffer.
     VkDeviceSize arrOffsets[] = {0};
     // Vertex buffer specified.
-    if (ptrVertexBuffer != nullptr && refMeshBuffer != nullptr) {
-        vkCmdBindVertexBuffers(vecCommandBuffers[currentFrameIndex], 0, 1, &refMeshBuffer, arrOffsets);
+    if (hasVertexBuffer && meshBuffer != nullptr) {
+        vkCmdBindVertexBuffers(commandBuffer, 0, 1, &meshBuffer, arrOffsets);
     }
 
     // Index buffer specified.
-    if (ptrIndexBuffer != nullptr && refMeshBuffer != nullptr) {
+    if (hasIndexBuffer && meshBuffer != nullptr) {
         // Bind the indices.
         vkCmdBindIndexBuffer(
-            vecCommandBuffers[currentFrameIndex], refMeshBuffer,
+            commandBuffer, meshBuffer,
             static_cast<VkDeviceSize>(vertexStride * numVertexElements), VK_INDEX_TYPE_UINT32
         );
-        vkCmdDrawIndexed(vecCommandBuffers[currentFrameIndex], static_cast<uint32_t>(numVerticesToDraw), 1, 0, 0, 0);
+        vkCmdDrawIndexed(commandBuffer, static_cast<uint32_t>(numVerticesToDraw), 1, 0, 0, 0);
     }
     // No index buffer specified.
     else {
-        vkCmdDraw(vecCommandBuffers[currentFrameIndex], static_cast<uint32_t>(numVerticesToDraw), 1, 0, 0);
+        vkCmdDraw(commandBuffer, static_cast<uint32_t>(numVerticesToDraw), 1, 0, 0);
+    }
+
+    // End the render pass.
+    vkCmdEndRenderPass(commandBuffer);
+}
+
+/// @brief Draw graphics once to the shared scene target of a logical device, then blit it to every window,
+/// submitting and presenting them together.
+/// @param graphicsLogicalDevice The handle to the graphics logical device.
+/// @param vecWindowHandles The handles to the windows to be drawn graphics on.
+/// @param graphicsPipelineConfigId The identifier for the graphics pipeline configuration to be used for drawing.
+/// @param numVerticesToDraw The number of vertices to be drawn.
+/// @param vertexStride The size of the individual vertex input.
+/// @param numVertexElements The number of individual vertices to draw.
+/// @param ptrVertexBuffer The pointer to the vertex buffer.
+/// @param ptrIndexBuffer The pointer to the index buffer.
+void celerique::vulkan::internal::Manager::drawSharedScene(
+    VkDevice graphicsLogicalDevice, const ::std::vector<Pointer>& vecWindowHandles,
+    PipelineConfigID graphicsPipelineConfigId, size_t numVerticesToDraw, size_t vertexStride,
+    size_t numVertexElements, void* ptrVertexBuffer, uint32_t* ptrIndexBuffer
+) {
+    ::std::shared_lock<::std::shared_mutex> readLock(_sharedMutex);
+
+    /// @brief The container for the result code from the vulkan api.
+    VkResult result;
+    /// @brief The reference to the device's shared scene target.
+    SharedSceneTarget& refTarget = _mapLogicDevToSharedSceneTarget.at(graphicsLogicalDevice);
+    // The shared lock only keeps the target alive, its frames are drawn one at a time.
+    ::std::lock_guard<::std::mutex> targetLock(*refTarget.ptrMutex);
+    /// @brief The current frame index being rendered.
+    size_t currentFrameIndex = refTarget.currentFrameIndex;
+    /// @brief The in-flight fence of the current frame.
+    VkFence inFlightFence = refTarget.vecInFlightFences[currentFrameIndex];
+
+    // Wait until the frame has finished rendering in the GPU.
+    result = vkWaitForFences(graphicsLogicalDevice, 1, &inFlightFence, VK_TRUE, UINT32_MAX);
+    if (result != VK_SUCCESS) {
+        ::std::string errorMessage = "Failed to wait for shared scene in-flight fence with result " + ::std::to_string(result);
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
+    }
+
+    /// @brief The extent covering every window. Each window scales the scene down to fit.
+    VkExtent2D sceneExtent = {0, 0};
+    for (Pointer windowHandle : vecWindowHandles) {
+        const VkExtent2D& swapChainExtent = _mapWindowToSwapChainExtent[windowHandle];
+        sceneExtent.width = ::std::max(sceneExtent.width, swapChainExtent.width);
+        sceneExtent.height = ::std::max(sceneExtent.height, swapChainExtent.height);
+    }
+    if (sceneExtent.width == 0 || sceneExtent.height == 0) return;
+    if (sceneExtent.width != refTarget.extent.width || sceneExtent.height != refTarget.extent.height) {
+        createSharedSceneImage(graphicsLogicalDevice, refTarget, sceneExtent);
+    }
+
+    /// @brief The windows whose swapchain image was acquired.
+    ::std::vector<Pointer> vecPresentedWindowHandles;
+    vecPresentedWindowHandles.reserve(vecWindowHandles.size());
+    /// @brief The swapchains to be presented.
+    ::std::vector<VkSwapchainKHR> vecSwapChains;
+    vecSwapChains.reserve(vecWindowHandles.size());
+    /// @brief The indices of the images to be presented.
+    ::std::vector<uint32_t> vecImageIndices;
+    vecImageIndices.reserve(vecWindowHandles.size());
+    /// @brief The image available semaphores the submission waits on.
+    ::std::vector<VkSemaphore> vecImageAvailableSemaphores;
+    vecImageAvailableSemaphores.reserve(vecWindowHandles.size());
+    /// @brief Wait on the semaphores of the images already acquired, so that they are unsignaled when
+    /// this frame is given up. Their images are released when their swapchains are re-created.
+    auto recycleImageAvailableSemaphores = [&]() {
+        if (vecImageAvailableSemaphores.empty()) return;
+        /// @brief The stages waiting on each semaphore.
+        ::std::vector<VkPipelineStageFlags> vecWaitStages(vecImageAvailableSemaphores.size(), VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+        /// @brief The submission waiting on the semaphores, with nothing to execute.
+        VkSubmitInfo recycleSubmitInfo = {};
+        recycleSubmitInfo.sType = VkStructureType::VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        recycleSubmitInfo.waitSemaphoreCount = static_cast<uint32_t>(vecImageAvailableSemaphores.size());
+        recycleSubmitInfo.pWaitSemaphores = vecImageAvailableSemaphores.data();
+        recycleSubmitInfo.pWaitDstStageMask = vecWaitStages.data();
+        /// @brief The graphics queue of the device.
+        VkQueue graphicsQueue = selectGraphicsQueue(graphicsLogicalDevice);
+        if (vkQueueSubmit(graphicsQueue, 1, &recycleSubmitInfo, VK_NULL_HANDLE) == VK_SUCCESS) {
+            // The semaphores are signaled again by later acquires, so the waits must have executed.
+            vkQueueWaitIdle(graphicsQueue);
+        }
+    };
+    // Obtain the next image of every window.
+    for (Pointer windowHandle : vecWindowHandles) {
+        /// @brief The window's swapchain handle.
+        VkSwapchainKHR swapChain = _mapWindowToSwapChain[windowHandle];
+        /// @brief The semaphore signaled once the image is available.
+        VkSemaphore imageAvailableSemaphore = refTarget.mapWindowToVecImageAvailableSemaphores.at(windowHandle)[currentFrameIndex];
+        /// @brief The index of the image to be rendered.
+        uint32_t imageIndex = 0;
+        result = vkAcquireNextImageKHR(
+            graphicsLogicalDevice, swapChain, UINT32_MAX, imageAvailableSemaphore, VK_NULL_HANDLE, &imageIndex
+        );
+        if (result == VK_ERROR_OUT_OF_DATE_KHR) {
+            // Skip the window. The engine will eventually re-create the swapchain triggered by certain events.
+            continue;
+        }
+        else if (result != VK_SUCCESS && result != VK_SUBOPTIMAL_KHR) {
+            recycleImageAvailableSemaphores();
+            ::std::string errorMessage = "Failed to acquire next image index with result " + ::std::to_string(result);
+            celeriqueLogError(errorMessage);
+            throw ::std::runtime_error(errorMessage);
+        }
+        vecImageAvailableSemaphores.push_back(imageAvailableSemaphore);
+
+        /// @brief The reference to the in-flight fence of the last submission drawing to the image.
+        VkFence& refImageInFlightFence = _mapWindowToVecImageInFlightFences[windowHandle][imageIndex];
+        // Wait until the last submission drawing to the image finished.
+        if (refImageInFlightFence != nullptr && refImageInFlightFence != inFlightFence) {
+            result = vkWaitForFences(graphicsLogicalDevice, 1, &refImageInFlightFence, VK_TRUE, UINT32_MAX);
+            if (result != VK_SUCCESS) {
+                recycleImageAvailableSemaphores();
+                ::std::string errorMessage = "Failed to wait for image in-flight fence with result " + ::std::to_string(result);
+                celeriqueLogError(errorMessage);
+                throw ::std::runtime_error(errorMessage);
+            }
+        }
+        refImageInFlightFence = inFlightFence;
+
+        vecPresentedWindowHandles.push_back(windowHandle);
+        vecSwapChains.push_back(swapChain);
+        vecImageIndices.push_back(imageIndex);
+    }
+    // Nothing to present to.
+    if (vecSwapChains.empty()) return;
+
+    // Reset the fence for drawing in the GPU.
+    result = vkResetFences(graphicsLogicalDevice, 1, &inFlightFence);
+    if (result != VK_SUCCESS) {
+        ::std::string errorMessage = "Failed to reset shared scene in-flight fence with result " + ::std::to_string(result);
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
+    }
+
+    fillMeshBuffer(
+        numVerticesToDraw, vertexStride, numVertexElements, ptrVertexBuffer, ptrIndexBuffer, graphicsLogicalDevice,
+        &refTarget.vecMeshBuffers[currentFrameIndex], &refTarget.vecMeshBufferMemories[currentFrameIndex]
+    );
+
+    /// @brief The command buffer rendering the scene and blitting it to every window.
+    VkCommandBuffer commandBuffer = refTarget.vecCommandBuffers[currentFrameIndex];
+    // Reset the command buffer.
+    result = vkResetCommandBuffer(commandBuffer, 0);
+    if (result != VK_SUCCESS) {
+        ::std::string errorMessage = "Failed to reset shared scene command buffer with result " + ::std::to_string(result);
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
+    }
+    /// @brief Information about how the command buffer begins recording.
+    VkCommandBufferBeginInfo commandBufferBeginInfo = {};
+    commandBufferBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    result = vkBeginCommandBuffer(commandBuffer, &commandBufferBeginInfo);
+    if (result != VK_SUCCESS) {
+        ::std::string errorMessage = "Failed to begin shared scene command buffer with result " + ::std::to_string(result);
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
+    }
+
+    // Render the scene once. The render pass leaves the image ready to be blitted from.
+    recordDrawPass(
+        commandBuffer, refTarget.renderPass, refTarget.frameBuffer, refTarget.extent, graphicsPipelineConfigId,
+        numVerticesToDraw, vertexStride, numVertexElements, ptrVertexBuffer != nullptr, ptrIndexBuffer != nullptr,
+        refTarget.vecMeshBuffers[currentFrameIndex]
+    );
+
+    /// @brief The colour the bars around a scaled scene are cleared to.
+    VkClearColorValue barColour = {};
+    barColour.float32[3] = 1.0f;
+    /// @brief The whole colour subresource of a swapchain image.
+    VkImageSubresourceRange subresourceRange = {};
+    subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    subresourceRange.baseMipLevel = 0;
+    subresourceRange.levelCount = 1;
+    subresourceRange.baseArrayLayer = 0;
+    subresourceRange.layerCount = 1;
+
+    // Scale the scene into every window, keeping its aspect ratio.
+    for (size_t i = 0; i < vecPresentedWindowHandles.size(); i++) {
+        /// @brief The window's swapchain extent.
+        const VkExtent2D& swapChainExtent = _mapWindowToSwapChainExtent[vecPresentedWindowHandles[i]];
+        /// @brief The swapchain image to be blitted to.
+        VkImage swapChainImage = _mapWindowToVecSwapChainImages[vecPresentedWindowHandles[i]][vecImageIndices[i]];
+
+        /// @brief The scale fitting the scene inside the window.
+        double scale = ::std::min(
+            static_cast<double>(swapChainExtent.width) / refTarget.extent.width,
+            static_cast<double>(swapChainExtent.height) / refTarget.extent.height
+        );
+        /// @brief The width of the scaled scene.
+        int32_t scaledWidth = ::std::max(1, static_cast<int32_t>(refTarget.extent.width * scale));
+        /// @brief The height of the scaled scene.
+        int32_t scaledHeight = ::std::max(1, static_cast<int32_t>(refTarget.extent.height * scale));
+        /// @brief Whether the scaled scene leaves bars to be cleared.
+        bool hasBars = scaledWidth != static_cast<int32_t>(swapChainExtent.width) ||
+            scaledHeight != static_cast<int32_t>(swapChainExtent.height);
+
+        /// @brief The barrier making the swapchain image writable by transfers.
+        VkImageMemoryBarrier toTransferBarrier = {};
+        toTransferBarrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        toTransferBarrier.srcAccessMask = 0;
+        toTransferBarrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        toTransferBarrier.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        toTransferBarrier.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        toTransferBarrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        toTransferBarrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        toTransferBarrier.image = swapChainImage;
+        toTransferBarrier.subresourceRange = subresourceRange;
+        // The acquire semaphore is waited on at the transfer stage.
+        vkCmdPipelineBarrier(
+            commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+            0, 0, nullptr, 0, nullptr, 1, &toTransferBarrier
+        );
+
+        if (hasBars) {
+            vkCmdClearColorImage(
+                commandBuffer, swapChainImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &barColour, 1, &subresourceRange
+            );
+            /// @brief The barrier ordering the blit after the clear.
+            VkImageMemoryBarrier clearedBarrier = toTransferBarrier;
+            clearedBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+            clearedBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            vkCmdPipelineBarrier(
+                commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                0, 0, nullptr, 0, nullptr, 1, &clearedBarrier
+            );
+        }
+
+        /// @brief The region of the scene scaled to the centre of the window.
+        VkImageBlit blitRegion = {};
+        blitRegion.srcSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+        blitRegion.srcSubresource.mipLevel = 0;
+        blitRegion.srcSubresource.baseArrayLayer = 0;
+        blitRegion.srcSubresource.layerCount = 1;
+        blitRegion.srcOffsets[0] = {0, 0, 0};
+        blitRegion.srcOffsets[1] = {static_cast<int32_t>(refTarget.extent.width), static_cast<int32_t>(refTarget.extent.height), 1};
+        blitRegion.dstSubresource = blitRegion.srcSubresource;
+        blitRegion.dstOffsets[0] = {
+            (static_cast<int32_t>(swapChainExtent.width) - scaledWidth) / 2,
+            (static_cast<int32_t>(swapChainExtent.height) - scaledHeight) / 2, 0
+        };
+        blitRegion.dstOffsets[1] = {blitRegion.dstOffsets[0].x + scaledWidth, blitRegion.dstOffsets[0].y + scaledHeight, 1};
+        vkCmdBlitImage(
+            commandBuffer, refTarget.image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            swapChainImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &blitRegion, refTarget.blitFilter
+        );
+
+        /// @brief The barrier handing the swapchain image to the presentation engine.
+        VkImageMemoryBarrier toPresentBarrier = toTransferBarrier;
+        toPresentBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        toPresentBarrier.dstAccessMask = 0;
+        toPresentBarrier.oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        toPresentBarrier.newLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+        vkCmdPipelineBarrier(
+            commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+            0, 0, nullptr, 0, nullptr, 1, &toPresentBarrier
+        );
     }
 
-    // End the render pass.
-    vkCmdEndRenderPass(vecCommandBuffers[currentFrameIndex]);
     // End command buffer recording.
-    result = vkEndCommandBuffer(vecCommandBuffers[currentFrameIndex]);
+    result = vkEndCommandBuffer(commandBuffer);
     if (result != VK_SUCCESS) {
-        ::std::string errorMessage = "Failed to record command with result " + ::std::to_string(result);
+        ::std::string errorMessage = "Failed to record shared scene command with result " + ::std::to_string(result);
         celeriqueLogError(errorMessage);
         throw ::std::runtime_error(errorMessage);
     }
 
-    /// @brief Collection of wait stages.
-    VkPipelineStageFlags waitStages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
-    /// @brief The collection of render finished semaphores.
-    const ::std::vector<VkSemaphore>& vecRenderFinishedSemaphores = _mapWindowToVecRenderFinishedSemaphores[windowHandle];
+    /// @brief The stages waiting on each image available semaphore.
+    ::std::vector<VkPipelineStageFlags> vecWaitStages(vecImageAvailableSemaphores.size(), VK_PIPELINE_STAGE_TRANSFER_BIT);
+    /// @brief The semaphore signaled when every window's image was written.
+    VkSemaphore renderFinishedSemaphore = refTarget.vecRenderFinishedSemaphores[currentFrameIndex];
 
-    /// @brief Information to be submitted to the graphics queue.
+    /// @brief Information to be submitted to the graphics queue, covering every window.
     VkSubmitInfo graphicsQueueSubmitInfo = {};
     graphicsQueueSubmitInfo.sType = VkStructureType::VK_STRUCTURE_TYPE_SUBMIT_INFO;
     graphicsQueueSubmitInfo.commandBufferCount = 1;
-    graphicsQueueSubmitInfo.pCommandBuffers = &vecCommandBuffers[currentFrameIndex];
-    graphicsQueueSubmitInfo.waitSemaphoreCount = 1;
-    graphicsQueueSubmitInfo.pWaitSemaphores = &vecImageAvailableSemaphores[currentFrameIndex];
-    graphicsQueueSubmitInfo.pWaitDstStageMask = waitStages;
+    graphicsQueueSubmitInfo.pCommandBuffers = &commandBuffer;
+    graphicsQueueSubmitInfo.waitSemaphoreCount = static_cast<uint32_t>(vecImageAvailableSemaphores.size());
+    graphicsQueueSubmitInfo.pWaitSemaphores = vecImageAvailableSemaphores.data();
+    graphicsQueueSubmitInfo.pWaitDstStageMask = vecWaitStages.data();
     graphicsQueueSubmitInfo.signalSemaphoreCount = 1;
-    graphicsQueueSubmitInfo.pSignalSemaphores = &vecRenderFinishedSemaphores[currentFrameIndex];
+    graphicsQueueSubmitInfo.pSignalSemaphores = &renderFinishedSemaphore;
 
     // Submit to the graphics queue. Signals the in-flight fence when graphics rendering is done.
-    result = vkQueueSubmit(selectGraphicsQueue(graphicsLogicalDevice), 1, &graphicsQueueSubmitInfo, vecInFlightFences[currentFrameIndex]);
+    result = vkQueueSubmit(selectGraphicsQueue(graphicsLogicalDevice), 1, &graphicsQueueSubmitInfo, inFlightFence);
     if (result != VK_SUCCESS) {
-        ::std::string errorMessage = "Failed to submit to graphics queue with result " + ::std::to_string(result);
+        ::std::string errorMessage = "Failed to submit shared scene to graphics queue with result " + ::std::to_string(result);
         celeriqueLogError(errorMessage);
         throw ::std::runtime_error(errorMessage);
     }
+    addDynamicBufferFrameFence(graphicsLogicalDevice, inFlightFence);
+    refTarget.currentFrameIndex = (currentFrameIndex + 1) % numSharedSceneFrames;
 
-    /// @brief Presentation information.
+    /// @brief The result of presenting to each swapchain.
+    ::std::vector<VkResult> vecPresentResults(vecSwapChains.size(), VK_SUCCESS);
+    /// @brief Presentation information, covering every window.
     VkPresentInfoKHR presentInfo = {};
     presentInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
     presentInfo.waitSemaphoreCount = 1;
-    presentInfo.pWaitSemaphores = &vecRenderFinishedSemaphores[currentFrameIndex];
-    presentInfo.swapchainCount = 1;
-    presentInfo.pSwapchains = &swapChain;
-    presentInfo.pImageIndices = &imageIndex;
+    presentInfo.pWaitSemaphores = &renderFinishedSemaphore;
+    presentInfo.swapchainCount = static_cast<uint32_t>(vecSwapChains.size());
+    presentInfo.pSwapchains = vecSwapChains.data();
+    presentInfo.pImageIndices = vecImageIndices.data();
+    presentInfo.pResults = vecPresentResults.data();
 
-    // Waits for the graphics rendering before
-    // presenting the image back to the swapchain.
+    // Waits for the graphics rendering before presenting the images back to their swapchains.
     result = vkQueuePresentKHR(selectPresentQueue(graphicsLogicalDevice), &presentInfo);
-    if (result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR) {
-        // Simply return. The engine will eventually re-create the swapchain triggered by certain events.
-        return;
-    } else if (result != VK_SUCCESS) {
-        ::std::string errorMessage = "Failed to submit to present with result " + ::std::to_string(result);
+    // The engine will eventually re-create out of date swapchains triggered by certain events.
+    if (result != VK_SUCCESS && result != VK_ERROR_OUT_OF_DATE_KHR && result != VK_SUBOPTIMAL_KHR) {
+        ::std::string errorMessage = "Failed to submit shared scene to present with result " + ::std::to_string(result);
         celeriqueLogError(errorMessage);
         throw ::std::runtime_error(errorMessage);
     }
-
-    // Update the current frame index.
-    _mapWindowToCurrentFrameIndex[windowHandle] = (currentFrameIndex + 1) % vecSwapChainFrameBuffers.size();
+    for (VkResult presentResult : vecPresentResults) {
+        if (presentResult != VK_SUCCESS && presentResult != VK_ERROR_OUT_OF_DATE_KHR && presentResult != VK_SUBOPTIMAL_KHR) {
+            ::std::string errorMessage = "Failed to present shared scene to a window with result " + ::std::to_string(presentResult);
+            celeriqueLogError(errorMessage);
+            throw ::std::runtime_error(errorMessage);
+        }
+    }
 }
 
-/// @brief Fill the mesh buffer with vertices and indices to be drawn.
-/// @param numVerticesToDraw The number of vertices to be drawn.
-/// @param vertexStride The size of the individual vertex input.
-/// @param numVertexElements The number of individual vertices to draw.
-/// @param ptrVertexBuffer The pointer to the vertex buffer.
-/// @param ptrIndexBuffer The pointer to the index buffer.
-/// @param graphicsLogicalDevice The graphics logical device used to draw the window.
-/// @param ptrMeshBuffer The pointer to the handle to the buffer containing vertex and index data.
-/// @param ptrMeshBufferMemory The pointer to the handle to the memory of the mesh buffer in the GPU.
-void celerique::vulkan::internal::Manager::fillMeshBuffer(
-    size_t numVerticesToDraw, size_t vertexStride, size_t numVertexElements, void* ptrVertexBuffer, uint32_t* ptrIndexBuffer,
-    VkDevice graphicsLogicalDevice, VkBuffer* ptrMeshBuffer, VkDeviceMemory* ptrMeshBufferMemory
+/// @brief (Re-)create the offscreen image of a shared scene target. Waits for its frames to finish.
+/// @param graphicsLogicalDevice The handle to the graphics logical device.
+/// @param refTarget The reference to the shared scene target.
+/// @param extent The extent of the image.
+void celerique::vulkan::internal::Manager::createSharedSceneImage(
+    VkDevice graphicsLogicalDevice, SharedSceneTarget& refTarget, const VkExtent2D& extent
 ) {
-    // Destroy the old data if they exist.
-    if (*ptrMeshBufferMemory != nullptr) {
-        vkFreeMemory(graphicsLogicalDevice, *ptrMeshBufferMemory, nullptr);
-        *ptrMeshBufferMemory = nullptr;
-    }
-    if (*ptrMeshBuffer != nullptr) {
-        vkDestroyBuffer(graphicsLogicalDevice, *ptrMeshBuffer, nullptr);
-        *ptrMeshBuffer = nullptr;
-    }
-
-    // Return immediately as there is nothing to fill.
-    if (numVerticesToDraw == 0 || vertexStride == 0 || numVertexElements == 0 || ptrVertexBuffer == nullptr) return;
-
-    /// @brief The variable that stores the result of any vulkan function called.
+    /// @brief The container for the result code from the vulkan api.
     VkResult result;
 
-    /// @brief The size of the buffer to be allocated.
-    VkDeviceSize bufferSize;
-    // Without index buffer.
-    if (ptrIndexBuffer == nullptr) {
-        bufferSize = static_cast<VkDeviceSize>(vertexStride * numVertexElements);
+    // The previous frames may still be reading the old image.
+    result = vkWaitForFences(
+        graphicsLogicalDevice, static_cast<uint32_t>(refTarget.vecInFlightFences.size()),
+        refTarget.vecInFlightFences.data(), VK_TRUE, UINT32_MAX
+    );
+    if (result != VK_SUCCESS) {
+        ::std::string errorMessage = "Failed to wait for shared scene in-flight fences with result " + ::std::to_string(result);
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
     }
-    // With index buffer.
-    else {
-        bufferSize = static_cast<VkDeviceSize>(
-            vertexStride * numVertexElements + sizeof(uint32_t) * numVerticesToDraw
-        );
+    destroySharedSceneImage(graphicsLogicalDevice, refTarget);
+
+    /// @brief Information about the offscreen image to be created.
+    VkImageCreateInfo imageInfo = {};
+    imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+    imageInfo.imageType = VK_IMAGE_TYPE_2D;
+    imageInfo.format = refTarget.format;
+    imageInfo.extent = {extent.width, extent.height, 1};
+    imageInfo.mipLevels = 1;
+    imageInfo.arrayLayers = 1;
+    imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+    imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+    imageInfo.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+    imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    // Create the image.
+    result = vkCreateImage(graphicsLogicalDevice, &imageInfo, nullptr, &refTarget.image);
+    if (result != VK_SUCCESS) {
+        ::std::string errorMessage = "Failed to create shared scene image with result " + ::std::to_string(result);
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
     }
 
-    /// @brief The CPU accessible objects buffer.
-    VkBuffer stagingObjectsBuffer = nullptr;
-    /// @brief The CPU accessible objects buffer memory.
-    VkDeviceMemory stagingObjectsBufferMemory = nullptr;
-    // Create resources for staging buffer and memory.
-    createBufferAndAllocateMemory(
-        graphicsLogicalDevice, bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
-        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
-        &stagingObjectsBuffer, &stagingObjectsBufferMemory
+    /// @brief The memory requirements for the image.
+    VkMemoryRequirements memoryRequirements = {};
+    vkGetImageMemoryRequirements(graphicsLogicalDevice, refTarget.image, &memoryRequirements);
+    /// @brief Information about the memory to be allocated.
+    VkMemoryAllocateInfo memoryAllocateInfo = {};
+    memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    memoryAllocateInfo.allocationSize = memoryRequirements.size;
+    memoryAllocateInfo.memoryTypeIndex = findMemoryTypeIndex(
+        _mapLogicDevToPhysDev[graphicsLogicalDevice], memoryRequirements.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT
     );
-
-    /// @brief The pointer to the CPU accessible buffer of `stagingObjectsBuffer`.
-    void* ptrStagingDataSrc = nullptr;
-    result = vkMapMemory(graphicsLogicalDevice, stagingObjectsBufferMemory, 0, bufferSize, 0, &ptrStagingDataSrc);
+    // Allocate memory.
+    result = vkAllocateMemory(graphicsLogicalDevice, &memoryAllocateInfo, nullptr, &refTarget.imageMemory);
     if (result != VK_SUCCESS) {
-        ::std::string errorMessage = "Failed to map memory with result " + ::std::to_string(result);
+        ::std::string errorMessage = "Failed to allocate shared scene image memory with result " + ::std::to_string(result);
         celeriqueLogError(errorMessage);
         throw ::std::runtime_error(errorMessage);
     }
-    // Fill in with the vertices data.
-    memcpy(ptrStagingDataSrc, ptrVertexBuffer, vertexStride * numVertexElements);
-    // If index buffer specified,
-    if (ptrIndexBuffer != nullptr) {
-        // Append the data buffer with the indices data.
-        memcpy(
-            reinterpret_cast<void*>(
-                reinterpret_cast<Pointer>(ptrStagingDataSrc) +
-                static_cast<Pointer>(vertexStride * numVertexElements)
-            ),
-            ptrIndexBuffer, numVerticesToDraw * sizeof(uint32_t)
-        );
+    // Bind the image to the memory.
+    result = vkBindImageMemory(graphicsLogicalDevice, refTarget.image, refTarget.imageMemory, 0);
+    if (result != VK_SUCCESS) {
+        ::std::string errorMessage = "Failed to bind shared scene image memory with result " + ::std::to_string(result);
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
     }
-    vkUnmapMemory(graphicsLogicalDevice, stagingObjectsBufferMemory);
 
-    if (ptrIndexBuffer != nullptr) {
-        createBufferAndAllocateMemory(
-            graphicsLogicalDevice, bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT |
-            VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
-            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-            ptrMeshBuffer, ptrMeshBufferMemory
-        );
-    } else {
-        createBufferAndAllocateMemory(
-            graphicsLogicalDevice, bufferSize,
-            VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
-            VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT,
-            ptrMeshBuffer, ptrMeshBufferMemory
-        );
+    /// @brief Contains information on how to create the image view.
+    VkImageViewCreateInfo imageViewInfo = {};
+    imageViewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+    imageViewInfo.image = refTarget.image;
+    imageViewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    imageViewInfo.format = refTarget.format;
+    imageViewInfo.components.r = VK_COMPONENT_SWIZZLE_IDENTITY;
+    imageViewInfo.components.g = VK_COMPONENT_SWIZZLE_IDENTITY;
+    imageViewInfo.components.b = VK_COMPONENT_SWIZZLE_IDENTITY;
+    imageViewInfo.components.a = VK_COMPONENT_SWIZZLE_IDENTITY;
+    imageViewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    imageViewInfo.subresourceRange.baseMipLevel = 0;
+    imageViewInfo.subresourceRange.levelCount = 1;
+    imageViewInfo.subresourceRange.baseArrayLayer = 0;
+    imageViewInfo.subresourceRange.layerCount = 1;
+    // Create image view.
+    result = vkCreateImageView(graphicsLogicalDevice, &imageViewInfo, nullptr, &refTarget.imageView);
+    if (result != VK_SUCCESS) {
+        ::std::string errorMessage = "Failed to create shared scene image view with result " + ::std::to_string(result);
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
     }
 
-    /// @brief The handle to the physical device that the logical device represents.
-    VkPhysicalDevice physicalDevice = _mapLogicDevToPhysDev[graphicsLogicalDevice];
-    /// @brief The command queue used for copy submission. (will be using the graphics queue).
-    VkQueue copyCommandQueue = selectGraphicsQueue(graphicsLogicalDevice);
-
-    copyVulkanBufferData(graphicsLogicalDevice, copyCommandQueue, stagingObjectsBuffer, *ptrMeshBuffer, bufferSize);
+    /// @brief The information about the framebuffer to be created.
+    VkFramebufferCreateInfo frameBufferInfo = {};
+    frameBufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
+    frameBufferInfo.renderPass = refTarget.renderPass;
+    frameBufferInfo.width = extent.width;
+    frameBufferInfo.height = extent.height;
+    frameBufferInfo.layers = 1;
+    frameBufferInfo.attachmentCount = 1;
+    frameBufferInfo.pAttachments = &refTarget.imageView;
+    // Create the framebuffer.
+    result = vkCreateFramebuffer(graphicsLogicalDevice, &frameBufferInfo, nullptr, &refTarget.frameBuffer);
+    if (result != VK_SUCCESS) {
+        ::std::string errorMessage = "Failed to create shared scene frame buffer with result " + ::std::to_string(result);
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
+    }
+    refTarget.extent = extent;
 
-    // Destroy staging resources.
-    vkFreeMemory(graphicsLogicalDevice, stagingObjectsBufferMemory, nullptr);
-    vkDestroyBuffer(graphicsLogicalDevice, stagingObjectsBuffer, nullptr);
+    celeriqueLogTrace("Created shared scene image.");
 }
 
 /// @brief Construct a collection shader stage create information structures.
@@ -2600,6 +3907,202 @@ void celerique::vulkan::internal::Manager::createBufferAndAllocateMemory(
     }
 }
 
+/// @brief Get the copy of a dynamic buffer for the current frame, waiting until the frame
+/// that last used it finished on the GPU. A frame handing out a copy first fills it with the
+/// buffer's latest contents, so writes to part of it keep the rest.
+/// @param bufferId The unique identifier of the dynamic GPU buffer.
+/// @param refDynamicBuffer The reference to the copies of the dynamic buffer.
+/// @param isFullyOverwritten Whether the caller overwrites the whole buffer, so nothing is carried over.
+/// @return The pointer to the mapped memory of the copy.
+::celerique::Byte* celerique::vulkan::internal::Manager::currentDynamicBufferCopy(
+    GpuBufferID bufferId, DynamicBuffer& refDynamicBuffer, bool isFullyOverwritten
+) {
+    // Every write within a frame lands in the same copy.
+    if (refDynamicBuffer.currentFrameIndex != _dynamicBufferFrameIndex) {
+        /// @brief The index of the copy of the current frame.
+        size_t copyIndex = static_cast<size_t>(_dynamicBufferFrameIndex % CELERIQUE_GPU_BUFFER_NUM_DYNAMIC_COPIES);
+        waitForDynamicBufferFrame(_mapGpuBufferIdToLogicDev[bufferId], copyIndex);
+        // The copy last handed out holds the latest contents. The GPU may still be reading it, which reading does not disturb.
+        if (!isFullyOverwritten && refDynamicBuffer.currentFrameIndex != UINT64_MAX && refDynamicBuffer.currentCopyIndex != copyIndex) {
+            memcpy(
+                refDynamicBuffer.ptrMapped + copyIndex * refDynamicBuffer.copyStride,
+                refDynamicBuffer.ptrMapped + refDynamicBuffer.currentCopyIndex * refDynamicBuffer.copyStride,
+                _mapGpuBufferIdToSize[bufferId]
+            );
+        }
+        refDynamicBuffer.currentCopyIndex = copyIndex;
+        refDynamicBuffer.currentFrameIndex = _dynamicBufferFrameIndex;
+    }
+    return refDynamicBuffer.ptrMapped + refDynamicBuffer.currentCopyIndex * refDynamicBuffer.copyStride;
+}
+
+/// @brief Keep the fence of a submission of the current frame, so the frame's dynamic buffer copies
+/// are handed out again only once it signaled.
+/// @param logicalDevice The logical device submitted to.
+/// @param submitFence The fence signaled when the submission finished.
+void celerique::vulkan::internal::Manager::addDynamicBufferFrameFence(VkDevice logicalDevice, VkFence submitFence) {
+    ::std::lock_guard<::std::mutex> lock(_dynamicBufferFrameMutex);
+
+    _isDynamicBufferFrameSubmitted = true;
+    /// @brief The reference to the submission fences of each copy of the device's dynamic buffers.
+    ::std::vector<::std::vector<VkFence>>& refVecFrameSubmitFences = _mapLogicDevToVecFrameSubmitFences[logicalDevice];
+    refVecFrameSubmitFences.resize(CELERIQUE_GPU_BUFFER_NUM_DYNAMIC_COPIES);
+    /// @brief The reference to the submission fences of the current frame's copy.
+    ::std::vector<VkFence>& refVecSubmitFences =
+        refVecFrameSubmitFences[static_cast<size_t>(_dynamicBufferFrameIndex % CELERIQUE_GPU_BUFFER_NUM_DYNAMIC_COPIES)];
+    // Fences are reused by later frames, so waiting on a kept one never waits for less than its frame.
+    if (::std::find(refVecSubmitFences.begin(), refVecSubmitFences.end(), submitFence) == refVecSubmitFences.end()) {
+        refVecSubmitFences.push_back(submitFence);
+    }
+}
+
+/// @brief Advance to the next frame if the draw that just ended submitted to any window.
+void celerique::vulkan::internal::Manager::endDynamicBufferFrame() {
+    ::std::lock_guard<::std::mutex> lock(_dynamicBufferFrameMutex);
+
+    // Copies of frames presenting nothing were never read by the GPU, so they are written again.
+    if (!_isDynamicBufferFrameSubmitted) return;
+    _isDynamicBufferFrameSubmitted = false;
+    _dynamicBufferFrameIndex++;
+}
+
+/// @brief Wait until the GPU finished the last frame that read a copy of the dynamic buffers of a logical device.
+/// @param logicalDevice The logical device of the dynamic buffers.
+/// @param copyIndex The index of the copy.
+void celerique::vulkan::internal::Manager::waitForDynamicBufferFrame(VkDevice logicalDevice, size_t copyIndex) {
+    /// @brief The iterator to the submission fences of each copy of the device's dynamic buffers.
+    auto frameSubmitFencesIterator = _mapLogicDevToVecFrameSubmitFences.find(logicalDevice);
+    if (frameSubmitFencesIterator == _mapLogicDevToVecFrameSubmitFences.end()) return;
+
+    /// @brief The reference to the submission fences of the last frame that read the copy.
+    ::std::vector<VkFence>& refVecSubmitFences = frameSubmitFencesIterator->second[copyIndex];
+    if (refVecSubmitFences.empty()) return;
+    VkResult result = vkWaitForFences(
+        logicalDevice, static_cast<uint32_t>(refVecSubmitFences.size()), refVecSubmitFences.data(), VK_TRUE, UINT64_MAX
+    );
+    if (result != VK_SUCCESS) {
+        ::std::string errorMessage = "Failed to wait for dynamic buffer frame fences with result " + ::std::to_string(result);
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
+    }
+    refVecSubmitFences.clear();
+}
+
+/// @brief Forget the submission fences kept for the frames of an idle logical device.
+/// @param logicalDevice The logical device.
+void celerique::vulkan::internal::Manager::forgetDynamicBufferFrameFences(VkDevice logicalDevice) {
+    ::std::lock_guard<::std::mutex> lock(_dynamicBufferFrameMutex);
+    _mapLogicDevToVecFrameSubmitFences.erase(logicalDevice);
+}
+
+/// @brief Create a persistently mapped buffer object, preferring device local host visible memory
+/// and falling back to host memory.
+/// @param logicalDevice The logical device used to create the resources.
+/// @param deviceSize The size of the memory to be allocated.
+/// @param usageFlags The buffer's usage.
+/// @param ptrBuffer The pointer to the buffer handle.
+/// @param ptrBufferMemory The pointer to the buffer memory handle.
+/// @param ptrDynamicBuffer The pointer to the dynamic buffer to be given the mapped memory.
+void celerique::vulkan::internal::Manager::createDynamicBufferAndAllocateMemory(
+    VkDevice logicalDevice,
+    VkDeviceSize deviceSize,
+    VkBufferUsageFlags usageFlags,
+    VkBuffer* ptrBuffer,
+    VkDeviceMemory* ptrBufferMemory,
+    DynamicBuffer* ptrDynamicBuffer
+) {
+    /// @brief The variable that stores the result of any vulkan function called.
+    VkResult result;
+
+    /// @brief Information about the buffer to be created.
+    VkBufferCreateInfo bufferCreateInfo = {};
+    bufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferCreateInfo.size = deviceSize;
+    bufferCreateInfo.usage = usageFlags;
+    bufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    // Create the buffer.
+    result = vkCreateBuffer(logicalDevice, &bufferCreateInfo, nullptr, ptrBuffer);
+    if(result != VK_SUCCESS) {
+        ::std::string errorMessage = "Failed to create dynamic buffer with result " + ::std::to_string(result);
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
+    }
+
+    /// @brief The memory requirements for the buffer.
+    VkMemoryRequirements memoryRequirements = {};
+    // Retrieve buffer's memory requirements.
+    vkGetBufferMemoryRequirements(logicalDevice, *ptrBuffer, &memoryRequirements);
+
+    /// @brief The handle to the physical device that the logical device represents.
+    VkPhysicalDevice physicalDevice = _mapLogicDevToPhysDev[logicalDevice];
+    /// @brief The container for the memory properties of the specified physical device.
+    VkPhysicalDeviceMemoryProperties memoryProperties = {};
+    vkGetPhysicalDeviceMemoryProperties(physicalDevice, &memoryProperties);
+
+    /// @brief The properties of memory the GPU reads at full speed and the CPU writes directly, such as
+    /// through a resizable BAR or on an integrated GPU.
+    VkMemoryPropertyFlags deviceLocalHostVisibleFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT |
+        VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    /// @brief The memory type index to allocate from.
+    uint32_t memoryTypeIndex = UINT32_MAX;
+    for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; i++) {
+        /// @brief The reference to the memory type being considered.
+        const VkMemoryType& refMemoryType = memoryProperties.memoryTypes[i];
+        if ((memoryRequirements.memoryTypeBits & (1 << i)) != 0 &&
+        (refMemoryType.propertyFlags & deviceLocalHostVisibleFlags) == deviceLocalHostVisibleFlags &&
+        memoryProperties.memoryHeaps[refMemoryType.heapIndex].size >= memoryRequirements.size) {
+            memoryTypeIndex = i;
+            break;
+        }
+    }
+    ptrDynamicBuffer->isDeviceLocal = memoryTypeIndex != UINT32_MAX;
+    if (!ptrDynamicBuffer->isDeviceLocal) {
+        // Fall back to host memory the GPU reads over the bus.
+        memoryTypeIndex = findMemoryTypeIndex(
+            physicalDevice, memoryRequirements.memoryTypeBits,
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT
+        );
+    }
+
+    /// @brief Information about the memory to be allocated.
+    VkMemoryAllocateInfo memoryAllocateInfo = {};
+    memoryAllocateInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    memoryAllocateInfo.allocationSize = memoryRequirements.size;
+    memoryAllocateInfo.memoryTypeIndex = memoryTypeIndex;
+
+    // Allocate memory.
+    result = vkAllocateMemory(logicalDevice, &memoryAllocateInfo, nullptr, ptrBufferMemory);
+    if (result != VK_SUCCESS) {
+        ::std::string errorMessage = "Failed to allocate dynamic buffer memory with result " + ::std::to_string(result);
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
+    }
+
+    // Bind the buffer to the memory.
+    result = vkBindBufferMemory(logicalDevice, *ptrBuffer, *ptrBufferMemory, 0);
+    if (result != VK_SUCCESS) {
+        ::std::string errorMessage = "Failed to bind dynamic buffer memory with result " + ::std::to_string(result);
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
+    }
+
+    /// @brief The pointer to the mapped memory, kept until the buffer is freed.
+    void* ptrMapped = nullptr;
+    result = vkMapMemory(logicalDevice, *ptrBufferMemory, 0, VK_WHOLE_SIZE, 0, &ptrMapped);
+    if (result != VK_SUCCESS) {
+        ::std::string errorMessage = "Failed to map dynamic buffer memory with result " + ::std::to_string(result);
+        celeriqueLogError(errorMessage);
+        throw ::std::runtime_error(errorMessage);
+    }
+    ptrDynamicBuffer->ptrMapped = reinterpret_cast<Byte*>(ptrMapped);
+
+    celeriqueLogTrace(
+        ::std::string("Created dynamic buffer in ") +
+        (ptrDynamicBuffer->isDeviceLocal ? "device local" : "host") + " memory."
+    );
+}
+
 /// @brief Find the memory type index of a given physical device.
 /// @param physicalDevice The physical device specified.
 /// @param typeFilter The bit field types that are suitable.
@@ -2645,6 +4148,86 @@ void celerique::vulkan::internal::Manager::copyVulkanBufferData(
     endSingleTimeCommand(logicalDevice, copyCommandBuffer, commandQueue);
 }
 
+/// @brief Hash everything the commands drawing to a swapchain image are recorded from with 64-bit FNV-1a.
+/// The vertices and indices are represented by the caller's draw version, so hashing never reads them.
+/// @param graphicsPipelineConfigId The identifier for the graphics pipeline configuration to be used for drawing.
+/// @param numVerticesToDraw The number of vertices to be drawn.
+/// @param vertexStride The size of the individual vertex input.
+/// @param numVertexElements The number of individual vertices to draw.
+/// @param swapChainExtent The extent of the swapchain image drawn to.
+/// @param hasVertexBuffer Whether a vertex buffer is drawn.
+/// @param hasIndexBuffer Whether an index buffer is drawn.
+/// @param drawVersion The version of the vertices and indices.
+/// @return The hash of the draw. 0 for unversioned draws, which are never replayed.
+uint64_t celerique::vulkan::internal::Manager::hashDraw(
+    PipelineConfigID graphicsPipelineConfigId, size_t numVerticesToDraw, size_t vertexStride,
+    size_t numVertexElements, const VkExtent2D& swapChainExtent, bool hasVertexBuffer,
+    bool hasIndexBuffer, uint64_t drawVersion
+) {
+    if (drawVersion == 0) return 0;
+
+    /// @brief The running hash value.
+    uint64_t hash = 14695981039346656037ull;
+    /// @brief Mix a value into the hash, a byte at a time so every bit reaches every other.
+    auto mixWord = [&hash](uint64_t word) {
+        for (size_t byteIndex = 0; byteIndex < sizeof(word); byteIndex++) {
+            hash ^= (word >> (8 * byteIndex)) & 0xff;
+            hash *= 1099511628211ull;
+        }
+    };
+
+    // Removing a pipeline clears every cached hash, so its identifier is enough.
+    mixWord(static_cast<uint64_t>(graphicsPipelineConfigId));
+    mixWord(static_cast<uint64_t>(numVerticesToDraw));
+    mixWord(static_cast<uint64_t>(vertexStride));
+    mixWord(static_cast<uint64_t>(numVertexElements));
+    mixWord(hasVertexBuffer);
+    mixWord(hasIndexBuffer);
+    mixWord((static_cast<uint64_t>(swapChainExtent.width) << 32) | swapChainExtent.height);
+    mixWord(drawVersion);
+
+    // 0 marks a command buffer that was not recorded.
+    return hash != 0 ? hash : 1;
+}
+
+/// @brief Whether a window is drawn through its device's shared scene rather than on its own.
+/// @param isSharingSceneRendering Whether shared scene rendering is enabled.
+/// @param ptrTarget The pointer to the shared scene target of the window's device, or null if it has none.
+/// @param windowHandle The handle to the window.
+/// @param swapChainImageUsage The usage the window's swapchain images were created with.
+/// @return `true` if the window joined the target and its swapchain images can be blitted to.
+bool celerique::vulkan::internal::Manager::isDrawnWithSharedScene(
+    bool isSharingSceneRendering, const SharedSceneTarget* ptrTarget,
+    Pointer windowHandle, VkImageUsageFlags swapChainImageUsage
+) {
+    if (!isSharingSceneRendering || ptrTarget == nullptr) return false;
+    // Windows whose format differs from the target never joined it.
+    if (ptrTarget->mapWindowToVecImageAvailableSemaphores.find(windowHandle) ==
+    ptrTarget->mapWindowToVecImageAvailableSemaphores.end()) return false;
+    return (swapChainImageUsage & VK_IMAGE_USAGE_TRANSFER_DST_BIT) != 0;
+}
+
+/// @brief Whether any two non-empty ranges of the same GPU buffer overlap.
+/// @param vecRegions The ranges to be checked.
+/// @return `true` if a byte of a buffer is written by more than one range.
+bool celerique::vulkan::internal::Manager::hasOverlappingRegions(const ::std::vector<GpuBufferRegion>& vecRegions) {
+    /// @brief The map of a buffer ID to the sorted start and end of its ranges.
+    ::std::unordered_map<GpuBufferID, ::std::vector<::std::pair<size_t, size_t>>> mapGpuBufferIdToVecRanges;
+    for (const GpuBufferRegion& region : vecRegions) {
+        if (region.dataSize == 0) continue;
+        mapGpuBufferIdToVecRanges[region.bufferId].emplace_back(region.offset, region.offset + region.dataSize);
+    }
+    for (auto& pairBufferIdToVecRanges : mapGpuBufferIdToVecRanges) {
+        /// @brief The reference to the ranges of the buffer.
+        ::std::vector<::std::pair<size_t, size_t>>& refVecRanges = pairBufferIdToVecRanges.second;
+        ::std::sort(refVecRanges.begin(), refVecRanges.end());
+        for (size_t index = 1; index < refVecRanges.size(); index++) {
+            if (refVecRanges[index].first < refVecRanges[index - 1].second) return true;
+        }
+    }
+    return false;
+}
+
 /// @brief Gets the unique indices between these two vector of indices.
 /// @param leftVecIndices The vector of indices on the left hand side.
 /// @param rightVecIndices The vector of indices on the right hand side.
@@ -49,7 +49,7 @@ namespace celerique { namespace vulkan {
         MOCK_METHOD1(removeGraphicsPipelineConfig, void(PipelineConfigID));
         MOCK_METHOD0(clearGraphicsPipelineConfigs, void());
         MOCK_METHOD4(updateUniform, void(PipelineConfigID, size_t, void*, size_t));
-        MOCK_METHOD6(draw, void(PipelineConfigID, size_t, size_t, size_t, void*, uint32_t*));
+        MOCK_METHOD7(draw, void(PipelineConfigID, size_t, size_t, size_t, void*, uint32_t*, uint64_t));
         MOCK_METHOD2(addWindow, void(UiProtocol, Pointer));
         MOCK_METHOD1(removeWindow, void(Pointer));
         MOCK_METHOD1(reCreateSwapChain, void(Pointer));
@@ -121,4 +121,116 @@ namespace celerique { namespace vulkan {
 
         vulkanGraphicsApi->freeBuffer(bufferId);
     }
+
+    TEST_F(GraphicsApiUnitTestCpp, commandBufferCachingTogglesWithoutDrawing) {
+        ::std::unique_ptr<WindowBase> ptrWindow = createWindow(10, 10, "");
+        ::std::shared_ptr<IGraphicsAPI> vulkanGraphicsApi = getGraphicsApiInterface();
+        ptrWindow->useGraphicsApi(vulkanGraphicsApi);
+
+        vulkanGraphicsApi->setCommandBufferCaching(true);
+        vulkanGraphicsApi->setCommandBufferCaching(true);
+        vulkanGraphicsApi->setCommandBufferCaching(false);
+
+        /// @brief The statistics of the cache that was never drawn with.
+        CommandBufferCacheStats stats = vulkanGraphicsApi->commandBufferCacheStats();
+        GTEST_ASSERT_EQ(stats.numFramesReplayed, 0);
+        GTEST_ASSERT_EQ(stats.totalSavedTime.count(), 0);
+    }
+
+    TEST_F(GraphicsApiUnitTestCpp, sharedSceneRenderingTogglesWithWindows) {
+        ::std::shared_ptr<IGraphicsAPI> vulkanGraphicsApi = getGraphicsApiInterface();
+        vulkanGraphicsApi->setSharedSceneRendering(true);
+        {
+            ::std::unique_ptr<WindowBase> ptrFirstWindow = createWindow(10, 10, "");
+            ::std::unique_ptr<WindowBase> ptrSecondWindow = createWindow(20, 10, "");
+            // Windows added while sharing join the shared scene of their device.
+            ptrFirstWindow->useGraphicsApi(vulkanGraphicsApi);
+            ptrSecondWindow->useGraphicsApi(vulkanGraphicsApi);
+            vulkanGraphicsApi->setSharedSceneRendering(false);
+            vulkanGraphicsApi->setSharedSceneRendering(true);
+        }
+        vulkanGraphicsApi->setSharedSceneRendering(false);
+    }
+
+    TEST_F(GraphicsApiUnitTestCpp, dynamicBufferCopiesFollowSubmittedFrames) {
+        ::std::unique_ptr<WindowBase> ptrWindow = createWindow(10, 10, "");
+        ::std::shared_ptr<IGraphicsAPI> vulkanGraphicsApi = getGraphicsApiInterface();
+        ptrWindow->useGraphicsApi(vulkanGraphicsApi);
+
+        /// @brief The size of the GPU buffer.
+        size_t bufferSize = 16;
+        /// @brief The dynamic GPU buffer identifier.
+        GpuBufferID bufferId = vulkanGraphicsApi->createBuffer(
+            bufferSize, CELERIQUE_GPU_BUFFER_USAGE_UNIFORM | CELERIQUE_GPU_BUFFER_USAGE_DYNAMIC,
+            CELERIQUE_SHADER_STAGE_VERTEX
+        );
+        // Draws without windows submit nothing.
+        ptrWindow.reset();
+
+        /// @brief The copy written on the first frame.
+        void* ptrFirstCopy = vulkanGraphicsApi->mapDynamicBuffer(bufferId);
+        GTEST_ASSERT_NE(ptrFirstCopy, nullptr);
+        // Every write within a frame lands in the same copy.
+        GTEST_ASSERT_EQ(vulkanGraphicsApi->mapDynamicBuffer(bufferId), ptrFirstCopy);
+        GTEST_ASSERT_EQ(vulkanGraphicsApi->dynamicBufferOffset(bufferId), 0);
+
+        /// @brief The source of the data to be written.
+        char dataSrc[] = "dataSrc";
+        // Lands in the frame's copy without a copy command.
+        vulkanGraphicsApi->copyToBuffer(bufferId, reinterpret_cast<void*>(dataSrc), sizeof(dataSrc));
+        vulkanGraphicsApi->draw(CELERIQUE_PIPELINE_CONFIG_ID_NULL, 0, 0, 0, nullptr, nullptr);
+        // A frame is only over once it was submitted, so its copy is still written.
+        GTEST_ASSERT_EQ(vulkanGraphicsApi->mapDynamicBuffer(bufferId), ptrFirstCopy);
+
+        vulkanGraphicsApi->freeBuffer(bufferId);
+        // Only dynamic buffers are mapped.
+        GTEST_TEST_THROW_(
+            vulkanGraphicsApi->mapDynamicBuffer(bufferId), ::std::runtime_error, GTEST_FATAL_FAILURE_
+        );
+        GTEST_TEST_THROW_(
+            vulkanGraphicsApi->dynamicBufferOffset(bufferId), ::std::runtime_error, GTEST_FATAL_FAILURE_
+        );
+    }
+
+    TEST_F(GraphicsApiUnitTestCpp, bufferRegionsAreCopiedTogether) {
+        ::std::unique_ptr<WindowBase> ptrWindow = createWindow(10, 10, "");
+        ::std::shared_ptr<IGraphicsAPI> vulkanGraphicsApi = getGraphicsApiInterface();
+        ptrWindow->useGraphicsApi(vulkanGraphicsApi);
+
+        /// @brief The size of the GPU buffers.
+        size_t bufferSize = 64;
+        /// @brief The identifier of an instance buffer.
+        GpuBufferID instanceBufferId = vulkanGraphicsApi->createBuffer(bufferSize, CELERIQUE_GPU_BUFFER_USAGE_VERTEX);
+        /// @brief The identifier of a uniform buffer.
+        GpuBufferID uniformBufferId = vulkanGraphicsApi->createBuffer(
+            bufferSize, CELERIQUE_GPU_BUFFER_USAGE_UNIFORM, CELERIQUE_SHADER_STAGE_VERTEX
+        );
+
+        /// @brief The source of the data to be copied.
+        char dataSrc[] = "dataSrc";
+        vulkanGraphicsApi->copyToBufferRegion(instanceBufferId, 16, dataSrc, sizeof(dataSrc));
+        vulkanGraphicsApi->copyToBufferRegions({
+            {instanceBufferId, 0, dataSrc, sizeof(dataSrc)},
+            {uniformBufferId, 32, dataSrc, sizeof(dataSrc)},
+            {instanceBufferId, bufferSize - sizeof(dataSrc), dataSrc, sizeof(dataSrc)}
+        });
+        // An exception is thrown when a range ends past the buffer.
+        GTEST_TEST_THROW_(
+            vulkanGraphicsApi->copyToBufferRegion(uniformBufferId, bufferSize - 1, dataSrc, sizeof(dataSrc)),
+            ::std::runtime_error,
+            GTEST_FATAL_FAILURE_
+        );
+        // An exception is thrown when two ranges of the same buffer overlap.
+        GTEST_TEST_THROW_(
+            vulkanGraphicsApi->copyToBufferRegions({
+                {instanceBufferId, 0, dataSrc, sizeof(dataSrc)},
+                {instanceBufferId, sizeof(dataSrc) - 1, dataSrc, sizeof(dataSrc)}
+            }),
+            ::std::runtime_error,
+            GTEST_FATAL_FAILURE_
+        );
+
+        vulkanGraphicsApi->freeBuffer(instanceBufferId);
+        vulkanGraphicsApi->freeBuffer(uniformBufferId);
+    }
 }}
\ No newline at end of file
@@ -130,9 +130,10 @@ namespace celerique::testing {
         /// @param ptrArg The shared pointer to the update data container.
         void onUpdate(::std::shared_ptr<IUpdateData> ptrUpdateData) override {
             ::std::shared_lock<::std::shared_mutex> readLock(_sharedMutex);
+            // The cube's mesh never changes, so it stays at its first version.
             _ptrVulkanApi->draw(
                 _cubeGraphicsPipelineId, _vecIndices.size(), sizeof(CubeVertex), _vecVertices.size(),
-                reinterpret_cast<void*>(_vecVertices.data()), _vecIndices.data()
+                reinterpret_cast<void*>(_vecVertices.data()), _vecIndices.data(), 1
             );
         }
 
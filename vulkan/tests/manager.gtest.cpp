@@ -13,6 +13,7 @@ License: Mozilla Public License 2.0. (See ./LICENSE).
 
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <cstring>
 
 namespace celerique { namespace vulkan {
     /// @brief The GTest unit test suite for the vulkan resource management system.
@@ -70,4 +71,56 @@ namespace celerique { namespace vulkan {
         ::std::sort(vecActualUniqueIndices.begin(), vecActualUniqueIndices.end());
         GTEST_ASSERT_EQ(vecExpectedUniqueIndices, vecActualUniqueIndices);
     }
+
+    TEST_F(ManagerUnitTestCpp, onlyJoinedWindowsAreDrawnWithSharedScene) {
+        /// @brief A window that joined the shared scene.
+        Pointer joinedWindowHandle = 1;
+        /// @brief A window whose swapchain format differs from the shared scene, so it never joined.
+        Pointer otherFormatWindowHandle = 2;
+        /// @brief The usage of swapchain images that can be blitted to.
+        VkImageUsageFlags blitUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+        /// @brief The shared scene target of the windows' device.
+        internal::SharedSceneTarget target;
+        target.mapWindowToVecImageAvailableSemaphores[joinedWindowHandle] = ::std::vector<VkSemaphore>(
+            internal::numSharedSceneFrames, nullptr
+        );
+
+        GTEST_ASSERT_TRUE(internal::Manager::isDrawnWithSharedScene(true, &target, joinedWindowHandle, blitUsage));
+        // Every other window falls back to drawing on its own.
+        GTEST_ASSERT_FALSE(internal::Manager::isDrawnWithSharedScene(true, &target, otherFormatWindowHandle, blitUsage));
+        GTEST_ASSERT_FALSE(internal::Manager::isDrawnWithSharedScene(false, &target, joinedWindowHandle, blitUsage));
+        GTEST_ASSERT_FALSE(internal::Manager::isDrawnWithSharedScene(true, nullptr, joinedWindowHandle, blitUsage));
+        GTEST_ASSERT_FALSE(internal::Manager::isDrawnWithSharedScene(
+            true, &target, joinedWindowHandle, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT
+        ));
+    }
+
+    TEST_F(ManagerUnitTestCpp, cachedDrawsAreOnlyReplayedForTheSameVersion) {
+        /// @brief The extent of the swapchain image drawn to.
+        VkExtent2D swapChainExtent = {10, 10};
+
+        /// @brief The hash of the recorded draw.
+        uint64_t cachedDrawHash = internal::Manager::hashDraw(1, 3, 8, 3, swapChainExtent, true, true, 1);
+        // The same draw replays its cached command buffer.
+        GTEST_ASSERT_EQ(cachedDrawHash, internal::Manager::hashDraw(1, 3, 8, 3, swapChainExtent, true, true, 1));
+        // A new version of the vertices and indices is recorded again.
+        GTEST_ASSERT_NE(cachedDrawHash, internal::Manager::hashDraw(1, 3, 8, 3, swapChainExtent, true, true, 2));
+        // So is a resized swapchain image.
+        GTEST_ASSERT_NE(cachedDrawHash, internal::Manager::hashDraw(1, 3, 8, 3, {20, 10}, true, true, 1));
+        // Unversioned draws are never replayed.
+        GTEST_ASSERT_EQ(internal::Manager::hashDraw(1, 3, 8, 3, swapChainExtent, true, true, 0), 0);
+    }
+
+    TEST_F(ManagerUnitTestCpp, overlappingBufferRegionsAreDetected) {
+        /// @brief The source of the data to be copied.
+        char dataSrc[] = "dataSrc";
+        // Touching ranges and ranges of different buffers do not overlap.
+        GTEST_ASSERT_FALSE(internal::Manager::hasOverlappingRegions({
+            {1, 8, dataSrc, 8}, {1, 0, dataSrc, 8}, {2, 4, dataSrc, 8}
+        }));
+        // Empty ranges write nothing.
+        GTEST_ASSERT_FALSE(internal::Manager::hasOverlappingRegions({{1, 0, dataSrc, 8}, {1, 4, dataSrc, 0}}));
+        GTEST_ASSERT_TRUE(internal::Manager::hasOverlappingRegions({{1, 8, dataSrc, 8}, {1, 0, dataSrc, 9}}));
+        GTEST_ASSERT_TRUE(internal::Manager::hasOverlappingRegions({{1, 0, dataSrc, 16}, {1, 4, dataSrc, 4}}));
+    }
 }}
\ No newline at end of file
@@ -0,0 +1,45 @@
+#version 450
+
+/// @brief The position of the vertex in the bind pose.
+layout(location = 0) in vec3 inPosition;
+/// @brief The normal vector of the vertex in the bind pose.
+layout(location = 1) in vec3 inNormal;
+/// @brief The 4 joints influencing the vertex.
+layout(location = 2) in ivec4 inJoints;
+/// @brief The weight of each joint, summing to 1.
+layout(location = 3) in vec4 inWeights;
+
+/// @brief The skinning palettes of every character, written by `celerique::animateCharacters`:
+/// the top 3 rows of each joint's row-major skinning matrix.
+layout(std430, set = 0, binding = 0) readonly buffer SkinningPalette {
+    vec4 rows[];
+} palette;
+/// @brief The camera.
+layout(std140, set = 1, binding = 1) uniform Camera {
+    mat4 viewProjection;
+} camera;
+/// @brief The number of joints of each character, one character per instance.
+layout(push_constant) uniform Skeleton {
+    int numJoints;
+} skeleton;
+
+/// @brief The normal vector in world space for the fragment shader.
+layout(location = 0) out vec3 outCalculatedNormal;
+
+/// @brief Shader entrypoint.
+void main() {
+    /// @brief The first palette row of the character.
+    int firstRow = gl_InstanceIndex * skeleton.numJoints * 3;
+    /// @brief The weighted sum of the skinning matrix rows.
+    vec4 row0 = vec4(0.0), row1 = vec4(0.0), row2 = vec4(0.0);
+    for (int influence = 0; influence < 4; influence++) {
+        int jointRow = firstRow + inJoints[influence] * 3;
+        row0 += palette.rows[jointRow + 0] * inWeights[influence];
+        row1 += palette.rows[jointRow + 1] * inWeights[influence];
+        row2 += palette.rows[jointRow + 2] * inWeights[influence];
+    }
+
+    vec4 position = vec4(inPosition, 1.0);
+    outCalculatedNormal = normalize(vec3(dot(row0.xyz, inNormal), dot(row1.xyz, inNormal), dot(row2.xyz, inNormal)));
+    gl_Position = camera.viewProjection * vec4(dot(row0, position), dot(row1, position), dot(row2, position), 1.0);
+}
\ No newline at end of file